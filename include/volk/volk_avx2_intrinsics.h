@@ -330,4 +330,69 @@ static inline void vector_32fc_index_min_variant1(__m256 in0,
     *current_indices = _mm256_add_epi32(*current_indices, indices_increment);
 }
 
+/* Evaluation of 8 sines & cosines at once, sharing one range reduction.
+ * Same algorithm as _vsincosq_f32 in volk_neon_intrinsics.h
+ * Optimized from here (zlib license)
+ * http://gruntthepeon.free.fr/ssemath/ */
+static inline void _mm256_sincos_ps_avx2(__m256 x, __m256* sine, __m256* cosine)
+{
+    const __m256 minus_cephes_DP1 = _mm256_set1_ps(-0.78515625f);
+    const __m256 minus_cephes_DP2 = _mm256_set1_ps(-2.4187564849853515625e-4f);
+    const __m256 minus_cephes_DP3 = _mm256_set1_ps(-3.77489497744594108e-8f);
+    const __m256 sincof_p0 = _mm256_set1_ps(-1.9515295891e-4f);
+    const __m256 sincof_p1 = _mm256_set1_ps(8.3321608736e-3f);
+    const __m256 sincof_p2 = _mm256_set1_ps(-1.6666654611e-1f);
+    const __m256 coscof_p0 = _mm256_set1_ps(2.443315711809948e-005f);
+    const __m256 coscof_p1 = _mm256_set1_ps(-1.388731625493765e-003f);
+    const __m256 coscof_p2 = _mm256_set1_ps(4.166664568298827e-002f);
+    const __m256 cephes_FOPI = _mm256_set1_ps(1.27323954473516f); // 4 / M_PI
+    const __m256 sign_bit = _mm256_set1_ps(-0.0f);
+    const __m256i twos = _mm256_set1_epi32(2);
+    const __m256i fours = _mm256_set1_epi32(4);
+
+    // remember the sign of the input for the sine, continue with |x|
+    __m256 sign_sin = _mm256_and_ps(x, sign_bit);
+    x = _mm256_andnot_ps(sign_bit, x);
+
+    // octant j = (int)(x * 4 / pi), j = (j + 1) & (~1) (see the cephes sources)
+    __m256i emm2 = _mm256_cvttps_epi32(_mm256_mul_ps(x, cephes_FOPI));
+    emm2 = _mm256_add_epi32(emm2, _mm256_set1_epi32(1));
+    emm2 = _mm256_and_si256(emm2, _mm256_set1_epi32(~1));
+    const __m256 y = _mm256_cvtepi32_ps(emm2);
+
+    // the sine and cosine polynomials swap roles in every other quadrant
+    const __m256 poly_mask =
+        _mm256_castsi256_ps(_mm256_cmpeq_epi32(_mm256_and_si256(emm2, twos), twos));
+
+    // move the quadrant sign flips into the float sign bit
+    sign_sin = _mm256_xor_ps(
+        sign_sin,
+        _mm256_castsi256_ps(_mm256_slli_epi32(_mm256_and_si256(emm2, fours), 29)));
+    const __m256 sign_cos = _mm256_castsi256_ps(
+        _mm256_slli_epi32(_mm256_andnot_si256(_mm256_sub_epi32(emm2, twos), fours), 29));
+
+    // The magic pass: "Extended precision modular arithmetic"
+    x = _mm256_add_ps(x, _mm256_mul_ps(y, minus_cephes_DP1));
+    x = _mm256_add_ps(x, _mm256_mul_ps(y, minus_cephes_DP2));
+    x = _mm256_add_ps(x, _mm256_mul_ps(y, minus_cephes_DP3));
+
+    const __m256 z = _mm256_mul_ps(x, x);
+
+    // cosine polynomial for 0 <= x <= pi/4
+    __m256 y1 = _mm256_add_ps(_mm256_mul_ps(coscof_p0, z), coscof_p1);
+    y1 = _mm256_add_ps(_mm256_mul_ps(y1, z), coscof_p2);
+    y1 = _mm256_mul_ps(_mm256_mul_ps(y1, z), z);
+    y1 = _mm256_sub_ps(y1, _mm256_mul_ps(z, _mm256_set1_ps(0.5f)));
+    y1 = _mm256_add_ps(y1, _mm256_set1_ps(1.f));
+
+    // sine polynomial for 0 <= x <= pi/4
+    __m256 y2 = _mm256_add_ps(_mm256_mul_ps(sincof_p0, z), sincof_p1);
+    y2 = _mm256_add_ps(_mm256_mul_ps(y2, z), sincof_p2);
+    y2 = _mm256_mul_ps(_mm256_mul_ps(y2, z), x);
+    y2 = _mm256_add_ps(y2, x);
+
+    *sine = _mm256_xor_ps(_mm256_blendv_ps(y2, y1, poly_mask), sign_sin);
+    *cosine = _mm256_xor_ps(_mm256_blendv_ps(y1, y2, poly_mask), sign_cos);
+}
+
 #endif /* INCLUDE_VOLK_VOLK_AVX2_INTRINSICS_H_ */
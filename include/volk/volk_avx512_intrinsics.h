@@ -0,0 +1,102 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2026 Free Software Foundation, Inc.
+ *
+ * This file is part of VOLK
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+/*
+ * This file is intended to hold AVX512F intrinsics of intrinsics.
+ * They should be used in VOLK kernels to avoid copy-pasta.
+ */
+
+#ifndef INCLUDE_VOLK_VOLK_AVX512_INTRINSICS_H_
+#define INCLUDE_VOLK_VOLK_AVX512_INTRINSICS_H_
+#include <immintrin.h>
+
+static inline __m512 _mm512_complexmul_ps(__m512 x, __m512 y)
+{
+    const __m512 yl = _mm512_moveldup_ps(y); // Load yl with cr,cr,dr,dr ...
+    const __m512 yh = _mm512_movehdup_ps(y); // Load yh with ci,ci,di,di ...
+    const __m512 tmp2 = _mm512_mul_ps(_mm512_permute_ps(x, 0xB1), yh); // ai*ci,ar*ci ...
+
+    // ar*cr-ai*ci, ai*cr+ar*ci, br*dr-bi*di, bi*dr+br*di ...
+    return _mm512_fmaddsub_ps(x, yl, tmp2);
+}
+
+static inline __m512 _mm512_normalize_ps(__m512 val)
+{
+    __m512 tmp1 = _mm512_mul_ps(val, val);
+    // re^2 + im^2 in both slots of every complex value
+    tmp1 = _mm512_add_ps(tmp1, _mm512_permute_ps(tmp1, 0xB1));
+    tmp1 = _mm512_sqrt_ps(tmp1);
+    return _mm512_div_ps(val, tmp1);
+}
+
+/* Evaluation of 16 sines & cosines at once, sharing one range reduction.
+ * Same algorithm as _vsincosq_f32 in volk_neon_intrinsics.h
+ * Optimized from here (zlib license)
+ * http://gruntthepeon.free.fr/ssemath/ */
+static inline void _mm512_sincos_ps_avx512f(__m512 x, __m512* sine, __m512* cosine)
+{
+    const __m512 minus_cephes_DP1 = _mm512_set1_ps(-0.78515625f);
+    const __m512 minus_cephes_DP2 = _mm512_set1_ps(-2.4187564849853515625e-4f);
+    const __m512 minus_cephes_DP3 = _mm512_set1_ps(-3.77489497744594108e-8f);
+    const __m512 sincof_p0 = _mm512_set1_ps(-1.9515295891e-4f);
+    const __m512 sincof_p1 = _mm512_set1_ps(8.3321608736e-3f);
+    const __m512 sincof_p2 = _mm512_set1_ps(-1.6666654611e-1f);
+    const __m512 coscof_p0 = _mm512_set1_ps(2.443315711809948e-005f);
+    const __m512 coscof_p1 = _mm512_set1_ps(-1.388731625493765e-003f);
+    const __m512 coscof_p2 = _mm512_set1_ps(4.166664568298827e-002f);
+    const __m512 cephes_FOPI = _mm512_set1_ps(1.27323954473516f); // 4 / M_PI
+    const __m512i sign_bit = _mm512_set1_epi32(0x80000000);
+    const __m512i twos = _mm512_set1_epi32(2);
+    const __m512i fours = _mm512_set1_epi32(4);
+
+    // remember the sign of the input for the sine, continue with |x|
+    __m512i sign_sin = _mm512_and_si512(_mm512_castps_si512(x), sign_bit);
+    x = _mm512_castsi512_ps(_mm512_andnot_si512(sign_bit, _mm512_castps_si512(x)));
+
+    // octant j = (int)(x * 4 / pi), j = (j + 1) & (~1) (see the cephes sources)
+    __m512i emm2 = _mm512_cvttps_epi32(_mm512_mul_ps(x, cephes_FOPI));
+    emm2 = _mm512_add_epi32(emm2, _mm512_set1_epi32(1));
+    emm2 = _mm512_and_si512(emm2, _mm512_set1_epi32(~1));
+    const __m512 y = _mm512_cvtepi32_ps(emm2);
+
+    // the sine and cosine polynomials swap roles in every other quadrant
+    const __mmask16 poly_mask = _mm512_test_epi32_mask(emm2, twos);
+
+    // move the quadrant sign flips into the float sign bit
+    sign_sin = _mm512_xor_si512(sign_sin,
+                                _mm512_slli_epi32(_mm512_and_si512(emm2, fours), 29));
+    const __m512i sign_cos =
+        _mm512_slli_epi32(_mm512_andnot_si512(_mm512_sub_epi32(emm2, twos), fours), 29);
+
+    // The magic pass: "Extended precision modular arithmetic"
+    x = _mm512_fmadd_ps(y, minus_cephes_DP1, x);
+    x = _mm512_fmadd_ps(y, minus_cephes_DP2, x);
+    x = _mm512_fmadd_ps(y, minus_cephes_DP3, x);
+
+    const __m512 z = _mm512_mul_ps(x, x);
+
+    // cosine polynomial for 0 <= x <= pi/4
+    __m512 y1 = _mm512_fmadd_ps(coscof_p0, z, coscof_p1);
+    y1 = _mm512_fmadd_ps(y1, z, coscof_p2);
+    y1 = _mm512_mul_ps(_mm512_mul_ps(y1, z), z);
+    y1 = _mm512_fnmadd_ps(z, _mm512_set1_ps(0.5f), y1);
+    y1 = _mm512_add_ps(y1, _mm512_set1_ps(1.f));
+
+    // sine polynomial for 0 <= x <= pi/4
+    __m512 y2 = _mm512_fmadd_ps(sincof_p0, z, sincof_p1);
+    y2 = _mm512_fmadd_ps(y2, z, sincof_p2);
+    y2 = _mm512_fmadd_ps(_mm512_mul_ps(y2, z), x, x);
+
+    const __m512 ys = _mm512_mask_blend_ps(poly_mask, y2, y1);
+    const __m512 yc = _mm512_mask_blend_ps(poly_mask, y1, y2);
+    *sine = _mm512_castsi512_ps(_mm512_xor_si512(_mm512_castps_si512(ys), sign_sin));
+    *cosine = _mm512_castsi512_ps(_mm512_xor_si512(_mm512_castps_si512(yc), sign_cos));
+}
+
+#endif /* INCLUDE_VOLK_VOLK_AVX512_INTRINSICS_H_ */
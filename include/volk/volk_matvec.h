@@ -0,0 +1,69 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2026 Free Software Foundation, Inc.
+ *
+ * This file is part of VOLK
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#ifndef INCLUDED_VOLK_MATVEC_H
+#define INCLUDED_VOLK_MATVEC_H
+
+/*!
+ * \brief Packing of the matrix for volk_32fc_x2_matvec_32fc and
+ * volk_32fc_x2_matmul_small_32fc.
+ *
+ * The kernels expect the elements of VOLK_MATVEC_ROW_BLOCK consecutive rows
+ * interleaved per column, with the rows padded by zeros to a multiple of
+ * VOLK_MATVEC_ROW_BLOCK:
+ *
+ * packed[(g * cols + n) * VOLK_MATVEC_ROW_BLOCK + b] =
+ *     A[g * VOLK_MATVEC_ROW_BLOCK + b][n]
+ */
+
+#include <volk/volk_complex.h>
+
+//! Number of rows whose elements are interleaved per column
+#define VOLK_MATVEC_ROW_BLOCK 8
+
+/*!
+ * \brief The number of elements of a packed rows x cols matrix.
+ */
+static inline unsigned int volk_32fc_x2_matvec_packed_size(unsigned int rows,
+                                                           unsigned int cols)
+{
+    const unsigned int num_groups =
+        (rows + VOLK_MATVEC_ROW_BLOCK - 1) / VOLK_MATVEC_ROW_BLOCK;
+    return num_groups * VOLK_MATVEC_ROW_BLOCK * cols;
+}
+
+/*!
+ * \brief Repack a row major rows x cols matrix into the blocked layout.
+ *
+ * \param packed the volk_32fc_x2_matvec_packed_size(rows, cols) elements of
+ * the packed matrix.
+ * \param matrix the row major matrix.
+ * \param rows the number of matrix rows.
+ * \param cols the number of matrix columns.
+ */
+static inline void volk_32fc_x2_matvec_pack_weights(lv_32fc_t* packed,
+                                                    const lv_32fc_t* matrix,
+                                                    unsigned int rows,
+                                                    unsigned int cols)
+{
+    const unsigned int num_groups =
+        (rows + VOLK_MATVEC_ROW_BLOCK - 1) / VOLK_MATVEC_ROW_BLOCK;
+    unsigned int g, n, b;
+
+    for (g = 0; g < num_groups; g++) {
+        for (n = 0; n < cols; n++) {
+            for (b = 0; b < VOLK_MATVEC_ROW_BLOCK; b++) {
+                const unsigned int row = g * VOLK_MATVEC_ROW_BLOCK + b;
+                *packed++ = (row < rows) ? matrix[row * cols + n] : lv_cmake(0.f, 0.f);
+            }
+        }
+    }
+}
+
+#endif /* INCLUDED_VOLK_MATVEC_H */
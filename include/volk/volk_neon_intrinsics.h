@@ -281,4 +281,17 @@ static inline float32x4_t _neon_accumulate_square_sum_f32(float32x4_t sq_acc,
 #endif
 }
 
+#ifdef LV_HAVE_NEONV8_PMULL
+/* One CRC folding step over a 128-bit block: the carry-less products of the
+ * low and the high halves of x and k, XORed with data */
+static inline uint8x16_t _vclmulfoldq_u8(uint8x16_t x, poly64x2_t k, uint8x16_t data)
+{
+    const poly64x2_t xp = vreinterpretq_p64_u8(x);
+    const poly128_t low = vmull_p64(vgetq_lane_p64(xp, 0), vgetq_lane_p64(k, 0));
+    const poly128_t high = vmull_high_p64(xp, k);
+    return veorq_u8(veorq_u8(vreinterpretq_u8_p128(low), vreinterpretq_u8_p128(high)),
+                    data);
+}
+#endif
+
 #endif /* INCLUDE_VOLK_VOLK_NEON_INTRINSICS_H_ */
@@ -0,0 +1,83 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2026 Free Software Foundation, Inc.
+ *
+ * This file is part of VOLK
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+/*
+ * This file is intended to hold SSE4.1 intrinsics of intrinsics.
+ * They should be used in VOLK kernels to avoid copy-pasta.
+ */
+
+#ifndef INCLUDE_VOLK_VOLK_SSE41_INTRINSICS_H_
+#define INCLUDE_VOLK_VOLK_SSE41_INTRINSICS_H_
+#include <smmintrin.h>
+
+/* Evaluation of 4 sines & cosines at once, sharing one range reduction.
+ * Same algorithm as _vsincosq_f32 in volk_neon_intrinsics.h
+ * Optimized from here (zlib license)
+ * http://gruntthepeon.free.fr/ssemath/ */
+static inline void _mm_sincos_ps_sse4_1(__m128 x, __m128* sine, __m128* cosine)
+{
+    const __m128 minus_cephes_DP1 = _mm_set1_ps(-0.78515625f);
+    const __m128 minus_cephes_DP2 = _mm_set1_ps(-2.4187564849853515625e-4f);
+    const __m128 minus_cephes_DP3 = _mm_set1_ps(-3.77489497744594108e-8f);
+    const __m128 sincof_p0 = _mm_set1_ps(-1.9515295891e-4f);
+    const __m128 sincof_p1 = _mm_set1_ps(8.3321608736e-3f);
+    const __m128 sincof_p2 = _mm_set1_ps(-1.6666654611e-1f);
+    const __m128 coscof_p0 = _mm_set1_ps(2.443315711809948e-005f);
+    const __m128 coscof_p1 = _mm_set1_ps(-1.388731625493765e-003f);
+    const __m128 coscof_p2 = _mm_set1_ps(4.166664568298827e-002f);
+    const __m128 cephes_FOPI = _mm_set1_ps(1.27323954473516f); // 4 / M_PI
+    const __m128 sign_bit = _mm_set1_ps(-0.0f);
+    const __m128i twos = _mm_set1_epi32(2);
+    const __m128i fours = _mm_set1_epi32(4);
+
+    // remember the sign of the input for the sine, continue with |x|
+    __m128 sign_sin = _mm_and_ps(x, sign_bit);
+    x = _mm_andnot_ps(sign_bit, x);
+
+    // octant j = (int)(x * 4 / pi), j = (j + 1) & (~1) (see the cephes sources)
+    __m128i emm2 = _mm_cvttps_epi32(_mm_mul_ps(x, cephes_FOPI));
+    emm2 = _mm_add_epi32(emm2, _mm_set1_epi32(1));
+    emm2 = _mm_and_si128(emm2, _mm_set1_epi32(~1));
+    const __m128 y = _mm_cvtepi32_ps(emm2);
+
+    // the sine and cosine polynomials swap roles in every other quadrant
+    const __m128 poly_mask =
+        _mm_castsi128_ps(_mm_cmpeq_epi32(_mm_and_si128(emm2, twos), twos));
+
+    // move the quadrant sign flips into the float sign bit
+    sign_sin = _mm_xor_ps(
+        sign_sin, _mm_castsi128_ps(_mm_slli_epi32(_mm_and_si128(emm2, fours), 29)));
+    const __m128 sign_cos = _mm_castsi128_ps(
+        _mm_slli_epi32(_mm_andnot_si128(_mm_sub_epi32(emm2, twos), fours), 29));
+
+    // The magic pass: "Extended precision modular arithmetic"
+    x = _mm_add_ps(x, _mm_mul_ps(y, minus_cephes_DP1));
+    x = _mm_add_ps(x, _mm_mul_ps(y, minus_cephes_DP2));
+    x = _mm_add_ps(x, _mm_mul_ps(y, minus_cephes_DP3));
+
+    const __m128 z = _mm_mul_ps(x, x);
+
+    // cosine polynomial for 0 <= x <= pi/4
+    __m128 y1 = _mm_add_ps(_mm_mul_ps(coscof_p0, z), coscof_p1);
+    y1 = _mm_add_ps(_mm_mul_ps(y1, z), coscof_p2);
+    y1 = _mm_mul_ps(_mm_mul_ps(y1, z), z);
+    y1 = _mm_sub_ps(y1, _mm_mul_ps(z, _mm_set1_ps(0.5f)));
+    y1 = _mm_add_ps(y1, _mm_set1_ps(1.f));
+
+    // sine polynomial for 0 <= x <= pi/4
+    __m128 y2 = _mm_add_ps(_mm_mul_ps(sincof_p0, z), sincof_p1);
+    y2 = _mm_add_ps(_mm_mul_ps(y2, z), sincof_p2);
+    y2 = _mm_mul_ps(_mm_mul_ps(y2, z), x);
+    y2 = _mm_add_ps(y2, x);
+
+    *sine = _mm_xor_ps(_mm_blendv_ps(y2, y1, poly_mask), sign_sin);
+    *cosine = _mm_xor_ps(_mm_blendv_ps(y1, y2, poly_mask), sign_cos);
+}
+
+#endif /* INCLUDE_VOLK_VOLK_SSE41_INTRINSICS_H_ */
@@ -0,0 +1,76 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2026 Free Software Foundation, Inc.
+ *
+ * This file is part of VOLK
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#ifndef INCLUDED_VOLK_STATS_H
+#define INCLUDED_VOLK_STATS_H
+
+/*!
+ * \brief Summary statistics of a float vector, see volk_32f_stats_32f.
+ *
+ * The statistics of consecutive chunks of a stream can be merged with
+ * volk_32f_stats_combine, which gives the same result as one call on the
+ * whole stream up to rounding.
+ */
+
+#include <inttypes.h>
+
+typedef struct volk_32f_stats {
+    float min;          //!< smallest value
+    float max;          //!< largest value
+    uint32_t min_index; //!< index of the first occurrence of min
+    uint32_t max_index; //!< index of the first occurrence of max
+    float mean;         //!< arithmetic mean
+    float variance;     //!< population variance, i.e. normalized by count
+    uint32_t count;     //!< number of values, 0 for an empty state
+} volk_32f_stats_t;
+
+/*!
+ * \brief Merge the statistics of a later chunk into the accumulated statistics.
+ *
+ * \param acc the statistics of the stream so far, count may be 0.
+ * \param part the statistics of the next chunk.
+ * \param offset the stream index of the first element of the chunk, added to
+ * the indices of part.
+ */
+static inline void volk_32f_stats_combine(volk_32f_stats_t* acc,
+                                          const volk_32f_stats_t* part,
+                                          uint32_t offset)
+{
+    double n, delta;
+
+    if (part->count == 0) {
+        return;
+    }
+    if (acc->count == 0) {
+        *acc = *part;
+        acc->min_index += offset;
+        acc->max_index += offset;
+        return;
+    }
+    if (part->min < acc->min) {
+        acc->min = part->min;
+        acc->min_index = part->min_index + offset;
+    }
+    if (part->max > acc->max) {
+        acc->max = part->max;
+        acc->max_index = part->max_index + offset;
+    }
+
+    // Chan et al. pairwise update of the mean and the sum of squares
+    n = (double)acc->count + part->count;
+    delta = (double)part->mean - acc->mean;
+    acc->variance = (float)(((double)acc->variance * acc->count +
+                             (double)part->variance * part->count +
+                             delta * delta * acc->count * part->count / n) /
+                            n);
+    acc->mean = (float)(acc->mean + delta * part->count / n);
+    acc->count += part->count;
+}
+
+#endif /* INCLUDED_VOLK_STATS_H */
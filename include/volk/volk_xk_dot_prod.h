@@ -0,0 +1,66 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2026 Free Software Foundation, Inc.
+ *
+ * This file is part of VOLK
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#ifndef INCLUDED_VOLK_XK_DOT_PROD_H
+#define INCLUDED_VOLK_XK_DOT_PROD_H
+
+/*!
+ * \brief Packing of the taps for volk_32fc_32f_xK_dot_prod_32fc.
+ *
+ * The kernel expects the taps of VOLK_XK_DOT_PROD_BANK_BLOCK consecutive banks
+ * interleaved per sample, with the banks padded by zero taps to a multiple of
+ * VOLK_XK_DOT_PROD_BANK_BLOCK:
+ *
+ * packed[(g * num_points + n) * VOLK_XK_DOT_PROD_BANK_BLOCK + b] =
+ *     taps[(g * VOLK_XK_DOT_PROD_BANK_BLOCK + b) * num_points + n]
+ */
+
+//! Number of banks whose taps are interleaved per sample
+#define VOLK_XK_DOT_PROD_BANK_BLOCK 8
+
+/*!
+ * \brief The number of floats of the packed taps of num_banks banks.
+ */
+static inline unsigned int volk_32fc_32f_xK_dot_prod_packed_size(unsigned int num_banks,
+                                                                 unsigned int num_points)
+{
+    const unsigned int num_groups =
+        (num_banks + VOLK_XK_DOT_PROD_BANK_BLOCK - 1) / VOLK_XK_DOT_PROD_BANK_BLOCK;
+    return num_groups * VOLK_XK_DOT_PROD_BANK_BLOCK * num_points;
+}
+
+/*!
+ * \brief Repack row major taps into the blocked layout.
+ *
+ * \param packed the volk_32fc_32f_xK_dot_prod_packed_size(num_banks, num_points)
+ * floats of the packed taps.
+ * \param taps num_banks tap vectors of num_points taps each, one after the other.
+ * \param num_banks the number of tap sets.
+ * \param num_points the number of taps in every tap set.
+ */
+static inline void volk_32fc_32f_xK_dot_prod_pack_taps(float* packed,
+                                                       const float* taps,
+                                                       unsigned int num_banks,
+                                                       unsigned int num_points)
+{
+    const unsigned int num_groups =
+        (num_banks + VOLK_XK_DOT_PROD_BANK_BLOCK - 1) / VOLK_XK_DOT_PROD_BANK_BLOCK;
+    unsigned int g, n, b;
+
+    for (g = 0; g < num_groups; g++) {
+        for (n = 0; n < num_points; n++) {
+            for (b = 0; b < VOLK_XK_DOT_PROD_BANK_BLOCK; b++) {
+                const unsigned int bank = g * VOLK_XK_DOT_PROD_BANK_BLOCK + b;
+                *packed++ = (bank < num_banks) ? taps[bank * num_points + n] : 0.f;
+            }
+        }
+    }
+}
+
+#endif /* INCLUDED_VOLK_XK_DOT_PROD_H */
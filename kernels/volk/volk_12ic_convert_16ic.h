@@ -0,0 +1,215 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2026 Free Software Foundation, Inc.
+ *
+ * This file is part of VOLK
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+/*!
+ * \page volk_12ic_convert_16ic
+ *
+ * \b Overview
+ *
+ * Unpacks complex samples with 12-bit two's complement I and Q, packed into
+ * three bytes per sample, to 16-bit complex integers. The bytes of a sample
+ * are I[7:0], Q[3:0] I[11:8] and Q[11:4], i.e. the 24-bit little endian word
+ * I | Q << 12, as streamed by many 12-bit radios. The values are sign
+ * extended, not scaled.
+ *
+ * <b>Dispatcher Prototype</b>
+ * \code
+ * void volk_12ic_convert_16ic(lv_16sc_t* outputVector, const uint8_t* inputVector,
+ *                             unsigned int num_points)
+ * \endcode
+ *
+ * \b Inputs
+ * \li inputVector: the packed samples, 3 * num_points bytes.
+ * \li num_points: the number of complex samples.
+ *
+ * \b Outputs
+ * \li outputVector: the samples, between -2048 and 2047.
+ *
+ * \b Example
+ * \code
+ *   unsigned int N = 1000;
+ *   unsigned int alignment = volk_get_alignment();
+ *   uint8_t* in = (uint8_t*)volk_malloc(3 * N, alignment);
+ *   lv_16sc_t* out = (lv_16sc_t*)volk_malloc(sizeof(lv_16sc_t) * N, alignment);
+ *
+ *   for (unsigned int ii = 0; ii < N; ++ii) {
+ *       in[3 * ii] = 0xff;     // I = -1
+ *       in[3 * ii + 1] = 0x1f;
+ *       in[3 * ii + 2] = 0x00; // Q = 1
+ *   }
+ *
+ *   volk_12ic_convert_16ic(out, in, N); // out[ii] == lv_cmake(-1, 1)
+ *
+ *   volk_free(in);
+ *   volk_free(out);
+ * \endcode
+ */
+
+#ifndef INCLUDED_volk_12ic_convert_16ic_H
+#define INCLUDED_volk_12ic_convert_16ic_H
+
+#include <inttypes.h>
+#include <volk/volk_common.h>
+#include <volk/volk_complex.h>
+
+static inline void volk_12ic_unpack(int16_t* iq, const uint8_t* bytes)
+{
+    const uint32_t word =
+        bytes[0] | ((uint32_t)bytes[1] << 8) | ((uint32_t)bytes[2] << 16);
+    iq[0] = (int16_t)((int16_t)(word << 4) >> 4);
+    iq[1] = (int16_t)((int16_t)(word >> 8) >> 4);
+}
+
+/* The SIMD loops load 16 bytes for every 12, leave the last samples to the
+ * scalar tail so that no load crosses the end of the input */
+static inline unsigned int volk_12ic_groups(unsigned int num_points)
+{
+    return (num_points > 2) ? (num_points - 2) / 8 : 0;
+}
+
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void volk_12ic_convert_16ic_generic(lv_16sc_t* outputVector,
+                                                  const uint8_t* inputVector,
+                                                  unsigned int num_points)
+{
+    int16_t* outputPtr = (int16_t*)outputVector;
+    unsigned int number;
+
+    for (number = 0; number < num_points; number++) {
+        volk_12ic_unpack(outputPtr, inputVector);
+        inputVector += 3;
+        outputPtr += 2;
+    }
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+
+#ifdef LV_HAVE_SSSE3
+#include <tmmintrin.h>
+
+static inline void volk_12ic_convert_16ic_u_ssse3(lv_16sc_t* outputVector,
+                                                  const uint8_t* inputVector,
+                                                  unsigned int num_points)
+{
+    const unsigned int eighthPoints = volk_12ic_groups(num_points);
+    // I from bytes 3k, 3k + 1 and Q from bytes 3k + 1, 3k + 2
+    const __m128i gather =
+        _mm_setr_epi8(0, 1, 1, 2, 3, 4, 4, 5, 6, 7, 7, 8, 9, 10, 10, 11);
+    // move I to the top of its lane, then sign extend both by shifting down
+    const __m128i align = _mm_setr_epi16(16, 1, 16, 1, 16, 1, 16, 1);
+    int16_t* outputPtr = (int16_t*)outputVector;
+    __m128i values;
+    unsigned int number;
+
+    for (number = 0; number < eighthPoints; number++) {
+        values = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i*)inputVector), gather);
+        values = _mm_srai_epi16(_mm_mullo_epi16(values, align), 4);
+        _mm_storeu_si128((__m128i*)outputPtr, values);
+
+        values = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i*)(inputVector + 12)),
+                                  gather);
+        values = _mm_srai_epi16(_mm_mullo_epi16(values, align), 4);
+        _mm_storeu_si128((__m128i*)(outputPtr + 8), values);
+
+        inputVector += 24;
+        outputPtr += 16;
+    }
+
+    for (number = eighthPoints * 8; number < num_points; number++) {
+        volk_12ic_unpack(outputPtr, inputVector);
+        inputVector += 3;
+        outputPtr += 2;
+    }
+}
+
+#endif /* LV_HAVE_SSSE3 */
+
+
+#ifdef LV_HAVE_AVX2
+#include <immintrin.h>
+
+static inline void volk_12ic_convert_16ic_u_avx2(lv_16sc_t* outputVector,
+                                                 const uint8_t* inputVector,
+                                                 unsigned int num_points)
+{
+    const unsigned int eighthPoints = volk_12ic_groups(num_points);
+    const __m256i gather =
+        _mm256_setr_epi8(0, 1, 1, 2, 3, 4, 4, 5, 6, 7, 7, 8, 9, 10, 10, 11,
+                         0, 1, 1, 2, 3, 4, 4, 5, 6, 7, 7, 8, 9, 10, 10, 11);
+    const __m256i align =
+        _mm256_setr_epi16(16, 1, 16, 1, 16, 1, 16, 1, 16, 1, 16, 1, 16, 1, 16, 1);
+    int16_t* outputPtr = (int16_t*)outputVector;
+    __m256i values;
+    unsigned int number;
+
+    for (number = 0; number < eighthPoints; number++) {
+        values = _mm256_inserti128_si256(
+            _mm256_castsi128_si256(_mm_loadu_si128((const __m128i*)inputVector)),
+            _mm_loadu_si128((const __m128i*)(inputVector + 12)),
+            1);
+        values = _mm256_shuffle_epi8(values, gather);
+        values = _mm256_srai_epi16(_mm256_mullo_epi16(values, align), 4);
+        _mm256_storeu_si256((__m256i*)outputPtr, values);
+
+        inputVector += 24;
+        outputPtr += 16;
+    }
+
+    for (number = eighthPoints * 8; number < num_points; number++) {
+        volk_12ic_unpack(outputPtr, inputVector);
+        inputVector += 3;
+        outputPtr += 2;
+    }
+}
+
+#endif /* LV_HAVE_AVX2 */
+
+
+#ifdef LV_HAVE_NEON
+#include <arm_neon.h>
+
+static inline void volk_12ic_convert_16ic_neon(lv_16sc_t* outputVector,
+                                               const uint8_t* inputVector,
+                                               unsigned int num_points)
+{
+    const unsigned int eighthPoints = num_points / 8;
+    int16_t* outputPtr = (int16_t*)outputVector;
+    uint8x8x3_t bytes;
+    uint16x8_t middle;
+    int16x8x2_t values;
+    unsigned int number;
+
+    for (number = 0; number < eighthPoints; number++) {
+        bytes = vld3_u8(inputVector);
+        middle = vmovl_u8(bytes.val[1]);
+        values.val[0] = vreinterpretq_s16_u16(
+            vorrq_u16(vmovl_u8(bytes.val[0]), vshlq_n_u16(middle, 8)));
+        values.val[0] = vshrq_n_s16(vshlq_n_s16(values.val[0], 4), 4);
+        values.val[1] = vreinterpretq_s16_u16(
+            vorrq_u16(middle, vshlq_n_u16(vmovl_u8(bytes.val[2]), 8)));
+        values.val[1] = vshrq_n_s16(values.val[1], 4);
+        vst2q_s16(outputPtr, values);
+
+        inputVector += 24;
+        outputPtr += 16;
+    }
+
+    for (number = eighthPoints * 8; number < num_points; number++) {
+        volk_12ic_unpack(outputPtr, inputVector);
+        inputVector += 3;
+        outputPtr += 2;
+    }
+}
+
+#endif /* LV_HAVE_NEON */
+
+#endif /* INCLUDED_volk_12ic_convert_16ic_H */
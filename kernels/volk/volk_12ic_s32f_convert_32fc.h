@@ -0,0 +1,229 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2026 Free Software Foundation, Inc.
+ *
+ * This file is part of VOLK
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+/*!
+ * \page volk_12ic_s32f_convert_32fc
+ *
+ * \b Overview
+ *
+ * Converts complex samples with 12-bit I and Q, packed into three bytes per
+ * sample as described for volk_12ic_convert_16ic, to floating point complex
+ * values and divides them by the scalar.
+ *
+ * <b>Dispatcher Prototype</b>
+ * \code
+ * void volk_12ic_s32f_convert_32fc(lv_32fc_t* outputVector, const uint8_t* inputVector,
+ *                                  const float scalar, unsigned int num_points)
+ * \endcode
+ *
+ * \b Inputs
+ * \li inputVector: the packed samples, 3 * num_points bytes.
+ * \li scalar: the value the samples are divided by, e.g. 2048 for full scale 1.
+ * \li num_points: the number of complex samples.
+ *
+ * \b Outputs
+ * \li outputVector: the scaled samples.
+ *
+ * \b Example
+ * \code
+ *   unsigned int N = 1000;
+ *   unsigned int alignment = volk_get_alignment();
+ *   uint8_t* in = (uint8_t*)volk_malloc(3 * N, alignment);
+ *   lv_32fc_t* out = (lv_32fc_t*)volk_malloc(sizeof(lv_32fc_t) * N, alignment);
+ *
+ *   for (unsigned int ii = 0; ii < N; ++ii) {
+ *       in[3 * ii] = 0x00;     // I = -2048
+ *       in[3 * ii + 1] = 0x08;
+ *       in[3 * ii + 2] = 0x40; // Q = 1024
+ *   }
+ *
+ *   volk_12ic_s32f_convert_32fc(out, in, 2048.f, N); // out[ii] == lv_cmake(-1.f, .5f)
+ *
+ *   volk_free(in);
+ *   volk_free(out);
+ * \endcode
+ */
+
+#ifndef INCLUDED_volk_12ic_s32f_convert_32fc_H
+#define INCLUDED_volk_12ic_s32f_convert_32fc_H
+
+#include <inttypes.h>
+#include <volk/volk_12ic_convert_16ic.h>
+#include <volk/volk_complex.h>
+
+static inline void volk_12ic_unpack_32f(float* iq, const uint8_t* bytes, float scale)
+{
+    int16_t values[2];
+    volk_12ic_unpack(values, bytes);
+    iq[0] = values[0] * scale;
+    iq[1] = values[1] * scale;
+}
+
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void volk_12ic_s32f_convert_32fc_generic(lv_32fc_t* outputVector,
+                                                       const uint8_t* inputVector,
+                                                       const float scalar,
+                                                       unsigned int num_points)
+{
+    const float scale = 1.f / scalar;
+    float* outputPtr = (float*)outputVector;
+    unsigned int number;
+
+    for (number = 0; number < num_points; number++) {
+        volk_12ic_unpack_32f(outputPtr, inputVector, scale);
+        inputVector += 3;
+        outputPtr += 2;
+    }
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+
+#ifdef LV_HAVE_SSSE3
+#include <tmmintrin.h>
+
+static inline void volk_12ic_s32f_convert_32fc_u_ssse3(lv_32fc_t* outputVector,
+                                                       const uint8_t* inputVector,
+                                                       const float scalar,
+                                                       unsigned int num_points)
+{
+    const unsigned int fourthPoints = volk_12ic_groups(num_points) * 2;
+    const float scale = 1.f / scalar;
+    const __m128 vScale = _mm_set1_ps(scale);
+    const __m128i gather =
+        _mm_setr_epi8(0, 1, 1, 2, 3, 4, 4, 5, 6, 7, 7, 8, 9, 10, 10, 11);
+    const __m128i align = _mm_setr_epi16(16, 1, 16, 1, 16, 1, 16, 1);
+    float* outputPtr = (float*)outputVector;
+    __m128i values, wide;
+    unsigned int number;
+
+    for (number = 0; number < fourthPoints; number++) {
+        values = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i*)inputVector), gather);
+        values = _mm_mullo_epi16(values, align);
+
+        // the 12 bits are at the top of each 16-bit lane, duplicated into
+        // the top of a 32-bit lane one shift sign extends them
+        wide = _mm_srai_epi32(_mm_unpacklo_epi16(values, values), 20);
+        _mm_storeu_ps(outputPtr, _mm_mul_ps(_mm_cvtepi32_ps(wide), vScale));
+        wide = _mm_srai_epi32(_mm_unpackhi_epi16(values, values), 20);
+        _mm_storeu_ps(outputPtr + 4, _mm_mul_ps(_mm_cvtepi32_ps(wide), vScale));
+
+        inputVector += 12;
+        outputPtr += 8;
+    }
+
+    for (number = fourthPoints * 4; number < num_points; number++) {
+        volk_12ic_unpack_32f(outputPtr, inputVector, scale);
+        inputVector += 3;
+        outputPtr += 2;
+    }
+}
+
+#endif /* LV_HAVE_SSSE3 */
+
+
+#ifdef LV_HAVE_AVX2
+#include <immintrin.h>
+
+static inline void volk_12ic_s32f_convert_32fc_u_avx2(lv_32fc_t* outputVector,
+                                                      const uint8_t* inputVector,
+                                                      const float scalar,
+                                                      unsigned int num_points)
+{
+    const unsigned int eighthPoints = volk_12ic_groups(num_points);
+    const float scale = 1.f / scalar;
+    const __m256 vScale = _mm256_set1_ps(scale);
+    const __m256i gather =
+        _mm256_setr_epi8(0, 1, 1, 2, 3, 4, 4, 5, 6, 7, 7, 8, 9, 10, 10, 11,
+                         0, 1, 1, 2, 3, 4, 4, 5, 6, 7, 7, 8, 9, 10, 10, 11);
+    const __m256i align =
+        _mm256_setr_epi16(16, 1, 16, 1, 16, 1, 16, 1, 16, 1, 16, 1, 16, 1, 16, 1);
+    float* outputPtr = (float*)outputVector;
+    __m256i values;
+    __m256 wide;
+    unsigned int number;
+
+    for (number = 0; number < eighthPoints; number++) {
+        values = _mm256_inserti128_si256(
+            _mm256_castsi128_si256(_mm_loadu_si128((const __m128i*)inputVector)),
+            _mm_loadu_si128((const __m128i*)(inputVector + 12)),
+            1);
+        values = _mm256_shuffle_epi8(values, gather);
+        values = _mm256_srai_epi16(_mm256_mullo_epi16(values, align), 4);
+
+        wide = _mm256_cvtepi32_ps(_mm256_cvtepi16_epi32(_mm256_castsi256_si128(values)));
+        _mm256_storeu_ps(outputPtr, _mm256_mul_ps(wide, vScale));
+        wide = _mm256_cvtepi32_ps(
+            _mm256_cvtepi16_epi32(_mm256_extracti128_si256(values, 1)));
+        _mm256_storeu_ps(outputPtr + 8, _mm256_mul_ps(wide, vScale));
+
+        inputVector += 24;
+        outputPtr += 16;
+    }
+
+    for (number = eighthPoints * 8; number < num_points; number++) {
+        volk_12ic_unpack_32f(outputPtr, inputVector, scale);
+        inputVector += 3;
+        outputPtr += 2;
+    }
+}
+
+#endif /* LV_HAVE_AVX2 */
+
+
+#ifdef LV_HAVE_NEON
+#include <arm_neon.h>
+
+static inline void volk_12ic_s32f_convert_32fc_neon(lv_32fc_t* outputVector,
+                                                    const uint8_t* inputVector,
+                                                    const float scalar,
+                                                    unsigned int num_points)
+{
+    const unsigned int eighthPoints = num_points / 8;
+    const float scale = 1.f / scalar;
+    float* outputPtr = (float*)outputVector;
+    uint8x8x3_t bytes;
+    uint16x8_t middle;
+    int16x8_t real, imag;
+    float32x4x2_t values;
+    unsigned int number;
+
+    for (number = 0; number < eighthPoints; number++) {
+        bytes = vld3_u8(inputVector);
+        middle = vmovl_u8(bytes.val[1]);
+        real = vreinterpretq_s16_u16(
+            vorrq_u16(vmovl_u8(bytes.val[0]), vshlq_n_u16(middle, 8)));
+        real = vshrq_n_s16(vshlq_n_s16(real, 4), 4);
+        imag = vreinterpretq_s16_u16(
+            vorrq_u16(middle, vshlq_n_u16(vmovl_u8(bytes.val[2]), 8)));
+        imag = vshrq_n_s16(imag, 4);
+
+        values.val[0] = vmulq_n_f32(vcvtq_f32_s32(vmovl_s16(vget_low_s16(real))), scale);
+        values.val[1] = vmulq_n_f32(vcvtq_f32_s32(vmovl_s16(vget_low_s16(imag))), scale);
+        vst2q_f32(outputPtr, values);
+        values.val[0] = vmulq_n_f32(vcvtq_f32_s32(vmovl_s16(vget_high_s16(real))), scale);
+        values.val[1] = vmulq_n_f32(vcvtq_f32_s32(vmovl_s16(vget_high_s16(imag))), scale);
+        vst2q_f32(outputPtr + 8, values);
+
+        inputVector += 24;
+        outputPtr += 16;
+    }
+
+    for (number = eighthPoints * 8; number < num_points; number++) {
+        volk_12ic_unpack_32f(outputPtr, inputVector, scale);
+        inputVector += 3;
+        outputPtr += 2;
+    }
+}
+
+#endif /* LV_HAVE_NEON */
+
+#endif /* INCLUDED_volk_12ic_s32f_convert_32fc_H */
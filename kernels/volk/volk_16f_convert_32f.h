@@ -0,0 +1,174 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2026 Free Software Foundation, Inc.
+ *
+ * This file is part of VOLK
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+/*!
+ * \page volk_16f_convert_32f
+ *
+ * \b Overview
+ *
+ * Converts IEEE 754 half precision (binary16) values, stored as their bit
+ * patterns in uint16_t, to floats. The conversion is exact.
+ *
+ * <b>Dispatcher Prototype</b>
+ * \code
+ * void volk_16f_convert_32f(float* outputVector, const uint16_t* inputVector,
+ *                           unsigned int num_points)
+ * \endcode
+ *
+ * \b Inputs
+ * \li inputVector: the half precision values.
+ * \li num_points: the number of values.
+ *
+ * \b Outputs
+ * \li outputVector: the floats.
+ *
+ * \b Example
+ * \code
+ *   unsigned int N = 1000;
+ *   unsigned int alignment = volk_get_alignment();
+ *   uint16_t* in = (uint16_t*)volk_malloc(sizeof(uint16_t) * N, alignment);
+ *   float* out = (float*)volk_malloc(sizeof(float) * N, alignment);
+ *
+ *   for (unsigned int ii = 0; ii < N; ++ii) {
+ *       in[ii] = 0x3c00; // 1.0
+ *   }
+ *
+ *   volk_16f_convert_32f(out, in, N); // out[ii] == 1.f
+ *
+ *   volk_free(in);
+ *   volk_free(out);
+ * \endcode
+ */
+
+#ifndef INCLUDED_volk_16f_convert_32f_H
+#define INCLUDED_volk_16f_convert_32f_H
+
+#include <inttypes.h>
+#include <string.h>
+
+static inline float volk_16f_to_32f(uint16_t half)
+{
+    const uint32_t sign = (uint32_t)(half & 0x8000) << 16;
+    const uint32_t exponent = (half >> 10) & 0x1f;
+    const uint32_t mantissa = half & 0x3ff;
+    uint32_t bits;
+    float value;
+
+    if (exponent == 0x1f) {
+        // infinity, or NaN made quiet like the hardware conversions
+        bits = sign | 0x7f800000 | (mantissa ? 0x400000 | (mantissa << 13) : 0);
+    } else if (exponent != 0) {
+        bits = sign | ((exponent + 112) << 23) | (mantissa << 13);
+    } else {
+        // subnormal or zero, mantissa * 2^-24 is exact
+        value = (float)mantissa * 5.9604644775390625e-8f;
+        return sign ? -value : value;
+    }
+    memcpy(&value, &bits, sizeof(value));
+    return value;
+}
+
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void volk_16f_convert_32f_generic(float* outputVector,
+                                                const uint16_t* inputVector,
+                                                unsigned int num_points)
+{
+    unsigned int number;
+
+    for (number = 0; number < num_points; number++) {
+        *outputVector++ = volk_16f_to_32f(*inputVector++);
+    }
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+
+#if LV_HAVE_AVX && LV_HAVE_F16C
+#include <immintrin.h>
+
+static inline void volk_16f_convert_32f_u_avx_f16c(float* outputVector,
+                                                   const uint16_t* inputVector,
+                                                   unsigned int num_points)
+{
+    const unsigned int sixteenthPoints = num_points / 16;
+    unsigned int number;
+
+    for (number = 0; number < sixteenthPoints; number++) {
+        _mm256_storeu_ps(outputVector,
+                         _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*)inputVector)));
+        _mm256_storeu_ps(
+            outputVector + 8,
+            _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*)(inputVector + 8))));
+        inputVector += 16;
+        outputVector += 16;
+    }
+
+    for (number = sixteenthPoints * 16; number < num_points; number++) {
+        *outputVector++ = volk_16f_to_32f(*inputVector++);
+    }
+}
+
+#endif /* LV_HAVE_AVX && LV_HAVE_F16C */
+
+
+#ifdef LV_HAVE_AVX512F
+#include <immintrin.h>
+
+static inline void volk_16f_convert_32f_u_avx512f(float* outputVector,
+                                                  const uint16_t* inputVector,
+                                                  unsigned int num_points)
+{
+    const unsigned int sixteenthPoints = num_points / 16;
+    unsigned int number;
+
+    for (number = 0; number < sixteenthPoints; number++) {
+        _mm512_storeu_ps(
+            outputVector,
+            _mm512_cvtph_ps(_mm256_loadu_si256((const __m256i*)inputVector)));
+        inputVector += 16;
+        outputVector += 16;
+    }
+
+    for (number = sixteenthPoints * 16; number < num_points; number++) {
+        *outputVector++ = volk_16f_to_32f(*inputVector++);
+    }
+}
+
+#endif /* LV_HAVE_AVX512F */
+
+
+#ifdef LV_HAVE_NEONV8
+#include <arm_neon.h>
+
+static inline void volk_16f_convert_32f_neonv8(float* outputVector,
+                                               const uint16_t* inputVector,
+                                               unsigned int num_points)
+{
+    const unsigned int eighthPoints = num_points / 8;
+    float16x8_t half;
+    unsigned int number;
+
+    for (number = 0; number < eighthPoints; number++) {
+        half = vreinterpretq_f16_u16(vld1q_u16(inputVector));
+        vst1q_f32(outputVector, vcvt_f32_f16(vget_low_f16(half)));
+        vst1q_f32(outputVector + 4, vcvt_high_f32_f16(half));
+        inputVector += 8;
+        outputVector += 8;
+    }
+
+    for (number = eighthPoints * 8; number < num_points; number++) {
+        *outputVector++ = volk_16f_to_32f(*inputVector++);
+    }
+}
+
+#endif /* LV_HAVE_NEONV8 */
+
+#endif /* INCLUDED_volk_16f_convert_32f_H */
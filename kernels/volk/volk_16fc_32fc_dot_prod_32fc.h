@@ -0,0 +1,208 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2026 Free Software Foundation, Inc.
+ *
+ * This file is part of VOLK
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+/*!
+ * \page volk_16fc_32fc_dot_prod_32fc
+ *
+ * \b Overview
+ *
+ * Computes the dot product of a half precision complex vector, stored as in
+ * volk_16fc_convert_32fc, with complex float taps. The input is widened in
+ * registers and accumulated in single precision.
+ *
+ * <b>Dispatcher Prototype</b>
+ * \code
+ * void volk_16fc_32fc_dot_prod_32fc(lv_32fc_t* result, const uint16_t* input,
+ *                                   const lv_32fc_t* taps, unsigned int num_points)
+ * \endcode
+ *
+ * \b Inputs
+ * \li input: the 2 * num_points half precision values.
+ * \li taps: the complex taps.
+ * \li num_points: the number of complex values.
+ *
+ * \b Outputs
+ * \li result: the sum of input[i] * taps[i].
+ *
+ * \b Example
+ * Correlate a half precision recording with a float reference.
+ * \code
+ *   unsigned int N = 1000;
+ *   unsigned int alignment = volk_get_alignment();
+ *   uint16_t* rec = (uint16_t*)volk_malloc(2 * sizeof(uint16_t) * N, alignment);
+ *   lv_32fc_t* ref = (lv_32fc_t*)volk_malloc(sizeof(lv_32fc_t) * N, alignment);
+ *   lv_32fc_t corr;
+ *
+ *   // ... fill rec and ref
+ *
+ *   volk_16fc_32fc_dot_prod_32fc(&corr, rec, ref, N);
+ *
+ *   volk_free(rec);
+ *   volk_free(ref);
+ * \endcode
+ */
+
+#ifndef INCLUDED_volk_16fc_32fc_dot_prod_32fc_H
+#define INCLUDED_volk_16fc_32fc_dot_prod_32fc_H
+
+#include <volk/volk_16fc_convert_32fc.h>
+#include <volk/volk_common.h>
+#include <volk/volk_complex.h>
+
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void volk_16fc_32fc_dot_prod_32fc_generic(lv_32fc_t* result,
+                                                        const uint16_t* input,
+                                                        const lv_32fc_t* taps,
+                                                        unsigned int num_points)
+{
+    lv_32fc_t sum0 = lv_cmake(0.f, 0.f);
+    lv_32fc_t sum1 = lv_cmake(0.f, 0.f);
+    unsigned int number;
+
+    for (number = 0; number + 1 < num_points; number += 2) {
+        sum0 += volk_16fc_to_32fc(input) * taps[0];
+        sum1 += volk_16fc_to_32fc(input + 2) * taps[1];
+        input += 4;
+        taps += 2;
+    }
+    if (number < num_points) {
+        sum0 += volk_16fc_to_32fc(input) * taps[0];
+    }
+    *result = sum0 + sum1;
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+
+#if LV_HAVE_AVX && LV_HAVE_F16C
+#include <immintrin.h>
+#include <volk/volk_avx_intrinsics.h>
+
+static inline void volk_16fc_32fc_dot_prod_32fc_u_avx_f16c(lv_32fc_t* result,
+                                                           const uint16_t* input,
+                                                           const lv_32fc_t* taps,
+                                                           unsigned int num_points)
+{
+    __VOLK_ATTR_ALIGNED(32) lv_32fc_t partial[4];
+    const unsigned int eighthPoints = num_points / 8;
+    __m256 x, sum0, sum1;
+    lv_32fc_t dotProduct;
+    unsigned int number;
+
+    sum0 = _mm256_setzero_ps();
+    sum1 = _mm256_setzero_ps();
+    for (number = 0; number < eighthPoints; number++) {
+        x = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*)input));
+        sum0 = _mm256_add_ps(
+            sum0, _mm256_complexmul_ps(x, _mm256_loadu_ps((const float*)taps)));
+        x = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*)(input + 8)));
+        sum1 = _mm256_add_ps(
+            sum1, _mm256_complexmul_ps(x, _mm256_loadu_ps((const float*)(taps + 4))));
+        input += 16;
+        taps += 8;
+    }
+
+    _mm256_store_ps((float*)partial, _mm256_add_ps(sum0, sum1));
+    dotProduct = partial[0] + partial[1] + partial[2] + partial[3];
+
+    for (number = eighthPoints * 8; number < num_points; number++) {
+        dotProduct += volk_16fc_to_32fc(input) * (*taps++);
+        input += 2;
+    }
+    *result = dotProduct;
+}
+
+#endif /* LV_HAVE_AVX && LV_HAVE_F16C */
+
+
+#ifdef LV_HAVE_AVX512F
+#include <immintrin.h>
+#include <volk/volk_avx512_intrinsics.h>
+
+static inline void volk_16fc_32fc_dot_prod_32fc_u_avx512f(lv_32fc_t* result,
+                                                          const uint16_t* input,
+                                                          const lv_32fc_t* taps,
+                                                          unsigned int num_points)
+{
+    __VOLK_ATTR_ALIGNED(64) lv_32fc_t partial[8];
+    const unsigned int sixteenthPoints = num_points / 16;
+    __m512 x, sum0, sum1;
+    lv_32fc_t dotProduct;
+    unsigned int number;
+
+    sum0 = _mm512_setzero_ps();
+    sum1 = _mm512_setzero_ps();
+    for (number = 0; number < sixteenthPoints; number++) {
+        x = _mm512_cvtph_ps(_mm256_loadu_si256((const __m256i*)input));
+        sum0 = _mm512_add_ps(
+            sum0, _mm512_complexmul_ps(x, _mm512_loadu_ps((const float*)taps)));
+        x = _mm512_cvtph_ps(_mm256_loadu_si256((const __m256i*)(input + 16)));
+        sum1 = _mm512_add_ps(
+            sum1, _mm512_complexmul_ps(x, _mm512_loadu_ps((const float*)(taps + 8))));
+        input += 32;
+        taps += 16;
+    }
+
+    _mm512_store_ps((float*)partial, _mm512_add_ps(sum0, sum1));
+    dotProduct = partial[0] + partial[1] + partial[2] + partial[3] + partial[4] +
+                 partial[5] + partial[6] + partial[7];
+
+    for (number = sixteenthPoints * 16; number < num_points; number++) {
+        dotProduct += volk_16fc_to_32fc(input) * (*taps++);
+        input += 2;
+    }
+    *result = dotProduct;
+}
+
+#endif /* LV_HAVE_AVX512F */
+
+
+#ifdef LV_HAVE_NEONV8
+#include <arm_neon.h>
+
+static inline void volk_16fc_32fc_dot_prod_32fc_neonv8(lv_32fc_t* result,
+                                                       const uint16_t* input,
+                                                       const lv_32fc_t* taps,
+                                                       unsigned int num_points)
+{
+    const unsigned int quarterPoints = num_points / 4;
+    float32x4_t real = vdupq_n_f32(0.f);
+    float32x4_t imag = vdupq_n_f32(0.f);
+    float16x4x2_t x;
+    float32x4x2_t y;
+    float32x4_t xr, xi;
+    lv_32fc_t dotProduct;
+    unsigned int number;
+
+    for (number = 0; number < quarterPoints; number++) {
+        x = vld2_f16((const float16_t*)input);
+        y = vld2q_f32((const float*)taps);
+        xr = vcvt_f32_f16(x.val[0]);
+        xi = vcvt_f32_f16(x.val[1]);
+        real = vfmaq_f32(real, xr, y.val[0]);
+        real = vfmsq_f32(real, xi, y.val[1]);
+        imag = vfmaq_f32(imag, xr, y.val[1]);
+        imag = vfmaq_f32(imag, xi, y.val[0]);
+        input += 8;
+        taps += 4;
+    }
+
+    dotProduct = lv_cmake(vaddvq_f32(real), vaddvq_f32(imag));
+    for (number = quarterPoints * 4; number < num_points; number++) {
+        dotProduct += volk_16fc_to_32fc(input) * (*taps++);
+        input += 2;
+    }
+    *result = dotProduct;
+}
+
+#endif /* LV_HAVE_NEONV8 */
+
+#endif /* INCLUDED_volk_16fc_32fc_dot_prod_32fc_H */
@@ -0,0 +1,110 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2026 Free Software Foundation, Inc.
+ *
+ * This file is part of VOLK
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+/*!
+ * \page volk_16fc_convert_32fc
+ *
+ * \b Overview
+ *
+ * Converts half precision (binary16) complex values, stored as pairs of
+ * uint16_t with the real part first, to complex floats, see
+ * volk_16f_convert_32f.
+ *
+ * <b>Dispatcher Prototype</b>
+ * \code
+ * void volk_16fc_convert_32fc(lv_32fc_t* outputVector, const uint16_t* inputVector,
+ *                             unsigned int num_points)
+ * \endcode
+ *
+ * \b Inputs
+ * \li inputVector: the 2 * num_points half precision values.
+ * \li num_points: the number of complex values.
+ *
+ * \b Outputs
+ * \li outputVector: the complex floats.
+ *
+ * \b Example
+ * \code
+ *   unsigned int N = 1000;
+ *   unsigned int alignment = volk_get_alignment();
+ *   uint16_t* in = (uint16_t*)volk_malloc(2 * sizeof(uint16_t) * N, alignment);
+ *   lv_32fc_t* out = (lv_32fc_t*)volk_malloc(sizeof(lv_32fc_t) * N, alignment);
+ *
+ *   for (unsigned int ii = 0; ii < N; ++ii) {
+ *       in[2 * ii] = 0x3800;     // 0.5
+ *       in[2 * ii + 1] = 0xbc00; // -1.0
+ *   }
+ *
+ *   volk_16fc_convert_32fc(out, in, N); // out[ii] == lv_cmake(.5f, -1.f)
+ *
+ *   volk_free(in);
+ *   volk_free(out);
+ * \endcode
+ */
+
+#ifndef INCLUDED_volk_16fc_convert_32fc_H
+#define INCLUDED_volk_16fc_convert_32fc_H
+
+#include <volk/volk_16f_convert_32f.h>
+#include <volk/volk_complex.h>
+
+static inline lv_32fc_t volk_16fc_to_32fc(const uint16_t* half)
+{
+    return lv_cmake(volk_16f_to_32f(half[0]), volk_16f_to_32f(half[1]));
+}
+
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void volk_16fc_convert_32fc_generic(lv_32fc_t* outputVector,
+                                                  const uint16_t* inputVector,
+                                                  unsigned int num_points)
+{
+    volk_16f_convert_32f_generic((float*)outputVector, inputVector, 2 * num_points);
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+
+#if LV_HAVE_AVX && LV_HAVE_F16C
+
+static inline void volk_16fc_convert_32fc_u_avx_f16c(lv_32fc_t* outputVector,
+                                                     const uint16_t* inputVector,
+                                                     unsigned int num_points)
+{
+    volk_16f_convert_32f_u_avx_f16c((float*)outputVector, inputVector, 2 * num_points);
+}
+
+#endif /* LV_HAVE_AVX && LV_HAVE_F16C */
+
+
+#ifdef LV_HAVE_AVX512F
+
+static inline void volk_16fc_convert_32fc_u_avx512f(lv_32fc_t* outputVector,
+                                                    const uint16_t* inputVector,
+                                                    unsigned int num_points)
+{
+    volk_16f_convert_32f_u_avx512f((float*)outputVector, inputVector, 2 * num_points);
+}
+
+#endif /* LV_HAVE_AVX512F */
+
+
+#ifdef LV_HAVE_NEONV8
+
+static inline void volk_16fc_convert_32fc_neonv8(lv_32fc_t* outputVector,
+                                                 const uint16_t* inputVector,
+                                                 unsigned int num_points)
+{
+    volk_16f_convert_32f_neonv8((float*)outputVector, inputVector, 2 * num_points);
+}
+
+#endif /* LV_HAVE_NEONV8 */
+
+#endif /* INCLUDED_volk_16fc_convert_32fc_H */
@@ -0,0 +1,182 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2026 Free Software Foundation, Inc.
+ *
+ * This file is part of VOLK
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+/*!
+ * \page volk_16fc_x2_multiply_32fc
+ *
+ * \b Overview
+ *
+ * Multiplies two half precision complex vectors, stored as in
+ * volk_16fc_convert_32fc, element by element. The inputs are widened in
+ * registers and the products are computed and stored as complex floats.
+ *
+ * c[i] = a[i] * b[i]
+ *
+ * <b>Dispatcher Prototype</b>
+ * \code
+ * void volk_16fc_x2_multiply_32fc(lv_32fc_t* cVector, const uint16_t* aVector,
+ *                                 const uint16_t* bVector, unsigned int num_points)
+ * \endcode
+ *
+ * \b Inputs
+ * \li aVector: the first input, 2 * num_points half precision values.
+ * \li bVector: the second input, 2 * num_points half precision values.
+ * \li num_points: the number of complex values.
+ *
+ * \b Outputs
+ * \li cVector: the products.
+ *
+ * \b Example
+ * Mix a half precision recording with a half precision local oscillator.
+ * \code
+ *   unsigned int N = 1000;
+ *   unsigned int alignment = volk_get_alignment();
+ *   uint16_t* rec = (uint16_t*)volk_malloc(2 * sizeof(uint16_t) * N, alignment);
+ *   uint16_t* lo = (uint16_t*)volk_malloc(2 * sizeof(uint16_t) * N, alignment);
+ *   lv_32fc_t* out = (lv_32fc_t*)volk_malloc(sizeof(lv_32fc_t) * N, alignment);
+ *
+ *   // ... fill rec and lo, e.g. with volk_32fc_convert_16fc
+ *
+ *   volk_16fc_x2_multiply_32fc(out, rec, lo, N);
+ *
+ *   volk_free(rec);
+ *   volk_free(lo);
+ *   volk_free(out);
+ * \endcode
+ */
+
+#ifndef INCLUDED_volk_16fc_x2_multiply_32fc_H
+#define INCLUDED_volk_16fc_x2_multiply_32fc_H
+
+#include <volk/volk_16fc_convert_32fc.h>
+#include <volk/volk_complex.h>
+
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void volk_16fc_x2_multiply_32fc_generic(lv_32fc_t* cVector,
+                                                      const uint16_t* aVector,
+                                                      const uint16_t* bVector,
+                                                      unsigned int num_points)
+{
+    unsigned int number;
+
+    for (number = 0; number < num_points; number++) {
+        *cVector++ = volk_16fc_to_32fc(aVector) * volk_16fc_to_32fc(bVector);
+        aVector += 2;
+        bVector += 2;
+    }
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+
+#if LV_HAVE_AVX && LV_HAVE_F16C
+#include <immintrin.h>
+#include <volk/volk_avx_intrinsics.h>
+
+static inline void volk_16fc_x2_multiply_32fc_u_avx_f16c(lv_32fc_t* cVector,
+                                                         const uint16_t* aVector,
+                                                         const uint16_t* bVector,
+                                                         unsigned int num_points)
+{
+    const unsigned int quarterPoints = num_points / 4;
+    __m256 x, y;
+    unsigned int number;
+
+    for (number = 0; number < quarterPoints; number++) {
+        x = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*)aVector));
+        y = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*)bVector));
+        _mm256_storeu_ps((float*)cVector, _mm256_complexmul_ps(x, y));
+        aVector += 8;
+        bVector += 8;
+        cVector += 4;
+    }
+
+    for (number = quarterPoints * 4; number < num_points; number++) {
+        *cVector++ = volk_16fc_to_32fc(aVector) * volk_16fc_to_32fc(bVector);
+        aVector += 2;
+        bVector += 2;
+    }
+}
+
+#endif /* LV_HAVE_AVX && LV_HAVE_F16C */
+
+
+#ifdef LV_HAVE_AVX512F
+#include <immintrin.h>
+#include <volk/volk_avx512_intrinsics.h>
+
+static inline void volk_16fc_x2_multiply_32fc_u_avx512f(lv_32fc_t* cVector,
+                                                        const uint16_t* aVector,
+                                                        const uint16_t* bVector,
+                                                        unsigned int num_points)
+{
+    const unsigned int eighthPoints = num_points / 8;
+    __m512 x, y;
+    unsigned int number;
+
+    for (number = 0; number < eighthPoints; number++) {
+        x = _mm512_cvtph_ps(_mm256_loadu_si256((const __m256i*)aVector));
+        y = _mm512_cvtph_ps(_mm256_loadu_si256((const __m256i*)bVector));
+        _mm512_storeu_ps((float*)cVector, _mm512_complexmul_ps(x, y));
+        aVector += 16;
+        bVector += 16;
+        cVector += 8;
+    }
+
+    for (number = eighthPoints * 8; number < num_points; number++) {
+        *cVector++ = volk_16fc_to_32fc(aVector) * volk_16fc_to_32fc(bVector);
+        aVector += 2;
+        bVector += 2;
+    }
+}
+
+#endif /* LV_HAVE_AVX512F */
+
+
+#ifdef LV_HAVE_NEONV8
+#include <arm_neon.h>
+
+static inline void volk_16fc_x2_multiply_32fc_neonv8(lv_32fc_t* cVector,
+                                                     const uint16_t* aVector,
+                                                     const uint16_t* bVector,
+                                                     unsigned int num_points)
+{
+    const unsigned int quarterPoints = num_points / 4;
+    float16x4x2_t a, b;
+    float32x4_t ar, ai, br, bi;
+    float32x4x2_t c;
+    unsigned int number;
+
+    for (number = 0; number < quarterPoints; number++) {
+        a = vld2_f16((const float16_t*)aVector);
+        b = vld2_f16((const float16_t*)bVector);
+        ar = vcvt_f32_f16(a.val[0]);
+        ai = vcvt_f32_f16(a.val[1]);
+        br = vcvt_f32_f16(b.val[0]);
+        bi = vcvt_f32_f16(b.val[1]);
+        c.val[0] = vfmsq_f32(vmulq_f32(ar, br), ai, bi);
+        c.val[1] = vfmaq_f32(vmulq_f32(ar, bi), ai, br);
+        vst2q_f32((float*)cVector, c);
+        aVector += 8;
+        bVector += 8;
+        cVector += 4;
+    }
+
+    for (number = quarterPoints * 4; number < num_points; number++) {
+        *cVector++ = volk_16fc_to_32fc(aVector) * volk_16fc_to_32fc(bVector);
+        aVector += 2;
+        bVector += 2;
+    }
+}
+
+#endif /* LV_HAVE_NEONV8 */
+
+#endif /* INCLUDED_volk_16fc_x2_multiply_32fc_H */
@@ -0,0 +1,78 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2026 Free Software Foundation, Inc.
+ *
+ * This file is part of VOLK
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+/*!
+ * \page volk_16i_histogram_32u
+ *
+ * \b Overview
+ *
+ * Counts how often each of the 65536 values occurs in a vector of 16 bit
+ * integers, e.g. to check the code distribution of an ADC.
+ *
+ * Counting is scalar. SIMD only helps with the bin indices, which the scalar
+ * loop gets for free, and the histogram is too large to spread over
+ * sub-histograms.
+ *
+ * <b>Dispatcher Prototype</b>
+ * \code
+ * void volk_16i_histogram_32u(uint32_t* histogram, const int16_t* inputBuffer,
+ *                             unsigned int num_points)
+ * \endcode
+ *
+ * \b Inputs
+ * \li inputBuffer: the input vector.
+ * \li num_points: the number of elements in the input vector.
+ *
+ * \b Outputs
+ * \li histogram: the 65536 counts, histogram[v + 32768] counts the value v.
+ * Overwritten. The buffer has to hold 65536 elements whatever num_points is.
+ *
+ * \b Example
+ * \code
+ *   unsigned int N = 1024;
+ *   unsigned int alignment = volk_get_alignment();
+ *   int16_t* in = (int16_t*)volk_malloc(sizeof(int16_t) * N, alignment);
+ *   uint32_t* hist = (uint32_t*)volk_malloc(sizeof(uint32_t) * 65536, alignment);
+ *
+ *   for (unsigned int ii = 0; ii < N; ++ii) {
+ *       in[ii] = (int16_t)(ii % 16) - 8;
+ *   }
+ *
+ *   volk_16i_histogram_32u(hist, in, N); // hist[32760] ... hist[32775] == 64
+ *
+ *   volk_free(in);
+ *   volk_free(hist);
+ * \endcode
+ */
+
+#ifndef INCLUDED_volk_16i_histogram_32u_u_H
+#define INCLUDED_volk_16i_histogram_32u_u_H
+
+#include <inttypes.h>
+#include <string.h>
+#include <volk/volk_common.h>
+
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void volk_16i_histogram_32u_generic(uint32_t* histogram,
+                                                  const int16_t* inputBuffer,
+                                                  unsigned int num_points)
+{
+    unsigned int number;
+
+    memset(histogram, 0, 65536 * sizeof(uint32_t));
+    for (number = 0; number < num_points; number++) {
+        histogram[(uint16_t)inputBuffer[number] ^ 0x8000]++;
+    }
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+#endif /* INCLUDED_volk_16i_histogram_32u_u_H */
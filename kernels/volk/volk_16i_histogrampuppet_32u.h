@@ -0,0 +1,45 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2026 Free Software Foundation, Inc.
+ *
+ * This file is part of VOLK
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+/* For documentation see 'kernels/volk/volk_16i_histogram_32u.h'
+ * This file exists for test purposes only. Should not be used directly.
+ *
+ * The kernel writes 65536 bins whatever the vector length is, so the histogram
+ * goes to a separate buffer and bin ii is added to output[ii % num_points].
+ */
+
+#ifndef INCLUDED_volk_16i_histogrampuppet_32u_H
+#define INCLUDED_volk_16i_histogrampuppet_32u_H
+
+#include <string.h>
+#include <volk/volk.h>
+#include <volk/volk_16i_histogram_32u.h>
+
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void volk_16i_histogrampuppet_32u_generic(uint32_t* output,
+                                                        const int16_t* inputBuffer,
+                                                        unsigned int num_points)
+{
+    uint32_t* histogram =
+        (uint32_t*)volk_malloc(65536 * sizeof(uint32_t), volk_get_alignment());
+    unsigned int ii;
+
+    volk_16i_histogram_32u_generic(histogram, inputBuffer, num_points);
+    memset(output, 0, num_points * sizeof(uint32_t));
+    for (ii = 0; ii < 65536; ii++) {
+        output[ii % num_points] += histogram[ii];
+    }
+    volk_free(histogram);
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+#endif /* INCLUDED_volk_16i_histogrampuppet_32u_H */
@@ -0,0 +1,346 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2026 Free Software Foundation, Inc.
+ *
+ * This file is part of VOLK
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+/*!
+ * \page volk_16ic_deinterleave_32fc_xN
+ *
+ * \b Overview
+ *
+ * Splits a sample interleaved multi-channel stream of complex 16-bit
+ * integers into one complex float vector per channel. The values are
+ * converted without scaling, as in volk_16ic_convert_32fc.
+ *
+ * outputVectors[c][n] = (lv_32fc_t)inputVector[n * num_channels + c]
+ *
+ * Two channels and multiples of four channels are transposed in registers,
+ * other channel counts use scalar conversions.
+ *
+ * <b>Dispatcher Prototype</b>
+ * \code
+ * void volk_16ic_deinterleave_32fc_xN(lv_32fc_t** outputVectors,
+ *                                     const lv_16sc_t* inputVector,
+ *                                     unsigned int num_channels,
+ *                                     unsigned int num_points)
+ * \endcode
+ *
+ * \b Inputs
+ * \li inputVector: the interleaved stream, num_channels * num_points samples.
+ * \li num_channels: the number of channels N.
+ * \li num_points: the number of samples per channel.
+ *
+ * \b Outputs
+ * \li outputVectors: N pointers to the num_points samples of each channel.
+ *
+ * \b Example
+ * Split the 16-bit stream of an eight channel receiver.
+ * \code
+ *   unsigned int N = 1000;
+ *   unsigned int alignment = volk_get_alignment();
+ *   lv_16sc_t* in = (lv_16sc_t*)volk_malloc(8 * sizeof(lv_16sc_t) * N, alignment);
+ *   lv_32fc_t* channels[8];
+ *
+ *   for (unsigned int ii = 0; ii < 8; ++ii) {
+ *       channels[ii] = (lv_32fc_t*)volk_malloc(sizeof(lv_32fc_t) * N, alignment);
+ *   }
+ *   // ... fill in
+ *
+ *   volk_16ic_deinterleave_32fc_xN(channels, in, 8, N);
+ *
+ *   for (unsigned int ii = 0; ii < 8; ++ii) {
+ *       volk_free(channels[ii]);
+ *   }
+ *   volk_free(in);
+ * \endcode
+ */
+
+#ifndef INCLUDED_volk_16ic_deinterleave_32fc_xN_H
+#define INCLUDED_volk_16ic_deinterleave_32fc_xN_H
+
+#include <volk/volk_complex.h>
+
+static inline void volk_16ic_deinterleave_xN_frames(lv_32fc_t** outputVectors,
+                                                    const lv_16sc_t* inputVector,
+                                                    unsigned int num_channels,
+                                                    unsigned int first,
+                                                    unsigned int num_points)
+{
+    unsigned int number, channel;
+
+    inputVector += first * num_channels;
+    for (number = first; number < num_points; number++) {
+        for (channel = 0; channel < num_channels; channel++) {
+            outputVectors[channel][number] = lv_cmake((float)lv_creal(*inputVector),
+                                                      (float)lv_cimag(*inputVector));
+            inputVector++;
+        }
+    }
+}
+
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void volk_16ic_deinterleave_32fc_xN_generic(lv_32fc_t** outputVectors,
+                                                          const lv_16sc_t* inputVector,
+                                                          unsigned int num_channels,
+                                                          unsigned int num_points)
+{
+    volk_16ic_deinterleave_xN_frames(
+        outputVectors, inputVector, num_channels, 0, num_points);
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+
+#ifdef LV_HAVE_SSE2
+#include <emmintrin.h>
+
+static inline void volk_16ic_deinterleave_32fc_xN_u_sse2(lv_32fc_t** outputVectors,
+                                                         const lv_16sc_t* inputVector,
+                                                         unsigned int num_channels,
+                                                         unsigned int num_points)
+{
+    const int16_t* input = (const int16_t*)inputVector;
+    const int16_t* frame;
+    unsigned int quarterPoints = 0;
+    __m128i r0, r1, r2, r3, t0, t1, t2, t3;
+    __m128i col[4];
+    float* out;
+    unsigned int number, channel, k;
+
+    if (num_channels == 2) {
+        quarterPoints = num_points / 4;
+        for (number = 0; number < quarterPoints; number++) {
+            r0 = _mm_shuffle_epi32(_mm_loadu_si128((const __m128i*)input), 0xD8);
+            r1 = _mm_shuffle_epi32(_mm_loadu_si128((const __m128i*)(input + 8)), 0xD8);
+            col[0] = _mm_unpacklo_epi64(r0, r1);
+            col[1] = _mm_unpackhi_epi64(r0, r1);
+            input += 16;
+            for (k = 0; k < 2; k++) {
+                out = (float*)(outputVectors[k] + 4 * number);
+                _mm_storeu_ps(out,
+                              _mm_cvtepi32_ps(_mm_srai_epi32(
+                                  _mm_unpacklo_epi16(col[k], col[k]), 16)));
+                _mm_storeu_ps(out + 4,
+                              _mm_cvtepi32_ps(_mm_srai_epi32(
+                                  _mm_unpackhi_epi16(col[k], col[k]), 16)));
+            }
+        }
+    } else if (num_channels % 4 == 0) {
+        // transpose 4x4 blocks of four frames and four channels
+        quarterPoints = num_points / 4;
+        for (number = 0; number < quarterPoints; number++) {
+            frame = input + 8 * number * num_channels;
+            for (channel = 0; channel < num_channels; channel += 4) {
+                r0 = _mm_loadu_si128((const __m128i*)(frame + 2 * channel));
+                r1 = _mm_loadu_si128(
+                    (const __m128i*)(frame + 2 * num_channels + 2 * channel));
+                r2 = _mm_loadu_si128(
+                    (const __m128i*)(frame + 4 * num_channels + 2 * channel));
+                r3 = _mm_loadu_si128(
+                    (const __m128i*)(frame + 6 * num_channels + 2 * channel));
+                t0 = _mm_unpacklo_epi32(r0, r1);
+                t1 = _mm_unpackhi_epi32(r0, r1);
+                t2 = _mm_unpacklo_epi32(r2, r3);
+                t3 = _mm_unpackhi_epi32(r2, r3);
+                col[0] = _mm_unpacklo_epi64(t0, t2);
+                col[1] = _mm_unpackhi_epi64(t0, t2);
+                col[2] = _mm_unpacklo_epi64(t1, t3);
+                col[3] = _mm_unpackhi_epi64(t1, t3);
+                for (k = 0; k < 4; k++) {
+                    out = (float*)(outputVectors[channel + k] + 4 * number);
+                    _mm_storeu_ps(out,
+                                  _mm_cvtepi32_ps(_mm_srai_epi32(
+                                      _mm_unpacklo_epi16(col[k], col[k]), 16)));
+                    _mm_storeu_ps(out + 4,
+                                  _mm_cvtepi32_ps(_mm_srai_epi32(
+                                      _mm_unpackhi_epi16(col[k], col[k]), 16)));
+                }
+            }
+        }
+    }
+
+    volk_16ic_deinterleave_xN_frames(
+        outputVectors, inputVector, num_channels, quarterPoints * 4, num_points);
+}
+
+#endif /* LV_HAVE_SSE2 */
+
+
+#ifdef LV_HAVE_AVX2
+#include <immintrin.h>
+
+static inline void volk_16ic_deinterleave_32fc_xN_u_avx2(lv_32fc_t** outputVectors,
+                                                         const lv_16sc_t* inputVector,
+                                                         unsigned int num_channels,
+                                                         unsigned int num_points)
+{
+    const int16_t* input = (const int16_t*)inputVector;
+    const int16_t* frame;
+    unsigned int quarterPoints = 0;
+    unsigned int eighthPoints = 0;
+    __m256i x, r0, r1, r2, r3, t0, t1, t2, t3;
+    __m256i col[4];
+    float* out;
+    unsigned int number, channel, k;
+
+    if (num_channels == 2) {
+        quarterPoints = num_points / 4;
+        for (number = 0; number < quarterPoints; number++) {
+            x = _mm256_loadu_si256((const __m256i*)input);
+            x = _mm256_permute4x64_epi64(_mm256_shuffle_epi32(x, 0xD8), 0xD8);
+            input += 16;
+            _mm256_storeu_ps(
+                (float*)(outputVectors[0] + 4 * number),
+                _mm256_cvtepi32_ps(_mm256_cvtepi16_epi32(_mm256_castsi256_si128(x))));
+            _mm256_storeu_ps((float*)(outputVectors[1] + 4 * number),
+                             _mm256_cvtepi32_ps(
+                                 _mm256_cvtepi16_epi32(_mm256_extracti128_si256(x, 1))));
+        }
+    } else if (num_channels % 4 == 0) {
+        // frames 0-3 in the low lanes and frames 4-7 in the high lanes, so
+        // the in-lane 4x4 transpose gives eight frames of four channels
+        eighthPoints = num_points / 8;
+        for (number = 0; number < eighthPoints; number++) {
+            frame = input + 16 * number * num_channels;
+            for (channel = 0; channel < num_channels; channel += 4) {
+                r0 = _mm256_inserti128_si256(
+                    _mm256_castsi128_si256(
+                        _mm_loadu_si128((const __m128i*)(frame + 2 * channel))),
+                    _mm_loadu_si128(
+                        (const __m128i*)(frame + 8 * num_channels + 2 * channel)),
+                    1);
+                r1 = _mm256_inserti128_si256(
+                    _mm256_castsi128_si256(_mm_loadu_si128(
+                        (const __m128i*)(frame + 2 * num_channels + 2 * channel))),
+                    _mm_loadu_si128(
+                        (const __m128i*)(frame + 10 * num_channels + 2 * channel)),
+                    1);
+                r2 = _mm256_inserti128_si256(
+                    _mm256_castsi128_si256(_mm_loadu_si128(
+                        (const __m128i*)(frame + 4 * num_channels + 2 * channel))),
+                    _mm_loadu_si128(
+                        (const __m128i*)(frame + 12 * num_channels + 2 * channel)),
+                    1);
+                r3 = _mm256_inserti128_si256(
+                    _mm256_castsi128_si256(_mm_loadu_si128(
+                        (const __m128i*)(frame + 6 * num_channels + 2 * channel))),
+                    _mm_loadu_si128(
+                        (const __m128i*)(frame + 14 * num_channels + 2 * channel)),
+                    1);
+                t0 = _mm256_unpacklo_epi32(r0, r1);
+                t1 = _mm256_unpackhi_epi32(r0, r1);
+                t2 = _mm256_unpacklo_epi32(r2, r3);
+                t3 = _mm256_unpackhi_epi32(r2, r3);
+                col[0] = _mm256_unpacklo_epi64(t0, t2);
+                col[1] = _mm256_unpackhi_epi64(t0, t2);
+                col[2] = _mm256_unpacklo_epi64(t1, t3);
+                col[3] = _mm256_unpackhi_epi64(t1, t3);
+                for (k = 0; k < 4; k++) {
+                    out = (float*)(outputVectors[channel + k] + 8 * number);
+                    _mm256_storeu_ps(out,
+                                     _mm256_cvtepi32_ps(_mm256_cvtepi16_epi32(
+                                         _mm256_castsi256_si128(col[k]))));
+                    _mm256_storeu_ps(out + 8,
+                                     _mm256_cvtepi32_ps(_mm256_cvtepi16_epi32(
+                                         _mm256_extracti128_si256(col[k], 1))));
+                }
+            }
+        }
+    }
+
+    volk_16ic_deinterleave_xN_frames(outputVectors,
+                                     inputVector,
+                                     num_channels,
+                                     quarterPoints * 4 + eighthPoints * 8,
+                                     num_points);
+}
+
+#endif /* LV_HAVE_AVX2 */
+
+
+#ifdef LV_HAVE_NEON
+#include <arm_neon.h>
+
+static inline void volk_16ic_deinterleave_32fc_xN_neon(lv_32fc_t** outputVectors,
+                                                       const lv_16sc_t* inputVector,
+                                                       unsigned int num_channels,
+                                                       unsigned int num_points)
+{
+    const int16_t* input = (const int16_t*)inputVector;
+    const int16_t* frame;
+    unsigned int eighthPoints = 0;
+    unsigned int quarterPoints = 0;
+    int16x8x4_t values;
+    float32x4x2_t complexValues;
+    uint32x4x2_t t0, t1;
+    uint32x4_t col[4];
+    int16x8_t c16;
+    float* out;
+    unsigned int number, channel, k;
+
+    if (num_channels == 2) {
+        eighthPoints = num_points / 8;
+        for (number = 0; number < eighthPoints; number++) {
+            values = vld4q_s16(input);
+            input += 32;
+            for (k = 0; k < 2; k++) {
+                out = (float*)(outputVectors[k] + 8 * number);
+                complexValues.val[0] =
+                    vcvtq_f32_s32(vmovl_s16(vget_low_s16(values.val[2 * k])));
+                complexValues.val[1] =
+                    vcvtq_f32_s32(vmovl_s16(vget_low_s16(values.val[2 * k + 1])));
+                vst2q_f32(out, complexValues);
+                complexValues.val[0] =
+                    vcvtq_f32_s32(vmovl_s16(vget_high_s16(values.val[2 * k])));
+                complexValues.val[1] =
+                    vcvtq_f32_s32(vmovl_s16(vget_high_s16(values.val[2 * k + 1])));
+                vst2q_f32(out + 8, complexValues);
+            }
+        }
+    } else if (num_channels % 4 == 0) {
+        // transpose 4x4 blocks of four frames and four channels
+        quarterPoints = num_points / 4;
+        for (number = 0; number < quarterPoints; number++) {
+            frame = input + 8 * number * num_channels;
+            for (channel = 0; channel < num_channels; channel += 4) {
+                t0 = vtrnq_u32(
+                    vreinterpretq_u32_s16(vld1q_s16(frame + 2 * channel)),
+                    vreinterpretq_u32_s16(
+                        vld1q_s16(frame + 2 * num_channels + 2 * channel)));
+                t1 = vtrnq_u32(
+                    vreinterpretq_u32_s16(
+                        vld1q_s16(frame + 4 * num_channels + 2 * channel)),
+                    vreinterpretq_u32_s16(
+                        vld1q_s16(frame + 6 * num_channels + 2 * channel)));
+                col[0] = vcombine_u32(vget_low_u32(t0.val[0]), vget_low_u32(t1.val[0]));
+                col[1] = vcombine_u32(vget_low_u32(t0.val[1]), vget_low_u32(t1.val[1]));
+                col[2] =
+                    vcombine_u32(vget_high_u32(t0.val[0]), vget_high_u32(t1.val[0]));
+                col[3] =
+                    vcombine_u32(vget_high_u32(t0.val[1]), vget_high_u32(t1.val[1]));
+                for (k = 0; k < 4; k++) {
+                    out = (float*)(outputVectors[channel + k] + 4 * number);
+                    c16 = vreinterpretq_s16_u32(col[k]);
+                    vst1q_f32(out, vcvtq_f32_s32(vmovl_s16(vget_low_s16(c16))));
+                    vst1q_f32(out + 4, vcvtq_f32_s32(vmovl_s16(vget_high_s16(c16))));
+                }
+            }
+        }
+    }
+
+    volk_16ic_deinterleave_xN_frames(outputVectors,
+                                     inputVector,
+                                     num_channels,
+                                     eighthPoints * 8 + quarterPoints * 4,
+                                     num_points);
+}
+
+#endif /* LV_HAVE_NEON */
+
+#endif /* INCLUDED_volk_16ic_deinterleave_32fc_xN_H */
@@ -0,0 +1,200 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2026 Free Software Foundation, Inc.
+ *
+ * This file is part of VOLK
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+/*!
+ * \page volk_32f_convert_16f
+ *
+ * \b Overview
+ *
+ * Converts floats to IEEE 754 half precision (binary16) values, rounding to
+ * nearest even. The half precision values are stored as their bit patterns
+ * in uint16_t. Magnitudes above 65504 become infinity, NaN stays NaN.
+ *
+ * <b>Dispatcher Prototype</b>
+ * \code
+ * void volk_32f_convert_16f(uint16_t* outputVector, const float* inputVector,
+ *                           unsigned int num_points)
+ * \endcode
+ *
+ * \b Inputs
+ * \li inputVector: the floats to convert.
+ * \li num_points: the number of values.
+ *
+ * \b Outputs
+ * \li outputVector: the half precision values.
+ *
+ * \b Example
+ * Store a ramp in half the space and read it back.
+ * \code
+ *   unsigned int N = 1000;
+ *   unsigned int alignment = volk_get_alignment();
+ *   float* in = (float*)volk_malloc(sizeof(float) * N, alignment);
+ *   uint16_t* half = (uint16_t*)volk_malloc(sizeof(uint16_t) * N, alignment);
+ *   float* out = (float*)volk_malloc(sizeof(float) * N, alignment);
+ *
+ *   for (unsigned int ii = 0; ii < N; ++ii) {
+ *       in[ii] = (float)ii / N;
+ *   }
+ *
+ *   volk_32f_convert_16f(half, in, N);
+ *   volk_16f_convert_32f(out, half, N); // out[ii] == in[ii] to 11 bits
+ *
+ *   volk_free(in);
+ *   volk_free(half);
+ *   volk_free(out);
+ * \endcode
+ */
+
+#ifndef INCLUDED_volk_32f_convert_16f_H
+#define INCLUDED_volk_32f_convert_16f_H
+
+#include <inttypes.h>
+#include <string.h>
+
+static inline uint16_t volk_32f_to_16f(float value)
+{
+    uint32_t bits, magnitude, mantissa, half, remainder, halfway;
+    unsigned int shift;
+    uint16_t sign;
+
+    memcpy(&bits, &value, sizeof(bits));
+    sign = (uint16_t)((bits >> 16) & 0x8000);
+    magnitude = bits & 0x7fffffff;
+
+    if (magnitude > 0x7f800000) {
+        // quiet NaN with the top payload bits
+        return sign | 0x7e00 | ((magnitude >> 13) & 0x3ff);
+    }
+    if (magnitude >= 0x477ff000) {
+        // 65520 and above round to infinity
+        return sign | 0x7c00;
+    }
+    if (magnitude >= 0x38800000) {
+        // normal: rebias the exponent, round the 13 dropped bits to even
+        magnitude -= 0x38000000;
+        magnitude += 0xfff + ((magnitude >> 13) & 1);
+        return sign | (uint16_t)(magnitude >> 13);
+    }
+    if (magnitude < 0x33000000) {
+        // below half of the smallest subnormal
+        return sign;
+    }
+
+    // subnormal: the value in units of 2^-24, rounded to even
+    mantissa = (magnitude & 0x7fffff) | 0x800000;
+    shift = 126 - (magnitude >> 23);
+    half = mantissa >> shift;
+    remainder = mantissa & ((1u << shift) - 1);
+    halfway = 1u << (shift - 1);
+    if (remainder > halfway || (remainder == halfway && (half & 1))) {
+        half++;
+    }
+    return sign | (uint16_t)half;
+}
+
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void volk_32f_convert_16f_generic(uint16_t* outputVector,
+                                                const float* inputVector,
+                                                unsigned int num_points)
+{
+    unsigned int number;
+
+    for (number = 0; number < num_points; number++) {
+        *outputVector++ = volk_32f_to_16f(*inputVector++);
+    }
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+
+#if LV_HAVE_AVX && LV_HAVE_F16C
+#include <immintrin.h>
+
+static inline void volk_32f_convert_16f_u_avx_f16c(uint16_t* outputVector,
+                                                   const float* inputVector,
+                                                   unsigned int num_points)
+{
+    const unsigned int sixteenthPoints = num_points / 16;
+    unsigned int number;
+
+    for (number = 0; number < sixteenthPoints; number++) {
+        _mm_storeu_si128(
+            (__m128i*)outputVector,
+            _mm256_cvtps_ph(_mm256_loadu_ps(inputVector), _MM_FROUND_TO_NEAREST_INT));
+        _mm_storeu_si128((__m128i*)(outputVector + 8),
+                         _mm256_cvtps_ph(_mm256_loadu_ps(inputVector + 8),
+                                         _MM_FROUND_TO_NEAREST_INT));
+        inputVector += 16;
+        outputVector += 16;
+    }
+
+    for (number = sixteenthPoints * 16; number < num_points; number++) {
+        *outputVector++ = volk_32f_to_16f(*inputVector++);
+    }
+}
+
+#endif /* LV_HAVE_AVX && LV_HAVE_F16C */
+
+
+#ifdef LV_HAVE_AVX512F
+#include <immintrin.h>
+
+static inline void volk_32f_convert_16f_u_avx512f(uint16_t* outputVector,
+                                                  const float* inputVector,
+                                                  unsigned int num_points)
+{
+    const unsigned int sixteenthPoints = num_points / 16;
+    unsigned int number;
+
+    for (number = 0; number < sixteenthPoints; number++) {
+        _mm256_storeu_si256(
+            (__m256i*)outputVector,
+            _mm512_cvtps_ph(_mm512_loadu_ps(inputVector),
+                            _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC));
+        inputVector += 16;
+        outputVector += 16;
+    }
+
+    for (number = sixteenthPoints * 16; number < num_points; number++) {
+        *outputVector++ = volk_32f_to_16f(*inputVector++);
+    }
+}
+
+#endif /* LV_HAVE_AVX512F */
+
+
+#ifdef LV_HAVE_NEONV8
+#include <arm_neon.h>
+
+static inline void volk_32f_convert_16f_neonv8(uint16_t* outputVector,
+                                               const float* inputVector,
+                                               unsigned int num_points)
+{
+    const unsigned int eighthPoints = num_points / 8;
+    float16x8_t half;
+    unsigned int number;
+
+    for (number = 0; number < eighthPoints; number++) {
+        half = vcvt_high_f16_f32(vcvt_f16_f32(vld1q_f32(inputVector)),
+                                 vld1q_f32(inputVector + 4));
+        vst1q_u16(outputVector, vreinterpretq_u16_f16(half));
+        inputVector += 8;
+        outputVector += 8;
+    }
+
+    for (number = eighthPoints * 8; number < num_points; number++) {
+        *outputVector++ = volk_32f_to_16f(*inputVector++);
+    }
+}
+
+#endif /* LV_HAVE_NEONV8 */
+
+#endif /* INCLUDED_volk_32f_convert_16f_H */
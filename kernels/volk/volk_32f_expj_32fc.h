@@ -0,0 +1,362 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2026 Free Software Foundation, Inc.
+ *
+ * This file is part of VOLK
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+/*!
+ * \page volk_32f_expj_32fc
+ *
+ * \b Overview
+ *
+ * Computes the complex exponential exp(j * phase) = cos(phase) + j * sin(phase)
+ * of every value in the input phase vector. Sine and cosine share one range
+ * reduction, the same way as in volk_32f_sincos_32f_x2.
+ *
+ * <b>Dispatcher Prototype</b>
+ * \code
+ * void volk_32f_expj_32fc(lv_32fc_t* outVector, const float* phaseVector,
+ *                         unsigned int num_points)
+ * \endcode
+ *
+ * \b Inputs
+ * \li phaseVector: The input vector of phases in radians.
+ * \li num_points: The number of data points.
+ *
+ * \b Outputs
+ * \li outVector: The unit magnitude complex output vector.
+ *
+ * \b Example
+ * Generate the steering phasors for a linear phase ramp.
+ * \code
+ *   int N = 10;
+ *   unsigned int alignment = volk_get_alignment();
+ *   float* phase = (float*)volk_malloc(sizeof(float)*N, alignment);
+ *   lv_32fc_t* out = (lv_32fc_t*)volk_malloc(sizeof(lv_32fc_t)*N, alignment);
+ *
+ *   for(unsigned int ii = 0; ii < N; ++ii){
+ *       phase[ii] = 0.3f * ii;
+ *   }
+ *
+ *   volk_32f_expj_32fc(out, phase, N);
+ *
+ *   for(unsigned int ii = 0; ii < N; ++ii){
+ *       printf("exp(j * %1.3f) = %+1.3f %+1.3fj\n",
+ *              phase[ii], lv_creal(out[ii]), lv_cimag(out[ii]));
+ *   }
+ *
+ *   volk_free(phase);
+ *   volk_free(out);
+ * \endcode
+ */
+
+#include <inttypes.h>
+#include <math.h>
+#include <stdio.h>
+#include <volk/volk_complex.h>
+
+#ifndef INCLUDED_volk_32f_expj_32fc_a_H
+#define INCLUDED_volk_32f_expj_32fc_a_H
+
+#ifdef LV_HAVE_AVX512F
+#include <immintrin.h>
+#include <volk/volk_avx512_intrinsics.h>
+
+static inline void volk_32f_expj_32fc_a_avx512f(lv_32fc_t* outVector,
+                                                const float* phaseVector,
+                                                unsigned int num_points)
+{
+    float* outPtr = (float*)outVector;
+    const float* phasePtr = phaseVector;
+
+    unsigned int number = 0;
+    const unsigned int sixteenthPoints = num_points / 16;
+
+    // gather the 128 bit lanes of the unpacked halves back into sample order
+    const __m512i idx_lo =
+        _mm512_setr_epi32(0, 1, 2, 3, 16, 17, 18, 19, 4, 5, 6, 7, 20, 21, 22, 23);
+    const __m512i idx_hi =
+        _mm512_setr_epi32(8, 9, 10, 11, 24, 25, 26, 27, 12, 13, 14, 15, 28, 29, 30, 31);
+
+    __m512 aVal, sine, cosine, lo, hi;
+    for (; number < sixteenthPoints; number++) {
+        aVal = _mm512_load_ps(phasePtr);
+        _mm512_sincos_ps_avx512f(aVal, &sine, &cosine);
+
+        lo = _mm512_unpacklo_ps(cosine, sine);
+        hi = _mm512_unpackhi_ps(cosine, sine);
+        _mm512_store_ps(outPtr, _mm512_permutex2var_ps(lo, idx_lo, hi));
+        _mm512_store_ps(outPtr + 16, _mm512_permutex2var_ps(lo, idx_hi, hi));
+
+        phasePtr += 16;
+        outPtr += 32;
+    }
+
+    number = sixteenthPoints * 16;
+    for (; number < num_points; number++) {
+        *outPtr++ = cosf(*phasePtr);
+        *outPtr++ = sinf(*phasePtr++);
+    }
+}
+
+#endif /* LV_HAVE_AVX512F for aligned */
+
+#ifdef LV_HAVE_AVX2
+#include <immintrin.h>
+#include <volk/volk_avx2_intrinsics.h>
+
+static inline void volk_32f_expj_32fc_a_avx2(lv_32fc_t* outVector,
+                                             const float* phaseVector,
+                                             unsigned int num_points)
+{
+    float* outPtr = (float*)outVector;
+    const float* phasePtr = phaseVector;
+
+    unsigned int number = 0;
+    const unsigned int eighthPoints = num_points / 8;
+
+    __m256 aVal, sine, cosine, lo, hi;
+    for (; number < eighthPoints; number++) {
+        aVal = _mm256_load_ps(phasePtr);
+        _mm256_sincos_ps_avx2(aVal, &sine, &cosine);
+
+        // c0 s0 c1 s1 | c4 s4 c5 s5 and c2 s2 c3 s3 | c6 s6 c7 s7
+        lo = _mm256_unpacklo_ps(cosine, sine);
+        hi = _mm256_unpackhi_ps(cosine, sine);
+        _mm256_store_ps(outPtr, _mm256_permute2f128_ps(lo, hi, 0x20));
+        _mm256_store_ps(outPtr + 8, _mm256_permute2f128_ps(lo, hi, 0x31));
+
+        phasePtr += 8;
+        outPtr += 16;
+    }
+
+    number = eighthPoints * 8;
+    for (; number < num_points; number++) {
+        *outPtr++ = cosf(*phasePtr);
+        *outPtr++ = sinf(*phasePtr++);
+    }
+}
+
+#endif /* LV_HAVE_AVX2 for aligned */
+
+#ifdef LV_HAVE_SSE4_1
+#include <smmintrin.h>
+#include <volk/volk_sse41_intrinsics.h>
+
+static inline void volk_32f_expj_32fc_a_sse4_1(lv_32fc_t* outVector,
+                                               const float* phaseVector,
+                                               unsigned int num_points)
+{
+    float* outPtr = (float*)outVector;
+    const float* phasePtr = phaseVector;
+
+    unsigned int number = 0;
+    const unsigned int quarterPoints = num_points / 4;
+
+    __m128 aVal, sine, cosine;
+    for (; number < quarterPoints; number++) {
+        aVal = _mm_load_ps(phasePtr);
+        _mm_sincos_ps_sse4_1(aVal, &sine, &cosine);
+
+        _mm_store_ps(outPtr, _mm_unpacklo_ps(cosine, sine));
+        _mm_store_ps(outPtr + 4, _mm_unpackhi_ps(cosine, sine));
+
+        phasePtr += 4;
+        outPtr += 8;
+    }
+
+    number = quarterPoints * 4;
+    for (; number < num_points; number++) {
+        *outPtr++ = cosf(*phasePtr);
+        *outPtr++ = sinf(*phasePtr++);
+    }
+}
+
+#endif /* LV_HAVE_SSE4_1 for aligned */
+
+#endif /* INCLUDED_volk_32f_expj_32fc_a_H */
+
+#ifndef INCLUDED_volk_32f_expj_32fc_u_H
+#define INCLUDED_volk_32f_expj_32fc_u_H
+
+#ifdef LV_HAVE_AVX512F
+#include <immintrin.h>
+#include <volk/volk_avx512_intrinsics.h>
+
+static inline void volk_32f_expj_32fc_u_avx512f(lv_32fc_t* outVector,
+                                                const float* phaseVector,
+                                                unsigned int num_points)
+{
+    float* outPtr = (float*)outVector;
+    const float* phasePtr = phaseVector;
+
+    unsigned int number = 0;
+    const unsigned int sixteenthPoints = num_points / 16;
+
+    // gather the 128 bit lanes of the unpacked halves back into sample order
+    const __m512i idx_lo =
+        _mm512_setr_epi32(0, 1, 2, 3, 16, 17, 18, 19, 4, 5, 6, 7, 20, 21, 22, 23);
+    const __m512i idx_hi =
+        _mm512_setr_epi32(8, 9, 10, 11, 24, 25, 26, 27, 12, 13, 14, 15, 28, 29, 30, 31);
+
+    __m512 aVal, sine, cosine, lo, hi;
+    for (; number < sixteenthPoints; number++) {
+        aVal = _mm512_loadu_ps(phasePtr);
+        _mm512_sincos_ps_avx512f(aVal, &sine, &cosine);
+
+        lo = _mm512_unpacklo_ps(cosine, sine);
+        hi = _mm512_unpackhi_ps(cosine, sine);
+        _mm512_storeu_ps(outPtr, _mm512_permutex2var_ps(lo, idx_lo, hi));
+        _mm512_storeu_ps(outPtr + 16, _mm512_permutex2var_ps(lo, idx_hi, hi));
+
+        phasePtr += 16;
+        outPtr += 32;
+    }
+
+    number = sixteenthPoints * 16;
+    for (; number < num_points; number++) {
+        *outPtr++ = cosf(*phasePtr);
+        *outPtr++ = sinf(*phasePtr++);
+    }
+}
+
+#endif /* LV_HAVE_AVX512F for unaligned */
+
+#ifdef LV_HAVE_AVX2
+#include <immintrin.h>
+#include <volk/volk_avx2_intrinsics.h>
+
+static inline void volk_32f_expj_32fc_u_avx2(lv_32fc_t* outVector,
+                                             const float* phaseVector,
+                                             unsigned int num_points)
+{
+    float* outPtr = (float*)outVector;
+    const float* phasePtr = phaseVector;
+
+    unsigned int number = 0;
+    const unsigned int eighthPoints = num_points / 8;
+
+    __m256 aVal, sine, cosine, lo, hi;
+    for (; number < eighthPoints; number++) {
+        aVal = _mm256_loadu_ps(phasePtr);
+        _mm256_sincos_ps_avx2(aVal, &sine, &cosine);
+
+        // c0 s0 c1 s1 | c4 s4 c5 s5 and c2 s2 c3 s3 | c6 s6 c7 s7
+        lo = _mm256_unpacklo_ps(cosine, sine);
+        hi = _mm256_unpackhi_ps(cosine, sine);
+        _mm256_storeu_ps(outPtr, _mm256_permute2f128_ps(lo, hi, 0x20));
+        _mm256_storeu_ps(outPtr + 8, _mm256_permute2f128_ps(lo, hi, 0x31));
+
+        phasePtr += 8;
+        outPtr += 16;
+    }
+
+    number = eighthPoints * 8;
+    for (; number < num_points; number++) {
+        *outPtr++ = cosf(*phasePtr);
+        *outPtr++ = sinf(*phasePtr++);
+    }
+}
+
+#endif /* LV_HAVE_AVX2 for unaligned */
+
+#ifdef LV_HAVE_SSE4_1
+#include <smmintrin.h>
+#include <volk/volk_sse41_intrinsics.h>
+
+static inline void volk_32f_expj_32fc_u_sse4_1(lv_32fc_t* outVector,
+                                               const float* phaseVector,
+                                               unsigned int num_points)
+{
+    float* outPtr = (float*)outVector;
+    const float* phasePtr = phaseVector;
+
+    unsigned int number = 0;
+    const unsigned int quarterPoints = num_points / 4;
+
+    __m128 aVal, sine, cosine;
+    for (; number < quarterPoints; number++) {
+        aVal = _mm_loadu_ps(phasePtr);
+        _mm_sincos_ps_sse4_1(aVal, &sine, &cosine);
+
+        _mm_storeu_ps(outPtr, _mm_unpacklo_ps(cosine, sine));
+        _mm_storeu_ps(outPtr + 4, _mm_unpackhi_ps(cosine, sine));
+
+        phasePtr += 4;
+        outPtr += 8;
+    }
+
+    number = quarterPoints * 4;
+    for (; number < num_points; number++) {
+        *outPtr++ = cosf(*phasePtr);
+        *outPtr++ = sinf(*phasePtr++);
+    }
+}
+
+#endif /* LV_HAVE_SSE4_1 for unaligned */
+
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void volk_32f_expj_32fc_generic(lv_32fc_t* outVector,
+                                              const float* phaseVector,
+                                              unsigned int num_points)
+{
+    lv_32fc_t* outPtr = outVector;
+    const float* phasePtr = phaseVector;
+    unsigned int number = 0;
+
+    for (number = 0; number < num_points; number++) {
+        *outPtr++ = lv_cmake(cosf(*phasePtr), sinf(*phasePtr));
+        phasePtr++;
+    }
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+
+#ifdef LV_HAVE_NEON
+#include <arm_neon.h>
+#include <volk/volk_neon_intrinsics.h>
+
+static inline void volk_32f_expj_32fc_neon(lv_32fc_t* outVector,
+                                           const float* phaseVector,
+                                           unsigned int num_points)
+{
+    unsigned int number = 0;
+    const unsigned int quarter_points = num_points / 4;
+    float* outVectorPtr = (float*)outVector;
+    const float* phaseVectorPtr = phaseVector;
+
+    float32x4_t a_vec;
+    float32x4x2_t sincos_vec;
+    float32x4x2_t out_vec;
+
+    for (number = 0; number < quarter_points; number++) {
+        a_vec = vld1q_f32(phaseVectorPtr);
+        // Prefetch next one, speeds things up
+        __VOLK_PREFETCH(phaseVectorPtr + 4);
+        sincos_vec = _vsincosq_f32(a_vec);
+        // interleave as real (cosine) and imaginary (sine) parts
+        out_vec.val[0] = sincos_vec.val[1];
+        out_vec.val[1] = sincos_vec.val[0];
+        vst2q_f32(outVectorPtr, out_vec);
+        // move pointers ahead
+        outVectorPtr += 8;
+        phaseVectorPtr += 4;
+    }
+
+    // Deal with the rest
+    for (number = quarter_points * 4; number < num_points; number++) {
+        *outVectorPtr++ = cosf(*phaseVectorPtr);
+        *outVectorPtr++ = sinf(*phaseVectorPtr++);
+    }
+}
+
+#endif /* LV_HAVE_NEON */
+
+
+#endif /* INCLUDED_volk_32f_expj_32fc_u_H */
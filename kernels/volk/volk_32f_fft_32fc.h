@@ -0,0 +1,173 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2026 Free Software Foundation, Inc.
+ *
+ * This file is part of VOLK
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+/*!
+ * \page volk_32f_fft_32fc
+ *
+ * \b Overview
+ *
+ * Computes the discrete Fourier transform of a real vector whose length is a
+ * power of two. Only the num_points / 2 + 1 non negative frequency bins are
+ * written, the others are their complex conjugates.
+ *
+ * The even and odd samples are transformed as the real and imaginary part of
+ * one num_points / 2 complex FFT (see volk_32fc_fft_32fc), which is then split
+ * into the spectrum of the real input.
+ *
+ * The plan is the same as for a complex FFT of num_points, made by
+ * volk_32fc_fft_make_plan(plan, num_points, inverse).
+ *
+ * <b>Dispatcher Prototype</b>
+ * \code
+ * void volk_32f_fft_32fc(lv_32fc_t* outVector, const float* inVector,
+ *                        const lv_32fc_t* plan, unsigned int num_points)
+ * \endcode
+ *
+ * \b Inputs
+ * \li inVector: the num_points real input samples.
+ * \li plan: the plan made by volk_32fc_fft_make_plan for num_points.
+ * \li num_points: the FFT size, a power of two and at least 16.
+ *
+ * \b Outputs
+ * \li outVector: the frequency bins 0 ... num_points / 2. Must not overlap
+ * with inVector.
+ *
+ * \b Example
+ * \code
+ *   unsigned int N = 1024;
+ *   unsigned int alignment = volk_get_alignment();
+ *   float* in = (float*)volk_malloc(sizeof(float) * N, alignment);
+ *   lv_32fc_t* out = (lv_32fc_t*)volk_malloc(sizeof(lv_32fc_t) * (N / 2 + 1), alignment);
+ *   lv_32fc_t* plan = (lv_32fc_t*)volk_malloc(sizeof(lv_32fc_t) * N, alignment);
+ *
+ *   volk_32fc_fft_make_plan(plan, N, 0);
+ *
+ *   for (unsigned int ii = 0; ii < N; ++ii) {
+ *       in[ii] = cosf(2.f * M_PI * 5.f * ii / N);
+ *   }
+ *
+ *   volk_32f_fft_32fc(out, in, plan, N); // out[5] == N / 2
+ *
+ *   volk_free(in);
+ *   volk_free(out);
+ *   volk_free(plan);
+ * \endcode
+ */
+
+#ifndef INCLUDED_volk_32f_fft_32fc_u_H
+#define INCLUDED_volk_32f_fft_32fc_u_H
+
+#include <volk/volk_32fc_fft_32fc.h>
+#include <volk/volk_complex.h>
+
+/*
+ * Turn the num_points / 2 complex FFT Z of the packed real input into the
+ * spectrum X of the real input, in place:
+ * X[k] = E[k] + W^k * O[k], with E[k] = (Z[k] + conj(Z[N/2 - k])) / 2 and
+ * O[k] = -i * (Z[k] - conj(Z[N/2 - k])) / 2, W^k = plan[N/2 + k].
+ */
+static inline void volk_32f_fft_split_real(lv_32fc_t* outVector,
+                                           const lv_32fc_t* plan,
+                                           unsigned int num_points)
+{
+    const unsigned int half = num_points / 2;
+    const lv_32fc_t z0 = outVector[0];
+    unsigned int k;
+    lv_32fc_t zk, zc, e, o, t;
+
+    outVector[0] = lv_cmake(lv_creal(z0) + lv_cimag(z0), 0.f);
+    outVector[half] = lv_cmake(lv_creal(z0) - lv_cimag(z0), 0.f);
+
+    // X[N/2 - k] = conj(E[k] - W^k * O[k])
+    for (k = 1; k <= half / 2; k++) {
+        zk = outVector[k];
+        zc = lv_conj(outVector[half - k]);
+        e = (zk + zc) * 0.5f;
+        o = (zk - zc) * lv_cmake(0.f, -0.5f);
+        t = o * plan[half + k];
+        outVector[k] = e + t;
+        outVector[half - k] = lv_conj(e - t);
+    }
+}
+
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void volk_32f_fft_32fc_generic(lv_32fc_t* outVector,
+                                             const float* inVector,
+                                             const lv_32fc_t* plan,
+                                             unsigned int num_points)
+{
+    volk_32fc_fft_32fc_generic(
+        outVector, (const lv_32fc_t*)inVector, plan, num_points / 2);
+    volk_32f_fft_split_real(outVector, plan, num_points);
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+
+#ifdef LV_HAVE_SSE3
+
+static inline void volk_32f_fft_32fc_u_sse3(lv_32fc_t* outVector,
+                                            const float* inVector,
+                                            const lv_32fc_t* plan,
+                                            unsigned int num_points)
+{
+    volk_32fc_fft_32fc_u_sse3(
+        outVector, (const lv_32fc_t*)inVector, plan, num_points / 2);
+    volk_32f_fft_split_real(outVector, plan, num_points);
+}
+
+#endif /* LV_HAVE_SSE3 */
+
+
+#if LV_HAVE_AVX2 && LV_HAVE_FMA
+
+static inline void volk_32f_fft_32fc_u_avx2_fma(lv_32fc_t* outVector,
+                                                const float* inVector,
+                                                const lv_32fc_t* plan,
+                                                unsigned int num_points)
+{
+    volk_32fc_fft_32fc_u_avx2_fma(
+        outVector, (const lv_32fc_t*)inVector, plan, num_points / 2);
+    volk_32f_fft_split_real(outVector, plan, num_points);
+}
+
+#endif /* LV_HAVE_AVX2 && LV_HAVE_FMA */
+
+
+#ifdef LV_HAVE_AVX512F
+
+static inline void volk_32f_fft_32fc_u_avx512f(lv_32fc_t* outVector,
+                                               const float* inVector,
+                                               const lv_32fc_t* plan,
+                                               unsigned int num_points)
+{
+    volk_32fc_fft_32fc_u_avx512f(
+        outVector, (const lv_32fc_t*)inVector, plan, num_points / 2);
+    volk_32f_fft_split_real(outVector, plan, num_points);
+}
+
+#endif /* LV_HAVE_AVX512F */
+
+
+#ifdef LV_HAVE_NEON
+
+static inline void volk_32f_fft_32fc_neon(lv_32fc_t* outVector,
+                                          const float* inVector,
+                                          const lv_32fc_t* plan,
+                                          unsigned int num_points)
+{
+    volk_32fc_fft_32fc_neon(outVector, (const lv_32fc_t*)inVector, plan, num_points / 2);
+    volk_32f_fft_split_real(outVector, plan, num_points);
+}
+
+#endif /* LV_HAVE_NEON */
+
+#endif /* INCLUDED_volk_32f_fft_32fc_u_H */
@@ -0,0 +1,100 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2026 Free Software Foundation, Inc.
+ *
+ * This file is part of VOLK
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+/* For documentation see 'kernels/volk/volk_32f_fft_32fc.h'
+ * This file exists for test purposes only. Should not be used directly.
+ */
+
+#ifndef INCLUDED_volk_32f_fftpuppet_32fc_H
+#define INCLUDED_volk_32f_fftpuppet_32fc_H
+
+#include <volk/volk.h>
+#include <volk/volk_32f_fft_32fc.h>
+
+#define REAL_FFT_PUPPET_SIZE 2048
+
+/*
+ * Run back to back real FFTs of REAL_FFT_PUPPET_SIZE points over the input,
+ * the spectra are written one after the other.
+ */
+static inline void volk_32f_fftpuppet_run(
+    lv_32fc_t* outVector,
+    const float* inVector,
+    unsigned int num_points,
+    void (*fft)(lv_32fc_t*, const float*, const lv_32fc_t*, unsigned int))
+{
+    lv_32fc_t* plan = (lv_32fc_t*)volk_malloc(sizeof(lv_32fc_t) * REAL_FFT_PUPPET_SIZE,
+                                              volk_get_alignment());
+    unsigned int n;
+
+    volk_32fc_fft_make_plan(plan, REAL_FFT_PUPPET_SIZE, 0);
+    for (n = 0; n + REAL_FFT_PUPPET_SIZE <= num_points; n += REAL_FFT_PUPPET_SIZE) {
+        fft(outVector, inVector + n, plan, REAL_FFT_PUPPET_SIZE);
+        outVector += REAL_FFT_PUPPET_SIZE / 2 + 1;
+    }
+
+    volk_free(plan);
+}
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void volk_32f_fftpuppet_32fc_generic(lv_32fc_t* outVector,
+                                                   const float* inVector,
+                                                   unsigned int num_points)
+{
+    volk_32f_fftpuppet_run(outVector, inVector, num_points, volk_32f_fft_32fc_generic);
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+#ifdef LV_HAVE_SSE3
+
+static inline void volk_32f_fftpuppet_32fc_u_sse3(lv_32fc_t* outVector,
+                                                  const float* inVector,
+                                                  unsigned int num_points)
+{
+    volk_32f_fftpuppet_run(outVector, inVector, num_points, volk_32f_fft_32fc_u_sse3);
+}
+
+#endif /* LV_HAVE_SSE3 */
+
+#if LV_HAVE_AVX2 && LV_HAVE_FMA
+
+static inline void volk_32f_fftpuppet_32fc_u_avx2_fma(lv_32fc_t* outVector,
+                                                      const float* inVector,
+                                                      unsigned int num_points)
+{
+    volk_32f_fftpuppet_run(outVector, inVector, num_points, volk_32f_fft_32fc_u_avx2_fma);
+}
+
+#endif /* LV_HAVE_AVX2 && LV_HAVE_FMA */
+
+#ifdef LV_HAVE_AVX512F
+
+static inline void volk_32f_fftpuppet_32fc_u_avx512f(lv_32fc_t* outVector,
+                                                     const float* inVector,
+                                                     unsigned int num_points)
+{
+    volk_32f_fftpuppet_run(outVector, inVector, num_points, volk_32f_fft_32fc_u_avx512f);
+}
+
+#endif /* LV_HAVE_AVX512F */
+
+#ifdef LV_HAVE_NEON
+
+static inline void volk_32f_fftpuppet_32fc_neon(lv_32fc_t* outVector,
+                                                const float* inVector,
+                                                unsigned int num_points)
+{
+    volk_32f_fftpuppet_run(outVector, inVector, num_points, volk_32f_fft_32fc_neon);
+}
+
+#endif /* LV_HAVE_NEON */
+
+#endif /* INCLUDED_volk_32f_fftpuppet_32fc_H */
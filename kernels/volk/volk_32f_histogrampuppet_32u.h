@@ -0,0 +1,86 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2026 Free Software Foundation, Inc.
+ *
+ * This file is part of VOLK
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+/* For documentation see 'kernels/volk/volk_32f_s32f_x2_histogram_32u.h'
+ * This file exists for test purposes only. Should not be used directly.
+ *
+ * Computes a 257 bin histogram that clips the input, followed by a 5000 bin
+ * histogram that is too large for sub-histograms. The bins go to a separate
+ * buffer and bin ii is added to output[ii % num_points], so that vectors
+ * shorter than the bins are fine.
+ */
+
+#ifndef INCLUDED_volk_32f_histogrampuppet_32u_H
+#define INCLUDED_volk_32f_histogrampuppet_32u_H
+
+#include <string.h>
+#include <volk/volk.h>
+#include <volk/volk_32f_s32f_x2_histogram_32u.h>
+
+typedef void (*volk_32f_histogram_kernel)(
+    uint32_t*, const float*, const float, const float, unsigned int, unsigned int);
+
+static inline void volk_32f_histogrampuppet_32u_run(volk_32f_histogram_kernel kernel,
+                                                    uint32_t* output,
+                                                    const float* inputBuffer,
+                                                    unsigned int num_points)
+{
+    uint32_t* histogram =
+        (uint32_t*)volk_malloc((257 + 5000) * sizeof(uint32_t), volk_get_alignment());
+    unsigned int ii;
+
+    kernel(histogram, inputBuffer, -0.75f, 0.5f, 257, num_points);
+    kernel(histogram + 257, inputBuffer, -1.f, 1.f, 5000, num_points);
+    memset(output, 0, num_points * sizeof(uint32_t));
+    for (ii = 0; ii < 257 + 5000; ii++) {
+        output[ii % num_points] += histogram[ii];
+    }
+    volk_free(histogram);
+}
+
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void volk_32f_histogrampuppet_32u_generic(uint32_t* output,
+                                                        const float* inputBuffer,
+                                                        unsigned int num_points)
+{
+    volk_32f_histogrampuppet_32u_run(
+        volk_32f_s32f_x2_histogram_32u_generic, output, inputBuffer, num_points);
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+
+#ifdef LV_HAVE_AVX2
+
+static inline void volk_32f_histogrampuppet_32u_u_avx2(uint32_t* output,
+                                                       const float* inputBuffer,
+                                                       unsigned int num_points)
+{
+    volk_32f_histogrampuppet_32u_run(
+        volk_32f_s32f_x2_histogram_32u_u_avx2, output, inputBuffer, num_points);
+}
+
+#endif /* LV_HAVE_AVX2 */
+
+
+#ifdef LV_HAVE_NEON
+
+static inline void volk_32f_histogrampuppet_32u_neon(uint32_t* output,
+                                                     const float* inputBuffer,
+                                                     unsigned int num_points)
+{
+    volk_32f_histogrampuppet_32u_run(
+        volk_32f_s32f_x2_histogram_32u_neon, output, inputBuffer, num_points);
+}
+
+#endif /* LV_HAVE_NEON */
+
+#endif /* INCLUDED_volk_32f_histogrampuppet_32u_H */
@@ -0,0 +1,83 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2026 Free Software Foundation, Inc.
+ *
+ * This file is part of VOLK
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+/* For documentation see 'kernels/volk/volk_32f_s32f_index_above_32u.h'
+ * This file exists for test purposes only. Should not be used directly.
+ *
+ * Writes the number of indices followed by the indices. The unused part of the
+ * output that the SIMD implementations may overwrite is cleared.
+ */
+
+#ifndef INCLUDED_volk_32f_index_abovepuppet_32u_H
+#define INCLUDED_volk_32f_index_abovepuppet_32u_H
+
+#include <string.h>
+#include <volk/volk_32f_s32f_index_above_32u.h>
+
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void volk_32f_index_abovepuppet_32u_generic(uint32_t* result,
+                                                          const float* inputBuffer,
+                                                          unsigned int num_points)
+{
+    uint32_t* indices = result + 1;
+    volk_32f_s32f_index_above_32u_generic(
+        indices, result, inputBuffer, 0.5f, num_points - 1);
+    memset(indices + *result, 0, (num_points - 1 - *result) * sizeof(uint32_t));
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+
+#ifdef LV_HAVE_AVX2
+
+static inline void volk_32f_index_abovepuppet_32u_u_avx2(uint32_t* result,
+                                                         const float* inputBuffer,
+                                                         unsigned int num_points)
+{
+    uint32_t* indices = result + 1;
+    volk_32f_s32f_index_above_32u_u_avx2(
+        indices, result, inputBuffer, 0.5f, num_points - 1);
+    memset(indices + *result, 0, (num_points - 1 - *result) * sizeof(uint32_t));
+}
+
+#endif /* LV_HAVE_AVX2 */
+
+
+#ifdef LV_HAVE_AVX512F
+
+static inline void volk_32f_index_abovepuppet_32u_u_avx512f(uint32_t* result,
+                                                            const float* inputBuffer,
+                                                            unsigned int num_points)
+{
+    uint32_t* indices = result + 1;
+    volk_32f_s32f_index_above_32u_u_avx512f(
+        indices, result, inputBuffer, 0.5f, num_points - 1);
+    memset(indices + *result, 0, (num_points - 1 - *result) * sizeof(uint32_t));
+}
+
+#endif /* LV_HAVE_AVX512F */
+
+
+#ifdef LV_HAVE_NEON
+
+static inline void volk_32f_index_abovepuppet_32u_neon(uint32_t* result,
+                                                       const float* inputBuffer,
+                                                       unsigned int num_points)
+{
+    uint32_t* indices = result + 1;
+    volk_32f_s32f_index_above_32u_neon(
+        indices, result, inputBuffer, 0.5f, num_points - 1);
+    memset(indices + *result, 0, (num_points - 1 - *result) * sizeof(uint32_t));
+}
+
+#endif /* LV_HAVE_NEON */
+
+#endif /* INCLUDED_volk_32f_index_abovepuppet_32u_H */
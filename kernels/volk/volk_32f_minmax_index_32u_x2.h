@@ -0,0 +1,285 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2026 Free Software Foundation, Inc.
+ *
+ * This file is part of VOLK
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+/*!
+ * \page volk_32f_minmax_index_32u_x2
+ *
+ * \b Overview
+ *
+ * Finds the indices of the minimum and the maximum of a vector in a single
+ * pass. Like volk_32f_index_min_32u and volk_32f_index_max_32u, the first
+ * occurrence is returned if a value occurs several times.
+ *
+ * <b>Dispatcher Prototype</b>
+ * \code
+ * void volk_32f_minmax_index_32u_x2(uint32_t* minIndex, uint32_t* maxIndex,
+ *                                   const float* src0, uint32_t num_points)
+ * \endcode
+ *
+ * \b Inputs
+ * \li src0: the input vector. Must not contain NaN.
+ * \li num_points: the number of elements in the input vector.
+ *
+ * \b Outputs
+ * \li minIndex: the index of the minimum. Not written if num_points is 0.
+ * \li maxIndex: the index of the maximum. Not written if num_points is 0.
+ *
+ * \b Example
+ * \code
+ *   unsigned int N = 10;
+ *   unsigned int alignment = volk_get_alignment();
+ *   float* in = (float*)volk_malloc(sizeof(float) * N, alignment);
+ *   uint32_t minIndex, maxIndex;
+ *
+ *   for (unsigned int ii = 0; ii < N; ++ii) {
+ *       in[ii] = (ii - 3.f) * (ii - 3.f);
+ *   }
+ *
+ *   volk_32f_minmax_index_32u_x2(&minIndex, &maxIndex, in, N);
+ *   // minIndex == 3, maxIndex == 9
+ *
+ *   volk_free(in);
+ * \endcode
+ */
+
+#ifndef INCLUDED_volk_32f_minmax_index_32u_x2_u_H
+#define INCLUDED_volk_32f_minmax_index_32u_x2_u_H
+
+#include <inttypes.h>
+#include <volk/volk_common.h>
+
+/* Running minimum and maximum with the index of their first occurrence */
+typedef struct volk_32f_minmax_state {
+    float min;
+    float max;
+    uint32_t minIndex;
+    uint32_t maxIndex;
+} volk_32f_minmax_state_t;
+
+/* Reduce the lanes of a SIMD pass. Lane l of the block iters[l] holds the
+ * element iters[l] * lanes + l. */
+static inline void volk_32f_minmax_reduce_lanes(volk_32f_minmax_state_t* state,
+                                                const float* minLanes,
+                                                const float* maxLanes,
+                                                const uint32_t* minIters,
+                                                const uint32_t* maxIters,
+                                                unsigned int lanes)
+{
+    unsigned int lane;
+    uint32_t index;
+
+    state->min = minLanes[0];
+    state->max = maxLanes[0];
+    state->minIndex = minIters[0] * lanes;
+    state->maxIndex = maxIters[0] * lanes;
+    for (lane = 1; lane < lanes; lane++) {
+        index = minIters[lane] * lanes + lane;
+        if (minLanes[lane] < state->min ||
+            (minLanes[lane] == state->min && index < state->minIndex)) {
+            state->min = minLanes[lane];
+            state->minIndex = index;
+        }
+        index = maxIters[lane] * lanes + lane;
+        if (maxLanes[lane] > state->max ||
+            (maxLanes[lane] == state->max && index < state->maxIndex)) {
+            state->max = maxLanes[lane];
+            state->maxIndex = index;
+        }
+    }
+}
+
+static inline void volk_32f_minmax_update(volk_32f_minmax_state_t* state,
+                                          const float* src0,
+                                          uint32_t start,
+                                          uint32_t num_points)
+{
+    uint32_t number;
+    for (number = start; number < num_points; number++) {
+        if (src0[number] < state->min) {
+            state->min = src0[number];
+            state->minIndex = number;
+        }
+        if (src0[number] > state->max) {
+            state->max = src0[number];
+            state->maxIndex = number;
+        }
+    }
+}
+
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void volk_32f_minmax_index_32u_x2_generic(uint32_t* minIndex,
+                                                        uint32_t* maxIndex,
+                                                        const float* src0,
+                                                        uint32_t num_points)
+{
+    volk_32f_minmax_state_t state;
+
+    if (num_points == 0) {
+        return;
+    }
+    state.min = state.max = src0[0];
+    state.minIndex = state.maxIndex = 0;
+    volk_32f_minmax_update(&state, src0, 1, num_points);
+    *minIndex = state.minIndex;
+    *maxIndex = state.maxIndex;
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+
+#ifdef LV_HAVE_AVX
+#include <immintrin.h>
+
+static inline void volk_32f_minmax_index_32u_x2_u_avx(uint32_t* minIndex,
+                                                      uint32_t* maxIndex,
+                                                      const float* src0,
+                                                      uint32_t num_points)
+{
+    __VOLK_ATTR_ALIGNED(32) float minLanes[8];
+    __VOLK_ATTR_ALIGNED(32) float maxLanes[8];
+    __VOLK_ATTR_ALIGNED(32) uint32_t minIters[8];
+    __VOLK_ATTR_ALIGNED(32) uint32_t maxIters[8];
+    const uint32_t eighthPoints = num_points / 8;
+    volk_32f_minmax_state_t state;
+    __m256 vMin, vMax, minIter, maxIter, values, iter, less, greater;
+    uint32_t number;
+
+    if (num_points < 8) {
+        volk_32f_minmax_index_32u_x2_generic(minIndex, maxIndex, src0, num_points);
+        return;
+    }
+
+    vMin = vMax = _mm256_loadu_ps(src0);
+    minIter = maxIter = _mm256_setzero_ps();
+    for (number = 1; number < eighthPoints; number++) {
+        values = _mm256_loadu_ps(src0 + 8 * number);
+        // the block number is only blended, so it can stay in a float register
+        iter = _mm256_castsi256_ps(_mm256_set1_epi32(number));
+        less = _mm256_cmp_ps(values, vMin, _CMP_LT_OQ);
+        greater = _mm256_cmp_ps(values, vMax, _CMP_GT_OQ);
+        vMin = _mm256_blendv_ps(vMin, values, less);
+        vMax = _mm256_blendv_ps(vMax, values, greater);
+        minIter = _mm256_blendv_ps(minIter, iter, less);
+        maxIter = _mm256_blendv_ps(maxIter, iter, greater);
+    }
+    _mm256_store_ps(minLanes, vMin);
+    _mm256_store_ps(maxLanes, vMax);
+    _mm256_store_ps((float*)minIters, minIter);
+    _mm256_store_ps((float*)maxIters, maxIter);
+
+    volk_32f_minmax_reduce_lanes(&state, minLanes, maxLanes, minIters, maxIters, 8);
+    volk_32f_minmax_update(&state, src0, eighthPoints * 8, num_points);
+    *minIndex = state.minIndex;
+    *maxIndex = state.maxIndex;
+}
+
+#endif /* LV_HAVE_AVX */
+
+
+#ifdef LV_HAVE_AVX512F
+#include <immintrin.h>
+
+static inline void volk_32f_minmax_index_32u_x2_u_avx512f(uint32_t* minIndex,
+                                                          uint32_t* maxIndex,
+                                                          const float* src0,
+                                                          uint32_t num_points)
+{
+    __VOLK_ATTR_ALIGNED(64) float minLanes[16];
+    __VOLK_ATTR_ALIGNED(64) float maxLanes[16];
+    __VOLK_ATTR_ALIGNED(64) uint32_t minIters[16];
+    __VOLK_ATTR_ALIGNED(64) uint32_t maxIters[16];
+    const uint32_t sixteenthPoints = num_points / 16;
+    volk_32f_minmax_state_t state;
+    __m512 vMin, vMax, values;
+    __m512i minIter, maxIter, iter;
+    __mmask16 less, greater;
+    uint32_t number;
+
+    if (num_points < 16) {
+        volk_32f_minmax_index_32u_x2_generic(minIndex, maxIndex, src0, num_points);
+        return;
+    }
+
+    vMin = vMax = _mm512_loadu_ps(src0);
+    minIter = maxIter = _mm512_setzero_si512();
+    for (number = 1; number < sixteenthPoints; number++) {
+        values = _mm512_loadu_ps(src0 + 16 * number);
+        iter = _mm512_set1_epi32(number);
+        less = _mm512_cmp_ps_mask(values, vMin, _CMP_LT_OQ);
+        greater = _mm512_cmp_ps_mask(values, vMax, _CMP_GT_OQ);
+        vMin = _mm512_mask_mov_ps(vMin, less, values);
+        vMax = _mm512_mask_mov_ps(vMax, greater, values);
+        minIter = _mm512_mask_mov_epi32(minIter, less, iter);
+        maxIter = _mm512_mask_mov_epi32(maxIter, greater, iter);
+    }
+    _mm512_store_ps(minLanes, vMin);
+    _mm512_store_ps(maxLanes, vMax);
+    _mm512_store_si512(minIters, minIter);
+    _mm512_store_si512(maxIters, maxIter);
+
+    volk_32f_minmax_reduce_lanes(&state, minLanes, maxLanes, minIters, maxIters, 16);
+    volk_32f_minmax_update(&state, src0, sixteenthPoints * 16, num_points);
+    *minIndex = state.minIndex;
+    *maxIndex = state.maxIndex;
+}
+
+#endif /* LV_HAVE_AVX512F */
+
+
+#ifdef LV_HAVE_NEON
+#include <arm_neon.h>
+
+static inline void volk_32f_minmax_index_32u_x2_neon(uint32_t* minIndex,
+                                                     uint32_t* maxIndex,
+                                                     const float* src0,
+                                                     uint32_t num_points)
+{
+    float minLanes[4];
+    float maxLanes[4];
+    uint32_t minIters[4];
+    uint32_t maxIters[4];
+    const uint32_t quarterPoints = num_points / 4;
+    volk_32f_minmax_state_t state;
+    float32x4_t vMin, vMax, values;
+    uint32x4_t minIter, maxIter, iter, less, greater;
+    uint32_t number;
+
+    if (num_points < 4) {
+        volk_32f_minmax_index_32u_x2_generic(minIndex, maxIndex, src0, num_points);
+        return;
+    }
+
+    vMin = vMax = vld1q_f32(src0);
+    minIter = maxIter = vdupq_n_u32(0);
+    for (number = 1; number < quarterPoints; number++) {
+        values = vld1q_f32(src0 + 4 * number);
+        iter = vdupq_n_u32(number);
+        less = vcltq_f32(values, vMin);
+        greater = vcgtq_f32(values, vMax);
+        vMin = vbslq_f32(less, values, vMin);
+        vMax = vbslq_f32(greater, values, vMax);
+        minIter = vbslq_u32(less, iter, minIter);
+        maxIter = vbslq_u32(greater, iter, maxIter);
+    }
+    vst1q_f32(minLanes, vMin);
+    vst1q_f32(maxLanes, vMax);
+    vst1q_u32(minIters, minIter);
+    vst1q_u32(maxIters, maxIter);
+
+    volk_32f_minmax_reduce_lanes(&state, minLanes, maxLanes, minIters, maxIters, 4);
+    volk_32f_minmax_update(&state, src0, quarterPoints * 4, num_points);
+    *minIndex = state.minIndex;
+    *maxIndex = state.maxIndex;
+}
+
+#endif /* LV_HAVE_NEON */
+
+#endif /* INCLUDED_volk_32f_minmax_index_32u_x2_u_H */
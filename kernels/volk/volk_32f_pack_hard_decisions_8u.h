@@ -0,0 +1,217 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2026 Free Software Foundation, Inc.
+ *
+ * This file is part of VOLK
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+/*!
+ * \page volk_32f_pack_hard_decisions_8u
+ *
+ * \b Overview
+ *
+ * Takes hard decisions on soft bits and packs them into bytes. A soft bit
+ * with its sign bit set, i.e. a negative value, gives a one bit, which is the
+ * convention of log-likelihood ratios where positive values favour zero. The
+ * bits are packed as in volk_8u_pack_bits_8u.
+ *
+ * <b>Dispatcher Prototype</b>
+ * \code
+ * void volk_32f_pack_hard_decisions_8u(uint8_t* bytes, const float* softBits,
+ *                                      const unsigned int msbFirst,
+ *                                      unsigned int num_points)
+ * \endcode
+ *
+ * \b Inputs
+ * \li softBits: the soft bits or LLRs.
+ * \li msbFirst: non-zero to fill the bytes from the most significant bit.
+ * \li num_points: the number of soft bits.
+ *
+ * \b Outputs
+ * \li bytes: (num_points + 7) / 8 packed bytes.
+ *
+ * \b Example
+ * \code
+ *   unsigned int N = 8;
+ *   unsigned int alignment = volk_get_alignment();
+ *   float* soft = (float*)volk_malloc(sizeof(float) * N, alignment);
+ *   uint8_t* bytes = (uint8_t*)volk_malloc(sizeof(uint8_t), alignment);
+ *
+ *   for (unsigned int ii = 0; ii < N; ++ii) {
+ *       soft[ii] = (ii < 2) ? -1.5f : 0.5f;
+ *   }
+ *
+ *   volk_32f_pack_hard_decisions_8u(bytes, soft, 1, N); // bytes[0] == 0xc0
+ *
+ *   volk_free(soft);
+ *   volk_free(bytes);
+ * \endcode
+ */
+
+#ifndef INCLUDED_volk_32f_pack_hard_decisions_8u_u_H
+#define INCLUDED_volk_32f_pack_hard_decisions_8u_u_H
+
+#include <inttypes.h>
+#include <math.h>
+#include <string.h>
+#include <volk/volk_8u_pack_bits_8u.h>
+
+static inline void volk_32f_pack_hard_decisions_scalar(uint8_t* bytes,
+                                                       const float* softBits,
+                                                       unsigned int msbFirst,
+                                                       unsigned int count)
+{
+    uint8_t bits[8];
+    unsigned int bit, number;
+
+    for (number = 0; number < count; number += 8) {
+        for (bit = 0; bit < 8 && number + bit < count; bit++) {
+            bits[bit] = signbit(softBits[number + bit]) != 0;
+        }
+        *bytes++ = volk_8u_pack_bits_byte(bits, msbFirst, bit);
+    }
+}
+
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void volk_32f_pack_hard_decisions_8u_generic(uint8_t* bytes,
+                                                           const float* softBits,
+                                                           const unsigned int msbFirst,
+                                                           unsigned int num_points)
+{
+    volk_32f_pack_hard_decisions_scalar(bytes, softBits, msbFirst, num_points);
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+
+#ifdef LV_HAVE_SSE
+#include <xmmintrin.h>
+
+static inline void volk_32f_pack_hard_decisions_8u_u_sse(uint8_t* bytes,
+                                                         const float* softBits,
+                                                         const unsigned int msbFirst,
+                                                         unsigned int num_points)
+{
+    const unsigned int sixteenthPoints = num_points / 16;
+    uint32_t mask;
+    unsigned int number;
+
+    for (number = 0; number < sixteenthPoints; number++) {
+        mask = _mm_movemask_ps(_mm_loadu_ps(softBits)) |
+               _mm_movemask_ps(_mm_loadu_ps(softBits + 4)) << 4 |
+               _mm_movemask_ps(_mm_loadu_ps(softBits + 8)) << 8 |
+               _mm_movemask_ps(_mm_loadu_ps(softBits + 12)) << 12;
+        mask = msbFirst ? volk_8u_pack_bits_reverse(mask) : mask;
+        bytes[0] = (uint8_t)mask;
+        bytes[1] = (uint8_t)(mask >> 8);
+        softBits += 16;
+        bytes += 2;
+    }
+
+    volk_32f_pack_hard_decisions_scalar(
+        bytes, softBits, msbFirst, num_points - number * 16);
+}
+
+#endif /* LV_HAVE_SSE */
+
+
+#ifdef LV_HAVE_AVX
+#include <immintrin.h>
+
+static inline void volk_32f_pack_hard_decisions_8u_u_avx(uint8_t* bytes,
+                                                         const float* softBits,
+                                                         const unsigned int msbFirst,
+                                                         unsigned int num_points)
+{
+    const unsigned int thirtySecondPoints = num_points / 32;
+    uint32_t mask;
+    unsigned int number;
+
+    for (number = 0; number < thirtySecondPoints; number++) {
+        mask = _mm256_movemask_ps(_mm256_loadu_ps(softBits)) |
+               _mm256_movemask_ps(_mm256_loadu_ps(softBits + 8)) << 8 |
+               _mm256_movemask_ps(_mm256_loadu_ps(softBits + 16)) << 16 |
+               (uint32_t)_mm256_movemask_ps(_mm256_loadu_ps(softBits + 24)) << 24;
+        mask = msbFirst ? volk_8u_pack_bits_reverse(mask) : mask;
+        memcpy(bytes, &mask, sizeof(mask));
+        softBits += 32;
+        bytes += 4;
+    }
+
+    volk_32f_pack_hard_decisions_scalar(
+        bytes, softBits, msbFirst, num_points - number * 32);
+}
+
+#endif /* LV_HAVE_AVX */
+
+
+#ifdef LV_HAVE_AVX512F
+#include <immintrin.h>
+
+static inline void volk_32f_pack_hard_decisions_8u_u_avx512f(uint8_t* bytes,
+                                                             const float* softBits,
+                                                             const unsigned int msbFirst,
+                                                             unsigned int num_points)
+{
+    const unsigned int thirtySecondPoints = num_points / 32;
+    const __m512i signBit = _mm512_set1_epi32(0x80000000);
+    uint32_t mask;
+    unsigned int number;
+
+    for (number = 0; number < thirtySecondPoints; number++) {
+        mask = _mm512_test_epi32_mask(
+                   _mm512_castps_si512(_mm512_loadu_ps(softBits)), signBit) |
+               (uint32_t)_mm512_test_epi32_mask(
+                   _mm512_castps_si512(_mm512_loadu_ps(softBits + 16)), signBit)
+                   << 16;
+        mask = msbFirst ? volk_8u_pack_bits_reverse(mask) : mask;
+        memcpy(bytes, &mask, sizeof(mask));
+        softBits += 32;
+        bytes += 4;
+    }
+
+    volk_32f_pack_hard_decisions_scalar(
+        bytes, softBits, msbFirst, num_points - number * 32);
+}
+
+#endif /* LV_HAVE_AVX512F */
+
+
+#ifdef LV_HAVE_NEON
+#include <arm_neon.h>
+
+static inline void volk_32f_pack_hard_decisions_8u_neon(uint8_t* bytes,
+                                                        const float* softBits,
+                                                        const unsigned int msbFirst,
+                                                        unsigned int num_points)
+{
+    const unsigned int eighthPoints = num_points / 8;
+    const int32_t lsbShifts[8] = { 0, 1, 2, 3, 4, 5, 6, 7 };
+    const int32_t msbShifts[8] = { 7, 6, 5, 4, 3, 2, 1, 0 };
+    const int32_t* shifts = msbFirst ? msbShifts : lsbShifts;
+    const int32x4_t lowShifts = vld1q_s32(shifts);
+    const int32x4_t highShifts = vld1q_s32(shifts + 4);
+    uint32x4_t low, high;
+    uint32x2_t sum;
+    unsigned int number;
+
+    for (number = 0; number < eighthPoints; number++) {
+        low = vshrq_n_u32(vreinterpretq_u32_f32(vld1q_f32(softBits)), 31);
+        high = vshrq_n_u32(vreinterpretq_u32_f32(vld1q_f32(softBits + 4)), 31);
+        low = vaddq_u32(vshlq_u32(low, lowShifts), vshlq_u32(high, highShifts));
+        sum = vadd_u32(vget_low_u32(low), vget_high_u32(low));
+        *bytes++ = (uint8_t)vget_lane_u32(vpadd_u32(sum, sum), 0);
+        softBits += 8;
+    }
+
+    volk_32f_pack_hard_decisions_scalar(
+        bytes, softBits, msbFirst, num_points - number * 8);
+}
+
+#endif /* LV_HAVE_NEON */
+
+#endif /* INCLUDED_volk_32f_pack_hard_decisions_8u_u_H */
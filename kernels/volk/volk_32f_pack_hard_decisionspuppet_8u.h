@@ -0,0 +1,119 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2026 Free Software Foundation, Inc.
+ *
+ * This file is part of VOLK
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+/* For documentation see 'kernels/volk/volk_32f_pack_hard_decisions_8u.h'
+ * This file exists for test purposes only. Should not be used directly.
+ *
+ * Packs the first half of the input MSB first and the second half LSB first.
+ * The unused part of the output is cleared.
+ */
+
+#ifndef INCLUDED_volk_32f_pack_hard_decisionspuppet_8u_H
+#define INCLUDED_volk_32f_pack_hard_decisionspuppet_8u_H
+
+#include <string.h>
+#include <volk/volk_32f_pack_hard_decisions_8u.h>
+
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void volk_32f_pack_hard_decisionspuppet_8u_generic(uint8_t* bytes,
+                                                                 const float* softBits,
+                                                                 unsigned int num_points)
+{
+    const unsigned int half = num_points / 2;
+    const unsigned int halfBytes = (half + 7) / 8;
+    const unsigned int used = halfBytes + (num_points - half + 7) / 8;
+
+    volk_32f_pack_hard_decisions_8u_generic(bytes, softBits, 1, half);
+    volk_32f_pack_hard_decisions_8u_generic(
+        bytes + halfBytes, softBits + half, 0, num_points - half);
+    memset(bytes + used, 0, num_points - used);
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+
+#ifdef LV_HAVE_SSE
+
+static inline void volk_32f_pack_hard_decisionspuppet_8u_u_sse(uint8_t* bytes,
+                                                               const float* softBits,
+                                                               unsigned int num_points)
+{
+    const unsigned int half = num_points / 2;
+    const unsigned int halfBytes = (half + 7) / 8;
+    const unsigned int used = halfBytes + (num_points - half + 7) / 8;
+
+    volk_32f_pack_hard_decisions_8u_u_sse(bytes, softBits, 1, half);
+    volk_32f_pack_hard_decisions_8u_u_sse(
+        bytes + halfBytes, softBits + half, 0, num_points - half);
+    memset(bytes + used, 0, num_points - used);
+}
+
+#endif /* LV_HAVE_SSE */
+
+
+#ifdef LV_HAVE_AVX
+
+static inline void volk_32f_pack_hard_decisionspuppet_8u_u_avx(uint8_t* bytes,
+                                                               const float* softBits,
+                                                               unsigned int num_points)
+{
+    const unsigned int half = num_points / 2;
+    const unsigned int halfBytes = (half + 7) / 8;
+    const unsigned int used = halfBytes + (num_points - half + 7) / 8;
+
+    volk_32f_pack_hard_decisions_8u_u_avx(bytes, softBits, 1, half);
+    volk_32f_pack_hard_decisions_8u_u_avx(
+        bytes + halfBytes, softBits + half, 0, num_points - half);
+    memset(bytes + used, 0, num_points - used);
+}
+
+#endif /* LV_HAVE_AVX */
+
+
+#ifdef LV_HAVE_AVX512F
+
+static inline void
+volk_32f_pack_hard_decisionspuppet_8u_u_avx512f(uint8_t* bytes,
+                                                const float* softBits,
+                                                unsigned int num_points)
+{
+    const unsigned int half = num_points / 2;
+    const unsigned int halfBytes = (half + 7) / 8;
+    const unsigned int used = halfBytes + (num_points - half + 7) / 8;
+
+    volk_32f_pack_hard_decisions_8u_u_avx512f(bytes, softBits, 1, half);
+    volk_32f_pack_hard_decisions_8u_u_avx512f(
+        bytes + halfBytes, softBits + half, 0, num_points - half);
+    memset(bytes + used, 0, num_points - used);
+}
+
+#endif /* LV_HAVE_AVX512F */
+
+
+#ifdef LV_HAVE_NEON
+
+static inline void volk_32f_pack_hard_decisionspuppet_8u_neon(uint8_t* bytes,
+                                                              const float* softBits,
+                                                              unsigned int num_points)
+{
+    const unsigned int half = num_points / 2;
+    const unsigned int halfBytes = (half + 7) / 8;
+    const unsigned int used = halfBytes + (num_points - half + 7) / 8;
+
+    volk_32f_pack_hard_decisions_8u_neon(bytes, softBits, 1, half);
+    volk_32f_pack_hard_decisions_8u_neon(
+        bytes + halfBytes, softBits + half, 0, num_points - half);
+    memset(bytes + used, 0, num_points - used);
+}
+
+#endif /* LV_HAVE_NEON */
+
+#endif /* INCLUDED_volk_32f_pack_hard_decisionspuppet_8u_H */
@@ -0,0 +1,75 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2026 Free Software Foundation, Inc.
+ *
+ * This file is part of VOLK
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+/* For documentation see 'kernels/volk/volk_32f_s32f_quantile_noise_floor_32f.h'
+ * This file exists for test purposes only. Should not be used directly.
+ */
+
+#ifndef INCLUDED_volk_32f_quantile_noise_floorpuppet_32f_H
+#define INCLUDED_volk_32f_quantile_noise_floorpuppet_32f_H
+
+#include <volk/volk_32f_s32f_quantile_noise_floor_32f.h>
+
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void
+volk_32f_quantile_noise_floorpuppet_32f_generic(float* noiseFloorAmplitude,
+                                                const float* realDataPoints,
+                                                unsigned int num_points)
+{
+    volk_32f_s32f_quantile_noise_floor_32f_generic(
+        noiseFloorAmplitude, realDataPoints, 0.25f, num_points);
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+
+#ifdef LV_HAVE_AVX2
+
+static inline void
+volk_32f_quantile_noise_floorpuppet_32f_u_avx2(float* noiseFloorAmplitude,
+                                               const float* realDataPoints,
+                                               unsigned int num_points)
+{
+    volk_32f_s32f_quantile_noise_floor_32f_u_avx2(
+        noiseFloorAmplitude, realDataPoints, 0.25f, num_points);
+}
+
+#endif /* LV_HAVE_AVX2 */
+
+
+#ifdef LV_HAVE_AVX512F
+
+static inline void
+volk_32f_quantile_noise_floorpuppet_32f_u_avx512f(float* noiseFloorAmplitude,
+                                                  const float* realDataPoints,
+                                                  unsigned int num_points)
+{
+    volk_32f_s32f_quantile_noise_floor_32f_u_avx512f(
+        noiseFloorAmplitude, realDataPoints, 0.25f, num_points);
+}
+
+#endif /* LV_HAVE_AVX512F */
+
+
+#ifdef LV_HAVE_NEON
+
+static inline void
+volk_32f_quantile_noise_floorpuppet_32f_neon(float* noiseFloorAmplitude,
+                                             const float* realDataPoints,
+                                             unsigned int num_points)
+{
+    volk_32f_s32f_quantile_noise_floor_32f_neon(
+        noiseFloorAmplitude, realDataPoints, 0.25f, num_points);
+}
+
+#endif /* LV_HAVE_NEON */
+
+#endif /* INCLUDED_volk_32f_quantile_noise_floorpuppet_32f_H */
@@ -0,0 +1,106 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2026 Free Software Foundation, Inc.
+ *
+ * This file is part of VOLK
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+/* For documentation see 'kernels/volk/volk_32f_s32f_quantile_32f.h'
+ * This file exists for test purposes only. Should not be used directly.
+ *
+ * Writes the 0, 0.1, 0.5, 0.9 and 1 quantile of the first half of the input,
+ * then the same quantiles of a prefix that is selected without a histogram.
+ */
+
+#ifndef INCLUDED_volk_32f_quantilepuppet_32f_H
+#define INCLUDED_volk_32f_quantilepuppet_32f_H
+
+#include <volk/volk_32f_s32f_quantile_32f.h>
+
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void volk_32f_quantilepuppet_32f_generic(float* result,
+                                                       const float* inputBuffer,
+                                                       unsigned int num_points)
+{
+    const float quantiles[5] = { 0.f, 0.1f, 0.5f, 0.9f, 1.f };
+    const unsigned int small =
+        (num_points < VOLK_QUANTILE_MAX_COLLECT) ? num_points : VOLK_QUANTILE_MAX_COLLECT;
+    unsigned int ii;
+    for (ii = 0; ii < 5; ii++) {
+        volk_32f_s32f_quantile_32f_generic(
+            result + ii, inputBuffer, quantiles[ii], num_points / 2);
+        volk_32f_s32f_quantile_32f_generic(
+            result + 5 + ii, inputBuffer, quantiles[ii], small);
+    }
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+
+#ifdef LV_HAVE_AVX2
+
+static inline void volk_32f_quantilepuppet_32f_u_avx2(float* result,
+                                                      const float* inputBuffer,
+                                                      unsigned int num_points)
+{
+    const float quantiles[5] = { 0.f, 0.1f, 0.5f, 0.9f, 1.f };
+    const unsigned int small =
+        (num_points < VOLK_QUANTILE_MAX_COLLECT) ? num_points : VOLK_QUANTILE_MAX_COLLECT;
+    unsigned int ii;
+    for (ii = 0; ii < 5; ii++) {
+        volk_32f_s32f_quantile_32f_u_avx2(
+            result + ii, inputBuffer, quantiles[ii], num_points / 2);
+        volk_32f_s32f_quantile_32f_u_avx2(
+            result + 5 + ii, inputBuffer, quantiles[ii], small);
+    }
+}
+
+#endif /* LV_HAVE_AVX2 */
+
+
+#ifdef LV_HAVE_AVX512F
+
+static inline void volk_32f_quantilepuppet_32f_u_avx512f(float* result,
+                                                         const float* inputBuffer,
+                                                         unsigned int num_points)
+{
+    const float quantiles[5] = { 0.f, 0.1f, 0.5f, 0.9f, 1.f };
+    const unsigned int small =
+        (num_points < VOLK_QUANTILE_MAX_COLLECT) ? num_points : VOLK_QUANTILE_MAX_COLLECT;
+    unsigned int ii;
+    for (ii = 0; ii < 5; ii++) {
+        volk_32f_s32f_quantile_32f_u_avx512f(
+            result + ii, inputBuffer, quantiles[ii], num_points / 2);
+        volk_32f_s32f_quantile_32f_u_avx512f(
+            result + 5 + ii, inputBuffer, quantiles[ii], small);
+    }
+}
+
+#endif /* LV_HAVE_AVX512F */
+
+
+#ifdef LV_HAVE_NEON
+
+static inline void volk_32f_quantilepuppet_32f_neon(float* result,
+                                                    const float* inputBuffer,
+                                                    unsigned int num_points)
+{
+    const float quantiles[5] = { 0.f, 0.1f, 0.5f, 0.9f, 1.f };
+    const unsigned int small =
+        (num_points < VOLK_QUANTILE_MAX_COLLECT) ? num_points : VOLK_QUANTILE_MAX_COLLECT;
+    unsigned int ii;
+    for (ii = 0; ii < 5; ii++) {
+        volk_32f_s32f_quantile_32f_neon(
+            result + ii, inputBuffer, quantiles[ii], num_points / 2);
+        volk_32f_s32f_quantile_32f_neon(
+            result + 5 + ii, inputBuffer, quantiles[ii], small);
+    }
+}
+
+#endif /* LV_HAVE_NEON */
+
+#endif /* INCLUDED_volk_32f_quantilepuppet_32f_H */
@@ -0,0 +1,257 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2026 Free Software Foundation, Inc.
+ *
+ * This file is part of VOLK
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+/*!
+ * \page volk_32f_s32f_index_above_32u
+ *
+ * \b Overview
+ *
+ * Finds the indices of all elements that are larger than a threshold, e.g. the
+ * candidate peaks of a correlator output. The indices are written in ascending
+ * order, followed by their number.
+ *
+ * The SIMD implementations skip blocks without any element above the
+ * threshold and compact the others with a permute table (AVX2) or a compress
+ * store (AVX-512).
+ *
+ * <b>Dispatcher Prototype</b>
+ * \code
+ * void volk_32f_s32f_index_above_32u(uint32_t* indices, uint32_t* numIndices,
+ *                                    const float* inputBuffer, const float threshold,
+ *                                    unsigned int num_points)
+ * \endcode
+ *
+ * \b Inputs
+ * \li inputBuffer: the input vector.
+ * \li threshold: elements larger than the threshold are reported.
+ * \li num_points: the number of elements in the input vector.
+ *
+ * \b Outputs
+ * \li indices: the indices of the elements above the threshold. Must have
+ * room for num_points indices, all of which may be written.
+ * \li numIndices: the number of indices found.
+ *
+ * \b Example
+ * \code
+ *   unsigned int N = 100;
+ *   unsigned int alignment = volk_get_alignment();
+ *   float* in = (float*)volk_malloc(sizeof(float) * N, alignment);
+ *   uint32_t* indices = (uint32_t*)volk_malloc(sizeof(uint32_t) * N, alignment);
+ *   uint32_t count;
+ *
+ *   for (unsigned int ii = 0; ii < N; ++ii) {
+ *       in[ii] = (ii % 10 == 3) ? 1.f : 0.f;
+ *   }
+ *
+ *   volk_32f_s32f_index_above_32u(indices, &count, in, 0.5f, N);
+ *   // count == 10, indices == 3, 13, 23, ...
+ *
+ *   volk_free(in);
+ *   volk_free(indices);
+ * \endcode
+ */
+
+#ifndef INCLUDED_volk_32f_s32f_index_above_32u_u_H
+#define INCLUDED_volk_32f_s32f_index_above_32u_u_H
+
+#include <inttypes.h>
+#include <volk/volk_common.h>
+
+/* For each 8 bit mask the lanes that are set, packed into 4 bit fields */
+static const uint32_t volk_index_above_permute_table[256] = {
+    0x00000000, 0x00000000, 0x00000001, 0x00000010, 0x00000002, 0x00000020, 0x00000021,
+    0x00000210, 0x00000003, 0x00000030, 0x00000031, 0x00000310, 0x00000032, 0x00000320,
+    0x00000321, 0x00003210, 0x00000004, 0x00000040, 0x00000041, 0x00000410, 0x00000042,
+    0x00000420, 0x00000421, 0x00004210, 0x00000043, 0x00000430, 0x00000431, 0x00004310,
+    0x00000432, 0x00004320, 0x00004321, 0x00043210, 0x00000005, 0x00000050, 0x00000051,
+    0x00000510, 0x00000052, 0x00000520, 0x00000521, 0x00005210, 0x00000053, 0x00000530,
+    0x00000531, 0x00005310, 0x00000532, 0x00005320, 0x00005321, 0x00053210, 0x00000054,
+    0x00000540, 0x00000541, 0x00005410, 0x00000542, 0x00005420, 0x00005421, 0x00054210,
+    0x00000543, 0x00005430, 0x00005431, 0x00054310, 0x00005432, 0x00054320, 0x00054321,
+    0x00543210, 0x00000006, 0x00000060, 0x00000061, 0x00000610, 0x00000062, 0x00000620,
+    0x00000621, 0x00006210, 0x00000063, 0x00000630, 0x00000631, 0x00006310, 0x00000632,
+    0x00006320, 0x00006321, 0x00063210, 0x00000064, 0x00000640, 0x00000641, 0x00006410,
+    0x00000642, 0x00006420, 0x00006421, 0x00064210, 0x00000643, 0x00006430, 0x00006431,
+    0x00064310, 0x00006432, 0x00064320, 0x00064321, 0x00643210, 0x00000065, 0x00000650,
+    0x00000651, 0x00006510, 0x00000652, 0x00006520, 0x00006521, 0x00065210, 0x00000653,
+    0x00006530, 0x00006531, 0x00065310, 0x00006532, 0x00065320, 0x00065321, 0x00653210,
+    0x00000654, 0x00006540, 0x00006541, 0x00065410, 0x00006542, 0x00065420, 0x00065421,
+    0x00654210, 0x00006543, 0x00065430, 0x00065431, 0x00654310, 0x00065432, 0x00654320,
+    0x00654321, 0x06543210, 0x00000007, 0x00000070, 0x00000071, 0x00000710, 0x00000072,
+    0x00000720, 0x00000721, 0x00007210, 0x00000073, 0x00000730, 0x00000731, 0x00007310,
+    0x00000732, 0x00007320, 0x00007321, 0x00073210, 0x00000074, 0x00000740, 0x00000741,
+    0x00007410, 0x00000742, 0x00007420, 0x00007421, 0x00074210, 0x00000743, 0x00007430,
+    0x00007431, 0x00074310, 0x00007432, 0x00074320, 0x00074321, 0x00743210, 0x00000075,
+    0x00000750, 0x00000751, 0x00007510, 0x00000752, 0x00007520, 0x00007521, 0x00075210,
+    0x00000753, 0x00007530, 0x00007531, 0x00075310, 0x00007532, 0x00075320, 0x00075321,
+    0x00753210, 0x00000754, 0x00007540, 0x00007541, 0x00075410, 0x00007542, 0x00075420,
+    0x00075421, 0x00754210, 0x00007543, 0x00075430, 0x00075431, 0x00754310, 0x00075432,
+    0x00754320, 0x00754321, 0x07543210, 0x00000076, 0x00000760, 0x00000761, 0x00007610,
+    0x00000762, 0x00007620, 0x00007621, 0x00076210, 0x00000763, 0x00007630, 0x00007631,
+    0x00076310, 0x00007632, 0x00076320, 0x00076321, 0x00763210, 0x00000764, 0x00007640,
+    0x00007641, 0x00076410, 0x00007642, 0x00076420, 0x00076421, 0x00764210, 0x00007643,
+    0x00076430, 0x00076431, 0x00764310, 0x00076432, 0x00764320, 0x00764321, 0x07643210,
+    0x00000765, 0x00007650, 0x00007651, 0x00076510, 0x00007652, 0x00076520, 0x00076521,
+    0x00765210, 0x00007653, 0x00076530, 0x00076531, 0x00765310, 0x00076532, 0x00765320,
+    0x00765321, 0x07653210, 0x00007654, 0x00076540, 0x00076541, 0x00765410, 0x00076542,
+    0x00765420, 0x00765421, 0x07654210, 0x00076543, 0x00765430, 0x00765431, 0x07654310,
+    0x00765432, 0x07654320, 0x07654321, 0x76543210
+};
+
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void volk_32f_s32f_index_above_32u_generic(uint32_t* indices,
+                                                         uint32_t* numIndices,
+                                                         const float* inputBuffer,
+                                                         const float threshold,
+                                                         unsigned int num_points)
+{
+    uint32_t count = 0;
+    unsigned int number;
+
+    for (number = 0; number < num_points; number++) {
+        if (inputBuffer[number] > threshold) {
+            indices[count++] = number;
+        }
+    }
+    *numIndices = count;
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+
+#ifdef LV_HAVE_AVX2
+#include <immintrin.h>
+
+static inline void volk_32f_s32f_index_above_32u_u_avx2(uint32_t* indices,
+                                                        uint32_t* numIndices,
+                                                        const float* inputBuffer,
+                                                        const float threshold,
+                                                        unsigned int num_points)
+{
+    const unsigned int eighthPoints = num_points / 8;
+    const __m256 vThreshold = _mm256_set1_ps(threshold);
+    const __m256i shifts = _mm256_setr_epi32(0, 4, 8, 12, 16, 20, 24, 28);
+    const __m256i laneMask = _mm256_set1_epi32(7);
+    const __m256i eight = _mm256_set1_epi32(8);
+    __m256i index = _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7);
+    __m256i permute;
+    uint32_t count = 0;
+    unsigned int number;
+    int mask;
+
+    for (number = 0; number < eighthPoints; number++) {
+        mask = _mm256_movemask_ps(
+            _mm256_cmp_ps(_mm256_loadu_ps(inputBuffer), vThreshold, _CMP_GT_OQ));
+        if (mask) {
+            permute = _mm256_set1_epi32(volk_index_above_permute_table[mask]);
+            permute = _mm256_and_si256(_mm256_srlv_epi32(permute, shifts), laneMask);
+            // count <= 8 * number, so the full store stays within the output
+            _mm256_storeu_si256((__m256i*)(indices + count),
+                                _mm256_permutevar8x32_epi32(index, permute));
+            count += _mm_popcnt_u32(mask);
+        }
+        index = _mm256_add_epi32(index, eight);
+        inputBuffer += 8;
+    }
+
+    for (number = eighthPoints * 8; number < num_points; number++) {
+        if (*inputBuffer++ > threshold) {
+            indices[count++] = number;
+        }
+    }
+    *numIndices = count;
+}
+
+#endif /* LV_HAVE_AVX2 */
+
+
+#ifdef LV_HAVE_AVX512F
+#include <immintrin.h>
+
+static inline void volk_32f_s32f_index_above_32u_u_avx512f(uint32_t* indices,
+                                                           uint32_t* numIndices,
+                                                           const float* inputBuffer,
+                                                           const float threshold,
+                                                           unsigned int num_points)
+{
+    const unsigned int sixteenthPoints = num_points / 16;
+    const __m512 vThreshold = _mm512_set1_ps(threshold);
+    const __m512i sixteen = _mm512_set1_epi32(16);
+    __m512i index =
+        _mm512_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15);
+    __mmask16 mask;
+    uint32_t count = 0;
+    unsigned int number;
+
+    for (number = 0; number < sixteenthPoints; number++) {
+        mask =
+            _mm512_cmp_ps_mask(_mm512_loadu_ps(inputBuffer), vThreshold, _CMP_GT_OQ);
+        if (mask) {
+            _mm512_mask_compressstoreu_epi32(indices + count, mask, index);
+            count += _mm_popcnt_u32(mask);
+        }
+        index = _mm512_add_epi32(index, sixteen);
+        inputBuffer += 16;
+    }
+
+    for (number = sixteenthPoints * 16; number < num_points; number++) {
+        if (*inputBuffer++ > threshold) {
+            indices[count++] = number;
+        }
+    }
+    *numIndices = count;
+}
+
+#endif /* LV_HAVE_AVX512F */
+
+
+#ifdef LV_HAVE_NEON
+#include <arm_neon.h>
+
+static inline void volk_32f_s32f_index_above_32u_neon(uint32_t* indices,
+                                                      uint32_t* numIndices,
+                                                      const float* inputBuffer,
+                                                      const float threshold,
+                                                      unsigned int num_points)
+{
+    const unsigned int quarterPoints = num_points / 4;
+    const float32x4_t vThreshold = vdupq_n_f32(threshold);
+    uint32x4_t above;
+    uint32x2_t any;
+    uint32_t lanes[4];
+    uint32_t count = 0;
+    unsigned int number, lane;
+
+    for (number = 0; number < quarterPoints; number++) {
+        above = vcgtq_f32(vld1q_f32(inputBuffer), vThreshold);
+        any = vorr_u32(vget_low_u32(above), vget_high_u32(above));
+        if (vget_lane_u32(vpmax_u32(any, any), 0)) {
+            vst1q_u32(lanes, above);
+            for (lane = 0; lane < 4; lane++) {
+                if (lanes[lane]) {
+                    indices[count++] = 4 * number + lane;
+                }
+            }
+        }
+        inputBuffer += 4;
+    }
+
+    for (number = quarterPoints * 4; number < num_points; number++) {
+        if (*inputBuffer++ > threshold) {
+            indices[count++] = number;
+        }
+    }
+    *numIndices = count;
+}
+
+#endif /* LV_HAVE_NEON */
+
+#endif /* INCLUDED_volk_32f_s32f_index_above_32u_u_H */
@@ -0,0 +1,599 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2026 Free Software Foundation, Inc.
+ *
+ * This file is part of VOLK
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+/*!
+ * \page volk_32f_s32f_quantile_32f
+ *
+ * \b Overview
+ *
+ * Finds the quantile of a vector, i.e. the element that would be at index
+ * round(quantile * (num_points - 1)) if the vector was sorted in ascending
+ * order. The input vector is not modified.
+ *
+ * The values are mapped to order preserving integer keys and counted into a
+ * histogram that spans the range between the minimum and the maximum. Only the
+ * elements of the bin that holds the requested rank are then collected and
+ * selected exactly. Bins that hold too many elements to be collected are split
+ * into a finer histogram, which happens at most three times. The result is
+ * exact and the same for every implementation.
+ *
+ * <b>Dispatcher Prototype</b>
+ * \code
+ * void volk_32f_s32f_quantile_32f(float* result, const float* inputBuffer,
+ *                                 const float quantile, unsigned int num_points)
+ * \endcode
+ *
+ * \b Inputs
+ * \li inputBuffer: the input vector. Must not contain NaN.
+ * \li quantile: the quantile between 0 (minimum) and 1 (maximum). Values
+ * outside of this range are clamped.
+ * \li num_points: the number of elements in the input vector.
+ *
+ * \b Outputs
+ * \li result: the quantile of the input vector. Not written if num_points is 0.
+ *
+ * \b Example
+ * Find the median of a vector.
+ * \code
+ *   unsigned int N = 1001;
+ *   unsigned int alignment = volk_get_alignment();
+ *   float* in = (float*)volk_malloc(sizeof(float) * N, alignment);
+ *   float median;
+ *
+ *   for (unsigned int ii = 0; ii < N; ++ii) {
+ *       in[ii] = (float)((ii * 7) % N);
+ *   }
+ *
+ *   volk_32f_s32f_quantile_32f(&median, in, 0.5f, N); // median == 500
+ *
+ *   volk_free(in);
+ * \endcode
+ */
+
+#ifndef INCLUDED_volk_32f_s32f_quantile_32f_u_H
+#define INCLUDED_volk_32f_s32f_quantile_32f_u_H
+
+#include <inttypes.h>
+#include <string.h>
+#include <volk/volk_common.h>
+
+#define VOLK_QUANTILE_BINS 2048
+#define VOLK_QUANTILE_MAX_COLLECT 2048
+
+/* Order preserving mapping between floats and unsigned integers. */
+static inline uint32_t volk_32f_quantile_key(float value)
+{
+    uint32_t bits;
+    memcpy(&bits, &value, sizeof(bits));
+    return (bits & 0x80000000) ? ~bits : (bits | 0x80000000);
+}
+
+static inline float volk_32f_quantile_from_key(uint32_t key)
+{
+    const uint32_t bits = (key & 0x80000000) ? (key & 0x7fffffff) : ~key;
+    float value;
+    memcpy(&value, &bits, sizeof(value));
+    return value;
+}
+
+static inline unsigned int volk_32f_quantile_rank(float quantile, unsigned int num_points)
+{
+    if (!(quantile > 0.f)) {
+        return 0;
+    }
+    if (quantile >= 1.f) {
+        return num_points - 1;
+    }
+    return (unsigned int)((double)quantile * (num_points - 1) + 0.5);
+}
+
+/* Key window from the minimum and the maximum. Both zeros compare equal, so
+ * the window is widened to include -0 and +0. */
+static inline void volk_32f_quantile_window(uint32_t* keyLo,
+                                            uint32_t* range,
+                                            float minValue,
+                                            float maxValue)
+{
+    *keyLo = volk_32f_quantile_key((minValue == 0.f) ? -0.f : minValue);
+    *range = volk_32f_quantile_key((maxValue == 0.f) ? 0.f : maxValue) - *keyLo;
+}
+
+/* Smallest shift that maps a key range onto the histogram bins. */
+static inline unsigned int volk_32f_quantile_shift(uint32_t range)
+{
+    unsigned int shift = 0;
+    while ((range >> shift) >= VOLK_QUANTILE_BINS) {
+        shift++;
+    }
+    return shift;
+}
+
+/* Find the bin that holds the element of the given rank and make the rank
+ * relative to the first element of this bin. */
+static inline unsigned int volk_32f_quantile_pick_bin(const unsigned int* hist,
+                                                      unsigned int* rank)
+{
+    unsigned int bin = 0;
+    while (*rank >= hist[bin]) {
+        *rank -= hist[bin];
+        bin++;
+    }
+    return bin;
+}
+
+/* Narrow the key window down to the selected bin. */
+static inline void volk_32f_quantile_narrow(uint32_t* keyLo,
+                                            uint32_t* range,
+                                            unsigned int bin,
+                                            unsigned int shift)
+{
+    const uint32_t offset = (uint32_t)bin << shift;
+    const uint32_t width = ((uint32_t)1 << shift) - 1;
+    *keyLo += offset;
+    *range = (*range - offset < width) ? *range - offset : width;
+}
+
+/* Hoare quickselect, reorders the buffer. */
+static inline float volk_32f_quantile_select(float* buffer, int num_points, int rank)
+{
+    int left = 0;
+    int right = num_points - 1;
+    while (left < right) {
+        const float pivot = buffer[left + (right - left) / 2];
+        int i = left;
+        int j = right;
+        while (i <= j) {
+            while (buffer[i] < pivot) {
+                i++;
+            }
+            while (buffer[j] > pivot) {
+                j--;
+            }
+            if (i <= j) {
+                const float tmp = buffer[i];
+                buffer[i] = buffer[j];
+                buffer[j] = tmp;
+                i++;
+                j--;
+            }
+        }
+        if (rank <= j) {
+            right = j;
+        } else if (rank >= i) {
+            left = i;
+        } else {
+            break;
+        }
+    }
+    return buffer[rank];
+}
+
+static inline void volk_32f_quantile_histogram_generic(unsigned int* hist,
+                                                       const float* inputBuffer,
+                                                       uint32_t keyLo,
+                                                       uint32_t range,
+                                                       unsigned int shift,
+                                                       unsigned int num_points)
+{
+    unsigned int number;
+    for (number = 0; number < num_points; number++) {
+        const uint32_t d = volk_32f_quantile_key(inputBuffer[number]) - keyLo;
+        hist[(d <= range) ? (d >> shift) : VOLK_QUANTILE_BINS]++;
+    }
+}
+
+static inline unsigned int volk_32f_quantile_collect_generic(float* buffer,
+                                                             const float* inputBuffer,
+                                                             uint32_t keyLo,
+                                                             uint32_t range,
+                                                             unsigned int num_points)
+{
+    unsigned int count = 0;
+    unsigned int number;
+    for (number = 0; number < num_points; number++) {
+        if (volk_32f_quantile_key(inputBuffer[number]) - keyLo <= range) {
+            buffer[count++] = inputBuffer[number];
+        }
+    }
+    return count;
+}
+
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void volk_32f_s32f_quantile_32f_generic(float* result,
+                                                      const float* inputBuffer,
+                                                      const float quantile,
+                                                      unsigned int num_points)
+{
+    unsigned int hist[VOLK_QUANTILE_BINS + 1];
+    float buffer[VOLK_QUANTILE_MAX_COLLECT];
+    unsigned int rank = volk_32f_quantile_rank(quantile, num_points);
+    float minValue, maxValue;
+    uint32_t keyLo, range;
+    unsigned int shift, bin, number;
+
+    if (num_points == 0) {
+        return;
+    }
+    if (num_points <= VOLK_QUANTILE_MAX_COLLECT) {
+        memcpy(buffer, inputBuffer, num_points * sizeof(float));
+        *result = volk_32f_quantile_select(buffer, num_points, rank);
+        return;
+    }
+
+    minValue = maxValue = inputBuffer[0];
+    for (number = 1; number < num_points; number++) {
+        minValue = (inputBuffer[number] < minValue) ? inputBuffer[number] : minValue;
+        maxValue = (inputBuffer[number] > maxValue) ? inputBuffer[number] : maxValue;
+    }
+    volk_32f_quantile_window(&keyLo, &range, minValue, maxValue);
+
+    for (;;) {
+        shift = volk_32f_quantile_shift(range);
+        memset(hist, 0, sizeof(hist));
+        volk_32f_quantile_histogram_generic(
+            hist, inputBuffer, keyLo, range, shift, num_points);
+        bin = volk_32f_quantile_pick_bin(hist, &rank);
+        volk_32f_quantile_narrow(&keyLo, &range, bin, shift);
+        if (shift == 0) {
+            *result = volk_32f_quantile_from_key(keyLo);
+            return;
+        }
+        if (hist[bin] <= VOLK_QUANTILE_MAX_COLLECT) {
+            volk_32f_quantile_collect_generic(
+                buffer, inputBuffer, keyLo, range, num_points);
+            *result = volk_32f_quantile_select(buffer, hist[bin], rank);
+            return;
+        }
+    }
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+
+#ifdef LV_HAVE_AVX2
+#include <immintrin.h>
+
+static inline void volk_32f_s32f_quantile_32f_u_avx2(float* result,
+                                                     const float* inputBuffer,
+                                                     const float quantile,
+                                                     unsigned int num_points)
+{
+    unsigned int hist[VOLK_QUANTILE_BINS + 1];
+    float buffer[VOLK_QUANTILE_MAX_COLLECT];
+    __VOLK_ATTR_ALIGNED(32) uint32_t lanes[8];
+    __VOLK_ATTR_ALIGNED(32) float minLanes[8];
+    __VOLK_ATTR_ALIGNED(32) float maxLanes[8];
+    unsigned int rank = volk_32f_quantile_rank(quantile, num_points);
+    const unsigned int eighthPoints = num_points / 8;
+    const unsigned int tail = eighthPoints * 8;
+    const __m256i signBit = _mm256_set1_epi32(0x80000000);
+    const __m256i dummyBin = _mm256_set1_epi32(VOLK_QUANTILE_BINS);
+    __m256i x, key, d, inside, vKeyLo, vRange;
+    __m256 vMin, vMax, v;
+    __m128i vShift;
+    float minValue, maxValue;
+    uint32_t keyLo, range;
+    unsigned int shift, bin, number, lane, count;
+    int mask;
+
+    if (num_points == 0) {
+        return;
+    }
+    if (num_points <= VOLK_QUANTILE_MAX_COLLECT) {
+        memcpy(buffer, inputBuffer, num_points * sizeof(float));
+        *result = volk_32f_quantile_select(buffer, num_points, rank);
+        return;
+    }
+
+    vMin = vMax = _mm256_loadu_ps(inputBuffer);
+    for (number = 1; number < eighthPoints; number++) {
+        v = _mm256_loadu_ps(inputBuffer + 8 * number);
+        vMin = _mm256_min_ps(vMin, v);
+        vMax = _mm256_max_ps(vMax, v);
+    }
+    _mm256_store_ps(minLanes, vMin);
+    _mm256_store_ps(maxLanes, vMax);
+    minValue = minLanes[0];
+    maxValue = maxLanes[0];
+    for (lane = 1; lane < 8; lane++) {
+        minValue = (minLanes[lane] < minValue) ? minLanes[lane] : minValue;
+        maxValue = (maxLanes[lane] > maxValue) ? maxLanes[lane] : maxValue;
+    }
+    for (number = tail; number < num_points; number++) {
+        minValue = (inputBuffer[number] < minValue) ? inputBuffer[number] : minValue;
+        maxValue = (inputBuffer[number] > maxValue) ? inputBuffer[number] : maxValue;
+    }
+    volk_32f_quantile_window(&keyLo, &range, minValue, maxValue);
+
+    for (;;) {
+        shift = volk_32f_quantile_shift(range);
+        memset(hist, 0, sizeof(hist));
+        vKeyLo = _mm256_set1_epi32(keyLo);
+        vRange = _mm256_set1_epi32(range);
+        vShift = _mm_cvtsi32_si128(shift);
+        for (number = 0; number < eighthPoints; number++) {
+            x = _mm256_loadu_si256((const __m256i*)(inputBuffer + 8 * number));
+            key = _mm256_xor_si256(x, _mm256_or_si256(_mm256_srai_epi32(x, 31), signBit));
+            d = _mm256_sub_epi32(key, vKeyLo);
+            inside = _mm256_cmpeq_epi32(_mm256_min_epu32(d, vRange), d);
+            d = _mm256_blendv_epi8(dummyBin, _mm256_srl_epi32(d, vShift), inside);
+            _mm256_store_si256((__m256i*)lanes, d);
+            hist[lanes[0]]++;
+            hist[lanes[1]]++;
+            hist[lanes[2]]++;
+            hist[lanes[3]]++;
+            hist[lanes[4]]++;
+            hist[lanes[5]]++;
+            hist[lanes[6]]++;
+            hist[lanes[7]]++;
+        }
+        volk_32f_quantile_histogram_generic(
+            hist, inputBuffer + tail, keyLo, range, shift, num_points - tail);
+
+        bin = volk_32f_quantile_pick_bin(hist, &rank);
+        volk_32f_quantile_narrow(&keyLo, &range, bin, shift);
+        if (shift == 0) {
+            *result = volk_32f_quantile_from_key(keyLo);
+            return;
+        }
+        if (hist[bin] <= VOLK_QUANTILE_MAX_COLLECT) {
+            break;
+        }
+    }
+
+    vKeyLo = _mm256_set1_epi32(keyLo);
+    vRange = _mm256_set1_epi32(range);
+    count = 0;
+    for (number = 0; number < eighthPoints; number++) {
+        x = _mm256_loadu_si256((const __m256i*)(inputBuffer + 8 * number));
+        key = _mm256_xor_si256(x, _mm256_or_si256(_mm256_srai_epi32(x, 31), signBit));
+        d = _mm256_sub_epi32(key, vKeyLo);
+        inside = _mm256_cmpeq_epi32(_mm256_min_epu32(d, vRange), d);
+        mask = _mm256_movemask_ps(_mm256_castsi256_ps(inside));
+        if (mask) {
+            for (lane = 0; lane < 8; lane++) {
+                if (mask & (1 << lane)) {
+                    buffer[count++] = inputBuffer[8 * number + lane];
+                }
+            }
+        }
+    }
+    count += volk_32f_quantile_collect_generic(
+        buffer + count, inputBuffer + tail, keyLo, range, num_points - tail);
+
+    *result = volk_32f_quantile_select(buffer, count, rank);
+}
+
+#endif /* LV_HAVE_AVX2 */
+
+
+#ifdef LV_HAVE_AVX512F
+#include <immintrin.h>
+
+static inline void volk_32f_s32f_quantile_32f_u_avx512f(float* result,
+                                                        const float* inputBuffer,
+                                                        const float quantile,
+                                                        unsigned int num_points)
+{
+    unsigned int hist[VOLK_QUANTILE_BINS + 1];
+    float buffer[VOLK_QUANTILE_MAX_COLLECT];
+    __VOLK_ATTR_ALIGNED(64) uint32_t lanes[16];
+    unsigned int rank = volk_32f_quantile_rank(quantile, num_points);
+    const unsigned int sixteenthPoints = num_points / 16;
+    const unsigned int tail = sixteenthPoints * 16;
+    const __m512i signBit = _mm512_set1_epi32(0x80000000);
+    const __m512i dummyBin = _mm512_set1_epi32(VOLK_QUANTILE_BINS);
+    __m512i x, key, d, vKeyLo, vRange;
+    __m512 vMin, vMax, v;
+    __m128i vShift;
+    __mmask16 inside;
+    float minValue, maxValue;
+    uint32_t keyLo, range;
+    unsigned int shift, bin, number, count;
+
+    if (num_points == 0) {
+        return;
+    }
+    if (num_points <= VOLK_QUANTILE_MAX_COLLECT) {
+        memcpy(buffer, inputBuffer, num_points * sizeof(float));
+        *result = volk_32f_quantile_select(buffer, num_points, rank);
+        return;
+    }
+
+    vMin = vMax = _mm512_loadu_ps(inputBuffer);
+    for (number = 1; number < sixteenthPoints; number++) {
+        v = _mm512_loadu_ps(inputBuffer + 16 * number);
+        vMin = _mm512_min_ps(vMin, v);
+        vMax = _mm512_max_ps(vMax, v);
+    }
+    minValue = _mm512_reduce_min_ps(vMin);
+    maxValue = _mm512_reduce_max_ps(vMax);
+    for (number = tail; number < num_points; number++) {
+        minValue = (inputBuffer[number] < minValue) ? inputBuffer[number] : minValue;
+        maxValue = (inputBuffer[number] > maxValue) ? inputBuffer[number] : maxValue;
+    }
+    volk_32f_quantile_window(&keyLo, &range, minValue, maxValue);
+
+    for (;;) {
+        shift = volk_32f_quantile_shift(range);
+        memset(hist, 0, sizeof(hist));
+        vKeyLo = _mm512_set1_epi32(keyLo);
+        vRange = _mm512_set1_epi32(range);
+        vShift = _mm_cvtsi32_si128(shift);
+        for (number = 0; number < sixteenthPoints; number++) {
+            x = _mm512_loadu_si512(inputBuffer + 16 * number);
+            key = _mm512_xor_si512(x, _mm512_or_si512(_mm512_srai_epi32(x, 31), signBit));
+            d = _mm512_sub_epi32(key, vKeyLo);
+            inside = _mm512_cmple_epu32_mask(d, vRange);
+            d = _mm512_mask_blend_epi32(inside, dummyBin, _mm512_srl_epi32(d, vShift));
+            _mm512_store_si512(lanes, d);
+            hist[lanes[0]]++;
+            hist[lanes[1]]++;
+            hist[lanes[2]]++;
+            hist[lanes[3]]++;
+            hist[lanes[4]]++;
+            hist[lanes[5]]++;
+            hist[lanes[6]]++;
+            hist[lanes[7]]++;
+            hist[lanes[8]]++;
+            hist[lanes[9]]++;
+            hist[lanes[10]]++;
+            hist[lanes[11]]++;
+            hist[lanes[12]]++;
+            hist[lanes[13]]++;
+            hist[lanes[14]]++;
+            hist[lanes[15]]++;
+        }
+        volk_32f_quantile_histogram_generic(
+            hist, inputBuffer + tail, keyLo, range, shift, num_points - tail);
+
+        bin = volk_32f_quantile_pick_bin(hist, &rank);
+        volk_32f_quantile_narrow(&keyLo, &range, bin, shift);
+        if (shift == 0) {
+            *result = volk_32f_quantile_from_key(keyLo);
+            return;
+        }
+        if (hist[bin] <= VOLK_QUANTILE_MAX_COLLECT) {
+            break;
+        }
+    }
+
+    vKeyLo = _mm512_set1_epi32(keyLo);
+    vRange = _mm512_set1_epi32(range);
+    count = 0;
+    for (number = 0; number < sixteenthPoints; number++) {
+        x = _mm512_loadu_si512(inputBuffer + 16 * number);
+        key = _mm512_xor_si512(x, _mm512_or_si512(_mm512_srai_epi32(x, 31), signBit));
+        d = _mm512_sub_epi32(key, vKeyLo);
+        inside = _mm512_cmple_epu32_mask(d, vRange);
+        if (inside) {
+            _mm512_mask_compressstoreu_ps(buffer + count, inside, _mm512_castsi512_ps(x));
+            for (; inside; inside &= inside - 1) {
+                count++;
+            }
+        }
+    }
+    count += volk_32f_quantile_collect_generic(
+        buffer + count, inputBuffer + tail, keyLo, range, num_points - tail);
+
+    *result = volk_32f_quantile_select(buffer, count, rank);
+}
+
+#endif /* LV_HAVE_AVX512F */
+
+
+#ifdef LV_HAVE_NEON
+#include <arm_neon.h>
+
+static inline void volk_32f_s32f_quantile_32f_neon(float* result,
+                                                   const float* inputBuffer,
+                                                   const float quantile,
+                                                   unsigned int num_points)
+{
+    unsigned int hist[VOLK_QUANTILE_BINS + 1];
+    float buffer[VOLK_QUANTILE_MAX_COLLECT];
+    uint32_t lanes[4];
+    uint32_t insideLanes[4];
+    unsigned int rank = volk_32f_quantile_rank(quantile, num_points);
+    const unsigned int quarterPoints = num_points / 4;
+    const unsigned int tail = quarterPoints * 4;
+    const uint32x4_t signBit = vdupq_n_u32(0x80000000);
+    const uint32x4_t dummyBin = vdupq_n_u32(VOLK_QUANTILE_BINS);
+    uint32x4_t x, key, d, inside, vKeyLo, vRange;
+    int32x4_t vShift;
+    float32x4_t vMin, vMax, v;
+    float32x2_t vMin2, vMax2;
+    float minValue, maxValue;
+    uint32_t keyLo, range;
+    unsigned int shift, bin, number, lane, count;
+
+    if (num_points == 0) {
+        return;
+    }
+    if (num_points <= VOLK_QUANTILE_MAX_COLLECT) {
+        memcpy(buffer, inputBuffer, num_points * sizeof(float));
+        *result = volk_32f_quantile_select(buffer, num_points, rank);
+        return;
+    }
+
+    vMin = vMax = vld1q_f32(inputBuffer);
+    for (number = 1; number < quarterPoints; number++) {
+        v = vld1q_f32(inputBuffer + 4 * number);
+        vMin = vminq_f32(vMin, v);
+        vMax = vmaxq_f32(vMax, v);
+    }
+    vMin2 = vpmin_f32(vget_low_f32(vMin), vget_high_f32(vMin));
+    vMax2 = vpmax_f32(vget_low_f32(vMax), vget_high_f32(vMax));
+    minValue = vget_lane_f32(vpmin_f32(vMin2, vMin2), 0);
+    maxValue = vget_lane_f32(vpmax_f32(vMax2, vMax2), 0);
+    for (number = tail; number < num_points; number++) {
+        minValue = (inputBuffer[number] < minValue) ? inputBuffer[number] : minValue;
+        maxValue = (inputBuffer[number] > maxValue) ? inputBuffer[number] : maxValue;
+    }
+    volk_32f_quantile_window(&keyLo, &range, minValue, maxValue);
+
+    for (;;) {
+        shift = volk_32f_quantile_shift(range);
+        memset(hist, 0, sizeof(hist));
+        vKeyLo = vdupq_n_u32(keyLo);
+        vRange = vdupq_n_u32(range);
+        vShift = vdupq_n_s32(-(int)shift);
+        for (number = 0; number < quarterPoints; number++) {
+            x = vld1q_u32((const uint32_t*)inputBuffer + 4 * number);
+            key = vreinterpretq_u32_s32(vshrq_n_s32(vreinterpretq_s32_u32(x), 31));
+            key = veorq_u32(x, vorrq_u32(key, signBit));
+            d = vsubq_u32(key, vKeyLo);
+            inside = vcleq_u32(d, vRange);
+            d = vbslq_u32(inside, vshlq_u32(d, vShift), dummyBin);
+            vst1q_u32(lanes, d);
+            hist[lanes[0]]++;
+            hist[lanes[1]]++;
+            hist[lanes[2]]++;
+            hist[lanes[3]]++;
+        }
+        volk_32f_quantile_histogram_generic(
+            hist, inputBuffer + tail, keyLo, range, shift, num_points - tail);
+
+        bin = volk_32f_quantile_pick_bin(hist, &rank);
+        volk_32f_quantile_narrow(&keyLo, &range, bin, shift);
+        if (shift == 0) {
+            *result = volk_32f_quantile_from_key(keyLo);
+            return;
+        }
+        if (hist[bin] <= VOLK_QUANTILE_MAX_COLLECT) {
+            break;
+        }
+    }
+
+    vKeyLo = vdupq_n_u32(keyLo);
+    vRange = vdupq_n_u32(range);
+    count = 0;
+    for (number = 0; number < quarterPoints; number++) {
+        x = vld1q_u32((const uint32_t*)inputBuffer + 4 * number);
+        key = vreinterpretq_u32_s32(vshrq_n_s32(vreinterpretq_s32_u32(x), 31));
+        key = veorq_u32(x, vorrq_u32(key, signBit));
+        inside = vcleq_u32(vsubq_u32(key, vKeyLo), vRange);
+        vst1q_u32(insideLanes, inside);
+        for (lane = 0; lane < 4; lane++) {
+            if (insideLanes[lane]) {
+                buffer[count++] = inputBuffer[4 * number + lane];
+            }
+        }
+    }
+    count += volk_32f_quantile_collect_generic(
+        buffer + count, inputBuffer + tail, keyLo, range, num_points - tail);
+
+    *result = volk_32f_quantile_select(buffer, count, rank);
+}
+
+#endif /* LV_HAVE_NEON */
+
+#endif /* INCLUDED_volk_32f_s32f_quantile_32f_u_H */
@@ -0,0 +1,134 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2026 Free Software Foundation, Inc.
+ *
+ * This file is part of VOLK
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+/*!
+ * \page volk_32f_s32f_quantile_noise_floor_32f
+ *
+ * \b Overview
+ *
+ * Estimates the noise floor of a power spectrum in dB from one of its
+ * quantiles (see volk_32f_s32f_quantile_32f).
+ *
+ * The power of a noise bin is exponentially distributed, so its q quantile
+ * lies 10 * log10(-ln(1 - q)) dB off the mean noise power, e.g. the median is
+ * 1.59 dB below it. This offset is removed from the quantile of the spectrum.
+ * Unlike volk_32f_s32f_calc_spectral_noise_floor_32f the estimate is not
+ * biased by signals, as long as they occupy less than 1 - q of the bins.
+ *
+ * <b>Dispatcher Prototype</b>
+ * \code
+ * void volk_32f_s32f_quantile_noise_floor_32f(float* noiseFloorAmplitude,
+ *                                             const float* realDataPoints,
+ *                                             const float quantile,
+ *                                             unsigned int num_points)
+ * \endcode
+ *
+ * \b Inputs
+ * \li realDataPoints: the input power spectrum in dB.
+ * \li quantile: the quantile used for the estimate, between 0 and 1 exclusive.
+ * 0.5 (the median) is a good default.
+ * \li num_points: the number of data points.
+ *
+ * \b Outputs
+ * \li noiseFloorAmplitude: the mean noise power in dB.
+ *
+ * \b Example
+ * \code
+ *   unsigned int N = 4096;
+ *   unsigned int alignment = volk_get_alignment();
+ *   lv_32fc_t* spectrum = (lv_32fc_t*)volk_malloc(sizeof(lv_32fc_t) * N, alignment);
+ *   float* power = (float*)volk_malloc(sizeof(float) * N, alignment);
+ *   float noiseFloor;
+ *
+ *   // spectrum is the output of an FFT
+ *   volk_32fc_s32f_power_spectrum_32f(power, spectrum, 1.f, N);
+ *   volk_32f_s32f_quantile_noise_floor_32f(&noiseFloor, power, 0.5f, N);
+ *
+ *   volk_free(spectrum);
+ *   volk_free(power);
+ * \endcode
+ */
+
+#ifndef INCLUDED_volk_32f_s32f_quantile_noise_floor_32f_u_H
+#define INCLUDED_volk_32f_s32f_quantile_noise_floor_32f_u_H
+
+#include <math.h>
+#include <volk/volk_32f_s32f_quantile_32f.h>
+
+/* Offset in dB from the q quantile to the mean of an exponential distribution */
+static inline float volk_32f_quantile_noise_floor_offset(float quantile)
+{
+    return (float)(-10.0 * log10(-log(1.0 - (double)quantile)));
+}
+
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void
+volk_32f_s32f_quantile_noise_floor_32f_generic(float* noiseFloorAmplitude,
+                                               const float* realDataPoints,
+                                               const float quantile,
+                                               unsigned int num_points)
+{
+    volk_32f_s32f_quantile_32f_generic(
+        noiseFloorAmplitude, realDataPoints, quantile, num_points);
+    *noiseFloorAmplitude += volk_32f_quantile_noise_floor_offset(quantile);
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+
+#ifdef LV_HAVE_AVX2
+
+static inline void
+volk_32f_s32f_quantile_noise_floor_32f_u_avx2(float* noiseFloorAmplitude,
+                                              const float* realDataPoints,
+                                              const float quantile,
+                                              unsigned int num_points)
+{
+    volk_32f_s32f_quantile_32f_u_avx2(
+        noiseFloorAmplitude, realDataPoints, quantile, num_points);
+    *noiseFloorAmplitude += volk_32f_quantile_noise_floor_offset(quantile);
+}
+
+#endif /* LV_HAVE_AVX2 */
+
+
+#ifdef LV_HAVE_AVX512F
+
+static inline void
+volk_32f_s32f_quantile_noise_floor_32f_u_avx512f(float* noiseFloorAmplitude,
+                                                 const float* realDataPoints,
+                                                 const float quantile,
+                                                 unsigned int num_points)
+{
+    volk_32f_s32f_quantile_32f_u_avx512f(
+        noiseFloorAmplitude, realDataPoints, quantile, num_points);
+    *noiseFloorAmplitude += volk_32f_quantile_noise_floor_offset(quantile);
+}
+
+#endif /* LV_HAVE_AVX512F */
+
+
+#ifdef LV_HAVE_NEON
+
+static inline void
+volk_32f_s32f_quantile_noise_floor_32f_neon(float* noiseFloorAmplitude,
+                                            const float* realDataPoints,
+                                            const float quantile,
+                                            unsigned int num_points)
+{
+    volk_32f_s32f_quantile_32f_neon(
+        noiseFloorAmplitude, realDataPoints, quantile, num_points);
+    *noiseFloorAmplitude += volk_32f_quantile_noise_floor_offset(quantile);
+}
+
+#endif /* LV_HAVE_NEON */
+
+#endif /* INCLUDED_volk_32f_s32f_quantile_noise_floor_32f_u_H */
@@ -0,0 +1,229 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2026 Free Software Foundation, Inc.
+ *
+ * This file is part of VOLK
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+/*!
+ * \page volk_32f_s32f_x2_histogram_32u
+ *
+ * \b Overview
+ *
+ * Counts the elements of a float vector into num_bins equally wide bins
+ * between minValue and maxValue. An element x falls into bin
+ * floor((x - minValue) * num_bins / (maxValue - minValue)). Elements below
+ * minValue are counted into the first bin, elements at or above maxValue into
+ * the last bin, so the counts always add up to num_points.
+ *
+ * The SIMD implementations compute the bin indices and count into several
+ * interleaved sub-histograms to avoid store-to-load stalls on repeated bins
+ * when num_bins is small.
+ *
+ * <b>Dispatcher Prototype</b>
+ * \code
+ * void volk_32f_s32f_x2_histogram_32u(uint32_t* histogram, const float* inputBuffer,
+ *                                     const float minValue, const float maxValue,
+ *                                     unsigned int num_bins, unsigned int num_points)
+ * \endcode
+ *
+ * \b Inputs
+ * \li inputBuffer: the input vector.
+ * \li minValue: the lower edge of the first bin.
+ * \li maxValue: the upper edge of the last bin, must be larger than minValue.
+ * \li num_bins: the number of bins, at least 1.
+ * \li num_points: the number of elements in the input vector.
+ *
+ * \b Outputs
+ * \li histogram: the num_bins counts, overwritten.
+ *
+ * \b Example
+ * Histogram of a ramp between -1 and 1.
+ * \code
+ *   unsigned int N = 1000;
+ *   unsigned int bins = 10;
+ *   unsigned int alignment = volk_get_alignment();
+ *   float* in = (float*)volk_malloc(sizeof(float) * N, alignment);
+ *   uint32_t* hist = (uint32_t*)volk_malloc(sizeof(uint32_t) * bins, alignment);
+ *
+ *   for (unsigned int ii = 0; ii < N; ++ii) {
+ *       in[ii] = -1.f + 2.f * ii / N;
+ *   }
+ *
+ *   volk_32f_s32f_x2_histogram_32u(hist, in, -1.f, 1.f, bins, N); // hist[ii] == 100
+ *
+ *   volk_free(in);
+ *   volk_free(hist);
+ * \endcode
+ */
+
+#ifndef INCLUDED_volk_32f_s32f_x2_histogram_32u_u_H
+#define INCLUDED_volk_32f_s32f_x2_histogram_32u_u_H
+
+#include <inttypes.h>
+#include <string.h>
+#include <volk/volk_common.h>
+
+/* Sub-histograms are used up to this number of bins */
+#define VOLK_HISTOGRAM_MAX_SUB_BINS 1024
+
+static inline unsigned int
+volk_32f_histogram_bin(float value, float minValue, float scale, float lastBin)
+{
+    float bin = (value - minValue) * scale;
+    bin = (bin > 0.f) ? bin : 0.f;
+    bin = (bin < lastBin) ? bin : lastBin;
+    return (unsigned int)bin;
+}
+
+/* Point four sub-histograms into the scratch buffer if it is large enough,
+ * otherwise at the histogram itself. */
+static inline uint32_t* volk_32f_histogram_setup(uint32_t** sub,
+                                                 uint32_t* scratch,
+                                                 uint32_t* histogram,
+                                                 unsigned int num_bins)
+{
+    uint32_t* base = (num_bins <= VOLK_HISTOGRAM_MAX_SUB_BINS) ? scratch : histogram;
+    unsigned int stride = (base == scratch) ? num_bins : 0;
+    unsigned int ii;
+
+    memset(histogram, 0, num_bins * sizeof(uint32_t));
+    if (base == scratch) {
+        memset(scratch, 0, 4 * num_bins * sizeof(uint32_t));
+    }
+    for (ii = 0; ii < 4; ii++) {
+        sub[ii] = base + ii * stride;
+    }
+    return base;
+}
+
+static inline void volk_32f_histogram_merge(uint32_t* histogram,
+                                            const uint32_t* scratch,
+                                            const uint32_t* base,
+                                            unsigned int num_bins)
+{
+    unsigned int ii;
+    if (base == scratch) {
+        for (ii = 0; ii < num_bins; ii++) {
+            histogram[ii] = scratch[ii] + scratch[num_bins + ii] +
+                            scratch[2 * num_bins + ii] + scratch[3 * num_bins + ii];
+        }
+    }
+}
+
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void volk_32f_s32f_x2_histogram_32u_generic(uint32_t* histogram,
+                                                          const float* inputBuffer,
+                                                          const float minValue,
+                                                          const float maxValue,
+                                                          unsigned int num_bins,
+                                                          unsigned int num_points)
+{
+    const float scale = (float)num_bins / (maxValue - minValue);
+    const float lastBin = (float)(num_bins - 1);
+    unsigned int number;
+
+    memset(histogram, 0, num_bins * sizeof(uint32_t));
+    for (number = 0; number < num_points; number++) {
+        histogram[volk_32f_histogram_bin(*inputBuffer++, minValue, scale, lastBin)]++;
+    }
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+
+#ifdef LV_HAVE_AVX2
+#include <immintrin.h>
+
+static inline void volk_32f_s32f_x2_histogram_32u_u_avx2(uint32_t* histogram,
+                                                         const float* inputBuffer,
+                                                         const float minValue,
+                                                         const float maxValue,
+                                                         unsigned int num_bins,
+                                                         unsigned int num_points)
+{
+    uint32_t scratch[4 * VOLK_HISTOGRAM_MAX_SUB_BINS];
+    __VOLK_ATTR_ALIGNED(32) uint32_t lanes[8];
+    uint32_t* sub[4];
+    const float scale = (float)num_bins / (maxValue - minValue);
+    const float lastBin = (float)(num_bins - 1);
+    const unsigned int eighthPoints = num_points / 8;
+    const __m256 vMin = _mm256_set1_ps(minValue);
+    const __m256 vScale = _mm256_set1_ps(scale);
+    const __m256 vLast = _mm256_set1_ps(lastBin);
+    const __m256 zero = _mm256_setzero_ps();
+    const uint32_t* base = volk_32f_histogram_setup(sub, scratch, histogram, num_bins);
+    __m256 bin;
+    unsigned int number;
+
+    for (number = 0; number < eighthPoints; number++) {
+        bin = _mm256_mul_ps(_mm256_sub_ps(_mm256_loadu_ps(inputBuffer), vMin), vScale);
+        bin = _mm256_min_ps(_mm256_max_ps(bin, zero), vLast);
+        _mm256_store_si256((__m256i*)lanes, _mm256_cvttps_epi32(bin));
+        sub[0][lanes[0]]++;
+        sub[1][lanes[1]]++;
+        sub[2][lanes[2]]++;
+        sub[3][lanes[3]]++;
+        sub[0][lanes[4]]++;
+        sub[1][lanes[5]]++;
+        sub[2][lanes[6]]++;
+        sub[3][lanes[7]]++;
+        inputBuffer += 8;
+    }
+
+    for (number = eighthPoints * 8; number < num_points; number++) {
+        sub[0][volk_32f_histogram_bin(*inputBuffer++, minValue, scale, lastBin)]++;
+    }
+    volk_32f_histogram_merge(histogram, scratch, base, num_bins);
+}
+
+#endif /* LV_HAVE_AVX2 */
+
+
+#ifdef LV_HAVE_NEON
+#include <arm_neon.h>
+
+static inline void volk_32f_s32f_x2_histogram_32u_neon(uint32_t* histogram,
+                                                       const float* inputBuffer,
+                                                       const float minValue,
+                                                       const float maxValue,
+                                                       unsigned int num_bins,
+                                                       unsigned int num_points)
+{
+    uint32_t scratch[4 * VOLK_HISTOGRAM_MAX_SUB_BINS];
+    uint32_t lanes[4];
+    uint32_t* sub[4];
+    const float scale = (float)num_bins / (maxValue - minValue);
+    const float lastBin = (float)(num_bins - 1);
+    const unsigned int quarterPoints = num_points / 4;
+    const float32x4_t vMin = vdupq_n_f32(minValue);
+    const float32x4_t vScale = vdupq_n_f32(scale);
+    const float32x4_t vLast = vdupq_n_f32(lastBin);
+    const uint32_t* base = volk_32f_histogram_setup(sub, scratch, histogram, num_bins);
+    float32x4_t bin;
+    unsigned int number;
+
+    for (number = 0; number < quarterPoints; number++) {
+        bin = vmulq_f32(vsubq_f32(vld1q_f32(inputBuffer), vMin), vScale);
+        // negative bins and NaN convert to 0
+        vst1q_u32(lanes, vcvtq_u32_f32(vminq_f32(bin, vLast)));
+        sub[0][lanes[0]]++;
+        sub[1][lanes[1]]++;
+        sub[2][lanes[2]]++;
+        sub[3][lanes[3]]++;
+        inputBuffer += 4;
+    }
+
+    for (number = quarterPoints * 4; number < num_points; number++) {
+        sub[0][volk_32f_histogram_bin(*inputBuffer++, minValue, scale, lastBin)]++;
+    }
+    volk_32f_histogram_merge(histogram, scratch, base, num_bins);
+}
+
+#endif /* LV_HAVE_NEON */
+
+#endif /* INCLUDED_volk_32f_s32f_x2_histogram_32u_u_H */
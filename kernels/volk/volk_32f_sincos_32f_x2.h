@@ -0,0 +1,351 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2026 Free Software Foundation, Inc.
+ *
+ * This file is part of VOLK
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+/*!
+ * \page volk_32f_sincos_32f_x2
+ *
+ * \b Overview
+ *
+ * Computes the sine and the cosine of the input vector in one pass and stores
+ * the results in two output vectors. The range reduction is shared between
+ * both results, so this is cheaper than calling volk_32f_sin_32f and
+ * volk_32f_cos_32f on the same input.
+ *
+ * <b>Dispatcher Prototype</b>
+ * \code
+ * void volk_32f_sincos_32f_x2(float* sinVector, float* cosVector,
+ *                             const float* inVector, unsigned int num_points)
+ * \endcode
+ *
+ * \b Inputs
+ * \li inVector: The input vector of angles in radians.
+ * \li num_points: The number of data points.
+ *
+ * \b Outputs
+ * \li sinVector: The sine of each input value.
+ * \li cosVector: The cosine of each input value.
+ *
+ * \b Example
+ * Calculate sin(theta) and cos(theta) for several common angles.
+ * \code
+ *   int N = 10;
+ *   unsigned int alignment = volk_get_alignment();
+ *   float* in = (float*)volk_malloc(sizeof(float)*N, alignment);
+ *   float* sin_out = (float*)volk_malloc(sizeof(float)*N, alignment);
+ *   float* cos_out = (float*)volk_malloc(sizeof(float)*N, alignment);
+ *
+ *   for(unsigned int ii = 0; ii < N; ++ii){
+ *       in[ii] = 0.349f * ii;
+ *   }
+ *
+ *   volk_32f_sincos_32f_x2(sin_out, cos_out, in, N);
+ *
+ *   for(unsigned int ii = 0; ii < N; ++ii){
+ *       printf("sin(%1.3f) = %1.3f, cos(%1.3f) = %1.3f\n",
+ *              in[ii], sin_out[ii], in[ii], cos_out[ii]);
+ *   }
+ *
+ *   volk_free(in);
+ *   volk_free(sin_out);
+ *   volk_free(cos_out);
+ * \endcode
+ */
+
+#include <inttypes.h>
+#include <math.h>
+#include <stdio.h>
+
+#ifndef INCLUDED_volk_32f_sincos_32f_x2_a_H
+#define INCLUDED_volk_32f_sincos_32f_x2_a_H
+
+#ifdef LV_HAVE_AVX512F
+#include <immintrin.h>
+#include <volk/volk_avx512_intrinsics.h>
+
+static inline void volk_32f_sincos_32f_x2_a_avx512f(float* sinVector,
+                                                    float* cosVector,
+                                                    const float* inVector,
+                                                    unsigned int num_points)
+{
+    float* sinPtr = sinVector;
+    float* cosPtr = cosVector;
+    const float* inPtr = inVector;
+
+    unsigned int number = 0;
+    const unsigned int sixteenthPoints = num_points / 16;
+
+    __m512 aVal, sine, cosine;
+    for (; number < sixteenthPoints; number++) {
+        aVal = _mm512_load_ps(inPtr);
+        _mm512_sincos_ps_avx512f(aVal, &sine, &cosine);
+        _mm512_store_ps(sinPtr, sine);
+        _mm512_store_ps(cosPtr, cosine);
+        inPtr += 16;
+        sinPtr += 16;
+        cosPtr += 16;
+    }
+
+    number = sixteenthPoints * 16;
+    for (; number < num_points; number++) {
+        *sinPtr++ = sinf(*inPtr);
+        *cosPtr++ = cosf(*inPtr++);
+    }
+}
+
+#endif /* LV_HAVE_AVX512F for aligned */
+
+#ifdef LV_HAVE_AVX2
+#include <immintrin.h>
+#include <volk/volk_avx2_intrinsics.h>
+
+static inline void volk_32f_sincos_32f_x2_a_avx2(float* sinVector,
+                                                 float* cosVector,
+                                                 const float* inVector,
+                                                 unsigned int num_points)
+{
+    float* sinPtr = sinVector;
+    float* cosPtr = cosVector;
+    const float* inPtr = inVector;
+
+    unsigned int number = 0;
+    const unsigned int eighthPoints = num_points / 8;
+
+    __m256 aVal, sine, cosine;
+    for (; number < eighthPoints; number++) {
+        aVal = _mm256_load_ps(inPtr);
+        _mm256_sincos_ps_avx2(aVal, &sine, &cosine);
+        _mm256_store_ps(sinPtr, sine);
+        _mm256_store_ps(cosPtr, cosine);
+        inPtr += 8;
+        sinPtr += 8;
+        cosPtr += 8;
+    }
+
+    number = eighthPoints * 8;
+    for (; number < num_points; number++) {
+        *sinPtr++ = sinf(*inPtr);
+        *cosPtr++ = cosf(*inPtr++);
+    }
+}
+
+#endif /* LV_HAVE_AVX2 for aligned */
+
+#ifdef LV_HAVE_SSE4_1
+#include <smmintrin.h>
+#include <volk/volk_sse41_intrinsics.h>
+
+static inline void volk_32f_sincos_32f_x2_a_sse4_1(float* sinVector,
+                                                   float* cosVector,
+                                                   const float* inVector,
+                                                   unsigned int num_points)
+{
+    float* sinPtr = sinVector;
+    float* cosPtr = cosVector;
+    const float* inPtr = inVector;
+
+    unsigned int number = 0;
+    const unsigned int quarterPoints = num_points / 4;
+
+    __m128 aVal, sine, cosine;
+    for (; number < quarterPoints; number++) {
+        aVal = _mm_load_ps(inPtr);
+        _mm_sincos_ps_sse4_1(aVal, &sine, &cosine);
+        _mm_store_ps(sinPtr, sine);
+        _mm_store_ps(cosPtr, cosine);
+        inPtr += 4;
+        sinPtr += 4;
+        cosPtr += 4;
+    }
+
+    number = quarterPoints * 4;
+    for (; number < num_points; number++) {
+        *sinPtr++ = sinf(*inPtr);
+        *cosPtr++ = cosf(*inPtr++);
+    }
+}
+
+#endif /* LV_HAVE_SSE4_1 for aligned */
+
+#endif /* INCLUDED_volk_32f_sincos_32f_x2_a_H */
+
+#ifndef INCLUDED_volk_32f_sincos_32f_x2_u_H
+#define INCLUDED_volk_32f_sincos_32f_x2_u_H
+
+#ifdef LV_HAVE_AVX512F
+#include <immintrin.h>
+#include <volk/volk_avx512_intrinsics.h>
+
+static inline void volk_32f_sincos_32f_x2_u_avx512f(float* sinVector,
+                                                    float* cosVector,
+                                                    const float* inVector,
+                                                    unsigned int num_points)
+{
+    float* sinPtr = sinVector;
+    float* cosPtr = cosVector;
+    const float* inPtr = inVector;
+
+    unsigned int number = 0;
+    const unsigned int sixteenthPoints = num_points / 16;
+
+    __m512 aVal, sine, cosine;
+    for (; number < sixteenthPoints; number++) {
+        aVal = _mm512_loadu_ps(inPtr);
+        _mm512_sincos_ps_avx512f(aVal, &sine, &cosine);
+        _mm512_storeu_ps(sinPtr, sine);
+        _mm512_storeu_ps(cosPtr, cosine);
+        inPtr += 16;
+        sinPtr += 16;
+        cosPtr += 16;
+    }
+
+    number = sixteenthPoints * 16;
+    for (; number < num_points; number++) {
+        *sinPtr++ = sinf(*inPtr);
+        *cosPtr++ = cosf(*inPtr++);
+    }
+}
+
+#endif /* LV_HAVE_AVX512F for unaligned */
+
+#ifdef LV_HAVE_AVX2
+#include <immintrin.h>
+#include <volk/volk_avx2_intrinsics.h>
+
+static inline void volk_32f_sincos_32f_x2_u_avx2(float* sinVector,
+                                                 float* cosVector,
+                                                 const float* inVector,
+                                                 unsigned int num_points)
+{
+    float* sinPtr = sinVector;
+    float* cosPtr = cosVector;
+    const float* inPtr = inVector;
+
+    unsigned int number = 0;
+    const unsigned int eighthPoints = num_points / 8;
+
+    __m256 aVal, sine, cosine;
+    for (; number < eighthPoints; number++) {
+        aVal = _mm256_loadu_ps(inPtr);
+        _mm256_sincos_ps_avx2(aVal, &sine, &cosine);
+        _mm256_storeu_ps(sinPtr, sine);
+        _mm256_storeu_ps(cosPtr, cosine);
+        inPtr += 8;
+        sinPtr += 8;
+        cosPtr += 8;
+    }
+
+    number = eighthPoints * 8;
+    for (; number < num_points; number++) {
+        *sinPtr++ = sinf(*inPtr);
+        *cosPtr++ = cosf(*inPtr++);
+    }
+}
+
+#endif /* LV_HAVE_AVX2 for unaligned */
+
+#ifdef LV_HAVE_SSE4_1
+#include <smmintrin.h>
+#include <volk/volk_sse41_intrinsics.h>
+
+static inline void volk_32f_sincos_32f_x2_u_sse4_1(float* sinVector,
+                                                   float* cosVector,
+                                                   const float* inVector,
+                                                   unsigned int num_points)
+{
+    float* sinPtr = sinVector;
+    float* cosPtr = cosVector;
+    const float* inPtr = inVector;
+
+    unsigned int number = 0;
+    const unsigned int quarterPoints = num_points / 4;
+
+    __m128 aVal, sine, cosine;
+    for (; number < quarterPoints; number++) {
+        aVal = _mm_loadu_ps(inPtr);
+        _mm_sincos_ps_sse4_1(aVal, &sine, &cosine);
+        _mm_storeu_ps(sinPtr, sine);
+        _mm_storeu_ps(cosPtr, cosine);
+        inPtr += 4;
+        sinPtr += 4;
+        cosPtr += 4;
+    }
+
+    number = quarterPoints * 4;
+    for (; number < num_points; number++) {
+        *sinPtr++ = sinf(*inPtr);
+        *cosPtr++ = cosf(*inPtr++);
+    }
+}
+
+#endif /* LV_HAVE_SSE4_1 for unaligned */
+
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void volk_32f_sincos_32f_x2_generic(float* sinVector,
+                                                  float* cosVector,
+                                                  const float* inVector,
+                                                  unsigned int num_points)
+{
+    float* sinPtr = sinVector;
+    float* cosPtr = cosVector;
+    const float* inPtr = inVector;
+    unsigned int number = 0;
+
+    for (number = 0; number < num_points; number++) {
+        *sinPtr++ = sinf(*inPtr);
+        *cosPtr++ = cosf(*inPtr++);
+    }
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+
+#ifdef LV_HAVE_NEON
+#include <arm_neon.h>
+#include <volk/volk_neon_intrinsics.h>
+
+static inline void volk_32f_sincos_32f_x2_neon(float* sinVector,
+                                               float* cosVector,
+                                               const float* inVector,
+                                               unsigned int num_points)
+{
+    unsigned int number = 0;
+    const unsigned int quarter_points = num_points / 4;
+    float* sinVectorPtr = sinVector;
+    float* cosVectorPtr = cosVector;
+    const float* inVectorPtr = inVector;
+
+    float32x4_t a_vec;
+    float32x4x2_t sincos_vec;
+
+    for (number = 0; number < quarter_points; number++) {
+        a_vec = vld1q_f32(inVectorPtr);
+        // Prefetch next one, speeds things up
+        __VOLK_PREFETCH(inVectorPtr + 4);
+        sincos_vec = _vsincosq_f32(a_vec);
+        vst1q_f32(sinVectorPtr, sincos_vec.val[0]);
+        vst1q_f32(cosVectorPtr, sincos_vec.val[1]);
+        // move pointers ahead
+        sinVectorPtr += 4;
+        cosVectorPtr += 4;
+        inVectorPtr += 4;
+    }
+
+    // Deal with the rest
+    for (number = quarter_points * 4; number < num_points; number++) {
+        *sinVectorPtr++ = sinf(*inVectorPtr);
+        *cosVectorPtr++ = cosf(*inVectorPtr++);
+    }
+}
+
+#endif /* LV_HAVE_NEON */
+
+
+#endif /* INCLUDED_volk_32f_sincos_32f_x2_u_H */
@@ -0,0 +1,316 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2026 Free Software Foundation, Inc.
+ *
+ * This file is part of VOLK
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+/*!
+ * \page volk_32f_stats_32f
+ *
+ * \b Overview
+ *
+ * Computes the minimum, the maximum, the indices of their first occurrence,
+ * the mean and the variance of a vector in a single pass. The mean and the
+ * variance use the same Youngs and Cramer updates as
+ * volk_32f_stddev_and_mean_32f_x2.
+ *
+ * The result is a volk_32f_stats_t, so the statistics of consecutive chunks
+ * of a stream can be merged with volk_32f_stats_combine.
+ *
+ * <b>Dispatcher Prototype</b>
+ * \code
+ * void volk_32f_stats_32f(volk_32f_stats_t* stats, const float* inputBuffer,
+ *                         unsigned int num_points)
+ * \endcode
+ *
+ * \b Inputs
+ * \li inputBuffer: the input vector. Must not contain NaN.
+ * \li num_points: the number of elements in the input vector.
+ *
+ * \b Outputs
+ * \li stats: the statistics of the input vector. All fields are 0 if
+ * num_points is 0.
+ *
+ * \b Example
+ * Statistics of a stream that arrives in chunks.
+ * \code
+ *   unsigned int N = 4096;
+ *   unsigned int alignment = volk_get_alignment();
+ *   float* in = (float*)volk_malloc(sizeof(float) * N, alignment);
+ *   volk_32f_stats_t total = { 0 };
+ *   volk_32f_stats_t chunk;
+ *
+ *   for (unsigned int offset = 0; offset < 10 * N; offset += N) {
+ *       // read the next N samples into in
+ *       volk_32f_stats_32f(&chunk, in, N);
+ *       volk_32f_stats_combine(&total, &chunk, offset);
+ *   }
+ *   // total.mean, total.variance, total.max_index, ...
+ *
+ *   volk_free(in);
+ * \endcode
+ */
+
+#ifndef INCLUDED_volk_32f_stats_32f_u_H
+#define INCLUDED_volk_32f_stats_32f_u_H
+
+#include <inttypes.h>
+#include <string.h>
+#include <volk/volk_32f_minmax_index_32u_x2.h>
+#include <volk/volk_32f_stddev_and_mean_32f_x2.h>
+#include <volk/volk_common.h>
+#include <volk/volk_stats.h>
+
+static inline void volk_32f_stats_store(volk_32f_stats_t* stats,
+                                        const volk_32f_minmax_state_t* minmax,
+                                        float sum,
+                                        float squareSum,
+                                        unsigned int num_points)
+{
+    stats->min = minmax->min;
+    stats->max = minmax->max;
+    stats->min_index = minmax->minIndex;
+    stats->max_index = minmax->maxIndex;
+    stats->mean = sum / num_points;
+    stats->variance = squareSum / num_points;
+    stats->count = num_points;
+}
+
+/* Continue the minimum, maximum and the sums of a pass from start on */
+static inline void volk_32f_stats_tail(volk_32f_stats_t* stats,
+                                       volk_32f_minmax_state_t* minmax,
+                                       float sum,
+                                       float squareSum,
+                                       const float* inputBuffer,
+                                       unsigned int start,
+                                       unsigned int num_points)
+{
+    unsigned int number;
+
+    volk_32f_minmax_update(minmax, inputBuffer, start, num_points);
+    for (number = start; number < num_points; number++) {
+        sum += inputBuffer[number];
+        squareSum =
+            update_square_sum_1_val(squareSum, sum, number, inputBuffer[number]);
+    }
+    volk_32f_stats_store(stats, minmax, sum, squareSum, num_points);
+}
+
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void volk_32f_stats_32f_generic(volk_32f_stats_t* stats,
+                                              const float* inputBuffer,
+                                              unsigned int num_points)
+{
+    volk_32f_minmax_state_t minmax;
+
+    if (num_points == 0) {
+        memset(stats, 0, sizeof(*stats));
+        return;
+    }
+    minmax.min = minmax.max = inputBuffer[0];
+    minmax.minIndex = minmax.maxIndex = 0;
+    volk_32f_stats_tail(stats, &minmax, inputBuffer[0], 0.f, inputBuffer, 1, num_points);
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+
+#ifdef LV_HAVE_AVX
+#include <immintrin.h>
+#include <volk/volk_avx_intrinsics.h>
+
+static inline void volk_32f_stats_32f_u_avx(volk_32f_stats_t* stats,
+                                            const float* inputBuffer,
+                                            unsigned int num_points)
+{
+    __VOLK_ATTR_ALIGNED(32) float minLanes[8];
+    __VOLK_ATTR_ALIGNED(32) float maxLanes[8];
+    __VOLK_ATTR_ALIGNED(32) uint32_t minIters[8];
+    __VOLK_ATTR_ALIGNED(32) uint32_t maxIters[8];
+    __VOLK_ATTR_ALIGNED(32) float sumLanes[8];
+    __VOLK_ATTR_ALIGNED(32) float squareSumLanes[8];
+    const unsigned int eighthPoints = num_points / 8;
+    volk_32f_minmax_state_t minmax;
+    __m256 vMin, vMax, minIter, maxIter, values, iter, less, greater;
+    __m256 sum, squareSum, reciprocal, aux;
+    unsigned int number;
+
+    if (num_points < 8) {
+        volk_32f_stats_32f_generic(stats, inputBuffer, num_points);
+        return;
+    }
+
+    vMin = vMax = sum = _mm256_loadu_ps(inputBuffer);
+    minIter = maxIter = squareSum = _mm256_setzero_ps();
+    for (number = 1; number < eighthPoints; number++) {
+        values = _mm256_loadu_ps(inputBuffer + 8 * number);
+        iter = _mm256_castsi256_ps(_mm256_set1_epi32(number));
+        less = _mm256_cmp_ps(values, vMin, _CMP_LT_OQ);
+        greater = _mm256_cmp_ps(values, vMax, _CMP_GT_OQ);
+        vMin = _mm256_blendv_ps(vMin, values, less);
+        vMax = _mm256_blendv_ps(vMax, values, greater);
+        minIter = _mm256_blendv_ps(minIter, iter, less);
+        maxIter = _mm256_blendv_ps(maxIter, iter, greater);
+
+        reciprocal = _mm256_set1_ps(1.f / ((float)number * (number + 1.f)));
+        aux = _mm256_set1_ps(number + 1.f);
+        sum = _mm256_add_ps(sum, values);
+        squareSum =
+            _mm256_accumulate_square_sum_ps(squareSum, sum, values, reciprocal, aux);
+    }
+    _mm256_store_ps(minLanes, vMin);
+    _mm256_store_ps(maxLanes, vMax);
+    _mm256_store_ps((float*)minIters, minIter);
+    _mm256_store_ps((float*)maxIters, maxIter);
+    _mm256_store_ps(sumLanes, sum);
+    _mm256_store_ps(squareSumLanes, squareSum);
+
+    volk_32f_minmax_reduce_lanes(&minmax, minLanes, maxLanes, minIters, maxIters, 8);
+    accrue_result(squareSumLanes, sumLanes, 8, eighthPoints);
+    volk_32f_stats_tail(stats,
+                        &minmax,
+                        sumLanes[0],
+                        squareSumLanes[0],
+                        inputBuffer,
+                        eighthPoints * 8,
+                        num_points);
+}
+
+#endif /* LV_HAVE_AVX */
+
+
+#ifdef LV_HAVE_AVX512F
+#include <immintrin.h>
+
+static inline void volk_32f_stats_32f_u_avx512f(volk_32f_stats_t* stats,
+                                                const float* inputBuffer,
+                                                unsigned int num_points)
+{
+    __VOLK_ATTR_ALIGNED(64) float minLanes[16];
+    __VOLK_ATTR_ALIGNED(64) float maxLanes[16];
+    __VOLK_ATTR_ALIGNED(64) uint32_t minIters[16];
+    __VOLK_ATTR_ALIGNED(64) uint32_t maxIters[16];
+    __VOLK_ATTR_ALIGNED(64) float sumLanes[16];
+    __VOLK_ATTR_ALIGNED(64) float squareSumLanes[16];
+    const unsigned int sixteenthPoints = num_points / 16;
+    volk_32f_minmax_state_t minmax;
+    __m512 vMin, vMax, values, sum, squareSum, reciprocal, aux;
+    __m512i minIter, maxIter, iter;
+    __mmask16 less, greater;
+    unsigned int number;
+
+    if (num_points < 16) {
+        volk_32f_stats_32f_generic(stats, inputBuffer, num_points);
+        return;
+    }
+
+    vMin = vMax = sum = _mm512_loadu_ps(inputBuffer);
+    squareSum = _mm512_setzero_ps();
+    minIter = maxIter = _mm512_setzero_si512();
+    for (number = 1; number < sixteenthPoints; number++) {
+        values = _mm512_loadu_ps(inputBuffer + 16 * number);
+        iter = _mm512_set1_epi32(number);
+        less = _mm512_cmp_ps_mask(values, vMin, _CMP_LT_OQ);
+        greater = _mm512_cmp_ps_mask(values, vMax, _CMP_GT_OQ);
+        vMin = _mm512_mask_mov_ps(vMin, less, values);
+        vMax = _mm512_mask_mov_ps(vMax, greater, values);
+        minIter = _mm512_mask_mov_epi32(minIter, less, iter);
+        maxIter = _mm512_mask_mov_epi32(maxIter, greater, iter);
+
+        // squareSum += ((n + 1) * x - sum)^2 / (n * (n + 1))
+        reciprocal = _mm512_set1_ps(1.f / ((float)number * (number + 1.f)));
+        sum = _mm512_add_ps(sum, values);
+        aux = _mm512_sub_ps(_mm512_mul_ps(_mm512_set1_ps(number + 1.f), values), sum);
+        squareSum = _mm512_fmadd_ps(_mm512_mul_ps(aux, aux), reciprocal, squareSum);
+    }
+    _mm512_store_ps(minLanes, vMin);
+    _mm512_store_ps(maxLanes, vMax);
+    _mm512_store_si512(minIters, minIter);
+    _mm512_store_si512(maxIters, maxIter);
+    _mm512_store_ps(sumLanes, sum);
+    _mm512_store_ps(squareSumLanes, squareSum);
+
+    volk_32f_minmax_reduce_lanes(&minmax, minLanes, maxLanes, minIters, maxIters, 16);
+    accrue_result(squareSumLanes, sumLanes, 16, sixteenthPoints);
+    volk_32f_stats_tail(stats,
+                        &minmax,
+                        sumLanes[0],
+                        squareSumLanes[0],
+                        inputBuffer,
+                        sixteenthPoints * 16,
+                        num_points);
+}
+
+#endif /* LV_HAVE_AVX512F */
+
+
+#ifdef LV_HAVE_NEON
+#include <arm_neon.h>
+#include <volk/volk_neon_intrinsics.h>
+
+static inline void volk_32f_stats_32f_neon(volk_32f_stats_t* stats,
+                                           const float* inputBuffer,
+                                           unsigned int num_points)
+{
+    float minLanes[4];
+    float maxLanes[4];
+    uint32_t minIters[4];
+    uint32_t maxIters[4];
+    float sumLanes[4];
+    float squareSumLanes[4];
+    const unsigned int quarterPoints = num_points / 4;
+    volk_32f_minmax_state_t minmax;
+    float32x4_t vMin, vMax, values, sum, squareSum, reciprocal, aux;
+    uint32x4_t minIter, maxIter, iter, less, greater;
+    unsigned int number;
+
+    if (num_points < 4) {
+        volk_32f_stats_32f_generic(stats, inputBuffer, num_points);
+        return;
+    }
+
+    vMin = vMax = sum = vld1q_f32(inputBuffer);
+    squareSum = vdupq_n_f32(0.f);
+    minIter = maxIter = vdupq_n_u32(0);
+    for (number = 1; number < quarterPoints; number++) {
+        values = vld1q_f32(inputBuffer + 4 * number);
+        iter = vdupq_n_u32(number);
+        less = vcltq_f32(values, vMin);
+        greater = vcgtq_f32(values, vMax);
+        vMin = vbslq_f32(less, values, vMin);
+        vMax = vbslq_f32(greater, values, vMax);
+        minIter = vbslq_u32(less, iter, minIter);
+        maxIter = vbslq_u32(greater, iter, maxIter);
+
+        reciprocal = vdupq_n_f32(1.f / ((float)number * (number + 1.f)));
+        aux = vdupq_n_f32(number + 1.f);
+        sum = vaddq_f32(sum, values);
+        squareSum =
+            _neon_accumulate_square_sum_f32(squareSum, sum, values, reciprocal, aux);
+    }
+    vst1q_f32(minLanes, vMin);
+    vst1q_f32(maxLanes, vMax);
+    vst1q_u32(minIters, minIter);
+    vst1q_u32(maxIters, maxIter);
+    vst1q_f32(sumLanes, sum);
+    vst1q_f32(squareSumLanes, squareSum);
+
+    volk_32f_minmax_reduce_lanes(&minmax, minLanes, maxLanes, minIters, maxIters, 4);
+    accrue_result(squareSumLanes, sumLanes, 4, quarterPoints);
+    volk_32f_stats_tail(stats,
+                        &minmax,
+                        sumLanes[0],
+                        squareSumLanes[0],
+                        inputBuffer,
+                        quarterPoints * 4,
+                        num_points);
+}
+
+#endif /* LV_HAVE_NEON */
+
+#endif /* INCLUDED_volk_32f_stats_32f_u_H */
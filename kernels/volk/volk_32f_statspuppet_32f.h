@@ -0,0 +1,125 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2026 Free Software Foundation, Inc.
+ *
+ * This file is part of VOLK
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+/* For documentation see 'kernels/volk/volk_32f_stats_32f.h'
+ * This file exists for test purposes only. Should not be used directly.
+ *
+ * Writes the statistics of the whole input as floats, followed by the
+ * statistics of the input processed in two chunks and merged.
+ */
+
+#ifndef INCLUDED_volk_32f_statspuppet_32f_H
+#define INCLUDED_volk_32f_statspuppet_32f_H
+
+#include <volk/volk_32f_stats_32f.h>
+
+static inline void volk_32f_statspuppet_store(float* out, const volk_32f_stats_t* stats)
+{
+    out[0] = stats->min;
+    out[1] = stats->max;
+    out[2] = (float)stats->min_index;
+    out[3] = (float)stats->max_index;
+    out[4] = stats->mean;
+    out[5] = stats->variance;
+    out[6] = (float)stats->count;
+}
+
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void volk_32f_statspuppet_32f_generic(float* out,
+                                                    const float* inputBuffer,
+                                                    unsigned int num_points)
+{
+    const unsigned int third = num_points / 3;
+    volk_32f_stats_t whole, part, chunked;
+
+    memset(&chunked, 0, sizeof(chunked));
+    volk_32f_stats_32f_generic(&whole, inputBuffer, num_points);
+    volk_32f_stats_32f_generic(&part, inputBuffer, third);
+    volk_32f_stats_combine(&chunked, &part, 0);
+    volk_32f_stats_32f_generic(&part, inputBuffer + third, num_points - third);
+    volk_32f_stats_combine(&chunked, &part, third);
+
+    volk_32f_statspuppet_store(out, &whole);
+    volk_32f_statspuppet_store(out + 7, &chunked);
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+
+#ifdef LV_HAVE_AVX
+
+static inline void volk_32f_statspuppet_32f_u_avx(float* out,
+                                                  const float* inputBuffer,
+                                                  unsigned int num_points)
+{
+    const unsigned int third = num_points / 3;
+    volk_32f_stats_t whole, part, chunked;
+
+    memset(&chunked, 0, sizeof(chunked));
+    volk_32f_stats_32f_u_avx(&whole, inputBuffer, num_points);
+    volk_32f_stats_32f_u_avx(&part, inputBuffer, third);
+    volk_32f_stats_combine(&chunked, &part, 0);
+    volk_32f_stats_32f_u_avx(&part, inputBuffer + third, num_points - third);
+    volk_32f_stats_combine(&chunked, &part, third);
+
+    volk_32f_statspuppet_store(out, &whole);
+    volk_32f_statspuppet_store(out + 7, &chunked);
+}
+
+#endif /* LV_HAVE_AVX */
+
+
+#ifdef LV_HAVE_AVX512F
+
+static inline void volk_32f_statspuppet_32f_u_avx512f(float* out,
+                                                      const float* inputBuffer,
+                                                      unsigned int num_points)
+{
+    const unsigned int third = num_points / 3;
+    volk_32f_stats_t whole, part, chunked;
+
+    memset(&chunked, 0, sizeof(chunked));
+    volk_32f_stats_32f_u_avx512f(&whole, inputBuffer, num_points);
+    volk_32f_stats_32f_u_avx512f(&part, inputBuffer, third);
+    volk_32f_stats_combine(&chunked, &part, 0);
+    volk_32f_stats_32f_u_avx512f(&part, inputBuffer + third, num_points - third);
+    volk_32f_stats_combine(&chunked, &part, third);
+
+    volk_32f_statspuppet_store(out, &whole);
+    volk_32f_statspuppet_store(out + 7, &chunked);
+}
+
+#endif /* LV_HAVE_AVX512F */
+
+
+#ifdef LV_HAVE_NEON
+
+static inline void volk_32f_statspuppet_32f_neon(float* out,
+                                                 const float* inputBuffer,
+                                                 unsigned int num_points)
+{
+    const unsigned int third = num_points / 3;
+    volk_32f_stats_t whole, part, chunked;
+
+    memset(&chunked, 0, sizeof(chunked));
+    volk_32f_stats_32f_neon(&whole, inputBuffer, num_points);
+    volk_32f_stats_32f_neon(&part, inputBuffer, third);
+    volk_32f_stats_combine(&chunked, &part, 0);
+    volk_32f_stats_32f_neon(&part, inputBuffer + third, num_points - third);
+    volk_32f_stats_combine(&chunked, &part, third);
+
+    volk_32f_statspuppet_store(out, &whole);
+    volk_32f_statspuppet_store(out + 7, &chunked);
+}
+
+#endif /* LV_HAVE_NEON */
+
+#endif /* INCLUDED_volk_32f_statspuppet_32f_H */
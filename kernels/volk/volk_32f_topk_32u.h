@@ -0,0 +1,271 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2026 Free Software Foundation, Inc.
+ *
+ * This file is part of VOLK
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+/*!
+ * \page volk_32f_topk_32u
+ *
+ * \b Overview
+ *
+ * Finds the k largest elements of a vector and writes their indices, sorted
+ * from the largest to the smallest value. Equal values are ordered by
+ * ascending index.
+ *
+ * The current k best elements are kept in a min-heap that lives in the output
+ * buffer. The SIMD implementations compare whole blocks against the smallest
+ * of them and only touch the heap for the few elements that beat it, so for
+ * k much smaller than num_points the cost is close to a single streaming pass.
+ *
+ * <b>Dispatcher Prototype</b>
+ * \code
+ * void volk_32f_topk_32u(uint32_t* indices, const float* inputBuffer,
+ *                        unsigned int k, unsigned int num_points)
+ * \endcode
+ *
+ * \b Inputs
+ * \li inputBuffer: the input vector. Must not contain NaN.
+ * \li k: the number of elements to find. If larger than num_points, only
+ * num_points indices are written.
+ * \li num_points: the number of elements in the input vector.
+ *
+ * \b Outputs
+ * \li indices: the indices of the k largest elements, largest first.
+ *
+ * \b Example
+ * \code
+ *   unsigned int N = 65536;
+ *   unsigned int K = 16;
+ *   unsigned int alignment = volk_get_alignment();
+ *   float* in = (float*)volk_malloc(sizeof(float) * N, alignment);
+ *   uint32_t* indices = (uint32_t*)volk_malloc(sizeof(uint32_t) * K, alignment);
+ *
+ *   // in holds a power spectrum
+ *   volk_32f_topk_32u(indices, in, K, N);
+ *
+ *   volk_free(in);
+ *   volk_free(indices);
+ * \endcode
+ */
+
+#ifndef INCLUDED_volk_32f_topk_32u_u_H
+#define INCLUDED_volk_32f_topk_32u_u_H
+
+#include <inttypes.h>
+
+/* Is element a ranked below element b? */
+static inline int volk_32f_topk_worse(const float* inputBuffer, uint32_t a, uint32_t b)
+{
+    return (inputBuffer[a] < inputBuffer[b]) ||
+           (inputBuffer[a] == inputBuffer[b] && a > b);
+}
+
+static inline void volk_32f_topk_sift_down(uint32_t* heap,
+                                           const float* inputBuffer,
+                                           unsigned int size,
+                                           unsigned int pos)
+{
+    const uint32_t item = heap[pos];
+    unsigned int child;
+    while ((child = 2 * pos + 1) < size) {
+        if (child + 1 < size &&
+            volk_32f_topk_worse(inputBuffer, heap[child + 1], heap[child])) {
+            child++;
+        }
+        if (!volk_32f_topk_worse(inputBuffer, heap[child], item)) {
+            break;
+        }
+        heap[pos] = heap[child];
+        pos = child;
+    }
+    heap[pos] = item;
+}
+
+/* Heap of the first k elements, the worst one at the root */
+static inline void
+volk_32f_topk_init(uint32_t* heap, const float* inputBuffer, unsigned int k)
+{
+    unsigned int ii;
+    for (ii = 0; ii < k; ii++) {
+        heap[ii] = ii;
+    }
+    for (ii = k / 2; ii-- > 0;) {
+        volk_32f_topk_sift_down(heap, inputBuffer, k, ii);
+    }
+}
+
+/* Elements are pushed in ascending index order, so they only need to beat the
+ * value of the root. */
+static inline void volk_32f_topk_push(uint32_t* heap,
+                                      const float* inputBuffer,
+                                      unsigned int k,
+                                      uint32_t index)
+{
+    if (inputBuffer[index] > inputBuffer[heap[0]]) {
+        heap[0] = index;
+        volk_32f_topk_sift_down(heap, inputBuffer, k, 0);
+    }
+}
+
+/* Heap sort, leaves the best element first */
+static inline void
+volk_32f_topk_finish(uint32_t* heap, const float* inputBuffer, unsigned int k)
+{
+    unsigned int size;
+    uint32_t tmp;
+    for (size = k; size > 1; size--) {
+        tmp = heap[0];
+        heap[0] = heap[size - 1];
+        heap[size - 1] = tmp;
+        volk_32f_topk_sift_down(heap, inputBuffer, size - 1, 0);
+    }
+}
+
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void volk_32f_topk_32u_generic(uint32_t* indices,
+                                             const float* inputBuffer,
+                                             unsigned int k,
+                                             unsigned int num_points)
+{
+    unsigned int number;
+
+    k = (k < num_points) ? k : num_points;
+    if (k == 0) {
+        return;
+    }
+    volk_32f_topk_init(indices, inputBuffer, k);
+    for (number = k; number < num_points; number++) {
+        volk_32f_topk_push(indices, inputBuffer, k, number);
+    }
+    volk_32f_topk_finish(indices, inputBuffer, k);
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+
+#ifdef LV_HAVE_AVX2
+#include <immintrin.h>
+
+static inline void volk_32f_topk_32u_u_avx2(uint32_t* indices,
+                                            const float* inputBuffer,
+                                            unsigned int k,
+                                            unsigned int num_points)
+{
+    __m256 threshold;
+    int mask;
+    unsigned int number, lane;
+
+    k = (k < num_points) ? k : num_points;
+    if (k == 0) {
+        return;
+    }
+    volk_32f_topk_init(indices, inputBuffer, k);
+    threshold = _mm256_set1_ps(inputBuffer[indices[0]]);
+    for (number = k; number + 8 <= num_points; number += 8) {
+        mask = _mm256_movemask_ps(
+            _mm256_cmp_ps(_mm256_loadu_ps(inputBuffer + number), threshold, _CMP_GT_OQ));
+        if (mask) {
+            for (lane = 0; lane < 8; lane++) {
+                if (mask & (1 << lane)) {
+                    volk_32f_topk_push(indices, inputBuffer, k, number + lane);
+                }
+            }
+            threshold = _mm256_set1_ps(inputBuffer[indices[0]]);
+        }
+    }
+    for (; number < num_points; number++) {
+        volk_32f_topk_push(indices, inputBuffer, k, number);
+    }
+    volk_32f_topk_finish(indices, inputBuffer, k);
+}
+
+#endif /* LV_HAVE_AVX2 */
+
+
+#ifdef LV_HAVE_AVX512F
+#include <immintrin.h>
+
+static inline void volk_32f_topk_32u_u_avx512f(uint32_t* indices,
+                                               const float* inputBuffer,
+                                               unsigned int k,
+                                               unsigned int num_points)
+{
+    __m512 threshold;
+    __mmask16 mask;
+    unsigned int number, lane;
+
+    k = (k < num_points) ? k : num_points;
+    if (k == 0) {
+        return;
+    }
+    volk_32f_topk_init(indices, inputBuffer, k);
+    threshold = _mm512_set1_ps(inputBuffer[indices[0]]);
+    for (number = k; number + 16 <= num_points; number += 16) {
+        mask = _mm512_cmp_ps_mask(
+            _mm512_loadu_ps(inputBuffer + number), threshold, _CMP_GT_OQ);
+        if (mask) {
+            for (lane = 0; lane < 16; lane++) {
+                if (mask & (1 << lane)) {
+                    volk_32f_topk_push(indices, inputBuffer, k, number + lane);
+                }
+            }
+            threshold = _mm512_set1_ps(inputBuffer[indices[0]]);
+        }
+    }
+    for (; number < num_points; number++) {
+        volk_32f_topk_push(indices, inputBuffer, k, number);
+    }
+    volk_32f_topk_finish(indices, inputBuffer, k);
+}
+
+#endif /* LV_HAVE_AVX512F */
+
+
+#ifdef LV_HAVE_NEON
+#include <arm_neon.h>
+
+static inline void volk_32f_topk_32u_neon(uint32_t* indices,
+                                          const float* inputBuffer,
+                                          unsigned int k,
+                                          unsigned int num_points)
+{
+    float32x4_t threshold;
+    uint32x4_t above;
+    uint32x2_t any;
+    uint32_t lanes[4];
+    unsigned int number, lane;
+
+    k = (k < num_points) ? k : num_points;
+    if (k == 0) {
+        return;
+    }
+    volk_32f_topk_init(indices, inputBuffer, k);
+    threshold = vdupq_n_f32(inputBuffer[indices[0]]);
+    for (number = k; number + 4 <= num_points; number += 4) {
+        above = vcgtq_f32(vld1q_f32(inputBuffer + number), threshold);
+        any = vorr_u32(vget_low_u32(above), vget_high_u32(above));
+        if (vget_lane_u32(vpmax_u32(any, any), 0)) {
+            vst1q_u32(lanes, above);
+            for (lane = 0; lane < 4; lane++) {
+                if (lanes[lane]) {
+                    volk_32f_topk_push(indices, inputBuffer, k, number + lane);
+                }
+            }
+            threshold = vdupq_n_f32(inputBuffer[indices[0]]);
+        }
+    }
+    for (; number < num_points; number++) {
+        volk_32f_topk_push(indices, inputBuffer, k, number);
+    }
+    volk_32f_topk_finish(indices, inputBuffer, k);
+}
+
+#endif /* LV_HAVE_NEON */
+
+#endif /* INCLUDED_volk_32f_topk_32u_u_H */
@@ -0,0 +1,497 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2026 Free Software Foundation, Inc.
+ *
+ * This file is part of VOLK
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+/*!
+ * \page volk_32f_transpose_32f
+ *
+ * \b Overview
+ *
+ * Transposes a rows x cols float matrix with row-major storage, e.g. for
+ * corner turns between time-major and channel-major data.
+ *
+ * outputMatrix[c * output_stride + r] = inputMatrix[r * input_stride + c]
+ *
+ * The matrix is processed in VOLK_TRANSPOSE_BLOCK x VOLK_TRANSPOSE_BLOCK
+ * blocks, so that the rows touched by a block stay in cache and in the TLB,
+ * and every block is transposed in register tiles. When the output is
+ * at least VOLK_TRANSPOSE_STREAM_BYTES (4 MiB) and its rows are aligned to the
+ * vector size, the AVX and AVX-512 implementations write it with
+ * non-temporal stores, which keeps it from evicting the input from cache.
+ *
+ * <b>Dispatcher Prototype</b>
+ * \code
+ * void volk_32f_transpose_32f(float* outputMatrix,
+ *                             const float* inputMatrix,
+ *                             unsigned int rows,
+ *                             unsigned int cols,
+ *                             unsigned int input_stride,
+ *                             unsigned int output_stride)
+ * \endcode
+ *
+ * \b Inputs
+ * \li inputMatrix: the rows x cols input matrix.
+ * \li rows: the number of input rows.
+ * \li cols: the number of input columns.
+ * \li input_stride: the distance between input rows in elements, at least cols.
+ * \li output_stride: the distance between output rows in elements, at least rows.
+ *
+ * \b Outputs
+ * \li outputMatrix: the cols x rows transposed matrix, must not overlap the input.
+ *
+ * \b Example
+ * Turn 1024 snapshots of 64 channels into 64 channel time series.
+ * \code
+ *   unsigned int channels = 64;
+ *   unsigned int snapshots = 1024;
+ *   unsigned int alignment = volk_get_alignment();
+ *   float* in = (float*)volk_malloc(sizeof(float) * channels * snapshots, alignment);
+ *   float* out = (float*)volk_malloc(sizeof(float) * channels * snapshots, alignment);
+ *
+ *   // ... fill in, one row of 64 channels per snapshot
+ *
+ *   volk_32f_transpose_32f(out, in, snapshots, channels, channels, snapshots);
+ *
+ *   volk_free(in);
+ *   volk_free(out);
+ * \endcode
+ */
+
+#ifndef INCLUDED_volk_32f_transpose_32f_H
+#define INCLUDED_volk_32f_transpose_32f_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+// rows and columns of the blocks that are transposed at a time
+#define VOLK_TRANSPOSE_BLOCK 32
+
+// output size from which the AVX and AVX-512 implementations use streaming stores
+#define VOLK_TRANSPOSE_STREAM_BYTES (4u << 20)
+
+static inline unsigned int volk_transpose_min(unsigned int a, unsigned int b)
+{
+    return a < b ? a : b;
+}
+
+// whether an output of cols rows can be written with aligned streaming stores
+static inline int volk_transpose_stream(const void* outputMatrix,
+                                        unsigned int cols,
+                                        unsigned int output_stride,
+                                        size_t element_size,
+                                        size_t alignment)
+{
+    return (size_t)cols * output_stride * element_size >= VOLK_TRANSPOSE_STREAM_BYTES &&
+           (uintptr_t)outputMatrix % alignment == 0 &&
+           output_stride * element_size % alignment == 0;
+}
+
+static inline void volk_32f_transpose_rect(float* outputMatrix,
+                                           const float* inputMatrix,
+                                           unsigned int row_begin,
+                                           unsigned int row_end,
+                                           unsigned int col_begin,
+                                           unsigned int col_end,
+                                           unsigned int input_stride,
+                                           unsigned int output_stride)
+{
+    unsigned int row, col;
+
+    for (col = col_begin; col < col_end; col++) {
+        for (row = row_begin; row < row_end; row++) {
+            outputMatrix[(size_t)col * output_stride + row] =
+                inputMatrix[(size_t)row * input_stride + col];
+        }
+    }
+}
+
+// transposes what the tiles of a block left over on its right and lower edges
+static inline void volk_32f_transpose_edges(float* outputMatrix,
+                                            const float* inputMatrix,
+                                            unsigned int row0,
+                                            unsigned int row_end,
+                                            unsigned int col0,
+                                            unsigned int col_end,
+                                            unsigned int row_tile,
+                                            unsigned int col_tile,
+                                            unsigned int input_stride,
+                                            unsigned int output_stride)
+{
+    const unsigned int row_tiles = row0 + (row_end - row0) / row_tile * row_tile;
+    const unsigned int col_tiles = col0 + (col_end - col0) / col_tile * col_tile;
+
+    volk_32f_transpose_rect(outputMatrix,
+                            inputMatrix,
+                            row0,
+                            row_end,
+                            col_tiles,
+                            col_end,
+                            input_stride,
+                            output_stride);
+    volk_32f_transpose_rect(outputMatrix,
+                            inputMatrix,
+                            row_tiles,
+                            row_end,
+                            col0,
+                            col_tiles,
+                            input_stride,
+                            output_stride);
+}
+
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void volk_32f_transpose_32f_generic(float* outputMatrix,
+                                                  const float* inputMatrix,
+                                                  unsigned int rows,
+                                                  unsigned int cols,
+                                                  unsigned int input_stride,
+                                                  unsigned int output_stride)
+{
+    unsigned int row0, col0;
+
+    for (row0 = 0; row0 < rows; row0 += VOLK_TRANSPOSE_BLOCK) {
+        for (col0 = 0; col0 < cols; col0 += VOLK_TRANSPOSE_BLOCK) {
+            volk_32f_transpose_rect(outputMatrix,
+                                    inputMatrix,
+                                    row0,
+                                    volk_transpose_min(row0 + VOLK_TRANSPOSE_BLOCK, rows),
+                                    col0,
+                                    volk_transpose_min(col0 + VOLK_TRANSPOSE_BLOCK, cols),
+                                    input_stride,
+                                    output_stride);
+        }
+    }
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+
+#ifdef LV_HAVE_SSE
+#include <xmmintrin.h>
+
+static inline void volk_32f_transpose_32f_u_sse(float* outputMatrix,
+                                                const float* inputMatrix,
+                                                unsigned int rows,
+                                                unsigned int cols,
+                                                unsigned int input_stride,
+                                                unsigned int output_stride)
+{
+    unsigned int row0, col0, row_end, col_end, row, col;
+    const float* in;
+    float* out;
+    __m128 r0, r1, r2, r3;
+
+    for (row0 = 0; row0 < rows; row0 += VOLK_TRANSPOSE_BLOCK) {
+        row_end = volk_transpose_min(row0 + VOLK_TRANSPOSE_BLOCK, rows);
+        for (col0 = 0; col0 < cols; col0 += VOLK_TRANSPOSE_BLOCK) {
+            col_end = volk_transpose_min(col0 + VOLK_TRANSPOSE_BLOCK, cols);
+            for (col = col0; col + 4 <= col_end; col += 4) {
+                for (row = row0; row + 4 <= row_end; row += 4) {
+                    in = inputMatrix + (size_t)row * input_stride + col;
+                    out = outputMatrix + (size_t)col * output_stride + row;
+                    r0 = _mm_loadu_ps(in);
+                    r1 = _mm_loadu_ps(in + input_stride);
+                    r2 = _mm_loadu_ps(in + 2 * input_stride);
+                    r3 = _mm_loadu_ps(in + 3 * input_stride);
+                    _MM_TRANSPOSE4_PS(r0, r1, r2, r3);
+                    _mm_storeu_ps(out, r0);
+                    _mm_storeu_ps(out + output_stride, r1);
+                    _mm_storeu_ps(out + 2 * output_stride, r2);
+                    _mm_storeu_ps(out + 3 * output_stride, r3);
+                }
+            }
+            volk_32f_transpose_edges(outputMatrix,
+                                     inputMatrix,
+                                     row0,
+                                     row_end,
+                                     col0,
+                                     col_end,
+                                     4,
+                                     4,
+                                     input_stride,
+                                     output_stride);
+        }
+    }
+}
+
+#endif /* LV_HAVE_SSE */
+
+
+#ifdef LV_HAVE_AVX
+#include <immintrin.h>
+
+static inline void volk_32f_transpose_avx_tiles(float* outputMatrix,
+                                                const float* inputMatrix,
+                                                unsigned int rows,
+                                                unsigned int cols,
+                                                unsigned int input_stride,
+                                                unsigned int output_stride,
+                                                int stream);
+
+static inline void volk_32f_transpose_32f_u_avx(float* outputMatrix,
+                                                const float* inputMatrix,
+                                                unsigned int rows,
+                                                unsigned int cols,
+                                                unsigned int input_stride,
+                                                unsigned int output_stride)
+{
+    const int stream =
+        volk_transpose_stream(outputMatrix, cols, output_stride, sizeof(float), 32);
+    volk_32f_transpose_avx_tiles(
+        outputMatrix, inputMatrix, rows, cols, input_stride, output_stride, stream);
+}
+
+// the tiled transpose, with non-temporal stores if stream is set, which needs
+// the output and its rows aligned to 32 bytes
+static inline void volk_32f_transpose_avx_tiles(float* outputMatrix,
+                                                const float* inputMatrix,
+                                                unsigned int rows,
+                                                unsigned int cols,
+                                                unsigned int input_stride,
+                                                unsigned int output_stride,
+                                                int stream)
+{
+    // streaming stores take two tiles at once, so that every output row
+    // gets a whole cache line
+    const unsigned int row_tile = stream ? 16 : 8;
+    unsigned int row0, col0, row_end, col_end, row, col, half, k;
+    const float* in;
+    float* out;
+    __m256 r[8], t[2][8];
+
+    for (row0 = 0; row0 < rows; row0 += VOLK_TRANSPOSE_BLOCK) {
+        row_end = volk_transpose_min(row0 + VOLK_TRANSPOSE_BLOCK, rows);
+        for (col0 = 0; col0 < cols; col0 += VOLK_TRANSPOSE_BLOCK) {
+            col_end = volk_transpose_min(col0 + VOLK_TRANSPOSE_BLOCK, cols);
+            for (col = col0; col + 8 <= col_end; col += 8) {
+                for (row = row0; row + row_tile <= row_end; row += row_tile) {
+                    for (half = 0; half < row_tile / 8; half++) {
+                        in = inputMatrix + (size_t)(row + 8 * half) * input_stride + col;
+                        for (k = 0; k < 8; k++) {
+                            r[k] = _mm256_loadu_ps(in + k * input_stride);
+                        }
+                        for (k = 0; k < 8; k += 4) {
+                            __m256 lo01 = _mm256_unpacklo_ps(r[k], r[k + 1]);
+                            __m256 hi01 = _mm256_unpackhi_ps(r[k], r[k + 1]);
+                            __m256 lo23 = _mm256_unpacklo_ps(r[k + 2], r[k + 3]);
+                            __m256 hi23 = _mm256_unpackhi_ps(r[k + 2], r[k + 3]);
+                            r[k] = _mm256_shuffle_ps(lo01, lo23, 0x44);
+                            r[k + 1] = _mm256_shuffle_ps(lo01, lo23, 0xEE);
+                            r[k + 2] = _mm256_shuffle_ps(hi01, hi23, 0x44);
+                            r[k + 3] = _mm256_shuffle_ps(hi01, hi23, 0xEE);
+                        }
+                        for (k = 0; k < 4; k++) {
+                            t[half][k] = _mm256_permute2f128_ps(r[k], r[k + 4], 0x20);
+                            t[half][k + 4] = _mm256_permute2f128_ps(r[k], r[k + 4], 0x31);
+                        }
+                    }
+
+                    out = outputMatrix + (size_t)col * output_stride + row;
+                    if (stream) {
+                        for (k = 0; k < 8; k++) {
+                            _mm256_stream_ps(out + k * output_stride, t[0][k]);
+                            _mm256_stream_ps(out + k * output_stride + 8, t[1][k]);
+                        }
+                    } else {
+                        for (k = 0; k < 8; k++) {
+                            _mm256_storeu_ps(out + k * output_stride, t[0][k]);
+                        }
+                    }
+                }
+            }
+            volk_32f_transpose_edges(outputMatrix,
+                                     inputMatrix,
+                                     row0,
+                                     row_end,
+                                     col0,
+                                     col_end,
+                                     row_tile,
+                                     8,
+                                     input_stride,
+                                     output_stride);
+        }
+    }
+
+    if (stream) {
+        _mm_sfence();
+    }
+}
+
+#endif /* LV_HAVE_AVX */
+
+
+#ifdef LV_HAVE_AVX512F
+#include <immintrin.h>
+
+static inline void volk_32f_transpose_avx512f_tiles(float* outputMatrix,
+                                                    const float* inputMatrix,
+                                                    unsigned int rows,
+                                                    unsigned int cols,
+                                                    unsigned int input_stride,
+                                                    unsigned int output_stride,
+                                                    int stream);
+
+static inline void volk_32f_transpose_32f_u_avx512f(float* outputMatrix,
+                                                    const float* inputMatrix,
+                                                    unsigned int rows,
+                                                    unsigned int cols,
+                                                    unsigned int input_stride,
+                                                    unsigned int output_stride)
+{
+    const int stream =
+        volk_transpose_stream(outputMatrix, cols, output_stride, sizeof(float), 64);
+    volk_32f_transpose_avx512f_tiles(
+        outputMatrix, inputMatrix, rows, cols, input_stride, output_stride, stream);
+}
+
+// the tiled transpose, with non-temporal stores if stream is set, which needs
+// the output and its rows aligned to 64 bytes
+static inline void volk_32f_transpose_avx512f_tiles(float* outputMatrix,
+                                                    const float* inputMatrix,
+                                                    unsigned int rows,
+                                                    unsigned int cols,
+                                                    unsigned int input_stride,
+                                                    unsigned int output_stride,
+                                                    int stream)
+{
+    unsigned int row0, col0, row_end, col_end, row, col, k;
+    const float* in;
+    float* out;
+    __m512 r[16], t[16];
+
+    for (row0 = 0; row0 < rows; row0 += VOLK_TRANSPOSE_BLOCK) {
+        row_end = volk_transpose_min(row0 + VOLK_TRANSPOSE_BLOCK, rows);
+        for (col0 = 0; col0 < cols; col0 += VOLK_TRANSPOSE_BLOCK) {
+            col_end = volk_transpose_min(col0 + VOLK_TRANSPOSE_BLOCK, cols);
+            for (col = col0; col + 16 <= col_end; col += 16) {
+                for (row = row0; row + 16 <= row_end; row += 16) {
+                    in = inputMatrix + (size_t)row * input_stride + col;
+                    out = outputMatrix + (size_t)col * output_stride + row;
+                    for (k = 0; k < 16; k++) {
+                        r[k] = _mm512_loadu_ps(in + k * input_stride);
+                    }
+
+                    // 4x4 transposes inside the 128-bit lanes of each group
+                    // of four rows, t[4 * g + j] holds column 4 * lane + j
+                    for (k = 0; k < 16; k += 4) {
+                        __m512 lo01 = _mm512_unpacklo_ps(r[k], r[k + 1]);
+                        __m512 hi01 = _mm512_unpackhi_ps(r[k], r[k + 1]);
+                        __m512 lo23 = _mm512_unpacklo_ps(r[k + 2], r[k + 3]);
+                        __m512 hi23 = _mm512_unpackhi_ps(r[k + 2], r[k + 3]);
+                        t[k] = _mm512_castpd_ps(_mm512_unpacklo_pd(
+                            _mm512_castps_pd(lo01), _mm512_castps_pd(lo23)));
+                        t[k + 1] = _mm512_castpd_ps(_mm512_unpackhi_pd(
+                            _mm512_castps_pd(lo01), _mm512_castps_pd(lo23)));
+                        t[k + 2] = _mm512_castpd_ps(_mm512_unpacklo_pd(
+                            _mm512_castps_pd(hi01), _mm512_castps_pd(hi23)));
+                        t[k + 3] = _mm512_castpd_ps(_mm512_unpackhi_pd(
+                            _mm512_castps_pd(hi01), _mm512_castps_pd(hi23)));
+                    }
+
+                    // then a 4x4 transpose of the lanes
+                    for (k = 0; k < 4; k++) {
+                        __m512 even01 = _mm512_shuffle_f32x4(t[k], t[4 + k], 0x88);
+                        __m512 odd01 = _mm512_shuffle_f32x4(t[k], t[4 + k], 0xDD);
+                        __m512 even23 = _mm512_shuffle_f32x4(t[8 + k], t[12 + k], 0x88);
+                        __m512 odd23 = _mm512_shuffle_f32x4(t[8 + k], t[12 + k], 0xDD);
+                        r[k] = _mm512_shuffle_f32x4(even01, even23, 0x88);
+                        r[4 + k] = _mm512_shuffle_f32x4(odd01, odd23, 0x88);
+                        r[8 + k] = _mm512_shuffle_f32x4(even01, even23, 0xDD);
+                        r[12 + k] = _mm512_shuffle_f32x4(odd01, odd23, 0xDD);
+                    }
+
+                    if (stream) {
+                        for (k = 0; k < 16; k++) {
+                            _mm512_stream_ps(out + k * output_stride, r[k]);
+                        }
+                    } else {
+                        for (k = 0; k < 16; k++) {
+                            _mm512_storeu_ps(out + k * output_stride, r[k]);
+                        }
+                    }
+                }
+            }
+            volk_32f_transpose_edges(outputMatrix,
+                                     inputMatrix,
+                                     row0,
+                                     row_end,
+                                     col0,
+                                     col_end,
+                                     16,
+                                     16,
+                                     input_stride,
+                                     output_stride);
+        }
+    }
+
+    if (stream) {
+        _mm_sfence();
+    }
+}
+
+#endif /* LV_HAVE_AVX512F */
+
+
+#ifdef LV_HAVE_NEON
+#include <arm_neon.h>
+
+static inline void volk_32f_transpose_32f_neon(float* outputMatrix,
+                                               const float* inputMatrix,
+                                               unsigned int rows,
+                                               unsigned int cols,
+                                               unsigned int input_stride,
+                                               unsigned int output_stride)
+{
+    unsigned int row0, col0, row_end, col_end, row, col;
+    const float* in;
+    float* out;
+    float32x4x2_t t01, t23;
+
+    for (row0 = 0; row0 < rows; row0 += VOLK_TRANSPOSE_BLOCK) {
+        row_end = volk_transpose_min(row0 + VOLK_TRANSPOSE_BLOCK, rows);
+        for (col0 = 0; col0 < cols; col0 += VOLK_TRANSPOSE_BLOCK) {
+            col_end = volk_transpose_min(col0 + VOLK_TRANSPOSE_BLOCK, cols);
+            for (col = col0; col + 4 <= col_end; col += 4) {
+                for (row = row0; row + 4 <= row_end; row += 4) {
+                    in = inputMatrix + (size_t)row * input_stride + col;
+                    out = outputMatrix + (size_t)col * output_stride + row;
+                    t01 = vtrnq_f32(vld1q_f32(in), vld1q_f32(in + input_stride));
+                    t23 = vtrnq_f32(vld1q_f32(in + 2 * input_stride),
+                                    vld1q_f32(in + 3 * input_stride));
+                    vst1q_f32(out,
+                              vcombine_f32(vget_low_f32(t01.val[0]),
+                                           vget_low_f32(t23.val[0])));
+                    vst1q_f32(out + output_stride,
+                              vcombine_f32(vget_low_f32(t01.val[1]),
+                                           vget_low_f32(t23.val[1])));
+                    vst1q_f32(out + 2 * output_stride,
+                              vcombine_f32(vget_high_f32(t01.val[0]),
+                                           vget_high_f32(t23.val[0])));
+                    vst1q_f32(out + 3 * output_stride,
+                              vcombine_f32(vget_high_f32(t01.val[1]),
+                                           vget_high_f32(t23.val[1])));
+                }
+            }
+            volk_32f_transpose_edges(outputMatrix,
+                                     inputMatrix,
+                                     row0,
+                                     row_end,
+                                     col0,
+                                     col_end,
+                                     4,
+                                     4,
+                                     input_stride,
+                                     output_stride);
+        }
+    }
+}
+
+#endif /* LV_HAVE_NEON */
+
+#endif /* INCLUDED_volk_32f_transpose_32f_H */
@@ -0,0 +1,388 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2026 Free Software Foundation, Inc.
+ *
+ * This file is part of VOLK
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+/*!
+ * \page volk_32f_x2_fir_decim_32f
+ *
+ * \b Overview
+ *
+ * FIR filter with integrated decimation for real input with real taps. Output
+ * n is the dot product of the taps with the input window starting at
+ * n * decimation:
+ *
+ * outVector[n] = sum_k inVector[n * decimation + k] * taps[k]
+ *
+ * The taps are applied in memory order like a dot product, so pass them time
+ * reversed for a conventional convolution. inVector holds the filter history
+ * followed by the new samples and must contain at least
+ * (num_points - 1) * decimation + num_taps items. Four outputs are computed
+ * per pass, so every block of taps is loaded once for all of them. See also
+ * volk_32fc_32f_fir_decim_32fc and volk_32fc_x2_fir_decim_32fc.
+ *
+ * <b>Dispatcher Prototype</b>
+ * \code
+ * void volk_32f_x2_fir_decim_32f(float* outVector, const float* inVector,
+ *                                const float* taps,
+ *                                unsigned int num_taps, unsigned int decimation,
+ *                                unsigned int num_points)
+ * \endcode
+ *
+ * \b Inputs
+ * \li inVector: The filter history followed by the input samples.
+ * \li taps: The filter taps.
+ * \li num_taps: The number of taps.
+ * \li decimation: The number of input samples consumed per output.
+ * \li num_points: The number of output samples to produce.
+ *
+ * \b Outputs
+ * \li outVector: The filtered and decimated samples.
+ *
+ * \b Example
+ * A 4 tap moving average, decimated by 2.
+ * \code
+ *   unsigned int num_taps = 4;
+ *   unsigned int decimation = 2;
+ *   unsigned int N = 10;
+ *   unsigned int num_in = (N - 1) * decimation + num_taps;
+ *   unsigned int alignment = volk_get_alignment();
+ *   float* in = (float*)volk_malloc(sizeof(float) * num_in, alignment);
+ *   float* taps = (float*)volk_malloc(sizeof(float) * num_taps, alignment);
+ *   float* out = (float*)volk_malloc(sizeof(float) * N, alignment);
+ *
+ *   for(unsigned int ii = 0; ii < num_in; ++ii){
+ *       in[ii] = 1.f;
+ *   }
+ *   for(unsigned int ii = 0; ii < num_taps; ++ii){
+ *       taps[ii] = 1.f / num_taps;
+ *   }
+ *
+ *   volk_32f_x2_fir_decim_32f(out, in, taps, num_taps, decimation, N);
+ *
+ *   for(unsigned int ii = 0; ii < N; ++ii){
+ *       printf("out[%u] = %+1.2f\n", ii, out[ii]);
+ *   }
+ *
+ *   volk_free(in);
+ *   volk_free(taps);
+ *   volk_free(out);
+ * \endcode
+ */
+
+#ifndef INCLUDED_volk_32f_x2_fir_decim_32f_u_H
+#define INCLUDED_volk_32f_x2_fir_decim_32f_u_H
+
+#include <volk/volk_complex.h>
+
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void volk_32f_x2_fir_decim_32f_generic(float* outVector,
+                                                     const float* inVector,
+                                                     const float* taps,
+                                                     unsigned int num_taps,
+                                                     unsigned int decimation,
+                                                     unsigned int num_points)
+{
+    const float* inPtr = inVector;
+    unsigned int n, k;
+
+    for (n = 0; n < num_points; n++) {
+        float sum = 0.f;
+        for (k = 0; k < num_taps; k++) {
+            sum += inPtr[k] * taps[k];
+        }
+        *outVector++ = sum;
+        inPtr += decimation;
+    }
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+
+#ifdef LV_HAVE_SSE
+#include <xmmintrin.h>
+
+static inline void volk_32f_x2_fir_decim_32f_u_sse(float* outVector,
+                                                   const float* inVector,
+                                                   const float* taps,
+                                                   unsigned int num_taps,
+                                                   unsigned int decimation,
+                                                   unsigned int num_points)
+{
+    const unsigned int quarter_taps = num_taps / 4;
+    const unsigned int block_taps = quarter_taps * 4;
+    const unsigned int stride = decimation;
+    const float* inPtr = inVector;
+    float* outPtr = outVector;
+    unsigned int n, k, o;
+
+    __m128 tap, acc0, acc1, acc2, acc3;
+    __m128 sum;
+
+    // Four outputs per pass: each block of taps is loaded once and
+    // multiplied into four independent accumulators.
+    for (n = 0; n + 4 <= num_points; n += 4) {
+        const float* in0 = inPtr;
+        const float* in1 = in0 + stride;
+        const float* in2 = in1 + stride;
+        const float* in3 = in2 + stride;
+
+        acc0 = _mm_setzero_ps();
+        acc1 = _mm_setzero_ps();
+        acc2 = _mm_setzero_ps();
+        acc3 = _mm_setzero_ps();
+
+        for (k = 0; k < quarter_taps; k++) {
+            tap = _mm_loadu_ps(taps + 4 * k);
+
+            acc0 = _mm_add_ps(acc0, _mm_mul_ps(_mm_loadu_ps(in0 + 4 * k), tap));
+            acc1 = _mm_add_ps(acc1, _mm_mul_ps(_mm_loadu_ps(in1 + 4 * k), tap));
+            acc2 = _mm_add_ps(acc2, _mm_mul_ps(_mm_loadu_ps(in2 + 4 * k), tap));
+            acc3 = _mm_add_ps(acc3, _mm_mul_ps(_mm_loadu_ps(in3 + 4 * k), tap));
+        }
+
+        _MM_TRANSPOSE4_PS(acc0, acc1, acc2, acc3);
+        sum = _mm_add_ps(_mm_add_ps(acc0, acc1), _mm_add_ps(acc2, acc3));
+        _mm_storeu_ps(outPtr, sum);
+
+        for (k = block_taps; k < num_taps; k++) {
+            for (o = 0; o < 4; o++) {
+                outPtr[o] += inPtr[o * stride + k] * taps[k];
+            }
+        }
+
+        inPtr += 4 * stride;
+        outPtr += 4;
+    }
+
+    volk_32f_x2_fir_decim_32f_generic(
+        outPtr, inPtr, taps, num_taps, decimation, num_points - n);
+}
+
+#endif /* LV_HAVE_SSE */
+
+
+#if LV_HAVE_AVX2 && LV_HAVE_FMA
+#include <immintrin.h>
+
+static inline void volk_32f_x2_fir_decim_32f_u_avx2_fma(float* outVector,
+                                                        const float* inVector,
+                                                        const float* taps,
+                                                        unsigned int num_taps,
+                                                        unsigned int decimation,
+                                                        unsigned int num_points)
+{
+    const unsigned int eighth_taps = num_taps / 8;
+    const unsigned int block_taps = eighth_taps * 8;
+    const unsigned int stride = decimation;
+    const float* inPtr = inVector;
+    float* outPtr = outVector;
+    unsigned int n, k, o;
+
+    __m256 tap, acc0, acc1, acc2, acc3;
+    __m128 sum;
+
+    // Four outputs per pass: each block of taps is loaded once and
+    // multiplied into four independent accumulators.
+    for (n = 0; n + 4 <= num_points; n += 4) {
+        const float* in0 = inPtr;
+        const float* in1 = in0 + stride;
+        const float* in2 = in1 + stride;
+        const float* in3 = in2 + stride;
+
+        acc0 = _mm256_setzero_ps();
+        acc1 = _mm256_setzero_ps();
+        acc2 = _mm256_setzero_ps();
+        acc3 = _mm256_setzero_ps();
+
+        for (k = 0; k < eighth_taps; k++) {
+            tap = _mm256_loadu_ps(taps + 8 * k);
+
+            acc0 = _mm256_fmadd_ps(_mm256_loadu_ps(in0 + 8 * k), tap, acc0);
+            acc1 = _mm256_fmadd_ps(_mm256_loadu_ps(in1 + 8 * k), tap, acc1);
+            acc2 = _mm256_fmadd_ps(_mm256_loadu_ps(in2 + 8 * k), tap, acc2);
+            acc3 = _mm256_fmadd_ps(_mm256_loadu_ps(in3 + 8 * k), tap, acc3);
+        }
+
+        acc0 = _mm256_hadd_ps(acc0, acc1);
+        acc2 = _mm256_hadd_ps(acc2, acc3);
+        acc0 = _mm256_hadd_ps(acc0, acc2);
+        sum = _mm_add_ps(_mm256_castps256_ps128(acc0), _mm256_extractf128_ps(acc0, 1));
+        _mm_storeu_ps(outPtr, sum);
+
+        for (k = block_taps; k < num_taps; k++) {
+            for (o = 0; o < 4; o++) {
+                outPtr[o] += inPtr[o * stride + k] * taps[k];
+            }
+        }
+
+        inPtr += 4 * stride;
+        outPtr += 4;
+    }
+
+    volk_32f_x2_fir_decim_32f_generic(
+        outPtr, inPtr, taps, num_taps, decimation, num_points - n);
+}
+
+#endif /* LV_HAVE_AVX2 && LV_HAVE_FMA */
+
+
+#ifdef LV_HAVE_AVX512F
+#include <immintrin.h>
+
+static inline void volk_32f_x2_fir_decim_32f_u_avx512f(float* outVector,
+                                                       const float* inVector,
+                                                       const float* taps,
+                                                       unsigned int num_taps,
+                                                       unsigned int decimation,
+                                                       unsigned int num_points)
+{
+    const unsigned int sixteenth_taps = num_taps / 16;
+    const unsigned int block_taps = sixteenth_taps * 16;
+    const unsigned int stride = decimation;
+    const float* inPtr = inVector;
+    float* outPtr = outVector;
+    unsigned int n, k;
+    const __mmask16 tailMask = (__mmask16)((1u << (num_taps - block_taps)) - 1);
+
+    __m512 tap, acc0, acc1, acc2, acc3;
+    __m128 sum;
+    __m256 h0, h1, h2, h3;
+
+    // Four outputs per pass: each block of taps is loaded once and
+    // multiplied into four independent accumulators.
+    for (n = 0; n + 4 <= num_points; n += 4) {
+        const float* in0 = inPtr;
+        const float* in1 = in0 + stride;
+        const float* in2 = in1 + stride;
+        const float* in3 = in2 + stride;
+
+        acc0 = _mm512_setzero_ps();
+        acc1 = _mm512_setzero_ps();
+        acc2 = _mm512_setzero_ps();
+        acc3 = _mm512_setzero_ps();
+
+        for (k = 0; k < sixteenth_taps; k++) {
+            tap = _mm512_loadu_ps(taps + 16 * k);
+
+            acc0 = _mm512_fmadd_ps(_mm512_loadu_ps(in0 + 16 * k), tap, acc0);
+            acc1 = _mm512_fmadd_ps(_mm512_loadu_ps(in1 + 16 * k), tap, acc1);
+            acc2 = _mm512_fmadd_ps(_mm512_loadu_ps(in2 + 16 * k), tap, acc2);
+            acc3 = _mm512_fmadd_ps(_mm512_loadu_ps(in3 + 16 * k), tap, acc3);
+        }
+
+        if (block_taps < num_taps) {
+            // remaining taps, masked out lanes are neither read nor accumulated
+            tap = _mm512_maskz_loadu_ps(tailMask, taps + 16 * k);
+
+            acc0 = _mm512_fmadd_ps(
+                _mm512_maskz_loadu_ps(tailMask, in0 + 16 * k), tap, acc0);
+            acc1 = _mm512_fmadd_ps(
+                _mm512_maskz_loadu_ps(tailMask, in1 + 16 * k), tap, acc1);
+            acc2 = _mm512_fmadd_ps(
+                _mm512_maskz_loadu_ps(tailMask, in2 + 16 * k), tap, acc2);
+            acc3 = _mm512_fmadd_ps(
+                _mm512_maskz_loadu_ps(tailMask, in3 + 16 * k), tap, acc3);
+        }
+
+        // fold every accumulator to 256 bits
+        h0 = _mm256_add_ps(
+            _mm512_castps512_ps256(acc0),
+            _mm256_castpd_ps(_mm512_extractf64x4_pd(_mm512_castps_pd(acc0), 1)));
+        h1 = _mm256_add_ps(
+            _mm512_castps512_ps256(acc1),
+            _mm256_castpd_ps(_mm512_extractf64x4_pd(_mm512_castps_pd(acc1), 1)));
+        h2 = _mm256_add_ps(
+            _mm512_castps512_ps256(acc2),
+            _mm256_castpd_ps(_mm512_extractf64x4_pd(_mm512_castps_pd(acc2), 1)));
+        h3 = _mm256_add_ps(
+            _mm512_castps512_ps256(acc3),
+            _mm256_castpd_ps(_mm512_extractf64x4_pd(_mm512_castps_pd(acc3), 1)));
+
+        h0 = _mm256_hadd_ps(h0, h1);
+        h2 = _mm256_hadd_ps(h2, h3);
+        h0 = _mm256_hadd_ps(h0, h2);
+        sum = _mm_add_ps(_mm256_castps256_ps128(h0), _mm256_extractf128_ps(h0, 1));
+        _mm_storeu_ps(outPtr, sum);
+
+        inPtr += 4 * stride;
+        outPtr += 4;
+    }
+
+    volk_32f_x2_fir_decim_32f_generic(
+        outPtr, inPtr, taps, num_taps, decimation, num_points - n);
+}
+
+#endif /* LV_HAVE_AVX512F */
+
+
+#ifdef LV_HAVE_NEON
+#include <arm_neon.h>
+
+static inline void volk_32f_x2_fir_decim_32f_neon(float* outVector,
+                                                  const float* inVector,
+                                                  const float* taps,
+                                                  unsigned int num_taps,
+                                                  unsigned int decimation,
+                                                  unsigned int num_points)
+{
+    const unsigned int quarter_taps = num_taps / 4;
+    const unsigned int block_taps = quarter_taps * 4;
+    const unsigned int stride = decimation;
+    const float* inPtr = inVector;
+    float* outPtr = outVector;
+    unsigned int n, k, o;
+
+    float32x4_t tap, acc0, acc1, acc2, acc3;
+    float32x2_t sum01, sum23;
+
+    // Four outputs per pass: each block of taps is loaded once and
+    // multiplied into four independent accumulators.
+    for (n = 0; n + 4 <= num_points; n += 4) {
+        const float* in0 = inPtr;
+        const float* in1 = in0 + stride;
+        const float* in2 = in1 + stride;
+        const float* in3 = in2 + stride;
+
+        acc0 = vdupq_n_f32(0.f);
+        acc1 = vdupq_n_f32(0.f);
+        acc2 = vdupq_n_f32(0.f);
+        acc3 = vdupq_n_f32(0.f);
+
+        for (k = 0; k < quarter_taps; k++) {
+            tap = vld1q_f32(taps + 4 * k);
+            acc0 = vmlaq_f32(acc0, vld1q_f32(in0 + 4 * k), tap);
+            acc1 = vmlaq_f32(acc1, vld1q_f32(in1 + 4 * k), tap);
+            acc2 = vmlaq_f32(acc2, vld1q_f32(in2 + 4 * k), tap);
+            acc3 = vmlaq_f32(acc3, vld1q_f32(in3 + 4 * k), tap);
+        }
+
+        sum01 = vpadd_f32(vpadd_f32(vget_low_f32(acc0), vget_high_f32(acc0)),
+                          vpadd_f32(vget_low_f32(acc1), vget_high_f32(acc1)));
+        sum23 = vpadd_f32(vpadd_f32(vget_low_f32(acc2), vget_high_f32(acc2)),
+                          vpadd_f32(vget_low_f32(acc3), vget_high_f32(acc3)));
+        vst1q_f32(outPtr, vcombine_f32(sum01, sum23));
+
+        for (k = block_taps; k < num_taps; k++) {
+            for (o = 0; o < 4; o++) {
+                outPtr[o] += inPtr[o * stride + k] * taps[k];
+            }
+        }
+
+        inPtr += 4 * stride;
+        outPtr += 4;
+    }
+
+    volk_32f_x2_fir_decim_32f_generic(
+        outPtr, inPtr, taps, num_taps, decimation, num_points - n);
+}
+
+#endif /* LV_HAVE_NEON */
+
+#endif /* INCLUDED_volk_32f_x2_fir_decim_32f_u_H */
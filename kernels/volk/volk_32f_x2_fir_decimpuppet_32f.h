@@ -0,0 +1,136 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2026 Free Software Foundation, Inc.
+ *
+ * This file is part of VOLK
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+/*
+ * QA wrapper for volk_32f_x2_fir_decim_32f: a fixed number of taps and decimation
+ * factor; as many outputs as fit into the input buffer are computed.
+ */
+
+#ifndef INCLUDED_volk_32f_x2_fir_decimpuppet_32f_H
+#define INCLUDED_volk_32f_x2_fir_decimpuppet_32f_H
+
+#include <volk/volk_32f_x2_fir_decim_32f.h>
+
+static const unsigned int volk_32f_x2_fir_decimpuppet_taps = 37;
+static const unsigned int volk_32f_x2_fir_decimpuppet_decimation = 3;
+
+typedef void (*volk_32f_x2_fir_decim_kernel)(float*,
+                                             const float*,
+                                             const float*,
+                                             unsigned int,
+                                             unsigned int,
+                                             unsigned int);
+
+static inline void
+volk_32f_x2_fir_decimpuppet_32f_run(volk_32f_x2_fir_decim_kernel kernel,
+                                    float* outVector,
+                                    const float* inVector,
+                                    const float* taps,
+                                    unsigned int num_points)
+{
+    const unsigned int num_taps = volk_32f_x2_fir_decimpuppet_taps;
+    const unsigned int decimation = volk_32f_x2_fir_decimpuppet_decimation;
+
+    if (num_points < num_taps) {
+        return;
+    }
+    kernel(outVector,
+           inVector,
+           taps,
+           num_taps,
+           decimation,
+           (num_points - num_taps) / decimation + 1);
+}
+
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void volk_32f_x2_fir_decimpuppet_32f_generic(float* outVector,
+                                                           const float* inVector,
+                                                           const float* taps,
+                                                           unsigned int num_points)
+{
+    volk_32f_x2_fir_decimpuppet_32f_run(volk_32f_x2_fir_decim_32f_generic,
+                                        outVector,
+                                        inVector,
+                                        taps,
+                                        num_points);
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+
+#ifdef LV_HAVE_SSE
+
+static inline void volk_32f_x2_fir_decimpuppet_32f_u_sse(float* outVector,
+                                                         const float* inVector,
+                                                         const float* taps,
+                                                         unsigned int num_points)
+{
+    volk_32f_x2_fir_decimpuppet_32f_run(volk_32f_x2_fir_decim_32f_u_sse,
+                                        outVector,
+                                        inVector,
+                                        taps,
+                                        num_points);
+}
+
+#endif /* LV_HAVE_SSE */
+
+
+#if LV_HAVE_AVX2 && LV_HAVE_FMA
+
+static inline void volk_32f_x2_fir_decimpuppet_32f_u_avx2_fma(float* outVector,
+                                                              const float* inVector,
+                                                              const float* taps,
+                                                              unsigned int num_points)
+{
+    volk_32f_x2_fir_decimpuppet_32f_run(volk_32f_x2_fir_decim_32f_u_avx2_fma,
+                                        outVector,
+                                        inVector,
+                                        taps,
+                                        num_points);
+}
+
+#endif /* LV_HAVE_AVX2 && LV_HAVE_FMA */
+
+
+#ifdef LV_HAVE_AVX512F
+
+static inline void volk_32f_x2_fir_decimpuppet_32f_u_avx512f(float* outVector,
+                                                             const float* inVector,
+                                                             const float* taps,
+                                                             unsigned int num_points)
+{
+    volk_32f_x2_fir_decimpuppet_32f_run(volk_32f_x2_fir_decim_32f_u_avx512f,
+                                        outVector,
+                                        inVector,
+                                        taps,
+                                        num_points);
+}
+
+#endif /* LV_HAVE_AVX512F */
+
+
+#ifdef LV_HAVE_NEON
+
+static inline void volk_32f_x2_fir_decimpuppet_32f_neon(float* outVector,
+                                                        const float* inVector,
+                                                        const float* taps,
+                                                        unsigned int num_points)
+{
+    volk_32f_x2_fir_decimpuppet_32f_run(volk_32f_x2_fir_decim_32f_neon,
+                                        outVector,
+                                        inVector,
+                                        taps,
+                                        num_points);
+}
+
+#endif /* LV_HAVE_NEON */
+
+#endif /* INCLUDED_volk_32f_x2_fir_decimpuppet_32f_H */
@@ -0,0 +1,467 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2026 Free Software Foundation, Inc.
+ *
+ * This file is part of VOLK
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+/*!
+ * \page volk_32fc_32f_fir_decim_32fc
+ *
+ * \b Overview
+ *
+ * FIR filter with integrated decimation for complex input with real taps.
+ * Output n is the dot product of the taps with the input window starting at
+ * n * decimation:
+ *
+ * outVector[n] = sum_k inVector[n * decimation + k] * taps[k]
+ *
+ * The taps are applied in memory order like a dot product, so pass them time
+ * reversed for a conventional convolution. inVector holds the filter history
+ * followed by the new samples and must contain at least
+ * (num_points - 1) * decimation + num_taps items. Four outputs are computed
+ * per pass, so every block of taps is loaded once for all of them. See also
+ * volk_32fc_x2_fir_decim_32fc and volk_32f_x2_fir_decim_32f.
+ *
+ * <b>Dispatcher Prototype</b>
+ * \code
+ * void volk_32fc_32f_fir_decim_32fc(lv_32fc_t* outVector, const lv_32fc_t* inVector,
+ *                                   const float* taps,
+ *                                   unsigned int num_taps, unsigned int decimation,
+ *                                   unsigned int num_points)
+ * \endcode
+ *
+ * \b Inputs
+ * \li inVector: The filter history followed by the input samples.
+ * \li taps: The filter taps.
+ * \li num_taps: The number of taps.
+ * \li decimation: The number of input samples consumed per output.
+ * \li num_points: The number of output samples to produce.
+ *
+ * \b Outputs
+ * \li outVector: The filtered and decimated samples.
+ *
+ * \b Example
+ * A 4 tap moving average, decimated by 2.
+ * \code
+ *   unsigned int num_taps = 4;
+ *   unsigned int decimation = 2;
+ *   unsigned int N = 10;
+ *   unsigned int num_in = (N - 1) * decimation + num_taps;
+ *   unsigned int alignment = volk_get_alignment();
+ *   lv_32fc_t* in = (lv_32fc_t*)volk_malloc(sizeof(lv_32fc_t) * num_in, alignment);
+ *   float* taps = (float*)volk_malloc(sizeof(float) * num_taps, alignment);
+ *   lv_32fc_t* out = (lv_32fc_t*)volk_malloc(sizeof(lv_32fc_t) * N, alignment);
+ *
+ *   for(unsigned int ii = 0; ii < num_in; ++ii){
+ *       in[ii] = lv_cmake(1.f, 0.f);
+ *   }
+ *   for(unsigned int ii = 0; ii < num_taps; ++ii){
+ *       taps[ii] = 1.f / num_taps;
+ *   }
+ *
+ *   volk_32fc_32f_fir_decim_32fc(out, in, taps, num_taps, decimation, N);
+ *
+ *   for(unsigned int ii = 0; ii < N; ++ii){
+ *       printf("out[%u] = %+1.2f %+1.2fj\n", ii, lv_creal(out[ii]), lv_cimag(out[ii]));
+ *   }
+ *
+ *   volk_free(in);
+ *   volk_free(taps);
+ *   volk_free(out);
+ * \endcode
+ */
+
+#ifndef INCLUDED_volk_32fc_32f_fir_decim_32fc_u_H
+#define INCLUDED_volk_32fc_32f_fir_decim_32fc_u_H
+
+#include <volk/volk_complex.h>
+
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void volk_32fc_32f_fir_decim_32fc_generic(lv_32fc_t* outVector,
+                                                        const lv_32fc_t* inVector,
+                                                        const float* taps,
+                                                        unsigned int num_taps,
+                                                        unsigned int decimation,
+                                                        unsigned int num_points)
+{
+    const float* inPtr = (const float*)inVector;
+    unsigned int n, k;
+
+    for (n = 0; n < num_points; n++) {
+        float sumRe = 0.f;
+        float sumIm = 0.f;
+        for (k = 0; k < num_taps; k++) {
+            sumRe += inPtr[2 * k] * taps[k];
+            sumIm += inPtr[2 * k + 1] * taps[k];
+        }
+        *outVector++ = lv_cmake(sumRe, sumIm);
+        inPtr += 2 * decimation;
+    }
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+
+#ifdef LV_HAVE_SSE
+#include <xmmintrin.h>
+
+static inline void volk_32fc_32f_fir_decim_32fc_u_sse(lv_32fc_t* outVector,
+                                                      const lv_32fc_t* inVector,
+                                                      const float* taps,
+                                                      unsigned int num_taps,
+                                                      unsigned int decimation,
+                                                      unsigned int num_points)
+{
+    const unsigned int quarter_taps = num_taps / 4;
+    const unsigned int block_taps = quarter_taps * 4;
+    const unsigned int stride = 2 * decimation; // floats between outputs
+    const float* inPtr = (const float*)inVector;
+    float* outPtr = (float*)outVector;
+    unsigned int n, k, o;
+
+    __m128 tapVal, tapLo, tapHi, acc0, acc1, acc2, acc3;
+
+    // Four outputs per pass: each block of taps is loaded once and
+    // multiplied into four independent accumulators.
+    for (n = 0; n + 4 <= num_points; n += 4) {
+        const float* in0 = inPtr;
+        const float* in1 = in0 + stride;
+        const float* in2 = in1 + stride;
+        const float* in3 = in2 + stride;
+
+        acc0 = _mm_setzero_ps();
+        acc1 = _mm_setzero_ps();
+        acc2 = _mm_setzero_ps();
+        acc3 = _mm_setzero_ps();
+
+        for (k = 0; k < quarter_taps; k++) {
+            tapVal = _mm_loadu_ps(taps + 4 * k);
+            tapLo = _mm_unpacklo_ps(tapVal, tapVal); // t0, t0, t1, t1
+            tapHi = _mm_unpackhi_ps(tapVal, tapVal); // t2, t2, t3, t3
+
+            acc0 = _mm_add_ps(acc0, _mm_mul_ps(_mm_loadu_ps(in0 + 8 * k), tapLo));
+            acc0 =
+                _mm_add_ps(acc0, _mm_mul_ps(_mm_loadu_ps(in0 + 8 * k + 4), tapHi));
+            acc1 = _mm_add_ps(acc1, _mm_mul_ps(_mm_loadu_ps(in1 + 8 * k), tapLo));
+            acc1 =
+                _mm_add_ps(acc1, _mm_mul_ps(_mm_loadu_ps(in1 + 8 * k + 4), tapHi));
+            acc2 = _mm_add_ps(acc2, _mm_mul_ps(_mm_loadu_ps(in2 + 8 * k), tapLo));
+            acc2 =
+                _mm_add_ps(acc2, _mm_mul_ps(_mm_loadu_ps(in2 + 8 * k + 4), tapHi));
+            acc3 = _mm_add_ps(acc3, _mm_mul_ps(_mm_loadu_ps(in3 + 8 * k), tapLo));
+            acc3 =
+                _mm_add_ps(acc3, _mm_mul_ps(_mm_loadu_ps(in3 + 8 * k + 4), tapHi));
+        }
+
+        // fold the two complex lanes of every accumulator
+        acc0 = _mm_add_ps(acc0, _mm_movehl_ps(acc0, acc0));
+        acc1 = _mm_add_ps(acc1, _mm_movehl_ps(acc1, acc1));
+        acc2 = _mm_add_ps(acc2, _mm_movehl_ps(acc2, acc2));
+        acc3 = _mm_add_ps(acc3, _mm_movehl_ps(acc3, acc3));
+
+        _mm_storel_pi((__m64*)outPtr, acc0);
+        _mm_storel_pi((__m64*)(outPtr + 2), acc1);
+        _mm_storel_pi((__m64*)(outPtr + 4), acc2);
+        _mm_storel_pi((__m64*)(outPtr + 6), acc3);
+
+        for (k = block_taps; k < num_taps; k++) {
+            for (o = 0; o < 4; o++) {
+                outPtr[2 * o] += inPtr[o * stride + 2 * k] * taps[k];
+                outPtr[2 * o + 1] += inPtr[o * stride + 2 * k + 1] * taps[k];
+            }
+        }
+
+        inPtr += 4 * stride;
+        outPtr += 8;
+    }
+
+    volk_32fc_32f_fir_decim_32fc_generic((lv_32fc_t*)outPtr,
+                                         (const lv_32fc_t*)inPtr,
+                                         taps,
+                                         num_taps,
+                                         decimation,
+                                         num_points - n);
+}
+
+#endif /* LV_HAVE_SSE */
+
+
+#if LV_HAVE_AVX2 && LV_HAVE_FMA
+#include <immintrin.h>
+
+static inline void volk_32fc_32f_fir_decim_32fc_u_avx2_fma(lv_32fc_t* outVector,
+                                                           const lv_32fc_t* inVector,
+                                                           const float* taps,
+                                                           unsigned int num_taps,
+                                                           unsigned int decimation,
+                                                           unsigned int num_points)
+{
+    const unsigned int quarter_taps = num_taps / 4;
+    const unsigned int block_taps = quarter_taps * 4;
+    const unsigned int stride = 2 * decimation; // floats between outputs
+    const float* inPtr = (const float*)inVector;
+    float* outPtr = (float*)outVector;
+    unsigned int n, k, o;
+
+    __m128 tapVal;
+    __m256 tap, acc0, acc1, acc2, acc3;
+    __m256 sum01, sum23, sum;
+
+    // Four outputs per pass: each block of taps is loaded once and
+    // multiplied into four independent accumulators.
+    for (n = 0; n + 4 <= num_points; n += 4) {
+        const float* in0 = inPtr;
+        const float* in1 = in0 + stride;
+        const float* in2 = in1 + stride;
+        const float* in3 = in2 + stride;
+
+        acc0 = _mm256_setzero_ps();
+        acc1 = _mm256_setzero_ps();
+        acc2 = _mm256_setzero_ps();
+        acc3 = _mm256_setzero_ps();
+
+        for (k = 0; k < quarter_taps; k++) {
+            tapVal = _mm_loadu_ps(taps + 4 * k);
+            tap = _mm256_insertf128_ps(
+                _mm256_castps128_ps256(_mm_unpacklo_ps(tapVal, tapVal)),
+                _mm_unpackhi_ps(tapVal, tapVal),
+                1); // t0, t0, t1, t1, t2, t2, t3, t3
+
+            acc0 = _mm256_fmadd_ps(_mm256_loadu_ps(in0 + 8 * k), tap, acc0);
+            acc1 = _mm256_fmadd_ps(_mm256_loadu_ps(in1 + 8 * k), tap, acc1);
+            acc2 = _mm256_fmadd_ps(_mm256_loadu_ps(in2 + 8 * k), tap, acc2);
+            acc3 = _mm256_fmadd_ps(_mm256_loadu_ps(in3 + 8 * k), tap, acc3);
+        }
+
+        // (c0a c0b | c1a c1b) and (c2a c2b | c3a c3b)
+        sum01 = _mm256_add_ps(_mm256_permute2f128_ps(acc0, acc1, 0x20),
+                              _mm256_permute2f128_ps(acc0, acc1, 0x31));
+        sum23 = _mm256_add_ps(_mm256_permute2f128_ps(acc2, acc3, 0x20),
+                              _mm256_permute2f128_ps(acc2, acc3, 0x31));
+        // (c0 c2 | c1 c3)
+        sum = _mm256_add_ps(_mm256_shuffle_ps(sum01, sum23, 0x44),
+                            _mm256_shuffle_ps(sum01, sum23, 0xEE));
+        sum = _mm256_castpd_ps(_mm256_permute4x64_pd(_mm256_castps_pd(sum), 0xD8));
+        _mm256_storeu_ps((float*)outPtr, sum);
+
+        for (k = block_taps; k < num_taps; k++) {
+            for (o = 0; o < 4; o++) {
+                outPtr[2 * o] += inPtr[o * stride + 2 * k] * taps[k];
+                outPtr[2 * o + 1] += inPtr[o * stride + 2 * k + 1] * taps[k];
+            }
+        }
+
+        inPtr += 4 * stride;
+        outPtr += 8;
+    }
+
+    volk_32fc_32f_fir_decim_32fc_generic((lv_32fc_t*)outPtr,
+                                         (const lv_32fc_t*)inPtr,
+                                         taps,
+                                         num_taps,
+                                         decimation,
+                                         num_points - n);
+}
+
+#endif /* LV_HAVE_AVX2 && LV_HAVE_FMA */
+
+
+#ifdef LV_HAVE_AVX512F
+#include <immintrin.h>
+
+static inline void volk_32fc_32f_fir_decim_32fc_u_avx512f(lv_32fc_t* outVector,
+                                                          const lv_32fc_t* inVector,
+                                                          const float* taps,
+                                                          unsigned int num_taps,
+                                                          unsigned int decimation,
+                                                          unsigned int num_points)
+{
+    const unsigned int eighth_taps = num_taps / 8;
+    const unsigned int block_taps = eighth_taps * 8;
+    const unsigned int stride = 2 * decimation; // floats between outputs
+    const float* inPtr = (const float*)inVector;
+    float* outPtr = (float*)outVector;
+    unsigned int n, k;
+    const __mmask16 tapMask = (__mmask16)((1u << (num_taps - block_taps)) - 1);
+    const __mmask16 tailMask =
+        (__mmask16)((1u << (2 * (num_taps - block_taps))) - 1);
+
+    const __m512i tapIdx =
+        _mm512_set_epi32(7, 7, 6, 6, 5, 5, 4, 4, 3, 3, 2, 2, 1, 1, 0, 0);
+    __m512 tap, acc0, acc1, acc2, acc3;
+    __m256 sum01, sum23, sum;
+    __m256 h0, h1, h2, h3;
+
+    // Four outputs per pass: each block of taps is loaded once and
+    // multiplied into four independent accumulators.
+    for (n = 0; n + 4 <= num_points; n += 4) {
+        const float* in0 = inPtr;
+        const float* in1 = in0 + stride;
+        const float* in2 = in1 + stride;
+        const float* in3 = in2 + stride;
+
+        acc0 = _mm512_setzero_ps();
+        acc1 = _mm512_setzero_ps();
+        acc2 = _mm512_setzero_ps();
+        acc3 = _mm512_setzero_ps();
+
+        for (k = 0; k < eighth_taps; k++) {
+            tap = _mm512_permutexvar_ps(
+                tapIdx, _mm512_castps256_ps512(_mm256_loadu_ps(taps + 8 * k)));
+
+            acc0 = _mm512_fmadd_ps(_mm512_loadu_ps(in0 + 16 * k), tap, acc0);
+            acc1 = _mm512_fmadd_ps(_mm512_loadu_ps(in1 + 16 * k), tap, acc1);
+            acc2 = _mm512_fmadd_ps(_mm512_loadu_ps(in2 + 16 * k), tap, acc2);
+            acc3 = _mm512_fmadd_ps(_mm512_loadu_ps(in3 + 16 * k), tap, acc3);
+        }
+
+        if (block_taps < num_taps) {
+            // remaining taps, masked out lanes are neither read nor accumulated
+            tap = _mm512_permutexvar_ps(
+                tapIdx, _mm512_maskz_loadu_ps(tapMask, taps + 8 * k));
+
+            acc0 = _mm512_fmadd_ps(
+                _mm512_maskz_loadu_ps(tailMask, in0 + 16 * k), tap, acc0);
+            acc1 = _mm512_fmadd_ps(
+                _mm512_maskz_loadu_ps(tailMask, in1 + 16 * k), tap, acc1);
+            acc2 = _mm512_fmadd_ps(
+                _mm512_maskz_loadu_ps(tailMask, in2 + 16 * k), tap, acc2);
+            acc3 = _mm512_fmadd_ps(
+                _mm512_maskz_loadu_ps(tailMask, in3 + 16 * k), tap, acc3);
+        }
+
+        // fold every accumulator to 256 bits
+        h0 = _mm256_add_ps(
+            _mm512_castps512_ps256(acc0),
+            _mm256_castpd_ps(_mm512_extractf64x4_pd(_mm512_castps_pd(acc0), 1)));
+        h1 = _mm256_add_ps(
+            _mm512_castps512_ps256(acc1),
+            _mm256_castpd_ps(_mm512_extractf64x4_pd(_mm512_castps_pd(acc1), 1)));
+        h2 = _mm256_add_ps(
+            _mm512_castps512_ps256(acc2),
+            _mm256_castpd_ps(_mm512_extractf64x4_pd(_mm512_castps_pd(acc2), 1)));
+        h3 = _mm256_add_ps(
+            _mm512_castps512_ps256(acc3),
+            _mm256_castpd_ps(_mm512_extractf64x4_pd(_mm512_castps_pd(acc3), 1)));
+
+        // (c0a c0b | c1a c1b) and (c2a c2b | c3a c3b)
+        sum01 = _mm256_add_ps(_mm256_permute2f128_ps(h0, h1, 0x20),
+                              _mm256_permute2f128_ps(h0, h1, 0x31));
+        sum23 = _mm256_add_ps(_mm256_permute2f128_ps(h2, h3, 0x20),
+                              _mm256_permute2f128_ps(h2, h3, 0x31));
+        // (c0 c2 | c1 c3)
+        sum = _mm256_add_ps(_mm256_shuffle_ps(sum01, sum23, 0x44),
+                            _mm256_shuffle_ps(sum01, sum23, 0xEE));
+        sum = _mm256_castpd_ps(_mm256_permute4x64_pd(_mm256_castps_pd(sum), 0xD8));
+        _mm256_storeu_ps((float*)outPtr, sum);
+
+        inPtr += 4 * stride;
+        outPtr += 8;
+    }
+
+    volk_32fc_32f_fir_decim_32fc_generic((lv_32fc_t*)outPtr,
+                                         (const lv_32fc_t*)inPtr,
+                                         taps,
+                                         num_taps,
+                                         decimation,
+                                         num_points - n);
+}
+
+#endif /* LV_HAVE_AVX512F */
+
+
+#ifdef LV_HAVE_NEON
+#include <arm_neon.h>
+
+static inline void volk_32fc_32f_fir_decim_32fc_neon(lv_32fc_t* outVector,
+                                                     const lv_32fc_t* inVector,
+                                                     const float* taps,
+                                                     unsigned int num_taps,
+                                                     unsigned int decimation,
+                                                     unsigned int num_points)
+{
+    const unsigned int quarter_taps = num_taps / 4;
+    const unsigned int block_taps = quarter_taps * 4;
+    const unsigned int stride = 2 * decimation; // floats between outputs
+    const float* inPtr = (const float*)inVector;
+    float* outPtr = (float*)outVector;
+    unsigned int n, k, o;
+
+    float32x4_t tap;
+    float32x4x2_t aVal;
+    float32x4_t re0, re1, re2, re3, im0, im1, im2, im3;
+
+    // Four outputs per pass: each block of taps is loaded once and
+    // multiplied into four independent accumulators.
+    for (n = 0; n + 4 <= num_points; n += 4) {
+        const float* in0 = inPtr;
+        const float* in1 = in0 + stride;
+        const float* in2 = in1 + stride;
+        const float* in3 = in2 + stride;
+
+        re0 = vdupq_n_f32(0.f);
+        re1 = vdupq_n_f32(0.f);
+        re2 = vdupq_n_f32(0.f);
+        re3 = vdupq_n_f32(0.f);
+        im0 = vdupq_n_f32(0.f);
+        im1 = vdupq_n_f32(0.f);
+        im2 = vdupq_n_f32(0.f);
+        im3 = vdupq_n_f32(0.f);
+
+        for (k = 0; k < quarter_taps; k++) {
+            tap = vld1q_f32(taps + 4 * k);
+            aVal = vld2q_f32(in0 + 8 * k);
+            re0 = vmlaq_f32(re0, aVal.val[0], tap);
+            im0 = vmlaq_f32(im0, aVal.val[1], tap);
+            aVal = vld2q_f32(in1 + 8 * k);
+            re1 = vmlaq_f32(re1, aVal.val[0], tap);
+            im1 = vmlaq_f32(im1, aVal.val[1], tap);
+            aVal = vld2q_f32(in2 + 8 * k);
+            re2 = vmlaq_f32(re2, aVal.val[0], tap);
+            im2 = vmlaq_f32(im2, aVal.val[1], tap);
+            aVal = vld2q_f32(in3 + 8 * k);
+            re3 = vmlaq_f32(re3, aVal.val[0], tap);
+            im3 = vmlaq_f32(im3, aVal.val[1], tap);
+        }
+
+        // (sum(re), sum(im)) of every output
+        vst1_f32(outPtr,
+                 vpadd_f32(vpadd_f32(vget_low_f32(re0), vget_high_f32(re0)),
+                           vpadd_f32(vget_low_f32(im0), vget_high_f32(im0))));
+        vst1_f32(outPtr + 2,
+                 vpadd_f32(vpadd_f32(vget_low_f32(re1), vget_high_f32(re1)),
+                           vpadd_f32(vget_low_f32(im1), vget_high_f32(im1))));
+        vst1_f32(outPtr + 4,
+                 vpadd_f32(vpadd_f32(vget_low_f32(re2), vget_high_f32(re2)),
+                           vpadd_f32(vget_low_f32(im2), vget_high_f32(im2))));
+        vst1_f32(outPtr + 6,
+                 vpadd_f32(vpadd_f32(vget_low_f32(re3), vget_high_f32(re3)),
+                           vpadd_f32(vget_low_f32(im3), vget_high_f32(im3))));
+
+        for (k = block_taps; k < num_taps; k++) {
+            for (o = 0; o < 4; o++) {
+                outPtr[2 * o] += inPtr[o * stride + 2 * k] * taps[k];
+                outPtr[2 * o + 1] += inPtr[o * stride + 2 * k + 1] * taps[k];
+            }
+        }
+
+        inPtr += 4 * stride;
+        outPtr += 8;
+    }
+
+    volk_32fc_32f_fir_decim_32fc_generic((lv_32fc_t*)outPtr,
+                                         (const lv_32fc_t*)inPtr,
+                                         taps,
+                                         num_taps,
+                                         decimation,
+                                         num_points - n);
+}
+
+#endif /* LV_HAVE_NEON */
+
+#endif /* INCLUDED_volk_32fc_32f_fir_decim_32fc_u_H */
@@ -0,0 +1,633 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2026 Free Software Foundation, Inc.
+ *
+ * This file is part of VOLK
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+/*!
+ * \page volk_32fc_32f_xK_dot_prod_32fc
+ *
+ * \b Overview
+ *
+ * Computes the dot product of one complex input vector with K = \p num_banks
+ * real tap vectors in a single pass over the input. This is the same as
+ * calling volk_32fc_32f_dot_prod_32fc once per tap set, but every input
+ * sample is loaded once and multiplied into the accumulators of all banks.
+ *
+ * The taps have to be in a blocked layout where the taps of 8 consecutive
+ * banks are interleaved per sample:
+ *
+ * taps[(g * num_points + n) * 8 + b] = tap n of bank g * 8 + b
+ *
+ * The number of banks is padded to a multiple of 8 with zero taps.
+ * volk_32fc_32f_xK_dot_prod_pack_taps from <volk/volk_xk_dot_prod.h> converts
+ * row major taps (one tap vector per bank) into this layout;
+ * volk_32fc_32f_xK_dot_prod_packed_size returns the number of floats it writes.
+ *
+ * The accumulators of all banks of a pass are kept in registers, which limits
+ * a pass to 16 banks with SSE and NEON and to 32 banks with AVX and AVX-512.
+ * For more banks the input is read once per pass, e.g. three times for K = 40
+ * with SSE, so the input is loaded once only for K up to 16 (or 32).
+ *
+ * <b>Dispatcher Prototype</b>
+ * \code
+ * void volk_32fc_32f_xK_dot_prod_32fc(lv_32fc_t* result, const lv_32fc_t* input,
+ *                                     const float* taps, unsigned int num_banks,
+ *                                     unsigned int num_points)
+ * \endcode
+ *
+ * \b Inputs
+ * \li input: vector of complex samples
+ * \li taps: the packed taps of all banks
+ * \li num_banks: the number of tap sets K
+ * \li num_points: number of samples in \p input and in every tap set
+ *
+ * \b Outputs
+ * \li result: K complex values, the dot product with each bank.
+ *
+ * \b Example
+ * \code
+ * #include <volk/volk_xk_dot_prod.h>
+ *
+ * int N = 1024;
+ * int K = 16;
+ * unsigned int alignment = volk_get_alignment();
+ * lv_32fc_t* x = (lv_32fc_t*)volk_malloc(N * sizeof(lv_32fc_t), alignment);
+ * float* t = (float*)volk_malloc(K * N * sizeof(float), alignment);
+ * float* packed = (float*)volk_malloc(
+ *     volk_32fc_32f_xK_dot_prod_packed_size(K, N) * sizeof(float), alignment);
+ * lv_32fc_t* y = (lv_32fc_t*)volk_malloc(K * sizeof(lv_32fc_t), alignment);
+ *
+ * <populate x and the K tap vectors t[k * N] ... t[k * N + N - 1]>
+ *
+ * volk_32fc_32f_xK_dot_prod_pack_taps(packed, t, K, N);
+ * volk_32fc_32f_xK_dot_prod_32fc(y, x, packed, K, N);
+ *
+ * volk_free(x);
+ * volk_free(t);
+ * volk_free(packed);
+ * volk_free(y);
+ * \endcode
+ */
+
+#ifndef INCLUDED_volk_32fc_32f_xK_dot_prod_32fc_u_H
+#define INCLUDED_volk_32fc_32f_xK_dot_prod_32fc_u_H
+
+#include <string.h>
+#include <volk/volk_common.h>
+#include <volk/volk_complex.h>
+#include <volk/volk_xk_dot_prod.h>
+
+/* Copy the results of up to max_banks banks starting at bank, dropping the padding */
+static inline void volk_32fc_32f_xK_dot_prod_store(lv_32fc_t* result,
+                                                   const lv_32fc_t* res,
+                                                   unsigned int bank,
+                                                   unsigned int max_banks,
+                                                   unsigned int num_banks)
+{
+    const unsigned int count =
+        (num_banks - bank < max_banks) ? num_banks - bank : max_banks;
+    memcpy(result + bank, res, sizeof(lv_32fc_t) * count);
+}
+
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void volk_32fc_32f_xK_dot_prod_32fc_generic(lv_32fc_t* result,
+                                                          const lv_32fc_t* input,
+                                                          const float* taps,
+                                                          unsigned int num_banks,
+                                                          unsigned int num_points)
+{
+    const float* in = (const float*)input;
+    const unsigned int num_groups =
+        (num_banks + VOLK_XK_DOT_PROD_BANK_BLOCK - 1) / VOLK_XK_DOT_PROD_BANK_BLOCK;
+    float res[2 * VOLK_XK_DOT_PROD_BANK_BLOCK];
+    unsigned int g, n, b;
+
+    for (g = 0; g < num_groups; g++) {
+        const float* tapPtr = taps + g * VOLK_XK_DOT_PROD_BANK_BLOCK * num_points;
+
+        for (b = 0; b < 2 * VOLK_XK_DOT_PROD_BANK_BLOCK; b++) {
+            res[b] = 0.f;
+        }
+        for (n = 0; n < num_points; n++) {
+            for (b = 0; b < VOLK_XK_DOT_PROD_BANK_BLOCK; b++) {
+                res[2 * b] += in[2 * n] * tapPtr[b];
+                res[2 * b + 1] += in[2 * n + 1] * tapPtr[b];
+            }
+            tapPtr += VOLK_XK_DOT_PROD_BANK_BLOCK;
+        }
+
+        volk_32fc_32f_xK_dot_prod_store(result,
+                                        (const lv_32fc_t*)res,
+                                        g * VOLK_XK_DOT_PROD_BANK_BLOCK,
+                                        VOLK_XK_DOT_PROD_BANK_BLOCK,
+                                        num_banks);
+    }
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+
+#ifdef LV_HAVE_SSE
+#include <xmmintrin.h>
+
+static inline void volk_32fc_32f_xK_dot_prod_32fc_u_sse(lv_32fc_t* result,
+                                                        const lv_32fc_t* input,
+                                                        const float* taps,
+                                                        unsigned int num_banks,
+                                                        unsigned int num_points)
+{
+    const float* in = (const float*)input;
+    const unsigned int num_groups =
+        (num_banks + VOLK_XK_DOT_PROD_BANK_BLOCK - 1) / VOLK_XK_DOT_PROD_BANK_BLOCK;
+    const unsigned int group_stride = VOLK_XK_DOT_PROD_BANK_BLOCK * num_points;
+    __VOLK_ATTR_ALIGNED(16) lv_32fc_t res[2 * VOLK_XK_DOT_PROD_BANK_BLOCK];
+    unsigned int g = 0, n;
+
+    __m128 xr, xi, t;
+    __m128 reLo0, imLo0, reHi0, imHi0, reLo1, imLo1, reHi1, imHi1;
+
+    // Two bank groups (16 banks) per pass: every input sample is broadcast
+    // once and multiplied into eight accumulators.
+    for (; g + 2 <= num_groups; g += 2) {
+        const float* t0 = taps + g * group_stride;
+        const float* t1 = t0 + group_stride;
+
+        reLo0 = _mm_setzero_ps();
+        imLo0 = _mm_setzero_ps();
+        reHi0 = _mm_setzero_ps();
+        imHi0 = _mm_setzero_ps();
+        reLo1 = _mm_setzero_ps();
+        imLo1 = _mm_setzero_ps();
+        reHi1 = _mm_setzero_ps();
+        imHi1 = _mm_setzero_ps();
+
+        for (n = 0; n < num_points; n++) {
+            xr = _mm_load1_ps(in + 2 * n);
+            xi = _mm_load1_ps(in + 2 * n + 1);
+            t = _mm_loadu_ps(t0 + 8 * n);
+            reLo0 = _mm_add_ps(reLo0, _mm_mul_ps(xr, t));
+            imLo0 = _mm_add_ps(imLo0, _mm_mul_ps(xi, t));
+            t = _mm_loadu_ps(t0 + 8 * n + 4);
+            reHi0 = _mm_add_ps(reHi0, _mm_mul_ps(xr, t));
+            imHi0 = _mm_add_ps(imHi0, _mm_mul_ps(xi, t));
+            t = _mm_loadu_ps(t1 + 8 * n);
+            reLo1 = _mm_add_ps(reLo1, _mm_mul_ps(xr, t));
+            imLo1 = _mm_add_ps(imLo1, _mm_mul_ps(xi, t));
+            t = _mm_loadu_ps(t1 + 8 * n + 4);
+            reHi1 = _mm_add_ps(reHi1, _mm_mul_ps(xr, t));
+            imHi1 = _mm_add_ps(imHi1, _mm_mul_ps(xi, t));
+        }
+
+        // interleave (re, im) of banks 0..7 of every group
+        _mm_store_ps((float*)(res + 0), _mm_unpacklo_ps(reLo0, imLo0));
+        _mm_store_ps((float*)(res + 2), _mm_unpackhi_ps(reLo0, imLo0));
+        _mm_store_ps((float*)(res + 4), _mm_unpacklo_ps(reHi0, imHi0));
+        _mm_store_ps((float*)(res + 6), _mm_unpackhi_ps(reHi0, imHi0));
+        _mm_store_ps((float*)(res + 8), _mm_unpacklo_ps(reLo1, imLo1));
+        _mm_store_ps((float*)(res + 10), _mm_unpackhi_ps(reLo1, imLo1));
+        _mm_store_ps((float*)(res + 12), _mm_unpacklo_ps(reHi1, imHi1));
+        _mm_store_ps((float*)(res + 14), _mm_unpackhi_ps(reHi1, imHi1));
+
+        volk_32fc_32f_xK_dot_prod_store(result,
+                                        res,
+                                        g * VOLK_XK_DOT_PROD_BANK_BLOCK,
+                                        2 * VOLK_XK_DOT_PROD_BANK_BLOCK,
+                                        num_banks);
+    }
+
+    for (; g < num_groups; g++) {
+        const float* t0 = taps + g * group_stride;
+
+        reLo0 = _mm_setzero_ps();
+        imLo0 = _mm_setzero_ps();
+        reHi0 = _mm_setzero_ps();
+        imHi0 = _mm_setzero_ps();
+
+        for (n = 0; n < num_points; n++) {
+            xr = _mm_load1_ps(in + 2 * n);
+            xi = _mm_load1_ps(in + 2 * n + 1);
+            t = _mm_loadu_ps(t0 + 8 * n);
+            reLo0 = _mm_add_ps(reLo0, _mm_mul_ps(xr, t));
+            imLo0 = _mm_add_ps(imLo0, _mm_mul_ps(xi, t));
+            t = _mm_loadu_ps(t0 + 8 * n + 4);
+            reHi0 = _mm_add_ps(reHi0, _mm_mul_ps(xr, t));
+            imHi0 = _mm_add_ps(imHi0, _mm_mul_ps(xi, t));
+        }
+
+        // interleave (re, im) of banks 0..7 of every group
+        _mm_store_ps((float*)(res + 0), _mm_unpacklo_ps(reLo0, imLo0));
+        _mm_store_ps((float*)(res + 2), _mm_unpackhi_ps(reLo0, imLo0));
+        _mm_store_ps((float*)(res + 4), _mm_unpacklo_ps(reHi0, imHi0));
+        _mm_store_ps((float*)(res + 6), _mm_unpackhi_ps(reHi0, imHi0));
+
+        volk_32fc_32f_xK_dot_prod_store(result,
+                                        res,
+                                        g * VOLK_XK_DOT_PROD_BANK_BLOCK,
+                                        1 * VOLK_XK_DOT_PROD_BANK_BLOCK,
+                                        num_banks);
+    }
+}
+
+#endif /* LV_HAVE_SSE */
+
+
+#if LV_HAVE_AVX && LV_HAVE_FMA
+#include <immintrin.h>
+
+static inline void volk_32fc_32f_xK_dot_prod_32fc_u_avx_fma(lv_32fc_t* result,
+                                                            const lv_32fc_t* input,
+                                                            const float* taps,
+                                                            unsigned int num_banks,
+                                                            unsigned int num_points)
+{
+    const float* in = (const float*)input;
+    const unsigned int num_groups =
+        (num_banks + VOLK_XK_DOT_PROD_BANK_BLOCK - 1) / VOLK_XK_DOT_PROD_BANK_BLOCK;
+    const unsigned int group_stride = VOLK_XK_DOT_PROD_BANK_BLOCK * num_points;
+    __VOLK_ATTR_ALIGNED(32) lv_32fc_t res[4 * VOLK_XK_DOT_PROD_BANK_BLOCK];
+    unsigned int g = 0, n;
+
+    __m256 xr, xi, t, lo, hi, re0, im0, re1, im1, re2, im2, re3, im3;
+
+    // Four bank groups (32 banks) per pass: every input sample is broadcast
+    // once and multiplied into eight accumulators.
+    for (; g + 4 <= num_groups; g += 4) {
+        const float* t0 = taps + g * group_stride;
+        const float* t1 = t0 + group_stride;
+        const float* t2 = t1 + group_stride;
+        const float* t3 = t2 + group_stride;
+
+        re0 = _mm256_setzero_ps();
+        im0 = _mm256_setzero_ps();
+        re1 = _mm256_setzero_ps();
+        im1 = _mm256_setzero_ps();
+        re2 = _mm256_setzero_ps();
+        im2 = _mm256_setzero_ps();
+        re3 = _mm256_setzero_ps();
+        im3 = _mm256_setzero_ps();
+
+        for (n = 0; n < num_points; n++) {
+            xr = _mm256_broadcast_ss(in + 2 * n);
+            xi = _mm256_broadcast_ss(in + 2 * n + 1);
+            t = _mm256_loadu_ps(t0 + 8 * n);
+            re0 = _mm256_fmadd_ps(xr, t, re0);
+            im0 = _mm256_fmadd_ps(xi, t, im0);
+            t = _mm256_loadu_ps(t1 + 8 * n);
+            re1 = _mm256_fmadd_ps(xr, t, re1);
+            im1 = _mm256_fmadd_ps(xi, t, im1);
+            t = _mm256_loadu_ps(t2 + 8 * n);
+            re2 = _mm256_fmadd_ps(xr, t, re2);
+            im2 = _mm256_fmadd_ps(xi, t, im2);
+            t = _mm256_loadu_ps(t3 + 8 * n);
+            re3 = _mm256_fmadd_ps(xr, t, re3);
+            im3 = _mm256_fmadd_ps(xi, t, im3);
+        }
+
+        // interleave (re, im) of banks 0..7 of every group
+        lo = _mm256_unpacklo_ps(re0, im0); // 0, 1 | 4, 5
+        hi = _mm256_unpackhi_ps(re0, im0); // 2, 3 | 6, 7
+        _mm256_store_ps((float*)(res + 0), _mm256_permute2f128_ps(lo, hi, 0x20));
+        _mm256_store_ps((float*)(res + 4), _mm256_permute2f128_ps(lo, hi, 0x31));
+        lo = _mm256_unpacklo_ps(re1, im1); // 0, 1 | 4, 5
+        hi = _mm256_unpackhi_ps(re1, im1); // 2, 3 | 6, 7
+        _mm256_store_ps((float*)(res + 8), _mm256_permute2f128_ps(lo, hi, 0x20));
+        _mm256_store_ps((float*)(res + 12), _mm256_permute2f128_ps(lo, hi, 0x31));
+        lo = _mm256_unpacklo_ps(re2, im2); // 0, 1 | 4, 5
+        hi = _mm256_unpackhi_ps(re2, im2); // 2, 3 | 6, 7
+        _mm256_store_ps((float*)(res + 16), _mm256_permute2f128_ps(lo, hi, 0x20));
+        _mm256_store_ps((float*)(res + 20), _mm256_permute2f128_ps(lo, hi, 0x31));
+        lo = _mm256_unpacklo_ps(re3, im3); // 0, 1 | 4, 5
+        hi = _mm256_unpackhi_ps(re3, im3); // 2, 3 | 6, 7
+        _mm256_store_ps((float*)(res + 24), _mm256_permute2f128_ps(lo, hi, 0x20));
+        _mm256_store_ps((float*)(res + 28), _mm256_permute2f128_ps(lo, hi, 0x31));
+
+        volk_32fc_32f_xK_dot_prod_store(result,
+                                        res,
+                                        g * VOLK_XK_DOT_PROD_BANK_BLOCK,
+                                        4 * VOLK_XK_DOT_PROD_BANK_BLOCK,
+                                        num_banks);
+    }
+
+    for (; g < num_groups; g++) {
+        const float* t0 = taps + g * group_stride;
+
+        re0 = _mm256_setzero_ps();
+        im0 = _mm256_setzero_ps();
+
+        for (n = 0; n < num_points; n++) {
+            xr = _mm256_broadcast_ss(in + 2 * n);
+            xi = _mm256_broadcast_ss(in + 2 * n + 1);
+            t = _mm256_loadu_ps(t0 + 8 * n);
+            re0 = _mm256_fmadd_ps(xr, t, re0);
+            im0 = _mm256_fmadd_ps(xi, t, im0);
+        }
+
+        // interleave (re, im) of banks 0..7 of every group
+        lo = _mm256_unpacklo_ps(re0, im0); // 0, 1 | 4, 5
+        hi = _mm256_unpackhi_ps(re0, im0); // 2, 3 | 6, 7
+        _mm256_store_ps((float*)(res + 0), _mm256_permute2f128_ps(lo, hi, 0x20));
+        _mm256_store_ps((float*)(res + 4), _mm256_permute2f128_ps(lo, hi, 0x31));
+
+        volk_32fc_32f_xK_dot_prod_store(result,
+                                        res,
+                                        g * VOLK_XK_DOT_PROD_BANK_BLOCK,
+                                        1 * VOLK_XK_DOT_PROD_BANK_BLOCK,
+                                        num_banks);
+    }
+}
+
+#endif /* LV_HAVE_AVX && LV_HAVE_FMA */
+
+
+#ifdef LV_HAVE_AVX512F
+#include <immintrin.h>
+
+static inline void volk_32fc_32f_xK_dot_prod_32fc_u_avx512f(lv_32fc_t* result,
+                                                            const lv_32fc_t* input,
+                                                            const float* taps,
+                                                            unsigned int num_banks,
+                                                            unsigned int num_points)
+{
+    const float* in = (const float*)input;
+    const unsigned int num_groups =
+        (num_banks + VOLK_XK_DOT_PROD_BANK_BLOCK - 1) / VOLK_XK_DOT_PROD_BANK_BLOCK;
+    const unsigned int group_stride = VOLK_XK_DOT_PROD_BANK_BLOCK * num_points;
+    __VOLK_ATTR_ALIGNED(32) lv_32fc_t res[4 * VOLK_XK_DOT_PROD_BANK_BLOCK];
+    unsigned int g = 0, n;
+
+    // re(x[n]) in the low eight lanes, re(x[n + 1]) in the high eight lanes
+    const __m512i reIdx =
+        _mm512_set_epi32(2, 2, 2, 2, 2, 2, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0);
+    const __m512i imIdx =
+        _mm512_set_epi32(3, 3, 3, 3, 3, 3, 3, 3, 1, 1, 1, 1, 1, 1, 1, 1);
+    __m512 x, xr, xi, t, re0, im0, re1, im1, re2, im2, re3, im3;
+    __m256 r, i, lo, hi;
+
+    // Four bank groups (32 banks) per pass: every input sample is broadcast
+    // once and multiplied into eight accumulators.
+    for (; g + 4 <= num_groups; g += 4) {
+        const float* t0 = taps + g * group_stride;
+        const float* t1 = t0 + group_stride;
+        const float* t2 = t1 + group_stride;
+        const float* t3 = t2 + group_stride;
+
+        re0 = _mm512_setzero_ps();
+        im0 = _mm512_setzero_ps();
+        re1 = _mm512_setzero_ps();
+        im1 = _mm512_setzero_ps();
+        re2 = _mm512_setzero_ps();
+        im2 = _mm512_setzero_ps();
+        re3 = _mm512_setzero_ps();
+        im3 = _mm512_setzero_ps();
+
+        // two samples per iteration, one in each half of the register
+        for (n = 0; n + 2 <= num_points; n += 2) {
+            x = _mm512_castps128_ps512(_mm_loadu_ps(in + 2 * n));
+            xr = _mm512_permutexvar_ps(reIdx, x);
+            xi = _mm512_permutexvar_ps(imIdx, x);
+            t = _mm512_loadu_ps(t0 + 8 * n);
+            re0 = _mm512_fmadd_ps(xr, t, re0);
+            im0 = _mm512_fmadd_ps(xi, t, im0);
+            t = _mm512_loadu_ps(t1 + 8 * n);
+            re1 = _mm512_fmadd_ps(xr, t, re1);
+            im1 = _mm512_fmadd_ps(xi, t, im1);
+            t = _mm512_loadu_ps(t2 + 8 * n);
+            re2 = _mm512_fmadd_ps(xr, t, re2);
+            im2 = _mm512_fmadd_ps(xi, t, im2);
+            t = _mm512_loadu_ps(t3 + 8 * n);
+            re3 = _mm512_fmadd_ps(xr, t, re3);
+            im3 = _mm512_fmadd_ps(xi, t, im3);
+        }
+        if (n < num_points) {
+            x = _mm512_castps128_ps512(
+                _mm_castpd_ps(_mm_load_sd((const double*)(in + 2 * n))));
+            xr = _mm512_permutexvar_ps(reIdx, x);
+            xi = _mm512_permutexvar_ps(imIdx, x);
+            t = _mm512_maskz_loadu_ps(0x00FF, t0 + 8 * n);
+            re0 = _mm512_fmadd_ps(xr, t, re0);
+            im0 = _mm512_fmadd_ps(xi, t, im0);
+            t = _mm512_maskz_loadu_ps(0x00FF, t1 + 8 * n);
+            re1 = _mm512_fmadd_ps(xr, t, re1);
+            im1 = _mm512_fmadd_ps(xi, t, im1);
+            t = _mm512_maskz_loadu_ps(0x00FF, t2 + 8 * n);
+            re2 = _mm512_fmadd_ps(xr, t, re2);
+            im2 = _mm512_fmadd_ps(xi, t, im2);
+            t = _mm512_maskz_loadu_ps(0x00FF, t3 + 8 * n);
+            re3 = _mm512_fmadd_ps(xr, t, re3);
+            im3 = _mm512_fmadd_ps(xi, t, im3);
+        }
+
+        // add the even and odd sample halves, interleave (re, im)
+        r = _mm256_add_ps(
+            _mm512_castps512_ps256(re0),
+            _mm256_castpd_ps(_mm512_extractf64x4_pd(_mm512_castps_pd(re0), 1)));
+        i = _mm256_add_ps(
+            _mm512_castps512_ps256(im0),
+            _mm256_castpd_ps(_mm512_extractf64x4_pd(_mm512_castps_pd(im0), 1)));
+        lo = _mm256_unpacklo_ps(r, i); // 0, 1 | 4, 5
+        hi = _mm256_unpackhi_ps(r, i); // 2, 3 | 6, 7
+        _mm256_store_ps((float*)(res + 0), _mm256_permute2f128_ps(lo, hi, 0x20));
+        _mm256_store_ps((float*)(res + 4), _mm256_permute2f128_ps(lo, hi, 0x31));
+        r = _mm256_add_ps(
+            _mm512_castps512_ps256(re1),
+            _mm256_castpd_ps(_mm512_extractf64x4_pd(_mm512_castps_pd(re1), 1)));
+        i = _mm256_add_ps(
+            _mm512_castps512_ps256(im1),
+            _mm256_castpd_ps(_mm512_extractf64x4_pd(_mm512_castps_pd(im1), 1)));
+        lo = _mm256_unpacklo_ps(r, i); // 0, 1 | 4, 5
+        hi = _mm256_unpackhi_ps(r, i); // 2, 3 | 6, 7
+        _mm256_store_ps((float*)(res + 8), _mm256_permute2f128_ps(lo, hi, 0x20));
+        _mm256_store_ps((float*)(res + 12), _mm256_permute2f128_ps(lo, hi, 0x31));
+        r = _mm256_add_ps(
+            _mm512_castps512_ps256(re2),
+            _mm256_castpd_ps(_mm512_extractf64x4_pd(_mm512_castps_pd(re2), 1)));
+        i = _mm256_add_ps(
+            _mm512_castps512_ps256(im2),
+            _mm256_castpd_ps(_mm512_extractf64x4_pd(_mm512_castps_pd(im2), 1)));
+        lo = _mm256_unpacklo_ps(r, i); // 0, 1 | 4, 5
+        hi = _mm256_unpackhi_ps(r, i); // 2, 3 | 6, 7
+        _mm256_store_ps((float*)(res + 16), _mm256_permute2f128_ps(lo, hi, 0x20));
+        _mm256_store_ps((float*)(res + 20), _mm256_permute2f128_ps(lo, hi, 0x31));
+        r = _mm256_add_ps(
+            _mm512_castps512_ps256(re3),
+            _mm256_castpd_ps(_mm512_extractf64x4_pd(_mm512_castps_pd(re3), 1)));
+        i = _mm256_add_ps(
+            _mm512_castps512_ps256(im3),
+            _mm256_castpd_ps(_mm512_extractf64x4_pd(_mm512_castps_pd(im3), 1)));
+        lo = _mm256_unpacklo_ps(r, i); // 0, 1 | 4, 5
+        hi = _mm256_unpackhi_ps(r, i); // 2, 3 | 6, 7
+        _mm256_store_ps((float*)(res + 24), _mm256_permute2f128_ps(lo, hi, 0x20));
+        _mm256_store_ps((float*)(res + 28), _mm256_permute2f128_ps(lo, hi, 0x31));
+
+        volk_32fc_32f_xK_dot_prod_store(result,
+                                        res,
+                                        g * VOLK_XK_DOT_PROD_BANK_BLOCK,
+                                        4 * VOLK_XK_DOT_PROD_BANK_BLOCK,
+                                        num_banks);
+    }
+
+    for (; g < num_groups; g++) {
+        const float* t0 = taps + g * group_stride;
+
+        re0 = _mm512_setzero_ps();
+        im0 = _mm512_setzero_ps();
+
+        // two samples per iteration, one in each half of the register
+        for (n = 0; n + 2 <= num_points; n += 2) {
+            x = _mm512_castps128_ps512(_mm_loadu_ps(in + 2 * n));
+            xr = _mm512_permutexvar_ps(reIdx, x);
+            xi = _mm512_permutexvar_ps(imIdx, x);
+            t = _mm512_loadu_ps(t0 + 8 * n);
+            re0 = _mm512_fmadd_ps(xr, t, re0);
+            im0 = _mm512_fmadd_ps(xi, t, im0);
+        }
+        if (n < num_points) {
+            x = _mm512_castps128_ps512(
+                _mm_castpd_ps(_mm_load_sd((const double*)(in + 2 * n))));
+            xr = _mm512_permutexvar_ps(reIdx, x);
+            xi = _mm512_permutexvar_ps(imIdx, x);
+            t = _mm512_maskz_loadu_ps(0x00FF, t0 + 8 * n);
+            re0 = _mm512_fmadd_ps(xr, t, re0);
+            im0 = _mm512_fmadd_ps(xi, t, im0);
+        }
+
+        // add the even and odd sample halves, interleave (re, im)
+        r = _mm256_add_ps(
+            _mm512_castps512_ps256(re0),
+            _mm256_castpd_ps(_mm512_extractf64x4_pd(_mm512_castps_pd(re0), 1)));
+        i = _mm256_add_ps(
+            _mm512_castps512_ps256(im0),
+            _mm256_castpd_ps(_mm512_extractf64x4_pd(_mm512_castps_pd(im0), 1)));
+        lo = _mm256_unpacklo_ps(r, i); // 0, 1 | 4, 5
+        hi = _mm256_unpackhi_ps(r, i); // 2, 3 | 6, 7
+        _mm256_store_ps((float*)(res + 0), _mm256_permute2f128_ps(lo, hi, 0x20));
+        _mm256_store_ps((float*)(res + 4), _mm256_permute2f128_ps(lo, hi, 0x31));
+
+        volk_32fc_32f_xK_dot_prod_store(result,
+                                        res,
+                                        g * VOLK_XK_DOT_PROD_BANK_BLOCK,
+                                        1 * VOLK_XK_DOT_PROD_BANK_BLOCK,
+                                        num_banks);
+    }
+}
+
+#endif /* LV_HAVE_AVX512F */
+
+
+#ifdef LV_HAVE_NEON
+#include <arm_neon.h>
+
+static inline void volk_32fc_32f_xK_dot_prod_32fc_neon(lv_32fc_t* result,
+                                                       const lv_32fc_t* input,
+                                                       const float* taps,
+                                                       unsigned int num_banks,
+                                                       unsigned int num_points)
+{
+    const float* in = (const float*)input;
+    const unsigned int num_groups =
+        (num_banks + VOLK_XK_DOT_PROD_BANK_BLOCK - 1) / VOLK_XK_DOT_PROD_BANK_BLOCK;
+    const unsigned int group_stride = VOLK_XK_DOT_PROD_BANK_BLOCK * num_points;
+    lv_32fc_t res[2 * VOLK_XK_DOT_PROD_BANK_BLOCK];
+    unsigned int g = 0, n;
+
+    float32x4_t xr, xi, t;
+    float32x4_t reLo0, imLo0, reHi0, imHi0, reLo1, imLo1, reHi1, imHi1;
+    float32x4x2_t out;
+
+    // Two bank groups (16 banks) per pass: every input sample is broadcast
+    // once and multiplied into eight accumulators.
+    for (; g + 2 <= num_groups; g += 2) {
+        const float* t0 = taps + g * group_stride;
+        const float* t1 = t0 + group_stride;
+
+        reLo0 = vdupq_n_f32(0.f);
+        imLo0 = vdupq_n_f32(0.f);
+        reHi0 = vdupq_n_f32(0.f);
+        imHi0 = vdupq_n_f32(0.f);
+        reLo1 = vdupq_n_f32(0.f);
+        imLo1 = vdupq_n_f32(0.f);
+        reHi1 = vdupq_n_f32(0.f);
+        imHi1 = vdupq_n_f32(0.f);
+
+        for (n = 0; n < num_points; n++) {
+            xr = vdupq_n_f32(in[2 * n]);
+            xi = vdupq_n_f32(in[2 * n + 1]);
+            t = vld1q_f32(t0 + 8 * n);
+            reLo0 = vmlaq_f32(reLo0, xr, t);
+            imLo0 = vmlaq_f32(imLo0, xi, t);
+            t = vld1q_f32(t0 + 8 * n + 4);
+            reHi0 = vmlaq_f32(reHi0, xr, t);
+            imHi0 = vmlaq_f32(imHi0, xi, t);
+            t = vld1q_f32(t1 + 8 * n);
+            reLo1 = vmlaq_f32(reLo1, xr, t);
+            imLo1 = vmlaq_f32(imLo1, xi, t);
+            t = vld1q_f32(t1 + 8 * n + 4);
+            reHi1 = vmlaq_f32(reHi1, xr, t);
+            imHi1 = vmlaq_f32(imHi1, xi, t);
+        }
+
+        // interleave (re, im) of banks 0..7 of every group
+        out.val[0] = reLo0;
+        out.val[1] = imLo0;
+        vst2q_f32((float*)(res + 0), out);
+        out.val[0] = reHi0;
+        out.val[1] = imHi0;
+        vst2q_f32((float*)(res + 4), out);
+        out.val[0] = reLo1;
+        out.val[1] = imLo1;
+        vst2q_f32((float*)(res + 8), out);
+        out.val[0] = reHi1;
+        out.val[1] = imHi1;
+        vst2q_f32((float*)(res + 12), out);
+
+        volk_32fc_32f_xK_dot_prod_store(result,
+                                        res,
+                                        g * VOLK_XK_DOT_PROD_BANK_BLOCK,
+                                        2 * VOLK_XK_DOT_PROD_BANK_BLOCK,
+                                        num_banks);
+    }
+
+    for (; g < num_groups; g++) {
+        const float* t0 = taps + g * group_stride;
+
+        reLo0 = vdupq_n_f32(0.f);
+        imLo0 = vdupq_n_f32(0.f);
+        reHi0 = vdupq_n_f32(0.f);
+        imHi0 = vdupq_n_f32(0.f);
+
+        for (n = 0; n < num_points; n++) {
+            xr = vdupq_n_f32(in[2 * n]);
+            xi = vdupq_n_f32(in[2 * n + 1]);
+            t = vld1q_f32(t0 + 8 * n);
+            reLo0 = vmlaq_f32(reLo0, xr, t);
+            imLo0 = vmlaq_f32(imLo0, xi, t);
+            t = vld1q_f32(t0 + 8 * n + 4);
+            reHi0 = vmlaq_f32(reHi0, xr, t);
+            imHi0 = vmlaq_f32(imHi0, xi, t);
+        }
+
+        // interleave (re, im) of banks 0..7 of every group
+        out.val[0] = reLo0;
+        out.val[1] = imLo0;
+        vst2q_f32((float*)(res + 0), out);
+        out.val[0] = reHi0;
+        out.val[1] = imHi0;
+        vst2q_f32((float*)(res + 4), out);
+
+        volk_32fc_32f_xK_dot_prod_store(result,
+                                        res,
+                                        g * VOLK_XK_DOT_PROD_BANK_BLOCK,
+                                        1 * VOLK_XK_DOT_PROD_BANK_BLOCK,
+                                        num_banks);
+    }
+}
+
+#endif /* LV_HAVE_NEON */
+
+#endif /* INCLUDED_volk_32fc_32f_xK_dot_prod_32fc_u_H */
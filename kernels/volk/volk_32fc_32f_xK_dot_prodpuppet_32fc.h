@@ -0,0 +1,106 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2026 Free Software Foundation, Inc.
+ *
+ * This file is part of VOLK
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+/*
+ * QA wrapper for volk_32fc_32f_xK_dot_prod_32fc. The random taps buffer is used as
+ * already packed taps of volk_32fc_32f_xK_dot_prodpuppet_banks banks, with the
+ * window length chosen so that the packed taps fit into the buffer.
+ */
+
+#ifndef INCLUDED_volk_32fc_32f_xK_dot_prodpuppet_32fc_H
+#define INCLUDED_volk_32fc_32f_xK_dot_prodpuppet_32fc_H
+
+#include <volk/volk_32fc_32f_xK_dot_prod_32fc.h>
+
+static const unsigned int volk_32fc_32f_xK_dot_prodpuppet_banks = 37;
+
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void volk_32fc_32f_xK_dot_prodpuppet_32fc_generic(lv_32fc_t* result,
+                                                                const lv_32fc_t* input,
+                                                                const float* taps,
+                                                                unsigned int num_points)
+{
+    const unsigned int window =
+        num_points /
+        volk_32fc_32f_xK_dot_prod_packed_size(volk_32fc_32f_xK_dot_prodpuppet_banks, 1);
+    volk_32fc_32f_xK_dot_prod_32fc_generic(
+        result, input, taps, volk_32fc_32f_xK_dot_prodpuppet_banks, window);
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+#ifdef LV_HAVE_SSE
+
+static inline void volk_32fc_32f_xK_dot_prodpuppet_32fc_u_sse(lv_32fc_t* result,
+                                                              const lv_32fc_t* input,
+                                                              const float* taps,
+                                                              unsigned int num_points)
+{
+    const unsigned int window =
+        num_points /
+        volk_32fc_32f_xK_dot_prod_packed_size(volk_32fc_32f_xK_dot_prodpuppet_banks, 1);
+    volk_32fc_32f_xK_dot_prod_32fc_u_sse(
+        result, input, taps, volk_32fc_32f_xK_dot_prodpuppet_banks, window);
+}
+
+#endif /* LV_HAVE_SSE */
+
+#if LV_HAVE_AVX && LV_HAVE_FMA
+
+static inline void
+volk_32fc_32f_xK_dot_prodpuppet_32fc_u_avx_fma(lv_32fc_t* result,
+                                               const lv_32fc_t* input,
+                                               const float* taps,
+                                               unsigned int num_points)
+{
+    const unsigned int window =
+        num_points /
+        volk_32fc_32f_xK_dot_prod_packed_size(volk_32fc_32f_xK_dot_prodpuppet_banks, 1);
+    volk_32fc_32f_xK_dot_prod_32fc_u_avx_fma(
+        result, input, taps, volk_32fc_32f_xK_dot_prodpuppet_banks, window);
+}
+
+#endif /* LV_HAVE_AVX && LV_HAVE_FMA */
+
+#ifdef LV_HAVE_AVX512F
+
+static inline void
+volk_32fc_32f_xK_dot_prodpuppet_32fc_u_avx512f(lv_32fc_t* result,
+                                               const lv_32fc_t* input,
+                                               const float* taps,
+                                               unsigned int num_points)
+{
+    const unsigned int window =
+        num_points /
+        volk_32fc_32f_xK_dot_prod_packed_size(volk_32fc_32f_xK_dot_prodpuppet_banks, 1);
+    volk_32fc_32f_xK_dot_prod_32fc_u_avx512f(
+        result, input, taps, volk_32fc_32f_xK_dot_prodpuppet_banks, window);
+}
+
+#endif /* LV_HAVE_AVX512F */
+
+#ifdef LV_HAVE_NEON
+
+static inline void volk_32fc_32f_xK_dot_prodpuppet_32fc_neon(lv_32fc_t* result,
+                                                             const lv_32fc_t* input,
+                                                             const float* taps,
+                                                             unsigned int num_points)
+{
+    const unsigned int window =
+        num_points /
+        volk_32fc_32f_xK_dot_prod_packed_size(volk_32fc_32f_xK_dot_prodpuppet_banks, 1);
+    volk_32fc_32f_xK_dot_prod_32fc_neon(
+        result, input, taps, volk_32fc_32f_xK_dot_prodpuppet_banks, window);
+}
+
+#endif /* LV_HAVE_NEON */
+
+#endif /* INCLUDED_volk_32fc_32f_xK_dot_prodpuppet_32fc_H */
@@ -0,0 +1,107 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2026 Free Software Foundation, Inc.
+ *
+ * This file is part of VOLK
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+/*!
+ * \page volk_32fc_convert_16fc
+ *
+ * \b Overview
+ *
+ * Converts complex floats to half precision (binary16) complex values, see
+ * volk_32f_convert_16f. Each output sample is two uint16_t, the real part
+ * first.
+ *
+ * <b>Dispatcher Prototype</b>
+ * \code
+ * void volk_32fc_convert_16fc(uint16_t* outputVector, const lv_32fc_t* inputVector,
+ *                             unsigned int num_points)
+ * \endcode
+ *
+ * \b Inputs
+ * \li inputVector: the complex floats to convert.
+ * \li num_points: the number of complex values.
+ *
+ * \b Outputs
+ * \li outputVector: the 2 * num_points half precision values.
+ *
+ * \b Example
+ * Store a tone in half precision.
+ * \code
+ *   unsigned int N = 1000;
+ *   unsigned int alignment = volk_get_alignment();
+ *   lv_32fc_t* in = (lv_32fc_t*)volk_malloc(sizeof(lv_32fc_t) * N, alignment);
+ *   uint16_t* out = (uint16_t*)volk_malloc(2 * sizeof(uint16_t) * N, alignment);
+ *
+ *   for (unsigned int ii = 0; ii < N; ++ii) {
+ *       in[ii] = lv_cmake(cosf(0.1f * ii), sinf(0.1f * ii));
+ *   }
+ *
+ *   volk_32fc_convert_16fc(out, in, N);
+ *
+ *   volk_free(in);
+ *   volk_free(out);
+ * \endcode
+ */
+
+#ifndef INCLUDED_volk_32fc_convert_16fc_H
+#define INCLUDED_volk_32fc_convert_16fc_H
+
+#include <volk/volk_32f_convert_16f.h>
+#include <volk/volk_complex.h>
+
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void volk_32fc_convert_16fc_generic(uint16_t* outputVector,
+                                                  const lv_32fc_t* inputVector,
+                                                  unsigned int num_points)
+{
+    volk_32f_convert_16f_generic(outputVector, (const float*)inputVector, 2 * num_points);
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+
+#if LV_HAVE_AVX && LV_HAVE_F16C
+
+static inline void volk_32fc_convert_16fc_u_avx_f16c(uint16_t* outputVector,
+                                                     const lv_32fc_t* inputVector,
+                                                     unsigned int num_points)
+{
+    volk_32f_convert_16f_u_avx_f16c(
+        outputVector, (const float*)inputVector, 2 * num_points);
+}
+
+#endif /* LV_HAVE_AVX && LV_HAVE_F16C */
+
+
+#ifdef LV_HAVE_AVX512F
+
+static inline void volk_32fc_convert_16fc_u_avx512f(uint16_t* outputVector,
+                                                    const lv_32fc_t* inputVector,
+                                                    unsigned int num_points)
+{
+    volk_32f_convert_16f_u_avx512f(
+        outputVector, (const float*)inputVector, 2 * num_points);
+}
+
+#endif /* LV_HAVE_AVX512F */
+
+
+#ifdef LV_HAVE_NEONV8
+
+static inline void volk_32fc_convert_16fc_neonv8(uint16_t* outputVector,
+                                                 const lv_32fc_t* inputVector,
+                                                 unsigned int num_points)
+{
+    volk_32f_convert_16f_neonv8(outputVector, (const float*)inputVector, 2 * num_points);
+}
+
+#endif /* LV_HAVE_NEONV8 */
+
+#endif /* INCLUDED_volk_32fc_convert_16fc_H */
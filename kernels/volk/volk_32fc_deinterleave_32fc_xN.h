@@ -0,0 +1,350 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2026 Free Software Foundation, Inc.
+ *
+ * This file is part of VOLK
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+/*!
+ * \page volk_32fc_deinterleave_32fc_xN
+ *
+ * \b Overview
+ *
+ * Splits a sample interleaved multi-channel stream (ch0, ch1, ..., chN-1,
+ * ch0, ...) into one vector per channel.
+ *
+ * outputVectors[c][n] = inputVector[n * num_channels + c]
+ *
+ * Two channels and multiples of four channels are transposed in registers,
+ * other even channel counts in pairs. Odd channel counts use scalar copies.
+ * volk_32fc_interleave_32fc_xN is the inverse.
+ *
+ * <b>Dispatcher Prototype</b>
+ * \code
+ * void volk_32fc_deinterleave_32fc_xN(lv_32fc_t** outputVectors,
+ *                                     const lv_32fc_t* inputVector,
+ *                                     unsigned int num_channels,
+ *                                     unsigned int num_points)
+ * \endcode
+ *
+ * \b Inputs
+ * \li inputVector: the interleaved stream, num_channels * num_points samples.
+ * \li num_channels: the number of channels N.
+ * \li num_points: the number of samples per channel.
+ *
+ * \b Outputs
+ * \li outputVectors: N pointers to the num_points samples of each channel.
+ *
+ * \b Example
+ * Split the stream of a four channel receiver.
+ * \code
+ *   unsigned int N = 1000;
+ *   unsigned int alignment = volk_get_alignment();
+ *   lv_32fc_t* in = (lv_32fc_t*)volk_malloc(4 * sizeof(lv_32fc_t) * N, alignment);
+ *   lv_32fc_t* channels[4];
+ *
+ *   for (unsigned int ii = 0; ii < 4; ++ii) {
+ *       channels[ii] = (lv_32fc_t*)volk_malloc(sizeof(lv_32fc_t) * N, alignment);
+ *   }
+ *   // ... fill in
+ *
+ *   volk_32fc_deinterleave_32fc_xN(channels, in, 4, N);
+ *
+ *   for (unsigned int ii = 0; ii < 4; ++ii) {
+ *       volk_free(channels[ii]);
+ *   }
+ *   volk_free(in);
+ * \endcode
+ */
+
+#ifndef INCLUDED_volk_32fc_deinterleave_32fc_xN_H
+#define INCLUDED_volk_32fc_deinterleave_32fc_xN_H
+
+#include <volk/volk_complex.h>
+
+static inline void volk_32fc_deinterleave_xN_frames(lv_32fc_t** outputVectors,
+                                                    const lv_32fc_t* inputVector,
+                                                    unsigned int num_channels,
+                                                    unsigned int first,
+                                                    unsigned int num_points)
+{
+    unsigned int number, channel;
+
+    inputVector += first * num_channels;
+    for (number = first; number < num_points; number++) {
+        for (channel = 0; channel < num_channels; channel++) {
+            outputVectors[channel][number] = *inputVector++;
+        }
+    }
+}
+
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void volk_32fc_deinterleave_32fc_xN_generic(lv_32fc_t** outputVectors,
+                                                          const lv_32fc_t* inputVector,
+                                                          unsigned int num_channels,
+                                                          unsigned int num_points)
+{
+    volk_32fc_deinterleave_xN_frames(
+        outputVectors, inputVector, num_channels, 0, num_points);
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+
+#ifdef LV_HAVE_SSE
+#include <xmmintrin.h>
+
+static inline void volk_32fc_deinterleave_32fc_xN_u_sse(lv_32fc_t** outputVectors,
+                                                        const lv_32fc_t* inputVector,
+                                                        unsigned int num_channels,
+                                                        unsigned int num_points)
+{
+    const unsigned int halfPoints = (num_channels % 2 == 0) ? num_points / 2 : 0;
+    const float* frame0;
+    const float* frame1;
+    __m128 a, b;
+    unsigned int number, channel;
+
+    // transpose 2x2 blocks of two frames and two channels
+    for (number = 0; number < halfPoints; number++) {
+        frame0 = (const float*)(inputVector + 2 * number * num_channels);
+        frame1 = frame0 + 2 * num_channels;
+        for (channel = 0; channel < num_channels; channel += 2) {
+            a = _mm_loadu_ps(frame0 + 2 * channel);
+            b = _mm_loadu_ps(frame1 + 2 * channel);
+            _mm_storeu_ps((float*)(outputVectors[channel] + 2 * number),
+                          _mm_movelh_ps(a, b));
+            _mm_storeu_ps((float*)(outputVectors[channel + 1] + 2 * number),
+                          _mm_movehl_ps(b, a));
+        }
+    }
+
+    volk_32fc_deinterleave_xN_frames(
+        outputVectors, inputVector, num_channels, halfPoints * 2, num_points);
+}
+
+#endif /* LV_HAVE_SSE */
+
+
+#ifdef LV_HAVE_AVX
+#include <immintrin.h>
+
+static inline void volk_32fc_deinterleave_32fc_xN_u_avx(lv_32fc_t** outputVectors,
+                                                        const lv_32fc_t* inputVector,
+                                                        unsigned int num_channels,
+                                                        unsigned int num_points)
+{
+    const double* input = (const double*)inputVector;
+    const double* frame;
+    unsigned int quarterPoints = 0;
+    unsigned int halfPoints = 0;
+    __m256d r0, r1, r2, r3, t0, t1, t2, t3;
+    __m128d a, b;
+    unsigned int number, channel;
+
+    if (num_channels == 2) {
+        quarterPoints = num_points / 4;
+        for (number = 0; number < quarterPoints; number++) {
+            r0 = _mm256_loadu_pd(input);
+            r1 = _mm256_loadu_pd(input + 4);
+            t0 = _mm256_permute2f128_pd(r0, r1, 0x20);
+            t1 = _mm256_permute2f128_pd(r0, r1, 0x31);
+            _mm256_storeu_pd((double*)(outputVectors[0] + 4 * number),
+                             _mm256_unpacklo_pd(t0, t1));
+            _mm256_storeu_pd((double*)(outputVectors[1] + 4 * number),
+                             _mm256_unpackhi_pd(t0, t1));
+            input += 8;
+        }
+    } else if (num_channels % 4 == 0) {
+        // transpose 4x4 blocks of four frames and four channels
+        quarterPoints = num_points / 4;
+        for (number = 0; number < quarterPoints; number++) {
+            frame = input + 4 * number * num_channels;
+            for (channel = 0; channel < num_channels; channel += 4) {
+                r0 = _mm256_loadu_pd(frame + channel);
+                r1 = _mm256_loadu_pd(frame + num_channels + channel);
+                r2 = _mm256_loadu_pd(frame + 2 * num_channels + channel);
+                r3 = _mm256_loadu_pd(frame + 3 * num_channels + channel);
+                t0 = _mm256_unpacklo_pd(r0, r1);
+                t1 = _mm256_unpackhi_pd(r0, r1);
+                t2 = _mm256_unpacklo_pd(r2, r3);
+                t3 = _mm256_unpackhi_pd(r2, r3);
+                _mm256_storeu_pd((double*)(outputVectors[channel] + 4 * number),
+                                 _mm256_permute2f128_pd(t0, t2, 0x20));
+                _mm256_storeu_pd((double*)(outputVectors[channel + 1] + 4 * number),
+                                 _mm256_permute2f128_pd(t1, t3, 0x20));
+                _mm256_storeu_pd((double*)(outputVectors[channel + 2] + 4 * number),
+                                 _mm256_permute2f128_pd(t0, t2, 0x31));
+                _mm256_storeu_pd((double*)(outputVectors[channel + 3] + 4 * number),
+                                 _mm256_permute2f128_pd(t1, t3, 0x31));
+            }
+        }
+    } else if (num_channels % 2 == 0) {
+        halfPoints = num_points / 2;
+        for (number = 0; number < halfPoints; number++) {
+            frame = input + 2 * number * num_channels;
+            for (channel = 0; channel < num_channels; channel += 2) {
+                a = _mm_loadu_pd(frame + channel);
+                b = _mm_loadu_pd(frame + num_channels + channel);
+                _mm_storeu_pd((double*)(outputVectors[channel] + 2 * number),
+                              _mm_unpacklo_pd(a, b));
+                _mm_storeu_pd((double*)(outputVectors[channel + 1] + 2 * number),
+                              _mm_unpackhi_pd(a, b));
+            }
+        }
+    }
+
+    volk_32fc_deinterleave_xN_frames(outputVectors,
+                                     inputVector,
+                                     num_channels,
+                                     quarterPoints * 4 + halfPoints * 2,
+                                     num_points);
+}
+
+#endif /* LV_HAVE_AVX */
+
+
+#ifdef LV_HAVE_AVX512F
+#include <immintrin.h>
+
+static inline void volk_32fc_deinterleave_32fc_xN_u_avx512f(lv_32fc_t** outputVectors,
+                                                            const lv_32fc_t* inputVector,
+                                                            unsigned int num_channels,
+                                                            unsigned int num_points)
+{
+    const double* input = (const double*)inputVector;
+    const double* frame;
+    unsigned int eighthPoints = 0;
+    unsigned int quarterPoints = 0;
+    unsigned int halfPoints = 0;
+    __m512d x, y;
+    __m128d a, b;
+    unsigned int number, channel;
+
+    if (num_channels == 2) {
+        const __m512i even = _mm512_setr_epi64(0, 2, 4, 6, 8, 10, 12, 14);
+        const __m512i odd = _mm512_setr_epi64(1, 3, 5, 7, 9, 11, 13, 15);
+        eighthPoints = num_points / 8;
+        for (number = 0; number < eighthPoints; number++) {
+            x = _mm512_loadu_pd(input);
+            y = _mm512_loadu_pd(input + 8);
+            _mm512_storeu_pd((double*)(outputVectors[0] + 8 * number),
+                             _mm512_permutex2var_pd(x, even, y));
+            _mm512_storeu_pd((double*)(outputVectors[1] + 8 * number),
+                             _mm512_permutex2var_pd(x, odd, y));
+            input += 16;
+        }
+    } else if (num_channels % 4 == 0) {
+        // four frames of four channels in two registers, two channels out of each
+        const __m512i first = _mm512_setr_epi64(0, 4, 8, 12, 1, 5, 9, 13);
+        const __m512i second = _mm512_setr_epi64(2, 6, 10, 14, 3, 7, 11, 15);
+        __m512d low, high;
+        quarterPoints = num_points / 4;
+        for (number = 0; number < quarterPoints; number++) {
+            frame = input + 4 * number * num_channels;
+            for (channel = 0; channel < num_channels; channel += 4) {
+                x = _mm512_insertf64x4(
+                    _mm512_castpd256_pd512(_mm256_loadu_pd(frame + channel)),
+                    _mm256_loadu_pd(frame + num_channels + channel),
+                    1);
+                y = _mm512_insertf64x4(
+                    _mm512_castpd256_pd512(
+                        _mm256_loadu_pd(frame + 2 * num_channels + channel)),
+                    _mm256_loadu_pd(frame + 3 * num_channels + channel),
+                    1);
+                low = _mm512_permutex2var_pd(x, first, y);
+                high = _mm512_permutex2var_pd(x, second, y);
+                _mm256_storeu_pd((double*)(outputVectors[channel] + 4 * number),
+                                 _mm512_castpd512_pd256(low));
+                _mm256_storeu_pd((double*)(outputVectors[channel + 1] + 4 * number),
+                                 _mm512_extractf64x4_pd(low, 1));
+                _mm256_storeu_pd((double*)(outputVectors[channel + 2] + 4 * number),
+                                 _mm512_castpd512_pd256(high));
+                _mm256_storeu_pd((double*)(outputVectors[channel + 3] + 4 * number),
+                                 _mm512_extractf64x4_pd(high, 1));
+            }
+        }
+    } else if (num_channels % 2 == 0) {
+        halfPoints = num_points / 2;
+        for (number = 0; number < halfPoints; number++) {
+            frame = input + 2 * number * num_channels;
+            for (channel = 0; channel < num_channels; channel += 2) {
+                a = _mm_loadu_pd(frame + channel);
+                b = _mm_loadu_pd(frame + num_channels + channel);
+                _mm_storeu_pd((double*)(outputVectors[channel] + 2 * number),
+                              _mm_unpacklo_pd(a, b));
+                _mm_storeu_pd((double*)(outputVectors[channel + 1] + 2 * number),
+                              _mm_unpackhi_pd(a, b));
+            }
+        }
+    }
+
+    volk_32fc_deinterleave_xN_frames(outputVectors,
+                                     inputVector,
+                                     num_channels,
+                                     eighthPoints * 8 + quarterPoints * 4 +
+                                         halfPoints * 2,
+                                     num_points);
+}
+
+#endif /* LV_HAVE_AVX512F */
+
+
+#ifdef LV_HAVE_NEON
+#include <arm_neon.h>
+
+static inline void volk_32fc_deinterleave_32fc_xN_neon(lv_32fc_t** outputVectors,
+                                                       const lv_32fc_t* inputVector,
+                                                       unsigned int num_channels,
+                                                       unsigned int num_points)
+{
+    const float* input = (const float*)inputVector;
+    const float* frame;
+    unsigned int quarterPoints = 0;
+    unsigned int halfPoints = 0;
+    float32x4x4_t values;
+    float32x4x2_t channelValues;
+    float32x4_t a, b;
+    unsigned int number, channel;
+
+    if (num_channels == 2) {
+        quarterPoints = num_points / 4;
+        for (number = 0; number < quarterPoints; number++) {
+            values = vld4q_f32(input);
+            channelValues.val[0] = values.val[0];
+            channelValues.val[1] = values.val[1];
+            vst2q_f32((float*)(outputVectors[0] + 4 * number), channelValues);
+            channelValues.val[0] = values.val[2];
+            channelValues.val[1] = values.val[3];
+            vst2q_f32((float*)(outputVectors[1] + 4 * number), channelValues);
+            input += 16;
+        }
+    } else if (num_channels % 2 == 0) {
+        halfPoints = num_points / 2;
+        for (number = 0; number < halfPoints; number++) {
+            frame = input + 4 * number * num_channels;
+            for (channel = 0; channel < num_channels; channel += 2) {
+                a = vld1q_f32(frame + 2 * channel);
+                b = vld1q_f32(frame + 2 * num_channels + 2 * channel);
+                vst1q_f32((float*)(outputVectors[channel] + 2 * number),
+                          vcombine_f32(vget_low_f32(a), vget_low_f32(b)));
+                vst1q_f32((float*)(outputVectors[channel + 1] + 2 * number),
+                          vcombine_f32(vget_high_f32(a), vget_high_f32(b)));
+            }
+        }
+    }
+
+    volk_32fc_deinterleave_xN_frames(outputVectors,
+                                     inputVector,
+                                     num_channels,
+                                     quarterPoints * 4 + halfPoints * 2,
+                                     num_points);
+}
+
+#endif /* LV_HAVE_NEON */
+
+#endif /* INCLUDED_volk_32fc_deinterleave_32fc_xN_H */
@@ -0,0 +1,679 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2026 Free Software Foundation, Inc.
+ *
+ * This file is part of VOLK
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+/*!
+ * \page volk_32fc_fft_32fc
+ *
+ * \b Overview
+ *
+ * Computes the discrete Fourier transform of a complex vector whose length is
+ * a power of two, using a precomputed plan.
+ *
+ * The plan holds the twiddle factors of all stages and decides the direction
+ * of the transform. It is num_points complex values long and is filled in by
+ * volk_32fc_fft_make_plan(plan, num_points, inverse):
+ *
+ * plan[m + j] = exp(-+ i * pi * j / m), for m = 1, 2, 4, ..., num_points / 2
+ * and j = 0 ... m - 1
+ *
+ * with the negative sign for the forward and the positive sign for the
+ * inverse transform. The inverse transform is not normalized, a forward
+ * transform followed by an inverse transform scales the input by num_points.
+ * A plan for N points can also be used by volk_32f_fft_32fc for a real input
+ * of N samples.
+ *
+ * The transform is a decimation in time FFT: the bit reversed input is copied
+ * to the output while the first two stages are applied, then the output is
+ * transformed in place with radix-4 passes and one final radix-2 pass if
+ * log2(num_points) is odd.
+ *
+ * <b>Dispatcher Prototype</b>
+ * \code
+ * void volk_32fc_fft_32fc(lv_32fc_t* outVector, const lv_32fc_t* inVector,
+ *                         const lv_32fc_t* plan, unsigned int num_points)
+ * \endcode
+ *
+ * \b Inputs
+ * \li inVector: the num_points complex input samples.
+ * \li plan: the plan made by volk_32fc_fft_make_plan for num_points.
+ * \li num_points: the FFT size, a power of two and at least 8.
+ *
+ * \b Outputs
+ * \li outVector: the num_points frequency bins, in natural order. Must not
+ * overlap with inVector.
+ *
+ * \b Example
+ * Transform a tone in bin 3 and back.
+ * \code
+ *   unsigned int N = 1024;
+ *   unsigned int alignment = volk_get_alignment();
+ *   lv_32fc_t* in = (lv_32fc_t*)volk_malloc(sizeof(lv_32fc_t) * N, alignment);
+ *   lv_32fc_t* spec = (lv_32fc_t*)volk_malloc(sizeof(lv_32fc_t) * N, alignment);
+ *   lv_32fc_t* out = (lv_32fc_t*)volk_malloc(sizeof(lv_32fc_t) * N, alignment);
+ *   lv_32fc_t* fwd = (lv_32fc_t*)volk_malloc(sizeof(lv_32fc_t) * N, alignment);
+ *   lv_32fc_t* inv = (lv_32fc_t*)volk_malloc(sizeof(lv_32fc_t) * N, alignment);
+ *
+ *   volk_32fc_fft_make_plan(fwd, N, 0);
+ *   volk_32fc_fft_make_plan(inv, N, 1);
+ *
+ *   for (unsigned int ii = 0; ii < N; ++ii) {
+ *       float phase = 2.f * M_PI * 3.f * ii / N;
+ *       in[ii] = lv_cmake(cosf(phase), sinf(phase));
+ *   }
+ *
+ *   volk_32fc_fft_32fc(spec, in, fwd, N);  // spec[3] == N
+ *   volk_32fc_fft_32fc(out, spec, inv, N); // out == N * in
+ *
+ *   volk_free(in);
+ *   volk_free(spec);
+ *   volk_free(out);
+ *   volk_free(fwd);
+ *   volk_free(inv);
+ * \endcode
+ */
+
+#ifndef INCLUDED_volk_32fc_fft_32fc_u_H
+#define INCLUDED_volk_32fc_fft_32fc_u_H
+
+#include <math.h>
+#include <volk/volk_complex.h>
+
+/*
+ * Fill in the twiddle factors for a num_points FFT, plan has to hold
+ * num_points values. inverse selects the direction of the transform.
+ */
+static inline void
+volk_32fc_fft_make_plan(lv_32fc_t* plan, unsigned int num_points, int inverse)
+{
+    const double sign = inverse ? 1.0 : -1.0;
+    unsigned int m, j;
+
+    plan[0] = lv_cmake(1.f, 0.f); // not used
+    for (m = 1; m < num_points; m *= 2) {
+        for (j = 0; j < m; j++) {
+            const double phase = sign * M_PI * j / m;
+            plan[m + j] = lv_cmake((float)cos(phase), (float)sin(phase));
+        }
+    }
+}
+
+/*
+ * Copy the input in bit reversed order and apply the first two butterfly
+ * stages on the way, which leaves independent 4 point DFTs in the output.
+ * The input is read front to back, DFT g of the output is made from the
+ * inputs r + {0, 2, 1, 3} * num_points / 4 with r = bitreverse(g).
+ */
+static inline void volk_32fc_fft_bitrev_radix4(lv_32fc_t* outVector,
+                                               const lv_32fc_t* inVector,
+                                               const lv_32fc_t* plan,
+                                               unsigned int num_points)
+{
+    const unsigned int quarter = num_points / 4;
+    const float s = lv_cimag(plan[3]); // -1 for the forward, +1 for the inverse
+    unsigned int r, bit, g = 0;
+    lv_32fc_t a0, a1, a2, a3, d;
+
+    for (r = 0; r < quarter; r++) {
+        a0 = inVector[r] + inVector[r + 2 * quarter];
+        a1 = inVector[r] - inVector[r + 2 * quarter];
+        a2 = inVector[r + quarter] + inVector[r + 3 * quarter];
+        d = inVector[r + quarter] - inVector[r + 3 * quarter];
+        a3 = lv_cmake(-s * lv_cimag(d), s * lv_creal(d)); // d * plan[3]
+
+        outVector[4 * g] = a0 + a2;
+        outVector[4 * g + 1] = a1 + a3;
+        outVector[4 * g + 2] = a0 - a2;
+        outVector[4 * g + 3] = a1 - a3;
+
+        // step the bit reversed counter
+        for (bit = quarter >> 1; g & bit; bit >>= 1) {
+            g ^= bit;
+        }
+        g |= bit;
+    }
+}
+
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void volk_32fc_fft_32fc_generic(lv_32fc_t* outVector,
+                                              const lv_32fc_t* inVector,
+                                              const lv_32fc_t* plan,
+                                              unsigned int num_points)
+{
+    unsigned int m, k, j;
+    lv_32fc_t* p;
+    lv_32fc_t a0, a1, a2, a3, b1, b3, c2, c3;
+
+    volk_32fc_fft_bitrev_radix4(outVector, inVector, plan, num_points);
+
+    // two stages (spans m and 2 * m) per pass over the data
+    for (m = 4; 4 * m <= num_points; m *= 4) {
+        for (k = 0; k < num_points; k += 4 * m) {
+            p = outVector + k;
+            for (j = 0; j < m; j++) {
+                b1 = p[j + m] * plan[m + j];
+                b3 = p[j + 3 * m] * plan[m + j];
+                a0 = p[j] + b1;
+                a1 = p[j] - b1;
+                a2 = p[j + 2 * m] + b3;
+                a3 = p[j + 2 * m] - b3;
+
+                c2 = a2 * plan[2 * m + j];
+                c3 = a3 * plan[3 * m + j];
+                p[j] = a0 + c2;
+                p[j + m] = a1 + c3;
+                p[j + 2 * m] = a0 - c2;
+                p[j + 3 * m] = a1 - c3;
+            }
+        }
+    }
+
+    // one radix-2 stage is left for odd log2(num_points)
+    if (m < num_points) {
+        for (j = 0; j < m; j++) {
+            b1 = outVector[j + m] * plan[m + j];
+            outVector[j + m] = outVector[j] - b1;
+            outVector[j] = outVector[j] + b1;
+        }
+    }
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+
+#ifdef LV_HAVE_SSE3
+#include <pmmintrin.h>
+#include <volk/volk_sse3_intrinsics.h>
+
+static inline void volk_32fc_fft_32fc_u_sse3(lv_32fc_t* outVector,
+                                             const lv_32fc_t* inVector,
+                                             const lv_32fc_t* plan,
+                                             unsigned int num_points)
+{
+    const unsigned int quarter = num_points / 4;
+    const float s = lv_cimag(plan[3]);
+    const __m128 sgn = _mm_setr_ps(-s, s, -s, s);
+    const float* in = (const float*)inVector;
+    const float* w = (const float*)plan;
+    unsigned int m, k, j, r, bit, g = 0;
+    float* p;
+    __m128 x0, x1, x2, x3, w1, w2, w3, a0, a1, a2, a3, b1, b3, c2, c3;
+
+    // bit reversed copy and the first two stages, see volk_32fc_fft_bitrev_radix4
+    for (r = 0; r < quarter; r += 2) {
+        x0 = _mm_loadu_ps(in + 2 * r);
+        x1 = _mm_loadu_ps(in + 2 * (r + 2 * quarter));
+        x2 = _mm_loadu_ps(in + 2 * (r + quarter));
+        x3 = _mm_loadu_ps(in + 2 * (r + 3 * quarter));
+        a0 = _mm_add_ps(x0, x1);
+        a1 = _mm_sub_ps(x0, x1);
+        a2 = _mm_add_ps(x2, x3);
+        a3 = _mm_sub_ps(x2, x3);
+        a3 = _mm_mul_ps(_mm_shuffle_ps(a3, a3, 0xB1), sgn); // * plan[3]
+        x0 = _mm_add_ps(a0, a2);
+        x1 = _mm_add_ps(a1, a3);
+        x2 = _mm_sub_ps(a0, a2);
+        x3 = _mm_sub_ps(a1, a3);
+
+        // the DFTs of r and r + 1 go to g and g + quarter / 2
+        p = (float*)(outVector + 4 * g);
+        _mm_storeu_ps(p, _mm_movelh_ps(x0, x1));
+        _mm_storeu_ps(p + 4, _mm_movelh_ps(x2, x3));
+        p = (float*)(outVector + 4 * (g + quarter / 2));
+        _mm_storeu_ps(p, _mm_movehl_ps(x1, x0));
+        _mm_storeu_ps(p + 4, _mm_movehl_ps(x3, x2));
+
+        for (bit = quarter >> 2; g & bit; bit >>= 1) {
+            g ^= bit;
+        }
+        g |= bit;
+    }
+
+    // two stages (spans m and 2 * m) per pass, two butterflies per register
+    for (m = 4; 4 * m <= num_points; m *= 4) {
+        for (k = 0; k < num_points; k += 4 * m) {
+            p = (float*)(outVector + k);
+            for (j = 0; j < m; j += 2) {
+                w1 = _mm_loadu_ps(w + 2 * (m + j));
+                w2 = _mm_loadu_ps(w + 2 * (2 * m + j));
+                w3 = _mm_loadu_ps(w + 2 * (3 * m + j));
+
+                b1 = _mm_complexmul_ps(_mm_loadu_ps(p + 2 * (j + m)), w1);
+                b3 = _mm_complexmul_ps(_mm_loadu_ps(p + 2 * (j + 3 * m)), w1);
+                a0 = _mm_loadu_ps(p + 2 * j);
+                a2 = _mm_loadu_ps(p + 2 * (j + 2 * m));
+                a1 = _mm_sub_ps(a0, b1);
+                a0 = _mm_add_ps(a0, b1);
+                a3 = _mm_sub_ps(a2, b3);
+                a2 = _mm_add_ps(a2, b3);
+
+                c2 = _mm_complexmul_ps(a2, w2);
+                c3 = _mm_complexmul_ps(a3, w3);
+                _mm_storeu_ps(p + 2 * j, _mm_add_ps(a0, c2));
+                _mm_storeu_ps(p + 2 * (j + m), _mm_add_ps(a1, c3));
+                _mm_storeu_ps(p + 2 * (j + 2 * m), _mm_sub_ps(a0, c2));
+                _mm_storeu_ps(p + 2 * (j + 3 * m), _mm_sub_ps(a1, c3));
+            }
+        }
+    }
+
+    // one radix-2 stage is left for odd log2(num_points)
+    if (m < num_points) {
+        p = (float*)outVector;
+        for (j = 0; j < m; j += 2) {
+            b1 = _mm_complexmul_ps(_mm_loadu_ps(p + 2 * (j + m)),
+                                   _mm_loadu_ps(w + 2 * (m + j)));
+            a0 = _mm_loadu_ps(p + 2 * j);
+            _mm_storeu_ps(p + 2 * j, _mm_add_ps(a0, b1));
+            _mm_storeu_ps(p + 2 * (j + m), _mm_sub_ps(a0, b1));
+        }
+    }
+}
+
+#endif /* LV_HAVE_SSE3 */
+
+
+#if LV_HAVE_AVX2 && LV_HAVE_FMA
+#include <immintrin.h>
+
+static inline void volk_32fc_fft_32fc_u_avx2_fma(lv_32fc_t* outVector,
+                                                 const lv_32fc_t* inVector,
+                                                 const lv_32fc_t* plan,
+                                                 unsigned int num_points)
+{
+    const unsigned int quarter = num_points / 4;
+    const float s = lv_cimag(plan[3]);
+    const __m256 sgn = _mm256_setr_ps(-s, s, -s, s, -s, s, -s, s);
+    const float* in = (const float*)inVector;
+    const float* w = (const float*)plan;
+    unsigned int m, k, j, r, bit, g = 0;
+    float* p;
+    __m256 w1, w1l, w1h, w2, w3, x0, x1, x2, x3, a0, a1, a2, a3, b1, b3, c2, c3;
+    __m256d t0, t1, t2, t3;
+
+    if (num_points < 16) {
+        volk_32fc_fft_bitrev_radix4(outVector, inVector, plan, num_points);
+    } else {
+        // bit reversed copy and the first two stages, see volk_32fc_fft_bitrev_radix4
+        for (r = 0; r < quarter; r += 4) {
+            x0 = _mm256_loadu_ps(in + 2 * r);
+            x1 = _mm256_loadu_ps(in + 2 * (r + 2 * quarter));
+            x2 = _mm256_loadu_ps(in + 2 * (r + quarter));
+            x3 = _mm256_loadu_ps(in + 2 * (r + 3 * quarter));
+            a0 = _mm256_add_ps(x0, x1);
+            a1 = _mm256_sub_ps(x0, x1);
+            a2 = _mm256_add_ps(x2, x3);
+            a3 = _mm256_sub_ps(x2, x3);
+            a3 = _mm256_mul_ps(_mm256_permute_ps(a3, 0xB1), sgn); // * plan[3]
+            x0 = _mm256_add_ps(a0, a2);
+            x1 = _mm256_add_ps(a1, a3);
+            x2 = _mm256_sub_ps(a0, a2);
+            x3 = _mm256_sub_ps(a1, a3);
+
+            // transpose, the DFT of r + i goes to g + bitreverse2(i) * quarter / 4
+            t0 = _mm256_unpacklo_pd(_mm256_castps_pd(x0), _mm256_castps_pd(x1));
+            t1 = _mm256_unpackhi_pd(_mm256_castps_pd(x0), _mm256_castps_pd(x1));
+            t2 = _mm256_unpacklo_pd(_mm256_castps_pd(x2), _mm256_castps_pd(x3));
+            t3 = _mm256_unpackhi_pd(_mm256_castps_pd(x2), _mm256_castps_pd(x3));
+            _mm256_storeu_pd((double*)(outVector + 4 * g),
+                             _mm256_permute2f128_pd(t0, t2, 0x20));
+            _mm256_storeu_pd((double*)(outVector + 4 * (g + quarter / 2)),
+                             _mm256_permute2f128_pd(t1, t3, 0x20));
+            _mm256_storeu_pd((double*)(outVector + 4 * (g + quarter / 4)),
+                             _mm256_permute2f128_pd(t0, t2, 0x31));
+            _mm256_storeu_pd((double*)(outVector + 4 * (g + 3 * quarter / 4)),
+                             _mm256_permute2f128_pd(t1, t3, 0x31));
+
+            for (bit = quarter >> 3; g & bit; bit >>= 1) {
+                g ^= bit;
+            }
+            g |= bit;
+        }
+    }
+
+    // two stages (spans m and 2 * m) per pass, four butterflies per register
+    for (m = 4; 4 * m <= num_points; m *= 4) {
+        for (k = 0; k < num_points; k += 4 * m) {
+            p = (float*)(outVector + k);
+            for (j = 0; j < m; j += 4) {
+                w1 = _mm256_loadu_ps(w + 2 * (m + j));
+                w2 = _mm256_loadu_ps(w + 2 * (2 * m + j));
+                w3 = _mm256_loadu_ps(w + 2 * (3 * m + j));
+
+                // both odd inputs are multiplied with the same twiddles
+                w1l = _mm256_moveldup_ps(w1); // wr, wr, ...
+                w1h = _mm256_movehdup_ps(w1); // wi, wi, ...
+                x1 = _mm256_loadu_ps(p + 2 * (j + m));
+                x3 = _mm256_loadu_ps(p + 2 * (j + 3 * m));
+                b1 = _mm256_fmaddsub_ps(
+                    x1, w1l, _mm256_mul_ps(_mm256_permute_ps(x1, 0xB1), w1h));
+                b3 = _mm256_fmaddsub_ps(
+                    x3, w1l, _mm256_mul_ps(_mm256_permute_ps(x3, 0xB1), w1h));
+
+                a0 = _mm256_loadu_ps(p + 2 * j);
+                a2 = _mm256_loadu_ps(p + 2 * (j + 2 * m));
+                a1 = _mm256_sub_ps(a0, b1);
+                a0 = _mm256_add_ps(a0, b1);
+                a3 = _mm256_sub_ps(a2, b3);
+                a2 = _mm256_add_ps(a2, b3);
+
+                c2 = _mm256_fmaddsub_ps(
+                    a2,
+                    _mm256_moveldup_ps(w2),
+                    _mm256_mul_ps(_mm256_permute_ps(a2, 0xB1), _mm256_movehdup_ps(w2)));
+                c3 = _mm256_fmaddsub_ps(
+                    a3,
+                    _mm256_moveldup_ps(w3),
+                    _mm256_mul_ps(_mm256_permute_ps(a3, 0xB1), _mm256_movehdup_ps(w3)));
+                _mm256_storeu_ps(p + 2 * j, _mm256_add_ps(a0, c2));
+                _mm256_storeu_ps(p + 2 * (j + m), _mm256_add_ps(a1, c3));
+                _mm256_storeu_ps(p + 2 * (j + 2 * m), _mm256_sub_ps(a0, c2));
+                _mm256_storeu_ps(p + 2 * (j + 3 * m), _mm256_sub_ps(a1, c3));
+            }
+        }
+    }
+
+    // one radix-2 stage is left for odd log2(num_points)
+    if (m < num_points) {
+        p = (float*)outVector;
+        for (j = 0; j < m; j += 4) {
+            w1 = _mm256_loadu_ps(w + 2 * (m + j));
+            x1 = _mm256_loadu_ps(p + 2 * (j + m));
+            b1 = _mm256_fmaddsub_ps(
+                x1,
+                _mm256_moveldup_ps(w1),
+                _mm256_mul_ps(_mm256_permute_ps(x1, 0xB1), _mm256_movehdup_ps(w1)));
+            a0 = _mm256_loadu_ps(p + 2 * j);
+            _mm256_storeu_ps(p + 2 * j, _mm256_add_ps(a0, b1));
+            _mm256_storeu_ps(p + 2 * (j + m), _mm256_sub_ps(a0, b1));
+        }
+    }
+}
+
+#endif /* LV_HAVE_AVX2 && LV_HAVE_FMA */
+
+
+#ifdef LV_HAVE_AVX512F
+#include <immintrin.h>
+#include <volk/volk_avx512_intrinsics.h>
+
+static inline void volk_32fc_fft_32fc_u_avx512f(lv_32fc_t* outVector,
+                                                const lv_32fc_t* inVector,
+                                                const lv_32fc_t* plan,
+                                                unsigned int num_points)
+{
+    const unsigned int quarter = num_points / 4;
+    const unsigned int eighth = quarter / 8;
+    const float s = lv_cimag(plan[3]);
+    const __m512 sgn = _mm512_broadcast_f32x4(_mm_setr_ps(-s, s, -s, s));
+    const float* in = (const float*)inVector;
+    const float* w = (const float*)plan;
+    unsigned int m = 4, k, j, r, bit, g = 0;
+    float* p;
+    __m512d t0, t1, t2, t3, u;
+    __m256 v1, v1l, v1h, v2, v3, y1, y3, d0, d1, d2, d3, e1, e3, f2, f3;
+    __m512 w1, w2, w3, a0, a1, a2, a3, b1, b3, c2, c3;
+
+    if (num_points < 32) {
+        volk_32fc_fft_bitrev_radix4(outVector, inVector, plan, num_points);
+    } else {
+        // bit reversed copy and the first two stages, see volk_32fc_fft_bitrev_radix4
+        for (r = 0; r < quarter; r += 8) {
+            a0 = _mm512_loadu_ps(in + 2 * r);
+            a1 = _mm512_loadu_ps(in + 2 * (r + 2 * quarter));
+            a2 = _mm512_loadu_ps(in + 2 * (r + quarter));
+            a3 = _mm512_loadu_ps(in + 2 * (r + 3 * quarter));
+            b1 = _mm512_add_ps(a0, a1);
+            a1 = _mm512_sub_ps(a0, a1);
+            b3 = _mm512_add_ps(a2, a3);
+            a3 = _mm512_sub_ps(a2, a3);
+            a3 = _mm512_mul_ps(_mm512_permute_ps(a3, 0xB1), sgn); // * plan[3]
+            a0 = _mm512_add_ps(b1, b3);
+            a2 = _mm512_sub_ps(b1, b3);
+            b1 = _mm512_add_ps(a1, a3);
+            b3 = _mm512_sub_ps(a1, a3);
+
+            // transpose, the DFT of r + i goes to g + bitreverse3(i) * eighth
+            // t0 holds the even, t1 the odd rows of the first two outputs
+            t0 = _mm512_unpacklo_pd(_mm512_castps_pd(a0), _mm512_castps_pd(b1));
+            t1 = _mm512_unpackhi_pd(_mm512_castps_pd(a0), _mm512_castps_pd(b1));
+            t2 = _mm512_unpacklo_pd(_mm512_castps_pd(a2), _mm512_castps_pd(b3));
+            t3 = _mm512_unpackhi_pd(_mm512_castps_pd(a2), _mm512_castps_pd(b3));
+
+            u = _mm512_shuffle_f64x2(t0, t2, _MM_SHUFFLE(2, 0, 2, 0));
+            u = _mm512_shuffle_f64x2(u, u, _MM_SHUFFLE(3, 1, 2, 0)); // rows 0, 4
+            _mm256_storeu_pd((double*)(outVector + 4 * g), _mm512_castpd512_pd256(u));
+            _mm256_storeu_pd((double*)(outVector + 4 * (g + eighth)),
+                             _mm512_extractf64x4_pd(u, 1));
+            u = _mm512_shuffle_f64x2(t0, t2, _MM_SHUFFLE(3, 1, 3, 1));
+            u = _mm512_shuffle_f64x2(u, u, _MM_SHUFFLE(3, 1, 2, 0)); // rows 2, 6
+            _mm256_storeu_pd((double*)(outVector + 4 * (g + 2 * eighth)),
+                             _mm512_castpd512_pd256(u));
+            _mm256_storeu_pd((double*)(outVector + 4 * (g + 3 * eighth)),
+                             _mm512_extractf64x4_pd(u, 1));
+            u = _mm512_shuffle_f64x2(t1, t3, _MM_SHUFFLE(2, 0, 2, 0));
+            u = _mm512_shuffle_f64x2(u, u, _MM_SHUFFLE(3, 1, 2, 0)); // rows 1, 5
+            _mm256_storeu_pd((double*)(outVector + 4 * (g + 4 * eighth)),
+                             _mm512_castpd512_pd256(u));
+            _mm256_storeu_pd((double*)(outVector + 4 * (g + 5 * eighth)),
+                             _mm512_extractf64x4_pd(u, 1));
+            u = _mm512_shuffle_f64x2(t1, t3, _MM_SHUFFLE(3, 1, 3, 1));
+            u = _mm512_shuffle_f64x2(u, u, _MM_SHUFFLE(3, 1, 2, 0)); // rows 3, 7
+            _mm256_storeu_pd((double*)(outVector + 4 * (g + 6 * eighth)),
+                             _mm512_castpd512_pd256(u));
+            _mm256_storeu_pd((double*)(outVector + 4 * (g + 7 * eighth)),
+                             _mm512_extractf64x4_pd(u, 1));
+
+            for (bit = quarter >> 4; g & bit; bit >>= 1) {
+                g ^= bit;
+            }
+            g |= bit;
+        }
+    }
+
+    // The spans 4 and 8 only fill half a register, four butterflies per __m256
+    if (16 <= num_points) {
+        v1 = _mm256_loadu_ps(w + 8);
+        v2 = _mm256_loadu_ps(w + 16);
+        v3 = _mm256_loadu_ps(w + 24);
+        v1l = _mm256_moveldup_ps(v1);
+        v1h = _mm256_movehdup_ps(v1);
+
+        for (k = 0; k < num_points; k += 16) {
+            p = (float*)(outVector + k);
+            y1 = _mm256_loadu_ps(p + 8);
+            y3 = _mm256_loadu_ps(p + 24);
+            e1 = _mm256_fmaddsub_ps(
+                y1, v1l, _mm256_mul_ps(_mm256_permute_ps(y1, 0xB1), v1h));
+            e3 = _mm256_fmaddsub_ps(
+                y3, v1l, _mm256_mul_ps(_mm256_permute_ps(y3, 0xB1), v1h));
+
+            d0 = _mm256_loadu_ps(p);
+            d2 = _mm256_loadu_ps(p + 16);
+            d1 = _mm256_sub_ps(d0, e1);
+            d0 = _mm256_add_ps(d0, e1);
+            d3 = _mm256_sub_ps(d2, e3);
+            d2 = _mm256_add_ps(d2, e3);
+
+            f2 = _mm256_fmaddsub_ps(
+                d2,
+                _mm256_moveldup_ps(v2),
+                _mm256_mul_ps(_mm256_permute_ps(d2, 0xB1), _mm256_movehdup_ps(v2)));
+            f3 = _mm256_fmaddsub_ps(
+                d3,
+                _mm256_moveldup_ps(v3),
+                _mm256_mul_ps(_mm256_permute_ps(d3, 0xB1), _mm256_movehdup_ps(v3)));
+            _mm256_storeu_ps(p, _mm256_add_ps(d0, f2));
+            _mm256_storeu_ps(p + 8, _mm256_add_ps(d1, f3));
+            _mm256_storeu_ps(p + 16, _mm256_sub_ps(d0, f2));
+            _mm256_storeu_ps(p + 24, _mm256_sub_ps(d1, f3));
+        }
+        m = 16;
+    }
+
+    // two stages (spans m and 2 * m) per pass, eight butterflies per register
+    for (; 4 * m <= num_points; m *= 4) {
+        for (k = 0; k < num_points; k += 4 * m) {
+            p = (float*)(outVector + k);
+            for (j = 0; j < m; j += 8) {
+                w1 = _mm512_loadu_ps(w + 2 * (m + j));
+                w2 = _mm512_loadu_ps(w + 2 * (2 * m + j));
+                w3 = _mm512_loadu_ps(w + 2 * (3 * m + j));
+
+                b1 = _mm512_complexmul_ps(_mm512_loadu_ps(p + 2 * (j + m)), w1);
+                b3 = _mm512_complexmul_ps(_mm512_loadu_ps(p + 2 * (j + 3 * m)), w1);
+                a0 = _mm512_loadu_ps(p + 2 * j);
+                a2 = _mm512_loadu_ps(p + 2 * (j + 2 * m));
+                a1 = _mm512_sub_ps(a0, b1);
+                a0 = _mm512_add_ps(a0, b1);
+                a3 = _mm512_sub_ps(a2, b3);
+                a2 = _mm512_add_ps(a2, b3);
+
+                c2 = _mm512_complexmul_ps(a2, w2);
+                c3 = _mm512_complexmul_ps(a3, w3);
+                _mm512_storeu_ps(p + 2 * j, _mm512_add_ps(a0, c2));
+                _mm512_storeu_ps(p + 2 * (j + m), _mm512_add_ps(a1, c3));
+                _mm512_storeu_ps(p + 2 * (j + 2 * m), _mm512_sub_ps(a0, c2));
+                _mm512_storeu_ps(p + 2 * (j + 3 * m), _mm512_sub_ps(a1, c3));
+            }
+        }
+    }
+
+    // one radix-2 stage is left for odd log2(num_points)
+    if (m < num_points) {
+        p = (float*)outVector;
+        for (j = 0; j + 8 <= m; j += 8) {
+            b1 = _mm512_complexmul_ps(_mm512_loadu_ps(p + 2 * (j + m)),
+                                      _mm512_loadu_ps(w + 2 * (m + j)));
+            a0 = _mm512_loadu_ps(p + 2 * j);
+            _mm512_storeu_ps(p + 2 * j, _mm512_add_ps(a0, b1));
+            _mm512_storeu_ps(p + 2 * (j + m), _mm512_sub_ps(a0, b1));
+        }
+        // only left for num_points == 8
+        for (; j < m; j++) {
+            const lv_32fc_t t = outVector[j + m] * plan[m + j];
+            outVector[j + m] = outVector[j] - t;
+            outVector[j] = outVector[j] + t;
+        }
+    }
+}
+
+#endif /* LV_HAVE_AVX512F */
+
+
+#ifdef LV_HAVE_NEON
+#include <arm_neon.h>
+#include <volk/volk_neon_intrinsics.h>
+
+static inline void volk_32fc_fft_32fc_neon(lv_32fc_t* outVector,
+                                           const lv_32fc_t* inVector,
+                                           const lv_32fc_t* plan,
+                                           unsigned int num_points)
+{
+    const unsigned int quarter = num_points / 4;
+    const float s = lv_cimag(plan[3]);
+    const float sgn_init[4] = { -s, s, -s, s };
+    const float32x4_t sgn = vld1q_f32(sgn_init);
+    const float* in = (const float*)inVector;
+    const float* w = (const float*)plan;
+    unsigned int m, k, j, r, bit, g = 0;
+    float* p;
+    float32x4_t y0, y1, y2, y3, e0, e1, e2, e3;
+    float32x4x2_t w1, w2, w3, x0, x2, a0, a1, a2, a3, b1, b3, c2, c3;
+
+    // bit reversed copy and the first two stages, see volk_32fc_fft_bitrev_radix4
+    for (r = 0; r < quarter; r += 2) {
+        y0 = vld1q_f32(in + 2 * r);
+        y1 = vld1q_f32(in + 2 * (r + 2 * quarter));
+        y2 = vld1q_f32(in + 2 * (r + quarter));
+        y3 = vld1q_f32(in + 2 * (r + 3 * quarter));
+        e0 = vaddq_f32(y0, y1);
+        e1 = vsubq_f32(y0, y1);
+        e2 = vaddq_f32(y2, y3);
+        e3 = vmulq_f32(vrev64q_f32(vsubq_f32(y2, y3)), sgn); // * plan[3]
+        y0 = vaddq_f32(e0, e2);
+        y1 = vaddq_f32(e1, e3);
+        y2 = vsubq_f32(e0, e2);
+        y3 = vsubq_f32(e1, e3);
+
+        // the DFTs of r and r + 1 go to g and g + quarter / 2
+        p = (float*)(outVector + 4 * g);
+        vst1q_f32(p, vcombine_f32(vget_low_f32(y0), vget_low_f32(y1)));
+        vst1q_f32(p + 4, vcombine_f32(vget_low_f32(y2), vget_low_f32(y3)));
+        p = (float*)(outVector + 4 * (g + quarter / 2));
+        vst1q_f32(p, vcombine_f32(vget_high_f32(y0), vget_high_f32(y1)));
+        vst1q_f32(p + 4, vcombine_f32(vget_high_f32(y2), vget_high_f32(y3)));
+
+        for (bit = quarter >> 2; g & bit; bit >>= 1) {
+            g ^= bit;
+        }
+        g |= bit;
+    }
+
+    // two stages (spans m and 2 * m) per pass, four deinterleaved butterflies
+    for (m = 4; 4 * m <= num_points; m *= 4) {
+        for (k = 0; k < num_points; k += 4 * m) {
+            p = (float*)(outVector + k);
+            for (j = 0; j < m; j += 4) {
+                w1 = vld2q_f32(w + 2 * (m + j));
+                w2 = vld2q_f32(w + 2 * (2 * m + j));
+                w3 = vld2q_f32(w + 2 * (3 * m + j));
+
+                b1 = _vmultiply_complexq_f32(vld2q_f32(p + 2 * (j + m)), w1);
+                b3 = _vmultiply_complexq_f32(vld2q_f32(p + 2 * (j + 3 * m)), w1);
+                x0 = vld2q_f32(p + 2 * j);
+                x2 = vld2q_f32(p + 2 * (j + 2 * m));
+                a0.val[0] = vaddq_f32(x0.val[0], b1.val[0]);
+                a0.val[1] = vaddq_f32(x0.val[1], b1.val[1]);
+                a1.val[0] = vsubq_f32(x0.val[0], b1.val[0]);
+                a1.val[1] = vsubq_f32(x0.val[1], b1.val[1]);
+                a2.val[0] = vaddq_f32(x2.val[0], b3.val[0]);
+                a2.val[1] = vaddq_f32(x2.val[1], b3.val[1]);
+                a3.val[0] = vsubq_f32(x2.val[0], b3.val[0]);
+                a3.val[1] = vsubq_f32(x2.val[1], b3.val[1]);
+
+                c2 = _vmultiply_complexq_f32(a2, w2);
+                c3 = _vmultiply_complexq_f32(a3, w3);
+                x0.val[0] = vaddq_f32(a0.val[0], c2.val[0]);
+                x0.val[1] = vaddq_f32(a0.val[1], c2.val[1]);
+                vst2q_f32(p + 2 * j, x0);
+                x0.val[0] = vaddq_f32(a1.val[0], c3.val[0]);
+                x0.val[1] = vaddq_f32(a1.val[1], c3.val[1]);
+                vst2q_f32(p + 2 * (j + m), x0);
+                x0.val[0] = vsubq_f32(a0.val[0], c2.val[0]);
+                x0.val[1] = vsubq_f32(a0.val[1], c2.val[1]);
+                vst2q_f32(p + 2 * (j + 2 * m), x0);
+                x0.val[0] = vsubq_f32(a1.val[0], c3.val[0]);
+                x0.val[1] = vsubq_f32(a1.val[1], c3.val[1]);
+                vst2q_f32(p + 2 * (j + 3 * m), x0);
+            }
+        }
+    }
+
+    // one radix-2 stage is left for odd log2(num_points)
+    if (m < num_points) {
+        p = (float*)outVector;
+        for (j = 0; j < m; j += 4) {
+            b1 = _vmultiply_complexq_f32(vld2q_f32(p + 2 * (j + m)),
+                                         vld2q_f32(w + 2 * (m + j)));
+            x0 = vld2q_f32(p + 2 * j);
+            a0.val[0] = vaddq_f32(x0.val[0], b1.val[0]);
+            a0.val[1] = vaddq_f32(x0.val[1], b1.val[1]);
+            a1.val[0] = vsubq_f32(x0.val[0], b1.val[0]);
+            a1.val[1] = vsubq_f32(x0.val[1], b1.val[1]);
+            vst2q_f32(p + 2 * j, a0);
+            vst2q_f32(p + 2 * (j + m), a1);
+        }
+    }
+}
+
+#endif /* LV_HAVE_NEON */
+
+#endif /* INCLUDED_volk_32fc_fft_32fc_u_H */
@@ -0,0 +1,107 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2026 Free Software Foundation, Inc.
+ *
+ * This file is part of VOLK
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+/* For documentation see 'kernels/volk/volk_32fc_fft_32fc.h'
+ * This file exists for test purposes only. Should not be used directly.
+ */
+
+#ifndef INCLUDED_volk_32fc_fftpuppet_32fc_H
+#define INCLUDED_volk_32fc_fftpuppet_32fc_H
+
+#include <volk/volk.h>
+#include <volk/volk_32fc_fft_32fc.h>
+
+#define FFT_PUPPET_SIZE 2048
+
+/*
+ * Run back to back FFTs of FFT_PUPPET_SIZE points over the input, alternating
+ * between the forward and the inverse transform.
+ */
+static inline void volk_32fc_fftpuppet_run(
+    lv_32fc_t* outVector,
+    const lv_32fc_t* inVector,
+    unsigned int num_points,
+    void (*fft)(lv_32fc_t*, const lv_32fc_t*, const lv_32fc_t*, unsigned int))
+{
+    const size_t plan_size = sizeof(lv_32fc_t) * FFT_PUPPET_SIZE;
+    lv_32fc_t* fwd = (lv_32fc_t*)volk_malloc(plan_size, volk_get_alignment());
+    lv_32fc_t* inv = (lv_32fc_t*)volk_malloc(plan_size, volk_get_alignment());
+    unsigned int n;
+
+    volk_32fc_fft_make_plan(fwd, FFT_PUPPET_SIZE, 0);
+    volk_32fc_fft_make_plan(inv, FFT_PUPPET_SIZE, 1);
+    for (n = 0; n + FFT_PUPPET_SIZE <= num_points; n += FFT_PUPPET_SIZE) {
+        fft(outVector + n,
+            inVector + n,
+            (n / FFT_PUPPET_SIZE) & 1 ? inv : fwd,
+            FFT_PUPPET_SIZE);
+    }
+
+    volk_free(fwd);
+    volk_free(inv);
+}
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void volk_32fc_fftpuppet_32fc_generic(lv_32fc_t* outVector,
+                                                    const lv_32fc_t* inVector,
+                                                    unsigned int num_points)
+{
+    volk_32fc_fftpuppet_run(outVector, inVector, num_points, volk_32fc_fft_32fc_generic);
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+#ifdef LV_HAVE_SSE3
+
+static inline void volk_32fc_fftpuppet_32fc_u_sse3(lv_32fc_t* outVector,
+                                                   const lv_32fc_t* inVector,
+                                                   unsigned int num_points)
+{
+    volk_32fc_fftpuppet_run(outVector, inVector, num_points, volk_32fc_fft_32fc_u_sse3);
+}
+
+#endif /* LV_HAVE_SSE3 */
+
+#if LV_HAVE_AVX2 && LV_HAVE_FMA
+
+static inline void volk_32fc_fftpuppet_32fc_u_avx2_fma(lv_32fc_t* outVector,
+                                                       const lv_32fc_t* inVector,
+                                                       unsigned int num_points)
+{
+    volk_32fc_fftpuppet_run(
+        outVector, inVector, num_points, volk_32fc_fft_32fc_u_avx2_fma);
+}
+
+#endif /* LV_HAVE_AVX2 && LV_HAVE_FMA */
+
+#ifdef LV_HAVE_AVX512F
+
+static inline void volk_32fc_fftpuppet_32fc_u_avx512f(lv_32fc_t* outVector,
+                                                      const lv_32fc_t* inVector,
+                                                      unsigned int num_points)
+{
+    volk_32fc_fftpuppet_run(
+        outVector, inVector, num_points, volk_32fc_fft_32fc_u_avx512f);
+}
+
+#endif /* LV_HAVE_AVX512F */
+
+#ifdef LV_HAVE_NEON
+
+static inline void volk_32fc_fftpuppet_32fc_neon(lv_32fc_t* outVector,
+                                                 const lv_32fc_t* inVector,
+                                                 unsigned int num_points)
+{
+    volk_32fc_fftpuppet_run(outVector, inVector, num_points, volk_32fc_fft_32fc_neon);
+}
+
+#endif /* LV_HAVE_NEON */
+
+#endif /* INCLUDED_volk_32fc_fftpuppet_32fc_H */
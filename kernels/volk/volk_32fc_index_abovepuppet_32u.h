@@ -0,0 +1,112 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2026 Free Software Foundation, Inc.
+ *
+ * This file is part of VOLK
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+/* For documentation see 'kernels/volk/volk_32fc_s32f_index_above_32u.h'
+ * This file exists for test purposes only. Should not be used directly.
+ *
+ * Writes the number of indices followed by the indices, first for most of the
+ * input with a threshold of 0.9, then for a short segment with every third
+ * element set to zero and a threshold of 0, which must skip the zeros. The
+ * unused part of the output that the SIMD implementations may overwrite is
+ * cleared.
+ */
+
+#ifndef INCLUDED_volk_32fc_index_abovepuppet_32u_H
+#define INCLUDED_volk_32fc_index_abovepuppet_32u_H
+
+#include <string.h>
+#include <volk/volk_32fc_s32f_index_above_32u.h>
+
+#define VOLK_INDEX_ABOVE_ZERO_POINTS 67
+
+typedef void (*volk_32fc_index_above_kernel)(uint32_t*,
+                                             uint32_t*,
+                                             const lv_32fc_t*,
+                                             const float,
+                                             unsigned int);
+
+static inline void
+volk_32fc_index_abovepuppet_32u_run(volk_32fc_index_above_kernel kernel,
+                                    uint32_t* result,
+                                    const lv_32fc_t* inputVector,
+                                    unsigned int num_points)
+{
+    lv_32fc_t zeros[VOLK_INDEX_ABOVE_ZERO_POINTS];
+    const unsigned int points = num_points - 2 - VOLK_INDEX_ABOVE_ZERO_POINTS;
+    uint32_t* indices = result + 1;
+    unsigned int ii;
+
+    kernel(indices, result, inputVector, 0.9f, points);
+    memset(indices + *result, 0, (points - *result) * sizeof(uint32_t));
+
+    result += 1 + points;
+    indices = result + 1;
+    for (ii = 0; ii < VOLK_INDEX_ABOVE_ZERO_POINTS; ii++) {
+        zeros[ii] = (ii % 3 == 0) ? lv_cmake(0.f, 0.f) : inputVector[points + ii];
+    }
+    kernel(indices, result, zeros, 0.f, VOLK_INDEX_ABOVE_ZERO_POINTS);
+    memset(indices + *result,
+           0,
+           (VOLK_INDEX_ABOVE_ZERO_POINTS - *result) * sizeof(uint32_t));
+}
+
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void volk_32fc_index_abovepuppet_32u_generic(uint32_t* result,
+                                                           const lv_32fc_t* inputVector,
+                                                           unsigned int num_points)
+{
+    volk_32fc_index_abovepuppet_32u_run(
+        volk_32fc_s32f_index_above_32u_generic, result, inputVector, num_points);
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+
+#ifdef LV_HAVE_AVX2
+
+static inline void volk_32fc_index_abovepuppet_32u_u_avx2(uint32_t* result,
+                                                          const lv_32fc_t* inputVector,
+                                                          unsigned int num_points)
+{
+    volk_32fc_index_abovepuppet_32u_run(
+        volk_32fc_s32f_index_above_32u_u_avx2, result, inputVector, num_points);
+}
+
+#endif /* LV_HAVE_AVX2 */
+
+
+#ifdef LV_HAVE_AVX512F
+
+static inline void
+volk_32fc_index_abovepuppet_32u_u_avx512f(uint32_t* result,
+                                          const lv_32fc_t* inputVector,
+                                          unsigned int num_points)
+{
+    volk_32fc_index_abovepuppet_32u_run(
+        volk_32fc_s32f_index_above_32u_u_avx512f, result, inputVector, num_points);
+}
+
+#endif /* LV_HAVE_AVX512F */
+
+
+#ifdef LV_HAVE_NEON
+
+static inline void volk_32fc_index_abovepuppet_32u_neon(uint32_t* result,
+                                                        const lv_32fc_t* inputVector,
+                                                        unsigned int num_points)
+{
+    volk_32fc_index_abovepuppet_32u_run(
+        volk_32fc_s32f_index_above_32u_neon, result, inputVector, num_points);
+}
+
+#endif /* LV_HAVE_NEON */
+
+#endif /* INCLUDED_volk_32fc_index_abovepuppet_32u_H */
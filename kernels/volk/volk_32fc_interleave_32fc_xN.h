@@ -0,0 +1,334 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2026 Free Software Foundation, Inc.
+ *
+ * This file is part of VOLK
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+/*!
+ * \page volk_32fc_interleave_32fc_xN
+ *
+ * \b Overview
+ *
+ * Merges one vector per channel into a sample interleaved multi-channel
+ * stream (ch0, ch1, ..., chN-1, ch0, ...), the inverse of
+ * volk_32fc_deinterleave_32fc_xN.
+ *
+ * outputVector[n * num_channels + c] = inputVectors[c][n]
+ *
+ * <b>Dispatcher Prototype</b>
+ * \code
+ * void volk_32fc_interleave_32fc_xN(lv_32fc_t* outputVector,
+ *                                   const lv_32fc_t** inputVectors,
+ *                                   unsigned int num_channels,
+ *                                   unsigned int num_points)
+ * \endcode
+ *
+ * \b Inputs
+ * \li inputVectors: N pointers to the num_points samples of each channel.
+ * \li num_channels: the number of channels N.
+ * \li num_points: the number of samples per channel.
+ *
+ * \b Outputs
+ * \li outputVector: the interleaved stream, num_channels * num_points samples.
+ *
+ * \b Example
+ * Merge four channels for a four channel transmitter.
+ * \code
+ *   unsigned int N = 1000;
+ *   unsigned int alignment = volk_get_alignment();
+ *   lv_32fc_t* out = (lv_32fc_t*)volk_malloc(4 * sizeof(lv_32fc_t) * N, alignment);
+ *   const lv_32fc_t* channels[4];
+ *
+ *   // ... point channels at the four signals
+ *
+ *   volk_32fc_interleave_32fc_xN(out, channels, 4, N);
+ *
+ *   volk_free(out);
+ * \endcode
+ */
+
+#ifndef INCLUDED_volk_32fc_interleave_32fc_xN_H
+#define INCLUDED_volk_32fc_interleave_32fc_xN_H
+
+#include <volk/volk_complex.h>
+
+static inline void volk_32fc_interleave_xN_frames(lv_32fc_t* outputVector,
+                                                  const lv_32fc_t** inputVectors,
+                                                  unsigned int num_channels,
+                                                  unsigned int first,
+                                                  unsigned int num_points)
+{
+    unsigned int number, channel;
+
+    outputVector += first * num_channels;
+    for (number = first; number < num_points; number++) {
+        for (channel = 0; channel < num_channels; channel++) {
+            *outputVector++ = inputVectors[channel][number];
+        }
+    }
+}
+
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void volk_32fc_interleave_32fc_xN_generic(lv_32fc_t* outputVector,
+                                                        const lv_32fc_t** inputVectors,
+                                                        unsigned int num_channels,
+                                                        unsigned int num_points)
+{
+    volk_32fc_interleave_xN_frames(
+        outputVector, inputVectors, num_channels, 0, num_points);
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+
+#ifdef LV_HAVE_SSE
+#include <xmmintrin.h>
+
+static inline void volk_32fc_interleave_32fc_xN_u_sse(lv_32fc_t* outputVector,
+                                                      const lv_32fc_t** inputVectors,
+                                                      unsigned int num_channels,
+                                                      unsigned int num_points)
+{
+    const unsigned int halfPoints = (num_channels % 2 == 0) ? num_points / 2 : 0;
+    float* frame0;
+    float* frame1;
+    __m128 a, b;
+    unsigned int number, channel;
+
+    // transpose 2x2 blocks of two channels and two frames
+    for (number = 0; number < halfPoints; number++) {
+        frame0 = (float*)(outputVector + 2 * number * num_channels);
+        frame1 = frame0 + 2 * num_channels;
+        for (channel = 0; channel < num_channels; channel += 2) {
+            a = _mm_loadu_ps((const float*)(inputVectors[channel] + 2 * number));
+            b = _mm_loadu_ps((const float*)(inputVectors[channel + 1] + 2 * number));
+            _mm_storeu_ps(frame0 + 2 * channel, _mm_movelh_ps(a, b));
+            _mm_storeu_ps(frame1 + 2 * channel, _mm_movehl_ps(b, a));
+        }
+    }
+
+    volk_32fc_interleave_xN_frames(
+        outputVector, inputVectors, num_channels, halfPoints * 2, num_points);
+}
+
+#endif /* LV_HAVE_SSE */
+
+
+#ifdef LV_HAVE_AVX
+#include <immintrin.h>
+
+static inline void volk_32fc_interleave_32fc_xN_u_avx(lv_32fc_t* outputVector,
+                                                      const lv_32fc_t** inputVectors,
+                                                      unsigned int num_channels,
+                                                      unsigned int num_points)
+{
+    double* output = (double*)outputVector;
+    double* frame;
+    unsigned int quarterPoints = 0;
+    unsigned int halfPoints = 0;
+    __m256d r0, r1, r2, r3, t0, t1, t2, t3;
+    __m128d a, b;
+    unsigned int number, channel;
+
+    if (num_channels == 2) {
+        quarterPoints = num_points / 4;
+        for (number = 0; number < quarterPoints; number++) {
+            r0 = _mm256_loadu_pd((const double*)(inputVectors[0] + 4 * number));
+            r1 = _mm256_loadu_pd((const double*)(inputVectors[1] + 4 * number));
+            t0 = _mm256_unpacklo_pd(r0, r1);
+            t1 = _mm256_unpackhi_pd(r0, r1);
+            _mm256_storeu_pd(output, _mm256_permute2f128_pd(t0, t1, 0x20));
+            _mm256_storeu_pd(output + 4, _mm256_permute2f128_pd(t0, t1, 0x31));
+            output += 8;
+        }
+    } else if (num_channels % 4 == 0) {
+        // transpose 4x4 blocks of four channels and four frames
+        quarterPoints = num_points / 4;
+        for (number = 0; number < quarterPoints; number++) {
+            frame = output + 4 * number * num_channels;
+            for (channel = 0; channel < num_channels; channel += 4) {
+                r0 = _mm256_loadu_pd((const double*)(inputVectors[channel] + 4 * number));
+                r1 = _mm256_loadu_pd(
+                    (const double*)(inputVectors[channel + 1] + 4 * number));
+                r2 = _mm256_loadu_pd(
+                    (const double*)(inputVectors[channel + 2] + 4 * number));
+                r3 = _mm256_loadu_pd(
+                    (const double*)(inputVectors[channel + 3] + 4 * number));
+                t0 = _mm256_unpacklo_pd(r0, r1);
+                t1 = _mm256_unpackhi_pd(r0, r1);
+                t2 = _mm256_unpacklo_pd(r2, r3);
+                t3 = _mm256_unpackhi_pd(r2, r3);
+                _mm256_storeu_pd(frame + channel, _mm256_permute2f128_pd(t0, t2, 0x20));
+                _mm256_storeu_pd(frame + num_channels + channel,
+                                 _mm256_permute2f128_pd(t1, t3, 0x20));
+                _mm256_storeu_pd(frame + 2 * num_channels + channel,
+                                 _mm256_permute2f128_pd(t0, t2, 0x31));
+                _mm256_storeu_pd(frame + 3 * num_channels + channel,
+                                 _mm256_permute2f128_pd(t1, t3, 0x31));
+            }
+        }
+    } else if (num_channels % 2 == 0) {
+        halfPoints = num_points / 2;
+        for (number = 0; number < halfPoints; number++) {
+            frame = output + 2 * number * num_channels;
+            for (channel = 0; channel < num_channels; channel += 2) {
+                a = _mm_loadu_pd((const double*)(inputVectors[channel] + 2 * number));
+                b = _mm_loadu_pd((const double*)(inputVectors[channel + 1] + 2 * number));
+                _mm_storeu_pd(frame + channel, _mm_unpacklo_pd(a, b));
+                _mm_storeu_pd(frame + num_channels + channel, _mm_unpackhi_pd(a, b));
+            }
+        }
+    }
+
+    volk_32fc_interleave_xN_frames(outputVector,
+                                   inputVectors,
+                                   num_channels,
+                                   quarterPoints * 4 + halfPoints * 2,
+                                   num_points);
+}
+
+#endif /* LV_HAVE_AVX */
+
+
+#ifdef LV_HAVE_AVX512F
+#include <immintrin.h>
+
+static inline void volk_32fc_interleave_32fc_xN_u_avx512f(lv_32fc_t* outputVector,
+                                                          const lv_32fc_t** inputVectors,
+                                                          unsigned int num_channels,
+                                                          unsigned int num_points)
+{
+    double* output = (double*)outputVector;
+    double* frame;
+    unsigned int eighthPoints = 0;
+    unsigned int quarterPoints = 0;
+    unsigned int halfPoints = 0;
+    __m512d x, y;
+    __m128d a, b;
+    unsigned int number, channel;
+
+    if (num_channels == 2) {
+        const __m512i low = _mm512_setr_epi64(0, 8, 1, 9, 2, 10, 3, 11);
+        const __m512i high = _mm512_setr_epi64(4, 12, 5, 13, 6, 14, 7, 15);
+        eighthPoints = num_points / 8;
+        for (number = 0; number < eighthPoints; number++) {
+            x = _mm512_loadu_pd((const double*)(inputVectors[0] + 8 * number));
+            y = _mm512_loadu_pd((const double*)(inputVectors[1] + 8 * number));
+            _mm512_storeu_pd(output, _mm512_permutex2var_pd(x, low, y));
+            _mm512_storeu_pd(output + 8, _mm512_permutex2var_pd(x, high, y));
+            output += 16;
+        }
+    } else if (num_channels % 4 == 0) {
+        // four channels of four frames in two registers, two frames out of each
+        const __m512i first = _mm512_setr_epi64(0, 4, 8, 12, 1, 5, 9, 13);
+        const __m512i second = _mm512_setr_epi64(2, 6, 10, 14, 3, 7, 11, 15);
+        __m512d frames01, frames23;
+        quarterPoints = num_points / 4;
+        for (number = 0; number < quarterPoints; number++) {
+            frame = output + 4 * number * num_channels;
+            for (channel = 0; channel < num_channels; channel += 4) {
+                x = _mm512_insertf64x4(
+                    _mm512_castpd256_pd512(_mm256_loadu_pd(
+                        (const double*)(inputVectors[channel] + 4 * number))),
+                    _mm256_loadu_pd(
+                        (const double*)(inputVectors[channel + 1] + 4 * number)),
+                    1);
+                y = _mm512_insertf64x4(
+                    _mm512_castpd256_pd512(_mm256_loadu_pd(
+                        (const double*)(inputVectors[channel + 2] + 4 * number))),
+                    _mm256_loadu_pd(
+                        (const double*)(inputVectors[channel + 3] + 4 * number)),
+                    1);
+                frames01 = _mm512_permutex2var_pd(x, first, y);
+                frames23 = _mm512_permutex2var_pd(x, second, y);
+                _mm256_storeu_pd(frame + channel, _mm512_castpd512_pd256(frames01));
+                _mm256_storeu_pd(frame + num_channels + channel,
+                                 _mm512_extractf64x4_pd(frames01, 1));
+                _mm256_storeu_pd(frame + 2 * num_channels + channel,
+                                 _mm512_castpd512_pd256(frames23));
+                _mm256_storeu_pd(frame + 3 * num_channels + channel,
+                                 _mm512_extractf64x4_pd(frames23, 1));
+            }
+        }
+    } else if (num_channels % 2 == 0) {
+        halfPoints = num_points / 2;
+        for (number = 0; number < halfPoints; number++) {
+            frame = output + 2 * number * num_channels;
+            for (channel = 0; channel < num_channels; channel += 2) {
+                a = _mm_loadu_pd((const double*)(inputVectors[channel] + 2 * number));
+                b = _mm_loadu_pd((const double*)(inputVectors[channel + 1] + 2 * number));
+                _mm_storeu_pd(frame + channel, _mm_unpacklo_pd(a, b));
+                _mm_storeu_pd(frame + num_channels + channel, _mm_unpackhi_pd(a, b));
+            }
+        }
+    }
+
+    volk_32fc_interleave_xN_frames(outputVector,
+                                   inputVectors,
+                                   num_channels,
+                                   eighthPoints * 8 + quarterPoints * 4 + halfPoints * 2,
+                                   num_points);
+}
+
+#endif /* LV_HAVE_AVX512F */
+
+
+#ifdef LV_HAVE_NEON
+#include <arm_neon.h>
+
+static inline void volk_32fc_interleave_32fc_xN_neon(lv_32fc_t* outputVector,
+                                                     const lv_32fc_t** inputVectors,
+                                                     unsigned int num_channels,
+                                                     unsigned int num_points)
+{
+    float* output = (float*)outputVector;
+    float* frame;
+    unsigned int quarterPoints = 0;
+    unsigned int halfPoints = 0;
+    float32x4x4_t values;
+    float32x4x2_t channelValues;
+    float32x4_t a, b;
+    unsigned int number, channel;
+
+    if (num_channels == 2) {
+        quarterPoints = num_points / 4;
+        for (number = 0; number < quarterPoints; number++) {
+            channelValues = vld2q_f32((const float*)(inputVectors[0] + 4 * number));
+            values.val[0] = channelValues.val[0];
+            values.val[1] = channelValues.val[1];
+            channelValues = vld2q_f32((const float*)(inputVectors[1] + 4 * number));
+            values.val[2] = channelValues.val[0];
+            values.val[3] = channelValues.val[1];
+            vst4q_f32(output, values);
+            output += 16;
+        }
+    } else if (num_channels % 2 == 0) {
+        halfPoints = num_points / 2;
+        for (number = 0; number < halfPoints; number++) {
+            frame = output + 4 * number * num_channels;
+            for (channel = 0; channel < num_channels; channel += 2) {
+                a = vld1q_f32((const float*)(inputVectors[channel] + 2 * number));
+                b = vld1q_f32((const float*)(inputVectors[channel + 1] + 2 * number));
+                vst1q_f32(frame + 2 * channel,
+                          vcombine_f32(vget_low_f32(a), vget_low_f32(b)));
+                vst1q_f32(frame + 2 * num_channels + 2 * channel,
+                          vcombine_f32(vget_high_f32(a), vget_high_f32(b)));
+            }
+        }
+    }
+
+    volk_32fc_interleave_xN_frames(outputVector,
+                                   inputVectors,
+                                   num_channels,
+                                   quarterPoints * 4 + halfPoints * 2,
+                                   num_points);
+}
+
+#endif /* LV_HAVE_NEON */
+
+#endif /* INCLUDED_volk_32fc_interleave_32fc_xN_H */
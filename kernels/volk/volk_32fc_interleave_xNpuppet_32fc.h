@@ -0,0 +1,118 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2026 Free Software Foundation, Inc.
+ *
+ * This file is part of VOLK
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+/*
+ * QA wrapper for volk_32fc_interleave_32fc_xN. The buffers are split into
+ * one segment per channel count in volk_32fc_interleave_xNpuppet_channels,
+ * so that the two channel, multiple of four, other even and odd channel paths
+ * all run.
+ */
+
+#ifndef INCLUDED_volk_32fc_interleave_xNpuppet_32fc_H
+#define INCLUDED_volk_32fc_interleave_xNpuppet_32fc_H
+
+#include <string.h>
+#include <volk/volk_32fc_interleave_32fc_xN.h>
+
+static const unsigned int volk_32fc_interleave_xNpuppet_channels[6] = {
+    2, 3, 4, 6, 8, 16
+};
+
+typedef void (*volk_32fc_interleave_xN_kernel)(lv_32fc_t*,
+                                               const lv_32fc_t**,
+                                               unsigned int,
+                                               unsigned int);
+
+static inline void
+volk_32fc_interleave_xNpuppet_32fc_run(volk_32fc_interleave_xN_kernel kernel,
+                                       lv_32fc_t* output,
+                                       const lv_32fc_t* input,
+                                       unsigned int num_points)
+{
+    const unsigned int* channels = volk_32fc_interleave_xNpuppet_channels;
+    const unsigned int segment = num_points / 6;
+    const lv_32fc_t* vectors[16];
+    unsigned int s, c, frames;
+
+    memset(output, 0, num_points * sizeof(lv_32fc_t));
+    for (s = 0; s < 6; s++) {
+        frames = segment / channels[s];
+        for (c = 0; c < channels[s]; c++) {
+            vectors[c] = input + s * segment + c * frames;
+        }
+        kernel(output + s * segment, vectors, channels[s], frames);
+    }
+}
+
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void volk_32fc_interleave_xNpuppet_32fc_generic(lv_32fc_t* output,
+                                                              const lv_32fc_t* input,
+                                                              unsigned int num_points)
+{
+    volk_32fc_interleave_xNpuppet_32fc_run(
+        volk_32fc_interleave_32fc_xN_generic, output, input, num_points);
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+
+#ifdef LV_HAVE_SSE
+
+static inline void volk_32fc_interleave_xNpuppet_32fc_u_sse(lv_32fc_t* output,
+                                                            const lv_32fc_t* input,
+                                                            unsigned int num_points)
+{
+    volk_32fc_interleave_xNpuppet_32fc_run(
+        volk_32fc_interleave_32fc_xN_u_sse, output, input, num_points);
+}
+
+#endif /* LV_HAVE_SSE */
+
+
+#ifdef LV_HAVE_AVX
+
+static inline void volk_32fc_interleave_xNpuppet_32fc_u_avx(lv_32fc_t* output,
+                                                            const lv_32fc_t* input,
+                                                            unsigned int num_points)
+{
+    volk_32fc_interleave_xNpuppet_32fc_run(
+        volk_32fc_interleave_32fc_xN_u_avx, output, input, num_points);
+}
+
+#endif /* LV_HAVE_AVX */
+
+
+#ifdef LV_HAVE_AVX512F
+
+static inline void volk_32fc_interleave_xNpuppet_32fc_u_avx512f(lv_32fc_t* output,
+                                                                const lv_32fc_t* input,
+                                                                unsigned int num_points)
+{
+    volk_32fc_interleave_xNpuppet_32fc_run(
+        volk_32fc_interleave_32fc_xN_u_avx512f, output, input, num_points);
+}
+
+#endif /* LV_HAVE_AVX512F */
+
+
+#ifdef LV_HAVE_NEON
+
+static inline void volk_32fc_interleave_xNpuppet_32fc_neon(lv_32fc_t* output,
+                                                           const lv_32fc_t* input,
+                                                           unsigned int num_points)
+{
+    volk_32fc_interleave_xNpuppet_32fc_run(
+        volk_32fc_interleave_32fc_xN_neon, output, input, num_points);
+}
+
+#endif /* LV_HAVE_NEON */
+
+#endif /* INCLUDED_volk_32fc_interleave_xNpuppet_32fc_H */
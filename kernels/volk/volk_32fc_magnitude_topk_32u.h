@@ -0,0 +1,299 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2026 Free Software Foundation, Inc.
+ *
+ * This file is part of VOLK
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+/*!
+ * \page volk_32fc_magnitude_topk_32u
+ *
+ * \b Overview
+ *
+ * Finds the k complex elements with the largest magnitude and writes their
+ * indices, sorted from the largest to the smallest magnitude. Equal magnitudes
+ * are ordered by ascending index. The squared magnitudes are compared.
+ *
+ * The current k best elements are kept in a min-heap that lives in the output
+ * buffer. The SIMD implementations compare whole blocks against the smallest
+ * of them and only touch the heap for the few elements that beat it, so for
+ * k much smaller than num_points the cost is close to a single streaming pass.
+ *
+ * <b>Dispatcher Prototype</b>
+ * \code
+ * void volk_32fc_magnitude_topk_32u(uint32_t* indices,
+ *                                   const lv_32fc_t* inputVector,
+ *                                   unsigned int k, unsigned int num_points)
+ * \endcode
+ *
+ * \b Inputs
+ * \li inputVector: the input vector. Must not contain NaN.
+ * \li k: the number of elements to find. If larger than num_points, only
+ * num_points indices are written.
+ * \li num_points: the number of elements in the input vector.
+ *
+ * \b Outputs
+ * \li indices: the indices of the k elements with the largest magnitude, largest first.
+ *
+ * \b Example
+ * \code
+ *   unsigned int N = 65536;
+ *   unsigned int K = 16;
+ *   unsigned int alignment = volk_get_alignment();
+ *   lv_32fc_t* in = (lv_32fc_t*)volk_malloc(sizeof(lv_32fc_t) * N, alignment);
+ *   uint32_t* indices = (uint32_t*)volk_malloc(sizeof(uint32_t) * K, alignment);
+ *
+ *   // in holds the output of an FFT
+ *   volk_32fc_magnitude_topk_32u(indices, in, K, N);
+ *
+ *   volk_free(in);
+ *   volk_free(indices);
+ * \endcode
+ */
+
+#ifndef INCLUDED_volk_32fc_magnitude_topk_32u_u_H
+#define INCLUDED_volk_32fc_magnitude_topk_32u_u_H
+
+#include <inttypes.h>
+#include <volk/volk_complex.h>
+
+static inline float volk_32fc_topk_mag(const lv_32fc_t* inputVector, uint32_t index)
+{
+    const float re = lv_creal(inputVector[index]);
+    const float im = lv_cimag(inputVector[index]);
+    return re * re + im * im;
+}
+
+/* Is element a ranked below element b? */
+static inline int
+volk_32fc_topk_worse(const lv_32fc_t* inputVector, uint32_t a, uint32_t b)
+{
+    const float magA = volk_32fc_topk_mag(inputVector, a);
+    const float magB = volk_32fc_topk_mag(inputVector, b);
+    return (magA < magB) || (magA == magB && a > b);
+}
+
+static inline void volk_32fc_topk_sift_down(uint32_t* heap,
+                                            const lv_32fc_t* inputVector,
+                                            unsigned int size,
+                                            unsigned int pos)
+{
+    const uint32_t item = heap[pos];
+    unsigned int child;
+    while ((child = 2 * pos + 1) < size) {
+        if (child + 1 < size &&
+            volk_32fc_topk_worse(inputVector, heap[child + 1], heap[child])) {
+            child++;
+        }
+        if (!volk_32fc_topk_worse(inputVector, heap[child], item)) {
+            break;
+        }
+        heap[pos] = heap[child];
+        pos = child;
+    }
+    heap[pos] = item;
+}
+
+/* Heap of the first k elements, the worst one at the root */
+static inline void
+volk_32fc_topk_init(uint32_t* heap, const lv_32fc_t* inputVector, unsigned int k)
+{
+    unsigned int ii;
+    for (ii = 0; ii < k; ii++) {
+        heap[ii] = ii;
+    }
+    for (ii = k / 2; ii-- > 0;) {
+        volk_32fc_topk_sift_down(heap, inputVector, k, ii);
+    }
+}
+
+/* Elements are pushed in ascending index order, so they only need to beat the
+ * magnitude of the root. */
+static inline void volk_32fc_topk_push(uint32_t* heap,
+                                       const lv_32fc_t* inputVector,
+                                       unsigned int k,
+                                       uint32_t index)
+{
+    if (volk_32fc_topk_mag(inputVector, index) >
+        volk_32fc_topk_mag(inputVector, heap[0])) {
+        heap[0] = index;
+        volk_32fc_topk_sift_down(heap, inputVector, k, 0);
+    }
+}
+
+/* Heap sort, leaves the best element first */
+static inline void
+volk_32fc_topk_finish(uint32_t* heap, const lv_32fc_t* inputVector, unsigned int k)
+{
+    unsigned int size;
+    uint32_t tmp;
+    for (size = k; size > 1; size--) {
+        tmp = heap[0];
+        heap[0] = heap[size - 1];
+        heap[size - 1] = tmp;
+        volk_32fc_topk_sift_down(heap, inputVector, size - 1, 0);
+    }
+}
+
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void volk_32fc_magnitude_topk_32u_generic(uint32_t* indices,
+                                                        const lv_32fc_t* inputVector,
+                                                        unsigned int k,
+                                                        unsigned int num_points)
+{
+    unsigned int number;
+
+    k = (k < num_points) ? k : num_points;
+    if (k == 0) {
+        return;
+    }
+    volk_32fc_topk_init(indices, inputVector, k);
+    for (number = k; number < num_points; number++) {
+        volk_32fc_topk_push(indices, inputVector, k, number);
+    }
+    volk_32fc_topk_finish(indices, inputVector, k);
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+
+#ifdef LV_HAVE_AVX2
+#include <immintrin.h>
+
+static inline void volk_32fc_magnitude_topk_32u_u_avx2(uint32_t* indices,
+                                                       const lv_32fc_t* inputVector,
+                                                       unsigned int k,
+                                                       unsigned int num_points)
+{
+    __m256 threshold, a, b, mag;
+    int mask;
+    unsigned int number, lane;
+
+    k = (k < num_points) ? k : num_points;
+    if (k == 0) {
+        return;
+    }
+    volk_32fc_topk_init(indices, inputVector, k);
+    threshold = _mm256_set1_ps(volk_32fc_topk_mag(inputVector, indices[0]));
+    for (number = k; number + 8 <= num_points; number += 8) {
+        a = _mm256_loadu_ps((const float*)(inputVector + number));
+        b = _mm256_loadu_ps((const float*)(inputVector + number + 4));
+        // hadd gives the magnitudes in the order 0 1 4 5 2 3 6 7
+        mag = _mm256_hadd_ps(_mm256_mul_ps(a, a), _mm256_mul_ps(b, b));
+        mag = _mm256_castpd_ps(_mm256_permute4x64_pd(_mm256_castps_pd(mag), 0xD8));
+        mask = _mm256_movemask_ps(_mm256_cmp_ps(mag, threshold, _CMP_GT_OQ));
+        if (mask) {
+            for (lane = 0; lane < 8; lane++) {
+                if (mask & (1 << lane)) {
+                    volk_32fc_topk_push(indices, inputVector, k, number + lane);
+                }
+            }
+            threshold = _mm256_set1_ps(volk_32fc_topk_mag(inputVector, indices[0]));
+        }
+    }
+    for (; number < num_points; number++) {
+        volk_32fc_topk_push(indices, inputVector, k, number);
+    }
+    volk_32fc_topk_finish(indices, inputVector, k);
+}
+
+#endif /* LV_HAVE_AVX2 */
+
+
+#ifdef LV_HAVE_AVX512F
+#include <immintrin.h>
+
+static inline void volk_32fc_magnitude_topk_32u_u_avx512f(uint32_t* indices,
+                                                          const lv_32fc_t* inputVector,
+                                                          unsigned int k,
+                                                          unsigned int num_points)
+{
+    const __m512i evenIdx =
+        _mm512_setr_epi32(0, 2, 4, 6, 8, 10, 12, 14, 16, 18, 20, 22, 24, 26, 28, 30);
+    const __m512i oddIdx =
+        _mm512_setr_epi32(1, 3, 5, 7, 9, 11, 13, 15, 17, 19, 21, 23, 25, 27, 29, 31);
+    __m512 threshold, a, b, mag;
+    __mmask16 mask;
+    unsigned int number, lane;
+
+    k = (k < num_points) ? k : num_points;
+    if (k == 0) {
+        return;
+    }
+    volk_32fc_topk_init(indices, inputVector, k);
+    threshold = _mm512_set1_ps(volk_32fc_topk_mag(inputVector, indices[0]));
+    for (number = k; number + 16 <= num_points; number += 16) {
+        a = _mm512_loadu_ps((const float*)(inputVector + number));
+        b = _mm512_loadu_ps((const float*)(inputVector + number + 8));
+        a = _mm512_mul_ps(a, a);
+        b = _mm512_mul_ps(b, b);
+        mag = _mm512_add_ps(_mm512_permutex2var_ps(a, evenIdx, b),
+                            _mm512_permutex2var_ps(a, oddIdx, b));
+        mask = _mm512_cmp_ps_mask(mag, threshold, _CMP_GT_OQ);
+        if (mask) {
+            for (lane = 0; lane < 16; lane++) {
+                if (mask & (1 << lane)) {
+                    volk_32fc_topk_push(indices, inputVector, k, number + lane);
+                }
+            }
+            threshold = _mm512_set1_ps(volk_32fc_topk_mag(inputVector, indices[0]));
+        }
+    }
+    for (; number < num_points; number++) {
+        volk_32fc_topk_push(indices, inputVector, k, number);
+    }
+    volk_32fc_topk_finish(indices, inputVector, k);
+}
+
+#endif /* LV_HAVE_AVX512F */
+
+
+#ifdef LV_HAVE_NEON
+#include <arm_neon.h>
+
+static inline void volk_32fc_magnitude_topk_32u_neon(uint32_t* indices,
+                                                     const lv_32fc_t* inputVector,
+                                                     unsigned int k,
+                                                     unsigned int num_points)
+{
+    float32x4_t threshold;
+    float32x4x2_t x;
+    uint32x4_t above;
+    uint32x2_t any;
+    uint32_t lanes[4];
+    unsigned int number, lane;
+
+    k = (k < num_points) ? k : num_points;
+    if (k == 0) {
+        return;
+    }
+    volk_32fc_topk_init(indices, inputVector, k);
+    threshold = vdupq_n_f32(volk_32fc_topk_mag(inputVector, indices[0]));
+    for (number = k; number + 4 <= num_points; number += 4) {
+        x = vld2q_f32((const float*)(inputVector + number));
+        above = vcgtq_f32(vmlaq_f32(vmulq_f32(x.val[0], x.val[0]), x.val[1], x.val[1]),
+                          threshold);
+        any = vorr_u32(vget_low_u32(above), vget_high_u32(above));
+        if (vget_lane_u32(vpmax_u32(any, any), 0)) {
+            vst1q_u32(lanes, above);
+            for (lane = 0; lane < 4; lane++) {
+                if (lanes[lane]) {
+                    volk_32fc_topk_push(indices, inputVector, k, number + lane);
+                }
+            }
+            threshold = vdupq_n_f32(volk_32fc_topk_mag(inputVector, indices[0]));
+        }
+    }
+    for (; number < num_points; number++) {
+        volk_32fc_topk_push(indices, inputVector, k, number);
+    }
+    volk_32fc_topk_finish(indices, inputVector, k);
+}
+
+#endif /* LV_HAVE_NEON */
+
+#endif /* INCLUDED_volk_32fc_magnitude_topk_32u_u_H */
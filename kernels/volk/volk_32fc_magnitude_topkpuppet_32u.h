@@ -0,0 +1,81 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2026 Free Software Foundation, Inc.
+ *
+ * This file is part of VOLK
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+/* For documentation see 'kernels/volk/volk_32fc_magnitude_topk_32u.h'
+ * This file exists for test purposes only. Should not be used directly.
+ *
+ * Writes the top 64 of the input followed by the top 8 of its first 1000
+ * elements.
+ */
+
+#ifndef INCLUDED_volk_32fc_magnitude_topkpuppet_32u_H
+#define INCLUDED_volk_32fc_magnitude_topkpuppet_32u_H
+
+#include <volk/volk_32fc_magnitude_topk_32u.h>
+
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void
+volk_32fc_magnitude_topkpuppet_32u_generic(uint32_t* indices,
+                                           const lv_32fc_t* inputVector,
+                                           unsigned int num_points)
+{
+    volk_32fc_magnitude_topk_32u_generic(indices, inputVector, 64, num_points);
+    volk_32fc_magnitude_topk_32u_generic(
+        indices + 64, inputVector, 8, (num_points < 1000) ? num_points : 1000);
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+
+#ifdef LV_HAVE_AVX2
+
+static inline void
+volk_32fc_magnitude_topkpuppet_32u_u_avx2(uint32_t* indices,
+                                          const lv_32fc_t* inputVector,
+                                          unsigned int num_points)
+{
+    volk_32fc_magnitude_topk_32u_u_avx2(indices, inputVector, 64, num_points);
+    volk_32fc_magnitude_topk_32u_u_avx2(
+        indices + 64, inputVector, 8, (num_points < 1000) ? num_points : 1000);
+}
+
+#endif /* LV_HAVE_AVX2 */
+
+
+#ifdef LV_HAVE_AVX512F
+
+static inline void
+volk_32fc_magnitude_topkpuppet_32u_u_avx512f(uint32_t* indices,
+                                             const lv_32fc_t* inputVector,
+                                             unsigned int num_points)
+{
+    volk_32fc_magnitude_topk_32u_u_avx512f(indices, inputVector, 64, num_points);
+    volk_32fc_magnitude_topk_32u_u_avx512f(
+        indices + 64, inputVector, 8, (num_points < 1000) ? num_points : 1000);
+}
+
+#endif /* LV_HAVE_AVX512F */
+
+
+#ifdef LV_HAVE_NEON
+
+static inline void volk_32fc_magnitude_topkpuppet_32u_neon(uint32_t* indices,
+                                                           const lv_32fc_t* inputVector,
+                                                           unsigned int num_points)
+{
+    volk_32fc_magnitude_topk_32u_neon(indices, inputVector, 64, num_points);
+    volk_32fc_magnitude_topk_32u_neon(
+        indices + 64, inputVector, 8, (num_points < 1000) ? num_points : 1000);
+}
+
+#endif /* LV_HAVE_NEON */
+
+#endif /* INCLUDED_volk_32fc_magnitude_topkpuppet_32u_H */
@@ -0,0 +1,124 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2026 Free Software Foundation, Inc.
+ *
+ * This file is part of VOLK
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+/* For documentation see 'kernels/volk/volk_32fc_s32f_qam_llr_32f.h'
+ * This file exists for test purposes only. Should not be used directly.
+ *
+ * Writes the LLRs of QPSK, 16QAM, 64QAM and 256QAM for four separate parts of
+ * the input, using a fixed noise variance. The unused part of the output is
+ * cleared.
+ */
+
+#ifndef INCLUDED_volk_32fc_qam_llrpuppet_32f_H
+#define INCLUDED_volk_32fc_qam_llrpuppet_32f_H
+
+#include <string.h>
+#include <volk/volk_32fc_s32f_qam_llr_32f.h>
+
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void volk_32fc_qam_llrpuppet_32f_generic(float* llrs,
+                                                       const lv_32fc_t* symbols,
+                                                       unsigned int num_points)
+{
+    const unsigned int part = num_points / 20;
+    unsigned int bits;
+
+    for (bits = 2; bits <= 8; bits += 2) {
+        volk_32fc_s32f_qam_llr_32f_generic(llrs, symbols, 0.5f, bits, part);
+        symbols += part;
+        llrs += bits * part;
+    }
+    memset(llrs, 0, (num_points - 20 * part) * sizeof(float));
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+
+#ifdef LV_HAVE_SSE4_1
+
+static inline void volk_32fc_qam_llrpuppet_32f_u_sse4_1(float* llrs,
+                                                        const lv_32fc_t* symbols,
+                                                        unsigned int num_points)
+{
+    const unsigned int part = num_points / 20;
+    unsigned int bits;
+
+    for (bits = 2; bits <= 8; bits += 2) {
+        volk_32fc_s32f_qam_llr_32f_u_sse4_1(llrs, symbols, 0.5f, bits, part);
+        symbols += part;
+        llrs += bits * part;
+    }
+    memset(llrs, 0, (num_points - 20 * part) * sizeof(float));
+}
+
+#endif /* LV_HAVE_SSE4_1 */
+
+
+#ifdef LV_HAVE_AVX
+
+static inline void volk_32fc_qam_llrpuppet_32f_u_avx(float* llrs,
+                                                     const lv_32fc_t* symbols,
+                                                     unsigned int num_points)
+{
+    const unsigned int part = num_points / 20;
+    unsigned int bits;
+
+    for (bits = 2; bits <= 8; bits += 2) {
+        volk_32fc_s32f_qam_llr_32f_u_avx(llrs, symbols, 0.5f, bits, part);
+        symbols += part;
+        llrs += bits * part;
+    }
+    memset(llrs, 0, (num_points - 20 * part) * sizeof(float));
+}
+
+#endif /* LV_HAVE_AVX */
+
+
+#ifdef LV_HAVE_AVX512F
+
+static inline void volk_32fc_qam_llrpuppet_32f_u_avx512f(float* llrs,
+                                                         const lv_32fc_t* symbols,
+                                                         unsigned int num_points)
+{
+    const unsigned int part = num_points / 20;
+    unsigned int bits;
+
+    for (bits = 2; bits <= 8; bits += 2) {
+        volk_32fc_s32f_qam_llr_32f_u_avx512f(llrs, symbols, 0.5f, bits, part);
+        symbols += part;
+        llrs += bits * part;
+    }
+    memset(llrs, 0, (num_points - 20 * part) * sizeof(float));
+}
+
+#endif /* LV_HAVE_AVX512F */
+
+
+#ifdef LV_HAVE_NEON
+
+static inline void volk_32fc_qam_llrpuppet_32f_neon(float* llrs,
+                                                    const lv_32fc_t* symbols,
+                                                    unsigned int num_points)
+{
+    const unsigned int part = num_points / 20;
+    unsigned int bits;
+
+    for (bits = 2; bits <= 8; bits += 2) {
+        volk_32fc_s32f_qam_llr_32f_neon(llrs, symbols, 0.5f, bits, part);
+        symbols += part;
+        llrs += bits * part;
+    }
+    memset(llrs, 0, (num_points - 20 * part) * sizeof(float));
+}
+
+#endif /* LV_HAVE_NEON */
+
+#endif /* INCLUDED_volk_32fc_qam_llrpuppet_32f_H */
@@ -0,0 +1,84 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2026 Free Software Foundation, Inc.
+ *
+ * This file is part of VOLK
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+/* For documentation see 'kernels/volk/volk_32fc_s32f_qam_slicer_32fc.h'
+ * This file exists for test purposes only. Should not be used directly.
+ *
+ * Slices five separate parts of the input as QPSK, 8PSK, 16QAM, 64QAM and
+ * 256QAM, with a constellation amplitude that puts some of the input outside
+ * of the outer points. The unused part of the output is cleared.
+ */
+
+#ifndef INCLUDED_volk_32fc_qam_slicerpuppet_32fc_H
+#define INCLUDED_volk_32fc_qam_slicerpuppet_32fc_H
+
+#include <string.h>
+#include <volk/volk_32fc_s32f_qam_slicer_32fc.h>
+
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void volk_32fc_qam_slicerpuppet_32fc_generic(lv_32fc_t* points,
+                                                           const lv_32fc_t* symbols,
+                                                           unsigned int num_points)
+{
+    const unsigned int bits[5] = { 2, 3, 4, 6, 8 };
+    const unsigned int part = num_points / 5;
+    unsigned int ii;
+
+    for (ii = 0; ii < 5; ii++) {
+        volk_32fc_s32f_qam_slicer_32fc_generic(
+            points + ii * part, symbols + ii * part, 0.8f, bits[ii], part);
+    }
+    memset(points + 5 * part, 0, (num_points - 5 * part) * sizeof(lv_32fc_t));
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+
+#ifdef LV_HAVE_AVX2
+
+static inline void volk_32fc_qam_slicerpuppet_32fc_u_avx2(lv_32fc_t* points,
+                                                          const lv_32fc_t* symbols,
+                                                          unsigned int num_points)
+{
+    const unsigned int bits[5] = { 2, 3, 4, 6, 8 };
+    const unsigned int part = num_points / 5;
+    unsigned int ii;
+
+    for (ii = 0; ii < 5; ii++) {
+        volk_32fc_s32f_qam_slicer_32fc_u_avx2(
+            points + ii * part, symbols + ii * part, 0.8f, bits[ii], part);
+    }
+    memset(points + 5 * part, 0, (num_points - 5 * part) * sizeof(lv_32fc_t));
+}
+
+#endif /* LV_HAVE_AVX2 */
+
+
+#ifdef LV_HAVE_NEON
+
+static inline void volk_32fc_qam_slicerpuppet_32fc_neon(lv_32fc_t* points,
+                                                        const lv_32fc_t* symbols,
+                                                        unsigned int num_points)
+{
+    const unsigned int bits[5] = { 2, 3, 4, 6, 8 };
+    const unsigned int part = num_points / 5;
+    unsigned int ii;
+
+    for (ii = 0; ii < 5; ii++) {
+        volk_32fc_s32f_qam_slicer_32fc_neon(
+            points + ii * part, symbols + ii * part, 0.8f, bits[ii], part);
+    }
+    memset(points + 5 * part, 0, (num_points - 5 * part) * sizeof(lv_32fc_t));
+}
+
+#endif /* LV_HAVE_NEON */
+
+#endif /* INCLUDED_volk_32fc_qam_slicerpuppet_32fc_H */
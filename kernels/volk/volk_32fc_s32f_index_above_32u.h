@@ -0,0 +1,256 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2026 Free Software Foundation, Inc.
+ *
+ * This file is part of VOLK
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+/*!
+ * \page volk_32fc_s32f_index_above_32u
+ *
+ * \b Overview
+ *
+ * Finds the indices of all complex elements whose magnitude is larger than a
+ * threshold, e.g. the candidate peaks of a complex correlator output. The
+ * squared magnitudes are compared against the squared threshold. The indices
+ * are written in ascending order, followed by their number.
+ *
+ * The SIMD implementations skip blocks without any element above the
+ * threshold and compact the others with a permute table (AVX2) or a compress
+ * store (AVX-512).
+ *
+ * <b>Dispatcher Prototype</b>
+ * \code
+ * void volk_32fc_s32f_index_above_32u(uint32_t* indices, uint32_t* numIndices,
+ *                                     const lv_32fc_t* inputVector,
+ *                                     const float threshold, unsigned int num_points)
+ * \endcode
+ *
+ * \b Inputs
+ * \li inputVector: the input vector.
+ * \li threshold: elements with a larger magnitude are reported. A negative
+ * threshold reports all elements.
+ * \li num_points: the number of elements in the input vector.
+ *
+ * \b Outputs
+ * \li indices: the indices of the elements above the threshold. Must have
+ * room for num_points indices, all of which may be written.
+ * \li numIndices: the number of indices found.
+ *
+ * \b Example
+ * \code
+ *   unsigned int N = 100;
+ *   unsigned int alignment = volk_get_alignment();
+ *   lv_32fc_t* in = (lv_32fc_t*)volk_malloc(sizeof(lv_32fc_t) * N, alignment);
+ *   uint32_t* indices = (uint32_t*)volk_malloc(sizeof(uint32_t) * N, alignment);
+ *   uint32_t count;
+ *
+ *   for (unsigned int ii = 0; ii < N; ++ii) {
+ *       in[ii] = (ii % 10 == 3) ? lv_cmake(0.f, 1.f) : lv_cmake(0.1f, 0.f);
+ *   }
+ *
+ *   volk_32fc_s32f_index_above_32u(indices, &count, in, 0.5f, N);
+ *   // count == 10, indices == 3, 13, 23, ...
+ *
+ *   volk_free(in);
+ *   volk_free(indices);
+ * \endcode
+ */
+
+#ifndef INCLUDED_volk_32fc_s32f_index_above_32u_u_H
+#define INCLUDED_volk_32fc_s32f_index_above_32u_u_H
+
+#include <inttypes.h>
+#include <volk/volk_32f_s32f_index_above_32u.h>
+#include <volk/volk_complex.h>
+
+static inline float volk_32fc_index_above_threshold_squared(float threshold)
+{
+    return (threshold >= 0.f) ? threshold * threshold : -1.f;
+}
+
+static inline void volk_32fc_index_above_tail(uint32_t* indices,
+                                              uint32_t* count,
+                                              const lv_32fc_t* inputVector,
+                                              float thresholdSquared,
+                                              unsigned int start,
+                                              unsigned int num_points)
+{
+    unsigned int number;
+    float re, im;
+    for (number = start; number < num_points; number++) {
+        re = lv_creal(inputVector[number]);
+        im = lv_cimag(inputVector[number]);
+        if (re * re + im * im > thresholdSquared) {
+            indices[(*count)++] = number;
+        }
+    }
+}
+
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void volk_32fc_s32f_index_above_32u_generic(uint32_t* indices,
+                                                          uint32_t* numIndices,
+                                                          const lv_32fc_t* inputVector,
+                                                          const float threshold,
+                                                          unsigned int num_points)
+{
+    uint32_t count = 0;
+    volk_32fc_index_above_tail(indices,
+                               &count,
+                               inputVector,
+                               volk_32fc_index_above_threshold_squared(threshold),
+                               0,
+                               num_points);
+    *numIndices = count;
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+
+#ifdef LV_HAVE_AVX2
+#include <immintrin.h>
+
+static inline void volk_32fc_s32f_index_above_32u_u_avx2(uint32_t* indices,
+                                                         uint32_t* numIndices,
+                                                         const lv_32fc_t* inputVector,
+                                                         const float threshold,
+                                                         unsigned int num_points)
+{
+    const float thresholdSquared = volk_32fc_index_above_threshold_squared(threshold);
+    const float* inputPtr = (const float*)inputVector;
+    const unsigned int eighthPoints = num_points / 8;
+    const __m256 vThreshold = _mm256_set1_ps(thresholdSquared);
+    const __m256i shifts = _mm256_setr_epi32(0, 4, 8, 12, 16, 20, 24, 28);
+    const __m256i laneMask = _mm256_set1_epi32(7);
+    const __m256i eight = _mm256_set1_epi32(8);
+    __m256i index = _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7);
+    __m256i permute;
+    __m256 a, b, mag;
+    uint32_t count = 0;
+    unsigned int number;
+    int mask;
+
+    for (number = 0; number < eighthPoints; number++) {
+        a = _mm256_loadu_ps(inputPtr);
+        b = _mm256_loadu_ps(inputPtr + 8);
+        // hadd gives the magnitudes in the order 0 1 4 5 2 3 6 7
+        mag = _mm256_hadd_ps(_mm256_mul_ps(a, a), _mm256_mul_ps(b, b));
+        mag = _mm256_castpd_ps(_mm256_permute4x64_pd(_mm256_castps_pd(mag), 0xD8));
+        mask = _mm256_movemask_ps(_mm256_cmp_ps(mag, vThreshold, _CMP_GT_OQ));
+        if (mask) {
+            permute = _mm256_set1_epi32(volk_index_above_permute_table[mask]);
+            permute = _mm256_and_si256(_mm256_srlv_epi32(permute, shifts), laneMask);
+            // count <= 8 * number, so the full store stays within the output
+            _mm256_storeu_si256((__m256i*)(indices + count),
+                                _mm256_permutevar8x32_epi32(index, permute));
+            count += _mm_popcnt_u32(mask);
+        }
+        index = _mm256_add_epi32(index, eight);
+        inputPtr += 16;
+    }
+
+    volk_32fc_index_above_tail(
+        indices, &count, inputVector, thresholdSquared, eighthPoints * 8, num_points);
+    *numIndices = count;
+}
+
+#endif /* LV_HAVE_AVX2 */
+
+
+#ifdef LV_HAVE_AVX512F
+#include <immintrin.h>
+
+static inline void volk_32fc_s32f_index_above_32u_u_avx512f(uint32_t* indices,
+                                                            uint32_t* numIndices,
+                                                            const lv_32fc_t* inputVector,
+                                                            const float threshold,
+                                                            unsigned int num_points)
+{
+    const float thresholdSquared = volk_32fc_index_above_threshold_squared(threshold);
+    const float* inputPtr = (const float*)inputVector;
+    const unsigned int sixteenthPoints = num_points / 16;
+    const __m512 vThreshold = _mm512_set1_ps(thresholdSquared);
+    const __m512i sixteen = _mm512_set1_epi32(16);
+    const __m512i evenIdx =
+        _mm512_setr_epi32(0, 2, 4, 6, 8, 10, 12, 14, 16, 18, 20, 22, 24, 26, 28, 30);
+    const __m512i oddIdx =
+        _mm512_setr_epi32(1, 3, 5, 7, 9, 11, 13, 15, 17, 19, 21, 23, 25, 27, 29, 31);
+    __m512i index =
+        _mm512_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15);
+    __m512 a, b, mag;
+    __mmask16 mask;
+    uint32_t count = 0;
+    unsigned int number;
+
+    for (number = 0; number < sixteenthPoints; number++) {
+        a = _mm512_loadu_ps(inputPtr);
+        b = _mm512_loadu_ps(inputPtr + 16);
+        a = _mm512_mul_ps(a, a);
+        b = _mm512_mul_ps(b, b);
+        mag = _mm512_add_ps(_mm512_permutex2var_ps(a, evenIdx, b),
+                            _mm512_permutex2var_ps(a, oddIdx, b));
+        mask = _mm512_cmp_ps_mask(mag, vThreshold, _CMP_GT_OQ);
+        if (mask) {
+            _mm512_mask_compressstoreu_epi32(indices + count, mask, index);
+            count += _mm_popcnt_u32(mask);
+        }
+        index = _mm512_add_epi32(index, sixteen);
+        inputPtr += 32;
+    }
+
+    volk_32fc_index_above_tail(
+        indices, &count, inputVector, thresholdSquared, sixteenthPoints * 16, num_points);
+    *numIndices = count;
+}
+
+#endif /* LV_HAVE_AVX512F */
+
+
+#ifdef LV_HAVE_NEON
+#include <arm_neon.h>
+
+static inline void volk_32fc_s32f_index_above_32u_neon(uint32_t* indices,
+                                                       uint32_t* numIndices,
+                                                       const lv_32fc_t* inputVector,
+                                                       const float threshold,
+                                                       unsigned int num_points)
+{
+    const float thresholdSquared = volk_32fc_index_above_threshold_squared(threshold);
+    const float* inputPtr = (const float*)inputVector;
+    const unsigned int quarterPoints = num_points / 4;
+    const float32x4_t vThreshold = vdupq_n_f32(thresholdSquared);
+    float32x4x2_t x;
+    uint32x4_t above;
+    uint32x2_t any;
+    uint32_t lanes[4];
+    uint32_t count = 0;
+    unsigned int number, lane;
+
+    for (number = 0; number < quarterPoints; number++) {
+        x = vld2q_f32(inputPtr);
+        above = vcgtq_f32(vmlaq_f32(vmulq_f32(x.val[0], x.val[0]), x.val[1], x.val[1]),
+                          vThreshold);
+        any = vorr_u32(vget_low_u32(above), vget_high_u32(above));
+        if (vget_lane_u32(vpmax_u32(any, any), 0)) {
+            vst1q_u32(lanes, above);
+            for (lane = 0; lane < 4; lane++) {
+                if (lanes[lane]) {
+                    indices[count++] = 4 * number + lane;
+                }
+            }
+        }
+        inputPtr += 8;
+    }
+
+    volk_32fc_index_above_tail(
+        indices, &count, inputVector, thresholdSquared, quarterPoints * 4, num_points);
+    *numIndices = count;
+}
+
+#endif /* LV_HAVE_NEON */
+
+#endif /* INCLUDED_volk_32fc_s32f_index_above_32u_u_H */
@@ -0,0 +1,108 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2026 Free Software Foundation, Inc.
+ *
+ * This file is part of VOLK
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+/* For documentation see 'kernels/volk/volk_32fc_s32f_x2_power_spectrum_avg_32f.h'
+ * This file exists for test purposes only. Should not be used directly.
+ *
+ * The first half of the input is the previous frame that initializes the
+ * average, the second half is averaged into it.
+ */
+
+#ifndef INCLUDED_volk_32fc_s32f_power_spectrum_avgpuppet_32f_H
+#define INCLUDED_volk_32fc_s32f_power_spectrum_avgpuppet_32f_H
+
+#include <volk/volk_32fc_s32f_x2_power_spectrum_avg_32f.h>
+
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void
+volk_32fc_s32f_power_spectrum_avgpuppet_32f_generic(float* logPowerAvg,
+                                                    const lv_32fc_t* complexFFTInput,
+                                                    const float normalizationFactor,
+                                                    unsigned int num_points)
+{
+    const unsigned int half = num_points / 2;
+    volk_32fc_s32f_x2_power_spectrum_avg_32f_generic(
+        logPowerAvg, complexFFTInput, normalizationFactor, 1.f, half);
+    volk_32fc_s32f_x2_power_spectrum_avg_32f_generic(
+        logPowerAvg, complexFFTInput + half, normalizationFactor, 0.25f, half);
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+#ifdef LV_HAVE_SSE2
+
+static inline void
+volk_32fc_s32f_power_spectrum_avgpuppet_32f_u_sse2(float* logPowerAvg,
+                                                   const lv_32fc_t* complexFFTInput,
+                                                   const float normalizationFactor,
+                                                   unsigned int num_points)
+{
+    const unsigned int half = num_points / 2;
+    volk_32fc_s32f_x2_power_spectrum_avg_32f_u_sse2(
+        logPowerAvg, complexFFTInput, normalizationFactor, 1.f, half);
+    volk_32fc_s32f_x2_power_spectrum_avg_32f_u_sse2(
+        logPowerAvg, complexFFTInput + half, normalizationFactor, 0.25f, half);
+}
+
+#endif /* LV_HAVE_SSE2 */
+
+#if LV_HAVE_AVX2 && LV_HAVE_FMA
+
+static inline void
+volk_32fc_s32f_power_spectrum_avgpuppet_32f_u_avx2_fma(float* logPowerAvg,
+                                                       const lv_32fc_t* complexFFTInput,
+                                                       const float normalizationFactor,
+                                                       unsigned int num_points)
+{
+    const unsigned int half = num_points / 2;
+    volk_32fc_s32f_x2_power_spectrum_avg_32f_u_avx2_fma(
+        logPowerAvg, complexFFTInput, normalizationFactor, 1.f, half);
+    volk_32fc_s32f_x2_power_spectrum_avg_32f_u_avx2_fma(
+        logPowerAvg, complexFFTInput + half, normalizationFactor, 0.25f, half);
+}
+
+#endif /* LV_HAVE_AVX2 && LV_HAVE_FMA */
+
+#ifdef LV_HAVE_AVX512F
+
+static inline void
+volk_32fc_s32f_power_spectrum_avgpuppet_32f_u_avx512f(float* logPowerAvg,
+                                                      const lv_32fc_t* complexFFTInput,
+                                                      const float normalizationFactor,
+                                                      unsigned int num_points)
+{
+    const unsigned int half = num_points / 2;
+    volk_32fc_s32f_x2_power_spectrum_avg_32f_u_avx512f(
+        logPowerAvg, complexFFTInput, normalizationFactor, 1.f, half);
+    volk_32fc_s32f_x2_power_spectrum_avg_32f_u_avx512f(
+        logPowerAvg, complexFFTInput + half, normalizationFactor, 0.25f, half);
+}
+
+#endif /* LV_HAVE_AVX512F */
+
+#ifdef LV_HAVE_NEON
+
+static inline void
+volk_32fc_s32f_power_spectrum_avgpuppet_32f_neon(float* logPowerAvg,
+                                                 const lv_32fc_t* complexFFTInput,
+                                                 const float normalizationFactor,
+                                                 unsigned int num_points)
+{
+    const unsigned int half = num_points / 2;
+    volk_32fc_s32f_x2_power_spectrum_avg_32f_neon(
+        logPowerAvg, complexFFTInput, normalizationFactor, 1.f, half);
+    volk_32fc_s32f_x2_power_spectrum_avg_32f_neon(
+        logPowerAvg, complexFFTInput + half, normalizationFactor, 0.25f, half);
+}
+
+#endif /* LV_HAVE_NEON */
+
+#endif /* INCLUDED_volk_32fc_s32f_power_spectrum_avgpuppet_32f_H */
@@ -0,0 +1,490 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2026 Free Software Foundation, Inc.
+ *
+ * This file is part of VOLK
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+/*!
+ * \page volk_32fc_s32f_qam_llr_32f
+ *
+ * \b Overview
+ *
+ * Computes max-log soft bit decisions (log-likelihood ratios) for symbols of a
+ * Gray-mapped square QAM constellation with 2^bitsPerSymbol points, i.e. QPSK,
+ * 16QAM, 64QAM or 256QAM for 2, 4, 6 or 8 bits per symbol.
+ *
+ * The constellation is normalized to unit average energy. Its in-phase and
+ * quadrature axes each carry bitsPerSymbol / 2 bits of a Gray coded PAM, and
+ * the bits of a symbol alternate between the two axes: bits 0 and 1 select
+ * the sign of I and Q, bits 2 and 3 the inner or outer half of each axis, and
+ * so on. This is the mapping used by LTE and 5G NR.
+ *
+ * The LLR of a bit is (d1 - d0) / noiseVariance, where d0 and d1 are the
+ * squared distances to the nearest constellation points with the bit cleared
+ * and set, so a positive LLR favours a zero bit. Per axis one of them is the
+ * distance to the nearest PAM level and the other the distance to the nearest
+ * level across the closest decision boundary of the bit, which needs no search
+ * over the constellation.
+ *
+ * <b>Dispatcher Prototype</b>
+ * \code
+ * void volk_32fc_s32f_qam_llr_32f(float* llrs, const lv_32fc_t* symbols,
+ *                                 const float noiseVariance,
+ *                                 unsigned int bitsPerSymbol, unsigned int num_points)
+ * \endcode
+ *
+ * \b Inputs
+ * \li symbols: the received symbols, scaled to the unit energy constellation.
+ * \li noiseVariance: the complex noise variance, i.e. twice the variance per axis.
+ * \li bitsPerSymbol: an even number between 2 and 16.
+ * \li num_points: the number of symbols.
+ *
+ * \b Outputs
+ * \li llrs: num_points * bitsPerSymbol LLRs, in bit order per symbol.
+ *
+ * \b Example
+ * Soft decisions of a 16QAM corner point.
+ * \code
+ *   unsigned int N = 1;
+ *   unsigned int alignment = volk_get_alignment();
+ *   lv_32fc_t* in = (lv_32fc_t*)volk_malloc(sizeof(lv_32fc_t) * N, alignment);
+ *   float* out = (float*)volk_malloc(sizeof(float) * 4 * N, alignment);
+ *
+ *   in[0] = lv_cmake(3.f, -3.f) / sqrtf(10.f);
+ *
+ *   volk_32fc_s32f_qam_llr_32f(out, in, 0.1f, 4, N);
+ *   // out[0] > 0, out[1] < 0, out[2] < 0, out[3] < 0
+ *
+ *   volk_free(in);
+ *   volk_free(out);
+ * \endcode
+ */
+
+#ifndef INCLUDED_volk_32fc_s32f_qam_llr_32f_u_H
+#define INCLUDED_volk_32fc_s32f_qam_llr_32f_u_H
+
+#include <math.h>
+#include <volk/volk_complex.h>
+
+#define VOLK_QAM_LLR_MAX_AXIS_BITS 8
+
+/* Geometry of one PAM axis in units of half the level spacing, where the
+ * levels are odd integers and bit k > 0 flips at odd multiples of half[k] in
+ * the magnitude. All arithmetic on levels and boundaries is exact, so every
+ * implementation gives the same result. */
+typedef struct volk_32fc_qam_llr_axis {
+    unsigned int bits;
+    float invSpacing;
+    float maxLevel;
+    float scale;
+    float half[VOLK_QAM_LLR_MAX_AXIS_BITS];
+    float invWidth[VOLK_QAM_LLR_MAX_AXIS_BITS];
+    float maxBoundary[VOLK_QAM_LLR_MAX_AXIS_BITS];
+} volk_32fc_qam_llr_axis_t;
+
+static inline void volk_32fc_qam_llr_setup(volk_32fc_qam_llr_axis_t* axis,
+                                           unsigned int bitsPerSymbol,
+                                           float noiseVariance)
+{
+    const unsigned int bits = bitsPerSymbol / 2;
+    const float levels = (float)(1u << bits);
+    const float energy = 2.f * (levels * levels - 1.f) / 3.f;
+    unsigned int k;
+
+    axis->bits = bits;
+    axis->invSpacing = sqrtf(energy);
+    axis->maxLevel = levels / 2.f - 1.f;
+    axis->scale = 1.f / (energy * noiseVariance);
+    for (k = 1; k < bits; k++) {
+        axis->half[k] = (float)(1u << (bits - k));
+        axis->invWidth[k] = 0.5f / axis->half[k];
+        axis->maxBoundary[k] = (float)((1u << (k - 1)) - 1);
+    }
+}
+
+/* LLRs of one axis value, written to every other element of llrs */
+static inline void
+volk_32fc_qam_llr_axis(float* llrs, float y, const volk_32fc_qam_llr_axis_t* axis)
+{
+    const float u = y * axis->invSpacing;
+    const float r = fabsf(u);
+    float level, nearest, boundary, flipped, diff, region;
+    unsigned int k;
+
+    level = r * 0.5f;
+    level = floorf((level < axis->maxLevel) ? level : axis->maxLevel);
+    nearest = level + level + 1.f;
+
+    // the nearest level of the other sign is -1
+    diff = (nearest + 1.f) * ((r + r) - (nearest - 1.f));
+    llrs[0] = copysignf(fabsf(diff), u) * axis->scale;
+
+    region = u;
+    for (k = 1; k < axis->bits; k++) {
+        // positive inside the regions where bit k is cleared
+        region = axis->half[k] - fabsf(region);
+        boundary = r * axis->invWidth[k];
+        boundary = floorf((boundary < axis->maxBoundary[k]) ? boundary
+                                                            : axis->maxBoundary[k]);
+        boundary = boundary * (axis->half[k] + axis->half[k]) + axis->half[k];
+        flipped = (r < boundary) ? boundary + 1.f : boundary - 1.f;
+        diff = (nearest - flipped) * ((r + r) - (nearest + flipped));
+        llrs[2 * k] = copysignf(fabsf(diff), region) * axis->scale;
+    }
+}
+
+static inline void volk_32fc_qam_llr_symbol(float* llrs,
+                                            const lv_32fc_t* symbol,
+                                            const volk_32fc_qam_llr_axis_t* axis)
+{
+    volk_32fc_qam_llr_axis(llrs, lv_creal(*symbol), axis);
+    volk_32fc_qam_llr_axis(llrs + 1, lv_cimag(*symbol), axis);
+}
+
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void volk_32fc_s32f_qam_llr_32f_generic(float* llrs,
+                                                      const lv_32fc_t* symbols,
+                                                      const float noiseVariance,
+                                                      unsigned int bitsPerSymbol,
+                                                      unsigned int num_points)
+{
+    volk_32fc_qam_llr_axis_t axis;
+    unsigned int number;
+
+    volk_32fc_qam_llr_setup(&axis, bitsPerSymbol, noiseVariance);
+    for (number = 0; number < num_points; number++) {
+        volk_32fc_qam_llr_symbol(llrs, symbols++, &axis);
+        llrs += bitsPerSymbol;
+    }
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+
+#ifdef LV_HAVE_SSE4_1
+#include <smmintrin.h>
+
+static inline void volk_32fc_s32f_qam_llr_32f_u_sse4_1(float* llrs,
+                                                       const lv_32fc_t* symbols,
+                                                       const float noiseVariance,
+                                                       unsigned int bitsPerSymbol,
+                                                       unsigned int num_points)
+{
+    volk_32fc_qam_llr_axis_t axis;
+    const unsigned int halfPoints = num_points / 2;
+    const __m128 signMask = _mm_set1_ps(-0.f);
+    const __m128 one = _mm_set1_ps(1.f);
+    const __m128 oneHalf = _mm_set1_ps(0.5f);
+    __m128 invSpacing, maxLevel, scale;
+    __m128 u, r, level, nearest, diff, llr, region, half, boundary, flipped;
+    unsigned int number, k;
+
+    volk_32fc_qam_llr_setup(&axis, bitsPerSymbol, noiseVariance);
+    invSpacing = _mm_set1_ps(axis.invSpacing);
+    maxLevel = _mm_set1_ps(axis.maxLevel);
+    scale = _mm_set1_ps(axis.scale);
+
+    for (number = 0; number < halfPoints; number++) {
+        // both axes of two symbols, the LLRs of each bit pair go to one symbol
+        u = _mm_mul_ps(_mm_loadu_ps((const float*)symbols), invSpacing);
+        r = _mm_andnot_ps(signMask, u);
+        level = _mm_floor_ps(_mm_min_ps(_mm_mul_ps(r, oneHalf), maxLevel));
+        nearest = _mm_add_ps(_mm_add_ps(level, level), one);
+        diff = _mm_mul_ps(_mm_add_ps(nearest, one),
+                          _mm_sub_ps(_mm_add_ps(r, r), _mm_sub_ps(nearest, one)));
+        llr = _mm_or_ps(_mm_andnot_ps(signMask, diff), _mm_and_ps(signMask, u));
+        llr = _mm_mul_ps(llr, scale);
+        if (axis.bits == 1) {
+            _mm_storeu_ps(llrs, llr);
+            symbols += 2;
+            llrs += 2 * bitsPerSymbol;
+            continue;
+        }
+
+        region = u;
+        for (k = 0; k < axis.bits; k++) {
+            if (k > 0) {
+                half = _mm_set1_ps(axis.half[k]);
+                region = _mm_sub_ps(half, _mm_andnot_ps(signMask, region));
+                boundary = _mm_min_ps(_mm_mul_ps(r, _mm_set1_ps(axis.invWidth[k])),
+                                      _mm_set1_ps(axis.maxBoundary[k]));
+                boundary = _mm_floor_ps(boundary);
+                boundary =
+                    _mm_add_ps(_mm_mul_ps(boundary, _mm_add_ps(half, half)), half);
+                flipped = _mm_blendv_ps(_mm_sub_ps(boundary, one),
+                                        _mm_add_ps(boundary, one),
+                                        _mm_cmplt_ps(r, boundary));
+                diff = _mm_mul_ps(
+                    _mm_sub_ps(nearest, flipped),
+                    _mm_sub_ps(_mm_add_ps(r, r), _mm_add_ps(nearest, flipped)));
+                llr = _mm_or_ps(_mm_andnot_ps(signMask, diff),
+                                _mm_and_ps(signMask, region));
+                llr = _mm_mul_ps(llr, scale);
+            }
+            _mm_storel_pi((__m64*)(llrs + 2 * k), llr);
+            _mm_storeh_pi((__m64*)(llrs + bitsPerSymbol + 2 * k), llr);
+        }
+        symbols += 2;
+        llrs += 2 * bitsPerSymbol;
+    }
+
+    for (number = halfPoints * 2; number < num_points; number++) {
+        volk_32fc_qam_llr_symbol(llrs, symbols++, &axis);
+        llrs += bitsPerSymbol;
+    }
+}
+
+#endif /* LV_HAVE_SSE4_1 */
+
+
+#ifdef LV_HAVE_AVX
+#include <immintrin.h>
+
+static inline void volk_32fc_s32f_qam_llr_32f_u_avx(float* llrs,
+                                                    const lv_32fc_t* symbols,
+                                                    const float noiseVariance,
+                                                    unsigned int bitsPerSymbol,
+                                                    unsigned int num_points)
+{
+    volk_32fc_qam_llr_axis_t axis;
+    const unsigned int quarterPoints = num_points / 4;
+    const __m256 signMask = _mm256_set1_ps(-0.f);
+    const __m256 one = _mm256_set1_ps(1.f);
+    const __m256 oneHalf = _mm256_set1_ps(0.5f);
+    __m256 invSpacing, maxLevel, scale;
+    __m256 u, r, level, nearest, diff, llr, region, half, boundary, flipped;
+    __m128 low, high;
+    unsigned int number, k;
+
+    volk_32fc_qam_llr_setup(&axis, bitsPerSymbol, noiseVariance);
+    invSpacing = _mm256_set1_ps(axis.invSpacing);
+    maxLevel = _mm256_set1_ps(axis.maxLevel);
+    scale = _mm256_set1_ps(axis.scale);
+
+    for (number = 0; number < quarterPoints; number++) {
+        u = _mm256_mul_ps(_mm256_loadu_ps((const float*)symbols), invSpacing);
+        r = _mm256_andnot_ps(signMask, u);
+        level = _mm256_floor_ps(_mm256_min_ps(_mm256_mul_ps(r, oneHalf), maxLevel));
+        nearest = _mm256_add_ps(_mm256_add_ps(level, level), one);
+        diff = _mm256_mul_ps(
+            _mm256_add_ps(nearest, one),
+            _mm256_sub_ps(_mm256_add_ps(r, r), _mm256_sub_ps(nearest, one)));
+        llr = _mm256_or_ps(_mm256_andnot_ps(signMask, diff),
+                           _mm256_and_ps(signMask, u));
+        llr = _mm256_mul_ps(llr, scale);
+        if (axis.bits == 1) {
+            _mm256_storeu_ps(llrs, llr);
+            symbols += 4;
+            llrs += 4 * bitsPerSymbol;
+            continue;
+        }
+
+        region = u;
+        for (k = 0; k < axis.bits; k++) {
+            if (k > 0) {
+                half = _mm256_set1_ps(axis.half[k]);
+                region = _mm256_sub_ps(half, _mm256_andnot_ps(signMask, region));
+                boundary = _mm256_min_ps(
+                    _mm256_mul_ps(r, _mm256_set1_ps(axis.invWidth[k])),
+                    _mm256_set1_ps(axis.maxBoundary[k]));
+                boundary = _mm256_floor_ps(boundary);
+                boundary = _mm256_add_ps(
+                    _mm256_mul_ps(boundary, _mm256_add_ps(half, half)), half);
+                flipped = _mm256_blendv_ps(_mm256_sub_ps(boundary, one),
+                                           _mm256_add_ps(boundary, one),
+                                           _mm256_cmp_ps(r, boundary, _CMP_LT_OQ));
+                diff = _mm256_mul_ps(_mm256_sub_ps(nearest, flipped),
+                                     _mm256_sub_ps(_mm256_add_ps(r, r),
+                                                   _mm256_add_ps(nearest, flipped)));
+                llr = _mm256_or_ps(_mm256_andnot_ps(signMask, diff),
+                                   _mm256_and_ps(signMask, region));
+                llr = _mm256_mul_ps(llr, scale);
+            }
+            low = _mm256_castps256_ps128(llr);
+            high = _mm256_extractf128_ps(llr, 1);
+            _mm_storel_pi((__m64*)(llrs + 2 * k), low);
+            _mm_storeh_pi((__m64*)(llrs + bitsPerSymbol + 2 * k), low);
+            _mm_storel_pi((__m64*)(llrs + 2 * bitsPerSymbol + 2 * k), high);
+            _mm_storeh_pi((__m64*)(llrs + 3 * bitsPerSymbol + 2 * k), high);
+        }
+        symbols += 4;
+        llrs += 4 * bitsPerSymbol;
+    }
+
+    for (number = quarterPoints * 4; number < num_points; number++) {
+        volk_32fc_qam_llr_symbol(llrs, symbols++, &axis);
+        llrs += bitsPerSymbol;
+    }
+}
+
+#endif /* LV_HAVE_AVX */
+
+
+#ifdef LV_HAVE_AVX512F
+#include <immintrin.h>
+
+static inline void volk_32fc_s32f_qam_llr_32f_u_avx512f(float* llrs,
+                                                        const lv_32fc_t* symbols,
+                                                        const float noiseVariance,
+                                                        unsigned int bitsPerSymbol,
+                                                        unsigned int num_points)
+{
+    volk_32fc_qam_llr_axis_t axis;
+    const unsigned int eighthPoints = num_points / 8;
+    const __m512i absMask = _mm512_set1_epi32(0x7fffffff);
+    const __m512 one = _mm512_set1_ps(1.f);
+    const __m512 oneHalf = _mm512_set1_ps(0.5f);
+    __m512 invSpacing, maxLevel, scale;
+    __m512 u, r, level, nearest, diff, llr, region, half, boundary, flipped;
+    __m256i symbolOffsets, offsets;
+    unsigned int number, k;
+
+    volk_32fc_qam_llr_setup(&axis, bitsPerSymbol, noiseVariance);
+    invSpacing = _mm512_set1_ps(axis.invSpacing);
+    maxLevel = _mm512_set1_ps(axis.maxLevel);
+    scale = _mm512_set1_ps(axis.scale);
+    // offsets of the LLR pairs of eight symbols in units of two floats
+    symbolOffsets = _mm256_mullo_epi32(_mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7),
+                                       _mm256_set1_epi32(axis.bits));
+
+    for (number = 0; number < eighthPoints; number++) {
+        u = _mm512_mul_ps(_mm512_loadu_ps((const float*)symbols), invSpacing);
+        r = _mm512_castsi512_ps(_mm512_and_epi32(_mm512_castps_si512(u), absMask));
+        level = _mm512_roundscale_ps(_mm512_min_ps(_mm512_mul_ps(r, oneHalf), maxLevel),
+                                     _MM_FROUND_TO_NEG_INF);
+        nearest = _mm512_add_ps(_mm512_add_ps(level, level), one);
+        diff = _mm512_mul_ps(
+            _mm512_add_ps(nearest, one),
+            _mm512_sub_ps(_mm512_add_ps(r, r), _mm512_sub_ps(nearest, one)));
+        // magnitude of diff with the sign of u
+        llr = _mm512_castsi512_ps(_mm512_ternarylogic_epi32(
+            _mm512_castps_si512(diff), _mm512_castps_si512(u), absMask, 0xe4));
+        llr = _mm512_mul_ps(llr, scale);
+        if (axis.bits == 1) {
+            _mm512_storeu_ps(llrs, llr);
+            symbols += 8;
+            llrs += 8 * bitsPerSymbol;
+            continue;
+        }
+
+        region = u;
+        offsets = symbolOffsets;
+        for (k = 0; k < axis.bits; k++) {
+            if (k > 0) {
+                half = _mm512_set1_ps(axis.half[k]);
+                region = _mm512_sub_ps(
+                    half,
+                    _mm512_castsi512_ps(
+                        _mm512_and_epi32(_mm512_castps_si512(region), absMask)));
+                boundary = _mm512_min_ps(
+                    _mm512_mul_ps(r, _mm512_set1_ps(axis.invWidth[k])),
+                    _mm512_set1_ps(axis.maxBoundary[k]));
+                boundary = _mm512_roundscale_ps(boundary, _MM_FROUND_TO_NEG_INF);
+                boundary = _mm512_add_ps(
+                    _mm512_mul_ps(boundary, _mm512_add_ps(half, half)), half);
+                flipped = _mm512_mask_blend_ps(
+                    _mm512_cmp_ps_mask(r, boundary, _CMP_LT_OQ),
+                    _mm512_sub_ps(boundary, one),
+                    _mm512_add_ps(boundary, one));
+                diff = _mm512_mul_ps(_mm512_sub_ps(nearest, flipped),
+                                     _mm512_sub_ps(_mm512_add_ps(r, r),
+                                                   _mm512_add_ps(nearest, flipped)));
+                llr = _mm512_castsi512_ps(
+                    _mm512_ternarylogic_epi32(_mm512_castps_si512(diff),
+                                              _mm512_castps_si512(region),
+                                              absMask,
+                                              0xe4));
+                llr = _mm512_mul_ps(llr, scale);
+                offsets = _mm256_add_epi32(offsets, _mm256_set1_epi32(1));
+            }
+            _mm512_i32scatter_pd(llrs, offsets, _mm512_castps_pd(llr), 8);
+        }
+        symbols += 8;
+        llrs += 8 * bitsPerSymbol;
+    }
+
+    for (number = eighthPoints * 8; number < num_points; number++) {
+        volk_32fc_qam_llr_symbol(llrs, symbols++, &axis);
+        llrs += bitsPerSymbol;
+    }
+}
+
+#endif /* LV_HAVE_AVX512F */
+
+
+#ifdef LV_HAVE_NEON
+#include <arm_neon.h>
+
+static inline void volk_32fc_s32f_qam_llr_32f_neon(float* llrs,
+                                                   const lv_32fc_t* symbols,
+                                                   const float noiseVariance,
+                                                   unsigned int bitsPerSymbol,
+                                                   unsigned int num_points)
+{
+    volk_32fc_qam_llr_axis_t axis;
+    const unsigned int halfPoints = num_points / 2;
+    const uint32x4_t signMask = vdupq_n_u32(0x80000000);
+    const float32x4_t one = vdupq_n_f32(1.f);
+    const float32x4_t oneHalf = vdupq_n_f32(0.5f);
+    float32x4_t invSpacing, maxLevel, scale;
+    float32x4_t u, r, level, nearest, diff, llr, region, half, boundary, flipped;
+    unsigned int number, k;
+
+    volk_32fc_qam_llr_setup(&axis, bitsPerSymbol, noiseVariance);
+    invSpacing = vdupq_n_f32(axis.invSpacing);
+    maxLevel = vdupq_n_f32(axis.maxLevel);
+    scale = vdupq_n_f32(axis.scale);
+
+    for (number = 0; number < halfPoints; number++) {
+        u = vmulq_f32(vld1q_f32((const float*)symbols), invSpacing);
+        r = vabsq_f32(u);
+        // truncation is the floor of the non-negative level
+        level = vcvtq_f32_u32(vcvtq_u32_f32(vminq_f32(vmulq_f32(r, oneHalf), maxLevel)));
+        nearest = vaddq_f32(vaddq_f32(level, level), one);
+        diff = vmulq_f32(vaddq_f32(nearest, one),
+                         vsubq_f32(vaddq_f32(r, r), vsubq_f32(nearest, one)));
+        llr = vmulq_f32(vbslq_f32(signMask, u, vabsq_f32(diff)), scale);
+        if (axis.bits == 1) {
+            vst1q_f32(llrs, llr);
+            symbols += 2;
+            llrs += 2 * bitsPerSymbol;
+            continue;
+        }
+
+        region = u;
+        for (k = 0; k < axis.bits; k++) {
+            if (k > 0) {
+                half = vdupq_n_f32(axis.half[k]);
+                region = vsubq_f32(half, vabsq_f32(region));
+                boundary = vminq_f32(vmulq_f32(r, vdupq_n_f32(axis.invWidth[k])),
+                                     vdupq_n_f32(axis.maxBoundary[k]));
+                boundary = vcvtq_f32_u32(vcvtq_u32_f32(boundary));
+                boundary = vaddq_f32(vmulq_f32(boundary, vaddq_f32(half, half)), half);
+                flipped = vbslq_f32(vcltq_f32(r, boundary),
+                                    vaddq_f32(boundary, one),
+                                    vsubq_f32(boundary, one));
+                diff = vmulq_f32(vsubq_f32(nearest, flipped),
+                                 vsubq_f32(vaddq_f32(r, r), vaddq_f32(nearest, flipped)));
+                llr = vmulq_f32(vbslq_f32(signMask, region, vabsq_f32(diff)), scale);
+            }
+            vst1_f32(llrs + 2 * k, vget_low_f32(llr));
+            vst1_f32(llrs + bitsPerSymbol + 2 * k, vget_high_f32(llr));
+        }
+        symbols += 2;
+        llrs += 2 * bitsPerSymbol;
+    }
+
+    for (number = halfPoints * 2; number < num_points; number++) {
+        volk_32fc_qam_llr_symbol(llrs, symbols++, &axis);
+        llrs += bitsPerSymbol;
+    }
+}
+
+#endif /* LV_HAVE_NEON */
+
+#endif /* INCLUDED_volk_32fc_s32f_qam_llr_32f_u_H */
@@ -0,0 +1,257 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2026 Free Software Foundation, Inc.
+ *
+ * This file is part of VOLK
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+/*!
+ * \page volk_32fc_s32f_qam_slicer_32fc
+ *
+ * \b Overview
+ *
+ * Hard decision slicer returning the nearest constellation point for QPSK,
+ * 8PSK, 16QAM, 64QAM or 256QAM, selected by 2, 3, 4, 6 or 8 bits per symbol.
+ * This is the decision of a decision-directed loop, for example the reference
+ * of an equalizer error.
+ *
+ * The constellations are the ones of volk_32fc_s32f_qam_slicer_8u, scaled by
+ * the given amplitude.
+ *
+ * <b>Dispatcher Prototype</b>
+ * \code
+ * void volk_32fc_s32f_qam_slicer_32fc(lv_32fc_t* points, const lv_32fc_t* symbols,
+ *                                     const float scale, unsigned int bitsPerSymbol,
+ *                                     unsigned int num_points)
+ * \endcode
+ *
+ * \b Inputs
+ * \li symbols: the received symbols.
+ * \li scale: the amplitude of the constellation, 1 for unit average energy.
+ * \li bitsPerSymbol: 2, 3, 4, 6 or 8.
+ * \li num_points: the number of symbols.
+ *
+ * \b Outputs
+ * \li points: the nearest constellation point per symbol.
+ *
+ * \b Example
+ * Slice a noisy QPSK symbol.
+ * \code
+ *   unsigned int N = 1;
+ *   unsigned int alignment = volk_get_alignment();
+ *   lv_32fc_t* in = (lv_32fc_t*)volk_malloc(sizeof(lv_32fc_t) * N, alignment);
+ *   lv_32fc_t* out = (lv_32fc_t*)volk_malloc(sizeof(lv_32fc_t) * N, alignment);
+ *
+ *   in[0] = lv_cmake(0.3f, -0.9f);
+ *
+ *   volk_32fc_s32f_qam_slicer_32fc(out, in, 1.f, 2, N); // out[0] == (0.707, -0.707)
+ *
+ *   volk_free(in);
+ *   volk_free(out);
+ * \endcode
+ */
+
+#ifndef INCLUDED_volk_32fc_s32f_qam_slicer_32fc_u_H
+#define INCLUDED_volk_32fc_s32f_qam_slicer_32fc_u_H
+
+#include <volk/volk_32fc_s32f_qam_slicer_8u.h>
+
+static inline lv_32fc_t volk_32fc_slicer_point(const lv_32fc_t* symbol,
+                                               const volk_32fc_slicer_t* slicer)
+{
+    unsigned int k;
+
+    if (slicer->axisBits == 0) {
+        k = volk_32fc_slicer_psk_point(lv_creal(*symbol), lv_cimag(*symbol));
+        return lv_cmake(slicer->pskReal[k], slicer->pskImag[k]);
+    }
+    return lv_cmake(volk_32fc_slicer_level(lv_creal(*symbol), slicer) * slicer->spacing,
+                    volk_32fc_slicer_level(lv_cimag(*symbol), slicer) * slicer->spacing);
+}
+
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void volk_32fc_s32f_qam_slicer_32fc_generic(lv_32fc_t* points,
+                                                          const lv_32fc_t* symbols,
+                                                          const float scale,
+                                                          unsigned int bitsPerSymbol,
+                                                          unsigned int num_points)
+{
+    volk_32fc_slicer_t slicer;
+    unsigned int number;
+
+    volk_32fc_slicer_setup(&slicer, bitsPerSymbol, scale);
+    for (number = 0; number < num_points; number++) {
+        *points++ = volk_32fc_slicer_point(symbols++, &slicer);
+    }
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+
+#ifdef LV_HAVE_AVX2
+#include <immintrin.h>
+
+static inline void volk_32fc_s32f_qam_slicer_32fc_u_avx2(lv_32fc_t* points,
+                                                         const lv_32fc_t* symbols,
+                                                         const float scale,
+                                                         unsigned int bitsPerSymbol,
+                                                         unsigned int num_points)
+{
+    volk_32fc_slicer_t slicer;
+    const unsigned int eighthPoints = num_points / 8;
+    const __m256 zero = _mm256_setzero_ps();
+    const __m256 signMask = _mm256_set1_ps(-0.f);
+    const __m256 one = _mm256_set1_ps(1.f);
+    const __m256 oneHalf = _mm256_set1_ps(0.5f);
+    const __m256 tanPi8 = _mm256_set1_ps(VOLK_SLICER_TAN_PI_8);
+    const __m256i four = _mm256_set1_epi32(4);
+    const __m256i eight = _mm256_set1_epi32(8);
+    const __m256i seven = _mm256_set1_epi32(7);
+    __m256 invSpacing, spacing, maxLevel, pskReal, pskImag;
+    __m256 cplx0, cplx1, x, y, ax, ay, re, im, level;
+    __m256i k;
+    unsigned int number;
+
+    volk_32fc_slicer_setup(&slicer, bitsPerSymbol, scale);
+    invSpacing = _mm256_set1_ps(slicer.invSpacing);
+    spacing = _mm256_set1_ps(slicer.spacing);
+    maxLevel = _mm256_set1_ps(slicer.maxLevel);
+    pskReal = _mm256_loadu_ps(slicer.pskReal);
+    pskImag = _mm256_loadu_ps(slicer.pskImag);
+
+    for (number = 0; number < eighthPoints; number++) {
+        cplx0 = _mm256_loadu_ps((const float*)symbols);
+        cplx1 = _mm256_loadu_ps((const float*)(symbols + 4));
+
+        if (slicer.axisBits == 0) {
+            // the parts of symbols 0, 1, 4, 5, 2, 3, 6, 7
+            x = _mm256_shuffle_ps(cplx0, cplx1, 0x88);
+            y = _mm256_shuffle_ps(cplx0, cplx1, 0xdd);
+            ax = _mm256_andnot_ps(signMask, x);
+            ay = _mm256_andnot_ps(signMask, y);
+            k = _mm256_add_epi32(
+                _mm256_castps_si256(
+                    _mm256_cmp_ps(ay, _mm256_mul_ps(tanPi8, ax), _CMP_GE_OQ)),
+                _mm256_castps_si256(
+                    _mm256_cmp_ps(ax, _mm256_mul_ps(tanPi8, ay), _CMP_LT_OQ)));
+            k = _mm256_sub_epi32(_mm256_setzero_si256(), k);
+            k = _mm256_blendv_epi8(
+                k,
+                _mm256_sub_epi32(four, k),
+                _mm256_castps_si256(_mm256_cmp_ps(x, zero, _CMP_LT_OQ)));
+            k = _mm256_blendv_epi8(
+                k,
+                _mm256_and_si256(_mm256_sub_epi32(eight, k), seven),
+                _mm256_castps_si256(_mm256_cmp_ps(y, zero, _CMP_LT_OQ)));
+
+            // interleaving restores the symbol order
+            re = _mm256_permutevar8x32_ps(pskReal, k);
+            im = _mm256_permutevar8x32_ps(pskImag, k);
+            cplx0 = _mm256_unpacklo_ps(re, im);
+            cplx1 = _mm256_unpackhi_ps(re, im);
+        } else {
+            level = _mm256_andnot_ps(signMask, _mm256_mul_ps(cplx0, invSpacing));
+            level = _mm256_floor_ps(_mm256_mul_ps(level, oneHalf));
+            level = _mm256_min_ps(_mm256_add_ps(_mm256_add_ps(level, level), one),
+                                  maxLevel);
+            level = _mm256_or_ps(level, _mm256_and_ps(signMask, cplx0));
+            cplx0 = _mm256_mul_ps(level, spacing);
+            level = _mm256_andnot_ps(signMask, _mm256_mul_ps(cplx1, invSpacing));
+            level = _mm256_floor_ps(_mm256_mul_ps(level, oneHalf));
+            level = _mm256_min_ps(_mm256_add_ps(_mm256_add_ps(level, level), one),
+                                  maxLevel);
+            level = _mm256_or_ps(level, _mm256_and_ps(signMask, cplx1));
+            cplx1 = _mm256_mul_ps(level, spacing);
+        }
+
+        _mm256_storeu_ps((float*)points, cplx0);
+        _mm256_storeu_ps((float*)(points + 4), cplx1);
+        symbols += 8;
+        points += 8;
+    }
+
+    for (number = eighthPoints * 8; number < num_points; number++) {
+        *points++ = volk_32fc_slicer_point(symbols++, &slicer);
+    }
+}
+
+#endif /* LV_HAVE_AVX2 */
+
+
+#ifdef LV_HAVE_NEON
+#include <arm_neon.h>
+
+static inline void volk_32fc_s32f_qam_slicer_32fc_neon(lv_32fc_t* points,
+                                                       const lv_32fc_t* symbols,
+                                                       const float scale,
+                                                       unsigned int bitsPerSymbol,
+                                                       unsigned int num_points)
+{
+    volk_32fc_slicer_t slicer;
+    const unsigned int quarterPoints = num_points / 4;
+    const float32x4_t zero = vdupq_n_f32(0.f);
+    const float32x4_t one = vdupq_n_f32(1.f);
+    const float32x4_t oneHalf = vdupq_n_f32(0.5f);
+    const float32x4_t tanPi8 = vdupq_n_f32(VOLK_SLICER_TAN_PI_8);
+    const uint32x4_t signMask = vdupq_n_u32(0x80000000);
+    float32x4_t invSpacing, spacing, maxLevel, axis, diagonal, ax, ay, level;
+    float32x4x2_t cplx;
+    uint32x4_t nearAxisI, nearAxisQ, re, im;
+    unsigned int number, part;
+
+    volk_32fc_slicer_setup(&slicer, bitsPerSymbol, scale);
+    invSpacing = vdupq_n_f32(slicer.invSpacing);
+    spacing = vdupq_n_f32(slicer.spacing);
+    maxLevel = vdupq_n_f32(slicer.maxLevel);
+    axis = vdupq_n_f32(slicer.pskReal[0]);
+    diagonal = vdupq_n_f32(slicer.pskReal[1]);
+
+    for (number = 0; number < quarterPoints; number++) {
+        cplx = vld2q_f32((const float*)symbols);
+
+        if (slicer.axisBits == 0) {
+            // the first quadrant point, mirrored into the quadrant of the symbol
+            ax = vabsq_f32(cplx.val[0]);
+            ay = vabsq_f32(cplx.val[1]);
+            nearAxisI = vcltq_f32(ay, vmulq_f32(tanPi8, ax));
+            nearAxisQ = vcltq_f32(ax, vmulq_f32(tanPi8, ay));
+            re = vbslq_u32(nearAxisQ,
+                           vdupq_n_u32(0),
+                           vreinterpretq_u32_f32(diagonal));
+            re = vbslq_u32(nearAxisI, vreinterpretq_u32_f32(axis), re);
+            im = vbslq_u32(nearAxisI,
+                           vdupq_n_u32(0),
+                           vreinterpretq_u32_f32(diagonal));
+            im = vbslq_u32(nearAxisQ, vreinterpretq_u32_f32(axis), im);
+            re = veorq_u32(re, vandq_u32(vcltq_f32(cplx.val[0], zero), signMask));
+            im = veorq_u32(im, vandq_u32(vcltq_f32(cplx.val[1], zero), signMask));
+            cplx.val[0] = vreinterpretq_f32_u32(re);
+            cplx.val[1] = vreinterpretq_f32_u32(im);
+        } else {
+            for (part = 0; part < 2; part++) {
+                // truncation is the floor of the non-negative level
+                level = vabsq_f32(vmulq_f32(cplx.val[part], invSpacing));
+                level = vcvtq_f32_u32(vcvtq_u32_f32(vmulq_f32(level, oneHalf)));
+                level = vminq_f32(vaddq_f32(vaddq_f32(level, level), one), maxLevel);
+                level = vbslq_f32(signMask, cplx.val[part], level);
+                cplx.val[part] = vmulq_f32(level, spacing);
+            }
+        }
+
+        vst2q_f32((float*)points, cplx);
+        symbols += 4;
+        points += 4;
+    }
+
+    for (number = quarterPoints * 4; number < num_points; number++) {
+        *points++ = volk_32fc_slicer_point(symbols++, &slicer);
+    }
+}
+
+#endif /* LV_HAVE_NEON */
+
+#endif /* INCLUDED_volk_32fc_s32f_qam_slicer_32fc_u_H */
@@ -0,0 +1,363 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2026 Free Software Foundation, Inc.
+ *
+ * This file is part of VOLK
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+/*!
+ * \page volk_32fc_s32f_qam_slicer_8u
+ *
+ * \b Overview
+ *
+ * Hard decision slicer returning the index of the nearest constellation point
+ * for QPSK, 8PSK, 16QAM, 64QAM or 256QAM, selected by 2, 3, 4, 6 or 8 bits
+ * per symbol.
+ *
+ * The square QAM constellations are Gray-mapped with unit average energy as
+ * in volk_32fc_s32f_qam_llr_32f. The index holds bit 0 of that kernel in its
+ * most significant bit, so it matches the signs of the LLRs. 8PSK has its
+ * points at angles k * pi / 4 on the unit circle, with the Gray index
+ * k ^ (k >> 1).
+ *
+ * The constellation is scaled by the given amplitude before slicing, so
+ * received symbols do not have to be normalized first.
+ *
+ * <b>Dispatcher Prototype</b>
+ * \code
+ * void volk_32fc_s32f_qam_slicer_8u(uint8_t* indices, const lv_32fc_t* symbols,
+ *                                   const float scale, unsigned int bitsPerSymbol,
+ *                                   unsigned int num_points)
+ * \endcode
+ *
+ * \b Inputs
+ * \li symbols: the received symbols.
+ * \li scale: the amplitude of the constellation, 1 for unit average energy.
+ * \li bitsPerSymbol: 2, 3, 4, 6 or 8.
+ * \li num_points: the number of symbols.
+ *
+ * \b Outputs
+ * \li indices: the index of the nearest constellation point per symbol.
+ *
+ * \b Example
+ * Slice a noisy 16QAM point.
+ * \code
+ *   unsigned int N = 1;
+ *   unsigned int alignment = volk_get_alignment();
+ *   lv_32fc_t* in = (lv_32fc_t*)volk_malloc(sizeof(lv_32fc_t) * N, alignment);
+ *   uint8_t* out = (uint8_t*)volk_malloc(sizeof(uint8_t) * N, alignment);
+ *
+ *   in[0] = lv_cmake(2.8f, -1.1f) / sqrtf(10.f);
+ *
+ *   volk_32fc_s32f_qam_slicer_8u(out, in, 1.f, 4, N); // out[0] == 0x6
+ *
+ *   volk_free(in);
+ *   volk_free(out);
+ * \endcode
+ */
+
+#ifndef INCLUDED_volk_32fc_s32f_qam_slicer_8u_u_H
+#define INCLUDED_volk_32fc_s32f_qam_slicer_8u_u_H
+
+#include <inttypes.h>
+#include <math.h>
+#include <volk/volk_complex.h>
+
+/* tan(pi / 8), the 8PSK decision boundary next to each axis */
+#define VOLK_SLICER_TAN_PI_8 0.41421356f
+
+typedef struct volk_32fc_slicer {
+    unsigned int axisBits; //!< QAM bits per axis, 0 for 8PSK
+    float invSpacing;      //!< converts to odd integer QAM levels
+    float spacing;         //!< converts odd integer QAM levels back
+    float maxLevel;        //!< largest QAM level
+    float pskReal[8];      //!< 8PSK points
+    float pskImag[8];
+} volk_32fc_slicer_t;
+
+static inline void volk_32fc_slicer_setup(volk_32fc_slicer_t* slicer,
+                                          unsigned int bitsPerSymbol,
+                                          float scale)
+{
+    const unsigned int axisBits = (bitsPerSymbol == 3) ? 0 : bitsPerSymbol / 2;
+    const float levels = (float)(1u << axisBits);
+    const float diagonal = 0.70710678f * scale;
+    const float a = scale / sqrtf(2.f * (levels * levels - 1.f) / 3.f);
+    const float real[8] = { scale,  diagonal,  0.f,    -diagonal,
+                            -scale, -diagonal, 0.f,    diagonal };
+    const float imag[8] = { 0.f, diagonal,  scale,  diagonal,
+                            0.f, -diagonal, -scale, -diagonal };
+    unsigned int k;
+
+    slicer->axisBits = axisBits;
+    slicer->invSpacing = 1.f / a;
+    slicer->spacing = a;
+    slicer->maxLevel = levels - 1.f;
+    for (k = 0; k < 8; k++) {
+        slicer->pskReal[k] = real[k];
+        slicer->pskImag[k] = imag[k];
+    }
+}
+
+/* Nearest QAM level of one axis as a signed odd integer */
+static inline float volk_32fc_slicer_level(float y, const volk_32fc_slicer_t* slicer)
+{
+    float level = floorf(fabsf(y * slicer->invSpacing) * 0.5f);
+    level = level + level + 1.f;
+    level = (level < slicer->maxLevel) ? level : slicer->maxLevel;
+    return copysignf(level, y);
+}
+
+/* Gray bits of a QAM level, the sign in the most significant bit */
+static inline unsigned int volk_32fc_slicer_level_bits(float level,
+                                                       unsigned int axisBits)
+{
+    unsigned int bits = (level < 0.f);
+    unsigned int k;
+
+    for (k = 1; k < axisBits; k++) {
+        level = (float)(1u << (axisBits - k)) - fabsf(level);
+        bits = (bits << 1) | (level < 0.f);
+    }
+    return bits;
+}
+
+/* Number k of the nearest 8PSK point at angle k * pi / 4 */
+static inline unsigned int volk_32fc_slicer_psk_point(float x, float y)
+{
+    const float ax = fabsf(x);
+    const float ay = fabsf(y);
+    unsigned int k = (ay >= VOLK_SLICER_TAN_PI_8 * ax) + (ax < VOLK_SLICER_TAN_PI_8 * ay);
+
+    k = (x < 0.f) ? 4 - k : k;
+    return (y < 0.f) ? (8 - k) & 7 : k;
+}
+
+static inline uint8_t volk_32fc_slicer_index(const lv_32fc_t* symbol,
+                                             const volk_32fc_slicer_t* slicer)
+{
+    unsigned int bitsI, bitsQ, index, k;
+
+    if (slicer->axisBits == 0) {
+        k = volk_32fc_slicer_psk_point(lv_creal(*symbol), lv_cimag(*symbol));
+        return (uint8_t)(k ^ (k >> 1));
+    }
+
+    bitsI = volk_32fc_slicer_level_bits(
+        volk_32fc_slicer_level(lv_creal(*symbol), slicer), slicer->axisBits);
+    bitsQ = volk_32fc_slicer_level_bits(
+        volk_32fc_slicer_level(lv_cimag(*symbol), slicer), slicer->axisBits);
+    index = 0;
+    for (k = slicer->axisBits; k > 0; k--) {
+        index = (index << 2) | (((bitsI >> (k - 1)) & 1) << 1) | ((bitsQ >> (k - 1)) & 1);
+    }
+    return (uint8_t)index;
+}
+
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void volk_32fc_s32f_qam_slicer_8u_generic(uint8_t* indices,
+                                                        const lv_32fc_t* symbols,
+                                                        const float scale,
+                                                        unsigned int bitsPerSymbol,
+                                                        unsigned int num_points)
+{
+    volk_32fc_slicer_t slicer;
+    unsigned int number;
+
+    volk_32fc_slicer_setup(&slicer, bitsPerSymbol, scale);
+    for (number = 0; number < num_points; number++) {
+        *indices++ = volk_32fc_slicer_index(symbols++, &slicer);
+    }
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+
+#ifdef LV_HAVE_AVX2
+#include <immintrin.h>
+
+static inline void volk_32fc_s32f_qam_slicer_8u_u_avx2(uint8_t* indices,
+                                                       const lv_32fc_t* symbols,
+                                                       const float scale,
+                                                       unsigned int bitsPerSymbol,
+                                                       unsigned int num_points)
+{
+    volk_32fc_slicer_t slicer;
+    const unsigned int eighthPoints = num_points / 8;
+    const __m256 zero = _mm256_setzero_ps();
+    const __m256 signMask = _mm256_set1_ps(-0.f);
+    const __m256 one = _mm256_set1_ps(1.f);
+    const __m256 oneHalf = _mm256_set1_ps(0.5f);
+    const __m256 tanPi8 = _mm256_set1_ps(VOLK_SLICER_TAN_PI_8);
+    const __m256i four = _mm256_set1_epi32(4);
+    const __m256i eight = _mm256_set1_epi32(8);
+    const __m256i seven = _mm256_set1_epi32(7);
+    const __m256i lowBytes = _mm256_setr_epi8(0, 4, 8, 12, -1, -1, -1, -1,
+                                              -1, -1, -1, -1, -1, -1, -1, -1,
+                                              0, 4, 8, 12, -1, -1, -1, -1,
+                                              -1, -1, -1, -1, -1, -1, -1, -1);
+    __m256 invSpacing, maxLevel, cplx0, cplx1, x, y, ax, ay, levelI, levelQ, half;
+    __m256i k, index, bitI, bitQ;
+    __m128i packed;
+    unsigned int number, bit;
+
+    volk_32fc_slicer_setup(&slicer, bitsPerSymbol, scale);
+    invSpacing = _mm256_set1_ps(slicer.invSpacing);
+    maxLevel = _mm256_set1_ps(slicer.maxLevel);
+
+    for (number = 0; number < eighthPoints; number++) {
+        cplx0 = _mm256_loadu_ps((const float*)symbols);
+        cplx1 = _mm256_loadu_ps((const float*)(symbols + 4));
+        // the parts of symbols 0, 1, 4, 5, 2, 3, 6, 7
+        x = _mm256_shuffle_ps(cplx0, cplx1, 0x88);
+        y = _mm256_shuffle_ps(cplx0, cplx1, 0xdd);
+
+        if (slicer.axisBits == 0) {
+            ax = _mm256_andnot_ps(signMask, x);
+            ay = _mm256_andnot_ps(signMask, y);
+            k = _mm256_add_epi32(
+                _mm256_castps_si256(
+                    _mm256_cmp_ps(ay, _mm256_mul_ps(tanPi8, ax), _CMP_GE_OQ)),
+                _mm256_castps_si256(
+                    _mm256_cmp_ps(ax, _mm256_mul_ps(tanPi8, ay), _CMP_LT_OQ)));
+            k = _mm256_sub_epi32(_mm256_setzero_si256(), k);
+            k = _mm256_blendv_epi8(
+                k,
+                _mm256_sub_epi32(four, k),
+                _mm256_castps_si256(_mm256_cmp_ps(x, zero, _CMP_LT_OQ)));
+            k = _mm256_blendv_epi8(
+                k,
+                _mm256_and_si256(_mm256_sub_epi32(eight, k), seven),
+                _mm256_castps_si256(_mm256_cmp_ps(y, zero, _CMP_LT_OQ)));
+            index = _mm256_xor_si256(k, _mm256_srli_epi32(k, 1));
+        } else {
+            levelI = _mm256_andnot_ps(signMask, _mm256_mul_ps(x, invSpacing));
+            levelI = _mm256_floor_ps(_mm256_mul_ps(levelI, oneHalf));
+            levelI = _mm256_min_ps(_mm256_add_ps(_mm256_add_ps(levelI, levelI), one),
+                                   maxLevel);
+            levelI = _mm256_or_ps(levelI, _mm256_and_ps(signMask, x));
+            levelQ = _mm256_andnot_ps(signMask, _mm256_mul_ps(y, invSpacing));
+            levelQ = _mm256_floor_ps(_mm256_mul_ps(levelQ, oneHalf));
+            levelQ = _mm256_min_ps(_mm256_add_ps(_mm256_add_ps(levelQ, levelQ), one),
+                                   maxLevel);
+            levelQ = _mm256_or_ps(levelQ, _mm256_and_ps(signMask, y));
+
+            index = _mm256_setzero_si256();
+            for (bit = 0; bit < slicer.axisBits; bit++) {
+                if (bit > 0) {
+                    half = _mm256_set1_ps((float)(1u << (slicer.axisBits - bit)));
+                    levelI = _mm256_sub_ps(half, _mm256_andnot_ps(signMask, levelI));
+                    levelQ = _mm256_sub_ps(half, _mm256_andnot_ps(signMask, levelQ));
+                }
+                bitI = _mm256_srli_epi32(_mm256_castps_si256(levelI), 31);
+                bitQ = _mm256_srli_epi32(_mm256_castps_si256(levelQ), 31);
+                index = _mm256_or_si256(
+                    _mm256_slli_epi32(index, 2),
+                    _mm256_or_si256(_mm256_slli_epi32(bitI, 1), bitQ));
+            }
+        }
+
+        index = _mm256_shuffle_epi8(index, lowBytes);
+        packed = _mm_unpacklo_epi16(_mm256_castsi256_si128(index),
+                                    _mm256_extracti128_si256(index, 1));
+        _mm_storel_epi64((__m128i*)indices, packed);
+        symbols += 8;
+        indices += 8;
+    }
+
+    for (number = eighthPoints * 8; number < num_points; number++) {
+        *indices++ = volk_32fc_slicer_index(symbols++, &slicer);
+    }
+}
+
+#endif /* LV_HAVE_AVX2 */
+
+
+#ifdef LV_HAVE_NEON
+#include <arm_neon.h>
+
+static inline void volk_32fc_s32f_qam_slicer_8u_neon(uint8_t* indices,
+                                                     const lv_32fc_t* symbols,
+                                                     const float scale,
+                                                     unsigned int bitsPerSymbol,
+                                                     unsigned int num_points)
+{
+    volk_32fc_slicer_t slicer;
+    const unsigned int eighthPoints = num_points / 8;
+    const float32x4_t zero = vdupq_n_f32(0.f);
+    const float32x4_t one = vdupq_n_f32(1.f);
+    const float32x4_t oneHalf = vdupq_n_f32(0.5f);
+    const float32x4_t tanPi8 = vdupq_n_f32(VOLK_SLICER_TAN_PI_8);
+    const uint32x4_t signMask = vdupq_n_u32(0x80000000);
+    const uint32x4_t four = vdupq_n_u32(4);
+    const uint32x4_t eight = vdupq_n_u32(8);
+    const uint32x4_t seven = vdupq_n_u32(7);
+    float32x4_t invSpacing, maxLevel, ax, ay, levelI, levelQ, half;
+    float32x4x2_t cplx;
+    uint32x4_t k, bitI, bitQ, index[2];
+    unsigned int number, part, bit;
+
+    volk_32fc_slicer_setup(&slicer, bitsPerSymbol, scale);
+    invSpacing = vdupq_n_f32(slicer.invSpacing);
+    maxLevel = vdupq_n_f32(slicer.maxLevel);
+
+    for (number = 0; number < eighthPoints; number++) {
+        for (part = 0; part < 2; part++) {
+            cplx = vld2q_f32((const float*)(symbols + 4 * part));
+
+            if (slicer.axisBits == 0) {
+                ax = vabsq_f32(cplx.val[0]);
+                ay = vabsq_f32(cplx.val[1]);
+                k = vaddq_u32(vcgeq_f32(ay, vmulq_f32(tanPi8, ax)),
+                              vcltq_f32(ax, vmulq_f32(tanPi8, ay)));
+                k = vsubq_u32(vdupq_n_u32(0), k);
+                k = vbslq_u32(vcltq_f32(cplx.val[0], zero), vsubq_u32(four, k), k);
+                k = vbslq_u32(vcltq_f32(cplx.val[1], zero),
+                              vandq_u32(vsubq_u32(eight, k), seven),
+                              k);
+                index[part] = veorq_u32(k, vshrq_n_u32(k, 1));
+                continue;
+            }
+
+            // truncation is the floor of the non-negative level
+            levelI = vabsq_f32(vmulq_f32(cplx.val[0], invSpacing));
+            levelI = vcvtq_f32_u32(vcvtq_u32_f32(vmulq_f32(levelI, oneHalf)));
+            levelI = vminq_f32(vaddq_f32(vaddq_f32(levelI, levelI), one), maxLevel);
+            levelI = vbslq_f32(signMask, cplx.val[0], levelI);
+            levelQ = vabsq_f32(vmulq_f32(cplx.val[1], invSpacing));
+            levelQ = vcvtq_f32_u32(vcvtq_u32_f32(vmulq_f32(levelQ, oneHalf)));
+            levelQ = vminq_f32(vaddq_f32(vaddq_f32(levelQ, levelQ), one), maxLevel);
+            levelQ = vbslq_f32(signMask, cplx.val[1], levelQ);
+
+            index[part] = vdupq_n_u32(0);
+            for (bit = 0; bit < slicer.axisBits; bit++) {
+                if (bit > 0) {
+                    half = vdupq_n_f32((float)(1u << (slicer.axisBits - bit)));
+                    levelI = vsubq_f32(half, vabsq_f32(levelI));
+                    levelQ = vsubq_f32(half, vabsq_f32(levelQ));
+                }
+                bitI = vshrq_n_u32(vreinterpretq_u32_f32(levelI), 31);
+                bitQ = vshrq_n_u32(vreinterpretq_u32_f32(levelQ), 31);
+                index[part] = vorrq_u32(vshlq_n_u32(index[part], 2),
+                                        vorrq_u32(vshlq_n_u32(bitI, 1), bitQ));
+            }
+        }
+
+        vst1_u8(indices,
+                vmovn_u16(vcombine_u16(vmovn_u32(index[0]), vmovn_u32(index[1]))));
+        symbols += 8;
+        indices += 8;
+    }
+
+    for (number = eighthPoints * 8; number < num_points; number++) {
+        *indices++ = volk_32fc_slicer_index(symbols++, &slicer);
+    }
+}
+
+#endif /* LV_HAVE_NEON */
+
+#endif /* INCLUDED_volk_32fc_s32f_qam_slicer_8u_u_H */
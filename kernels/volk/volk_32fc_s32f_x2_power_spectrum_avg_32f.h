@@ -0,0 +1,363 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2026 Free Software Foundation, Inc.
+ *
+ * This file is part of VOLK
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+/*!
+ * \page volk_32fc_s32f_x2_power_spectrum_avg_32f
+ *
+ * \b Overview
+ *
+ * Computes the power spectrum of a frame of FFT output in dB and folds it
+ * into an exponential average, in a single pass over the data:
+ *
+ * P[i] = 10 * log10(|X[i]|^2 / normalizationFactor^2)
+ *
+ * logPowerAvg[i] = logPowerAvg[i] + alpha * (P[i] - logPowerAvg[i])
+ *
+ * This replaces volk_32fc_s32f_power_spectrum_32f followed by a separate
+ * averaging pass. The logarithm is a polynomial approximation like in
+ * volk_32f_log2_32f, zero power is clamped to about -382 dB.
+ *
+ * <b>Dispatcher Prototype</b>
+ * \code
+ * void volk_32fc_s32f_x2_power_spectrum_avg_32f(float* logPowerAvg,
+ *                                               const lv_32fc_t* complexFFTInput,
+ *                                               const float normalizationFactor,
+ *                                               const float alpha,
+ *                                               unsigned int num_points)
+ * \endcode
+ *
+ * \b Inputs
+ * \li logPowerAvg: the running average in dB, updated in place.
+ * \li complexFFTInput: the FFT output of the current frame.
+ * \li normalizationFactor: the FFT output is divided by this before the power
+ * is calculated.
+ * \li alpha: the weight of the new frame, 1 replaces the average.
+ * \li num_points: the number of FFT bins.
+ *
+ * \b Outputs
+ * \li logPowerAvg: the updated average power in dB.
+ *
+ * \b Example
+ * \code
+ *   unsigned int N = 1024;
+ *   unsigned int alignment = volk_get_alignment();
+ *   lv_32fc_t* spec = (lv_32fc_t*)volk_malloc(sizeof(lv_32fc_t) * N, alignment);
+ *   float* avg = (float*)volk_malloc(sizeof(float) * N, alignment);
+ *
+ *   for (unsigned int ii = 0; ii < N; ++ii) {
+ *       avg[ii] = -200.f;
+ *   }
+ *
+ *   while (<more frames>) {
+ *       <fill spec with the FFT of the next frame>
+ *       volk_32fc_s32f_x2_power_spectrum_avg_32f(avg, spec, (float)N, 0.1f, N);
+ *   }
+ *
+ *   volk_free(spec);
+ *   volk_free(avg);
+ * \endcode
+ */
+
+#ifndef INCLUDED_volk_32fc_s32f_x2_power_spectrum_avg_32f_u_H
+#define INCLUDED_volk_32fc_s32f_x2_power_spectrum_avg_32f_u_H
+
+#include <inttypes.h>
+#include <math.h>
+#include <volk/volk_common.h>
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void
+volk_32fc_s32f_x2_power_spectrum_avg_32f_generic(float* logPowerAvg,
+                                                 const lv_32fc_t* complexFFTInput,
+                                                 const float normalizationFactor,
+                                                 const float alpha,
+                                                 unsigned int num_points)
+{
+    const float* inputPtr = (const float*)complexFFTInput;
+    float* avgPtr = logPowerAvg;
+    // dividing by normalizationFactor^2 is an offset in dB
+    const float offset = -2.f * volk_log2to10factor * log2f_non_ieee(normalizationFactor);
+    unsigned int number;
+
+    for (number = 0; number < num_points; number++) {
+        const float real = *inputPtr++;
+        const float imag = *inputPtr++;
+        const float power =
+            volk_log2to10factor * log2f_non_ieee((real * real) + (imag * imag)) + offset;
+        *avgPtr += alpha * (power - *avgPtr);
+        avgPtr++;
+    }
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+
+#ifdef LV_HAVE_SSE2
+#include <emmintrin.h>
+
+static inline void
+volk_32fc_s32f_x2_power_spectrum_avg_32f_u_sse2(float* logPowerAvg,
+                                                const lv_32fc_t* complexFFTInput,
+                                                const float normalizationFactor,
+                                                const float alpha,
+                                                unsigned int num_points)
+{
+    const float* inputPtr = (const float*)complexFFTInput;
+    float* avgPtr = logPowerAvg;
+    const float offset = -2.f * volk_log2to10factor * log2f_non_ieee(normalizationFactor);
+    unsigned int number = 0;
+    const unsigned int quarterPoints = num_points / 4;
+
+    const __m128 one = _mm_set1_ps(1.f);
+    const __m128 mantMask = _mm_castsi128_ps(_mm_set1_epi32(0x7fffff));
+    const __m128i expMask = _mm_set1_epi32(0x7f800000);
+    const __m128i bias = _mm_set1_epi32(127);
+    const __m128 dbScale = _mm_set1_ps(volk_log2to10factor);
+    const __m128 dbOffset = _mm_set1_ps(offset);
+    const __m128 vAlpha = _mm_set1_ps(alpha);
+    __m128 in0, in1, re, im, power, frac, mantissa, avg;
+    __m128i exp;
+
+    for (; number < quarterPoints; number++) {
+        in0 = _mm_loadu_ps(inputPtr);
+        in1 = _mm_loadu_ps(inputPtr + 4);
+        re = _mm_shuffle_ps(in0, in1, _MM_SHUFFLE(2, 0, 2, 0));
+        im = _mm_shuffle_ps(in0, in1, _MM_SHUFFLE(3, 1, 3, 1));
+        power = _mm_add_ps(_mm_mul_ps(re, re), _mm_mul_ps(im, im));
+
+        // log2(power) = exponent + log2(1.mantissa), see volk_32f_log2_32f
+        exp = _mm_sub_epi32(
+            _mm_srli_epi32(_mm_and_si128(_mm_castps_si128(power), expMask), 23), bias);
+        frac = _mm_or_ps(one, _mm_and_ps(power, mantMask));
+        mantissa = _mm_set1_ps(-3.4436006e-2f);
+        mantissa = _mm_add_ps(_mm_mul_ps(mantissa, frac), _mm_set1_ps(3.1821337e-1f));
+        mantissa = _mm_add_ps(_mm_mul_ps(mantissa, frac), _mm_set1_ps(-1.2315303f));
+        mantissa = _mm_add_ps(_mm_mul_ps(mantissa, frac), _mm_set1_ps(2.5988452f));
+        mantissa = _mm_add_ps(_mm_mul_ps(mantissa, frac), _mm_set1_ps(-3.3241990f));
+        mantissa = _mm_add_ps(_mm_mul_ps(mantissa, frac), _mm_set1_ps(3.1157899f));
+        power = _mm_add_ps(_mm_mul_ps(mantissa, _mm_sub_ps(frac, one)),
+                           _mm_cvtepi32_ps(exp));
+        power = _mm_add_ps(_mm_mul_ps(power, dbScale), dbOffset);
+
+        avg = _mm_loadu_ps(avgPtr);
+        avg = _mm_add_ps(avg, _mm_mul_ps(vAlpha, _mm_sub_ps(power, avg)));
+        _mm_storeu_ps(avgPtr, avg);
+
+        inputPtr += 8;
+        avgPtr += 4;
+    }
+
+    number = quarterPoints * 4;
+    volk_32fc_s32f_x2_power_spectrum_avg_32f_generic(avgPtr,
+                                                     (const lv_32fc_t*)inputPtr,
+                                                     normalizationFactor,
+                                                     alpha,
+                                                     num_points - number);
+}
+
+#endif /* LV_HAVE_SSE2 */
+
+
+#if LV_HAVE_AVX2 && LV_HAVE_FMA
+#include <immintrin.h>
+
+static inline void
+volk_32fc_s32f_x2_power_spectrum_avg_32f_u_avx2_fma(float* logPowerAvg,
+                                                    const lv_32fc_t* complexFFTInput,
+                                                    const float normalizationFactor,
+                                                    const float alpha,
+                                                    unsigned int num_points)
+{
+    const float* inputPtr = (const float*)complexFFTInput;
+    float* avgPtr = logPowerAvg;
+    const float offset = -2.f * volk_log2to10factor * log2f_non_ieee(normalizationFactor);
+    unsigned int number = 0;
+    const unsigned int eighthPoints = num_points / 8;
+
+    const __m256 one = _mm256_set1_ps(1.f);
+    const __m256 mantMask = _mm256_castsi256_ps(_mm256_set1_epi32(0x7fffff));
+    const __m256i expMask = _mm256_set1_epi32(0x7f800000);
+    const __m256i bias = _mm256_set1_epi32(127);
+    const __m256 dbScale = _mm256_set1_ps(volk_log2to10factor);
+    const __m256 dbOffset = _mm256_set1_ps(offset);
+    const __m256 vAlpha = _mm256_set1_ps(alpha);
+    __m256 in0, in1, re, im, power, frac, mantissa, avg;
+    __m256i exp;
+
+    for (; number < eighthPoints; number++) {
+        in0 = _mm256_loadu_ps(inputPtr);
+        in1 = _mm256_loadu_ps(inputPtr + 8);
+        // points 0, 1, 4, 5 | 2, 3, 6, 7
+        re = _mm256_shuffle_ps(in0, in1, _MM_SHUFFLE(2, 0, 2, 0));
+        im = _mm256_shuffle_ps(in0, in1, _MM_SHUFFLE(3, 1, 3, 1));
+        power = _mm256_fmadd_ps(re, re, _mm256_mul_ps(im, im));
+        power = _mm256_castpd_ps(_mm256_permute4x64_pd(_mm256_castps_pd(power), 0xD8));
+
+        // log2(power) = exponent + log2(1.mantissa), see volk_32f_log2_32f
+        exp = _mm256_sub_epi32(
+            _mm256_srli_epi32(_mm256_and_si256(_mm256_castps_si256(power), expMask), 23),
+            bias);
+        frac = _mm256_or_ps(one, _mm256_and_ps(power, mantMask));
+        mantissa = _mm256_set1_ps(-3.4436006e-2f);
+        mantissa = _mm256_fmadd_ps(mantissa, frac, _mm256_set1_ps(3.1821337e-1f));
+        mantissa = _mm256_fmadd_ps(mantissa, frac, _mm256_set1_ps(-1.2315303f));
+        mantissa = _mm256_fmadd_ps(mantissa, frac, _mm256_set1_ps(2.5988452f));
+        mantissa = _mm256_fmadd_ps(mantissa, frac, _mm256_set1_ps(-3.3241990f));
+        mantissa = _mm256_fmadd_ps(mantissa, frac, _mm256_set1_ps(3.1157899f));
+        power = _mm256_fmadd_ps(
+            mantissa, _mm256_sub_ps(frac, one), _mm256_cvtepi32_ps(exp));
+        power = _mm256_fmadd_ps(power, dbScale, dbOffset);
+
+        avg = _mm256_loadu_ps(avgPtr);
+        avg = _mm256_fmadd_ps(vAlpha, _mm256_sub_ps(power, avg), avg);
+        _mm256_storeu_ps(avgPtr, avg);
+
+        inputPtr += 16;
+        avgPtr += 8;
+    }
+
+    number = eighthPoints * 8;
+    volk_32fc_s32f_x2_power_spectrum_avg_32f_generic(avgPtr,
+                                                     (const lv_32fc_t*)inputPtr,
+                                                     normalizationFactor,
+                                                     alpha,
+                                                     num_points - number);
+}
+
+#endif /* LV_HAVE_AVX2 && LV_HAVE_FMA */
+
+
+#ifdef LV_HAVE_AVX512F
+#include <immintrin.h>
+
+static inline void
+volk_32fc_s32f_x2_power_spectrum_avg_32f_u_avx512f(float* logPowerAvg,
+                                                   const lv_32fc_t* complexFFTInput,
+                                                   const float normalizationFactor,
+                                                   const float alpha,
+                                                   unsigned int num_points)
+{
+    const float* inputPtr = (const float*)complexFFTInput;
+    float* avgPtr = logPowerAvg;
+    const float offset = -2.f * volk_log2to10factor * log2f_non_ieee(normalizationFactor);
+    unsigned int number = 0;
+    const unsigned int sixteenthPoints = num_points / 16;
+
+    const __m512 one = _mm512_set1_ps(1.f);
+    const __m512i mantMask = _mm512_set1_epi32(0x7fffff);
+    const __m512i oneBits = _mm512_castps_si512(one);
+    const __m512i expMask = _mm512_set1_epi32(0x7f800000);
+    const __m512i bias = _mm512_set1_epi32(127);
+    const __m512 dbScale = _mm512_set1_ps(volk_log2to10factor);
+    const __m512 dbOffset = _mm512_set1_ps(offset);
+    const __m512 vAlpha = _mm512_set1_ps(alpha);
+    const __m512i reIdx = _mm512_set_epi32(
+        30, 28, 26, 24, 22, 20, 18, 16, 14, 12, 10, 8, 6, 4, 2, 0);
+    const __m512i imIdx = _mm512_set_epi32(
+        31, 29, 27, 25, 23, 21, 19, 17, 15, 13, 11, 9, 7, 5, 3, 1);
+    __m512 in0, in1, re, im, power, frac, mantissa, avg;
+    __m512i exp;
+
+    for (; number < sixteenthPoints; number++) {
+        in0 = _mm512_loadu_ps(inputPtr);
+        in1 = _mm512_loadu_ps(inputPtr + 16);
+        re = _mm512_permutex2var_ps(in0, reIdx, in1);
+        im = _mm512_permutex2var_ps(in0, imIdx, in1);
+        power = _mm512_fmadd_ps(re, re, _mm512_mul_ps(im, im));
+
+        // log2(power) = exponent + log2(1.mantissa), see volk_32f_log2_32f
+        exp = _mm512_sub_epi32(
+            _mm512_srli_epi32(_mm512_and_si512(_mm512_castps_si512(power), expMask), 23),
+            bias);
+        frac = _mm512_castsi512_ps(_mm512_or_si512(
+            _mm512_and_si512(_mm512_castps_si512(power), mantMask), oneBits));
+        mantissa = _mm512_set1_ps(-3.4436006e-2f);
+        mantissa = _mm512_fmadd_ps(mantissa, frac, _mm512_set1_ps(3.1821337e-1f));
+        mantissa = _mm512_fmadd_ps(mantissa, frac, _mm512_set1_ps(-1.2315303f));
+        mantissa = _mm512_fmadd_ps(mantissa, frac, _mm512_set1_ps(2.5988452f));
+        mantissa = _mm512_fmadd_ps(mantissa, frac, _mm512_set1_ps(-3.3241990f));
+        mantissa = _mm512_fmadd_ps(mantissa, frac, _mm512_set1_ps(3.1157899f));
+        power = _mm512_fmadd_ps(
+            mantissa, _mm512_sub_ps(frac, one), _mm512_cvtepi32_ps(exp));
+        power = _mm512_fmadd_ps(power, dbScale, dbOffset);
+
+        avg = _mm512_loadu_ps(avgPtr);
+        avg = _mm512_fmadd_ps(vAlpha, _mm512_sub_ps(power, avg), avg);
+        _mm512_storeu_ps(avgPtr, avg);
+
+        inputPtr += 32;
+        avgPtr += 16;
+    }
+
+    number = sixteenthPoints * 16;
+    volk_32fc_s32f_x2_power_spectrum_avg_32f_generic(avgPtr,
+                                                     (const lv_32fc_t*)inputPtr,
+                                                     normalizationFactor,
+                                                     alpha,
+                                                     num_points - number);
+}
+
+#endif /* LV_HAVE_AVX512F */
+
+
+#ifdef LV_HAVE_NEON
+#include <arm_neon.h>
+#include <volk/volk_32f_log2_32f.h>
+
+static inline void
+volk_32fc_s32f_x2_power_spectrum_avg_32f_neon(float* logPowerAvg,
+                                              const lv_32fc_t* complexFFTInput,
+                                              const float normalizationFactor,
+                                              const float alpha,
+                                              unsigned int num_points)
+{
+    const float* inputPtr = (const float*)complexFFTInput;
+    float* avgPtr = logPowerAvg;
+    const float offset = -2.f * volk_log2to10factor * log2f_non_ieee(normalizationFactor);
+    unsigned int number = 0;
+    const unsigned int quarterPoints = num_points / 4;
+
+    const float32x4_t dbScale = vdupq_n_f32(volk_log2to10factor);
+    const float32x4_t dbOffset = vdupq_n_f32(offset);
+    const float32x4_t vAlpha = vdupq_n_f32(alpha);
+    float32x4x2_t in;
+    float32x4_t power, log2_approx, avg;
+    int32x4_t aval;
+
+    VLOG2Q_NEON_PREAMBLE()
+
+    for (; number < quarterPoints; number++) {
+        in = vld2q_f32(inputPtr);
+        power = vmulq_f32(in.val[0], in.val[0]);
+        power = vmlaq_f32(power, in.val[1], in.val[1]);
+        aval = vreinterpretq_s32_f32(power);
+
+        VLOG2Q_NEON_F32(log2_approx, aval)
+        power = vmlaq_f32(dbOffset, log2_approx, dbScale);
+
+        avg = vld1q_f32(avgPtr);
+        avg = vmlaq_f32(avg, vAlpha, vsubq_f32(power, avg));
+        vst1q_f32(avgPtr, avg);
+
+        inputPtr += 8;
+        avgPtr += 4;
+    }
+
+    number = quarterPoints * 4;
+    volk_32fc_s32f_x2_power_spectrum_avg_32f_generic(avgPtr,
+                                                     (const lv_32fc_t*)inputPtr,
+                                                     normalizationFactor,
+                                                     alpha,
+                                                     num_points - number);
+}
+
+#endif /* LV_HAVE_NEON */
+
+#endif /* INCLUDED_volk_32fc_s32f_x2_power_spectrum_avg_32f_u_H */
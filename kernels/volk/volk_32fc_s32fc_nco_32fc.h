@@ -0,0 +1,553 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2026 Free Software Foundation, Inc.
+ *
+ * This file is part of VOLK
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+/*!
+ * \page volk_32fc_s32fc_nco_32fc
+ *
+ * \b Overview
+ *
+ * Numerically controlled oscillator: writes the complex exponential
+ * e^{j(phi0 + k * delta)} to the output vector, starting at the phase offset
+ * phi0 = arg(phase) and advancing by delta = arg(phase_inc) per sample.
+ *
+ * This is the rotator (volk_32fc_s32fc_x2_rotator_32fc) without an input
+ * stream. The phase is renormalized at the same interval as in the rotator
+ * and after every call, so the magnitude of the output stays at 1.
+ *
+ * <b>Dispatcher Prototype</b>
+ * \code
+ * void volk_32fc_s32fc_nco_32fc(lv_32fc_t* outVector, const lv_32fc_t phase_inc,
+ *                               lv_32fc_t* phase, unsigned int num_points)
+ * \endcode
+ *
+ * \b Inputs
+ * \li phase_inc: rotational velocity, should have magnitude 1.
+ * \li phase: initial phase offset, updated to the phase of the next sample.
+ * \li num_points: The number of samples to generate.
+ *
+ * \b Outputs
+ * \li outVector: The vector where the generated tone will be stored.
+ *
+ * \b Example
+ * Generate a tone at f=0.1 (normalized angular frequency).
+ * \code
+ *   int N = 10;
+ *   unsigned int alignment = volk_get_alignment();
+ *   lv_32fc_t* out = (lv_32fc_t*)volk_malloc(sizeof(lv_32fc_t)*N, alignment);
+ *
+ *   float frequency = 0.1f;
+ *   lv_32fc_t phase_increment = lv_cmake(std::cos(frequency), std::sin(frequency));
+ *   lv_32fc_t phase = lv_cmake(1.f, 0.0f); // start at 1 (0 rad phase)
+ *
+ *   volk_32fc_s32fc_nco_32fc(out, phase_increment, &phase, N);
+ *
+ *   for(unsigned int ii = 0; ii < N; ++ii){
+ *       printf("out[%u] = %+1.2f %+1.2fj\n",
+ *           ii, lv_creal(out[ii]), lv_cimag(out[ii]));
+ *   }
+ *
+ *   volk_free(out);
+ * \endcode
+ */
+
+#ifndef INCLUDED_volk_32fc_s32fc_nco_32fc_a_H
+#define INCLUDED_volk_32fc_s32fc_nco_32fc_a_H
+
+#include <math.h>
+#include <stdio.h>
+#include <volk/volk_32fc_s32fc_x2_rotator_32fc.h>
+#include <volk/volk_complex.h>
+
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void volk_32fc_s32fc_nco_32fc_generic(lv_32fc_t* outVector,
+                                                    const lv_32fc_t phase_inc,
+                                                    lv_32fc_t* phase,
+                                                    unsigned int num_points)
+{
+    unsigned int i = 0;
+    int j = 0;
+    for (i = 0; i < (unsigned int)(num_points / ROTATOR_RELOAD); ++i) {
+        for (j = 0; j < ROTATOR_RELOAD; ++j) {
+            *outVector++ = *phase;
+            (*phase) *= phase_inc;
+        }
+
+        (*phase) /= hypotf(lv_creal(*phase), lv_cimag(*phase));
+    }
+    for (i = 0; i < num_points % ROTATOR_RELOAD; ++i) {
+        *outVector++ = *phase;
+        (*phase) *= phase_inc;
+    }
+    if (i) {
+        // Make sure, we normalize phase on every call!
+        (*phase) /= hypotf(lv_creal(*phase), lv_cimag(*phase));
+    }
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+
+#ifdef LV_HAVE_NEON
+#include <arm_neon.h>
+#include <volk/volk_neon_intrinsics.h>
+
+static inline void volk_32fc_s32fc_nco_32fc_neon(lv_32fc_t* outVector,
+                                                 const lv_32fc_t phase_inc,
+                                                 lv_32fc_t* phase,
+                                                 unsigned int num_points)
+{
+    lv_32fc_t* outputVectorPtr = outVector;
+    lv_32fc_t incr = 1;
+    lv_32fc_t phasePtr[4] = { (*phase), (*phase), (*phase), (*phase) };
+
+    unsigned int i = 0, j = 0;
+
+    for (i = 0; i < 4; ++i) {
+        phasePtr[i] *= incr;
+        incr *= (phase_inc);
+    }
+
+    // Notice that incr has be incremented in the previous loop
+    const lv_32fc_t incrPtr[4] = { incr, incr, incr, incr };
+    const float32x4x2_t incr_vec = vld2q_f32((float*)incrPtr);
+    float32x4x2_t phase_vec = vld2q_f32((float*)phasePtr);
+
+    for (i = 0; i < (unsigned int)(num_points / ROTATOR_RELOAD); i++) {
+        for (j = 0; j < ROTATOR_RELOAD_4; j++) {
+            vst2q_f32((float*)outputVectorPtr, phase_vec);
+            phase_vec = _vmultiply_complexq_f32(phase_vec, incr_vec);
+            outputVectorPtr += 4;
+        }
+        // normalize phase so magnitude doesn't grow because of
+        // floating point rounding error
+        const float32x4_t mag_squared = _vmagnitudesquaredq_f32(phase_vec);
+        const float32x4_t inv_mag = _vinvsqrtq_f32(mag_squared);
+        phase_vec.val[0] = vmulq_f32(phase_vec.val[0], inv_mag);
+        phase_vec.val[1] = vmulq_f32(phase_vec.val[1], inv_mag);
+    }
+
+    for (i = 0; i < (num_points % ROTATOR_RELOAD) / 4; i++) {
+        vst2q_f32((float*)outputVectorPtr, phase_vec);
+        phase_vec = _vmultiply_complexq_f32(phase_vec, incr_vec);
+        outputVectorPtr += 4;
+    }
+    if (i) {
+        const float32x4_t mag_squared = _vmagnitudesquaredq_f32(phase_vec);
+        const float32x4_t inv_mag = _vinvsqrtq_f32(mag_squared);
+        phase_vec.val[0] = vmulq_f32(phase_vec.val[0], inv_mag);
+        phase_vec.val[1] = vmulq_f32(phase_vec.val[1], inv_mag);
+    }
+    vst2q_f32((float*)phasePtr, phase_vec);
+
+    (*phase) = phasePtr[0];
+    volk_32fc_s32fc_nco_32fc_generic(outputVectorPtr, phase_inc, phase, num_points % 4);
+}
+
+#endif /* LV_HAVE_NEON */
+
+
+#ifdef LV_HAVE_SSE4_1
+#include <smmintrin.h>
+#include <volk/volk_sse3_intrinsics.h>
+
+static inline void volk_32fc_s32fc_nco_32fc_a_sse4_1(lv_32fc_t* outVector,
+                                                     const lv_32fc_t phase_inc,
+                                                     lv_32fc_t* phase,
+                                                     unsigned int num_points)
+{
+    lv_32fc_t* cPtr = outVector;
+    lv_32fc_t incr = 1;
+    lv_32fc_t phase_Ptr[2] = { (*phase), (*phase) };
+
+    unsigned int i, j = 0;
+
+    for (i = 0; i < 2; ++i) {
+        phase_Ptr[i] *= incr;
+        incr *= (phase_inc);
+    }
+
+    __m128 phase_Val, inc_Val, tmp1, tmp2;
+
+    phase_Val = _mm_loadu_ps((float*)phase_Ptr);
+    inc_Val = _mm_set_ps(lv_cimag(incr), lv_creal(incr), lv_cimag(incr), lv_creal(incr));
+
+    for (i = 0; i < (unsigned int)(num_points / ROTATOR_RELOAD); i++) {
+        for (j = 0; j < ROTATOR_RELOAD_2; ++j) {
+            _mm_store_ps((float*)cPtr, phase_Val);
+            phase_Val = _mm_complexmul_ps(phase_Val, inc_Val);
+            cPtr += 2;
+        }
+        tmp1 = _mm_mul_ps(phase_Val, phase_Val);
+        tmp2 = _mm_hadd_ps(tmp1, tmp1);
+        tmp1 = _mm_shuffle_ps(tmp2, tmp2, 0xD8);
+        tmp2 = _mm_sqrt_ps(tmp1);
+        phase_Val = _mm_div_ps(phase_Val, tmp2);
+    }
+    for (i = 0; i < (num_points % ROTATOR_RELOAD) / 2; ++i) {
+        _mm_store_ps((float*)cPtr, phase_Val);
+        phase_Val = _mm_complexmul_ps(phase_Val, inc_Val);
+        cPtr += 2;
+    }
+    if (i) {
+        tmp1 = _mm_mul_ps(phase_Val, phase_Val);
+        tmp2 = _mm_hadd_ps(tmp1, tmp1);
+        tmp1 = _mm_shuffle_ps(tmp2, tmp2, 0xD8);
+        tmp2 = _mm_sqrt_ps(tmp1);
+        phase_Val = _mm_div_ps(phase_Val, tmp2);
+    }
+
+    _mm_storeu_ps((float*)phase_Ptr, phase_Val);
+    if (num_points & 1) {
+        *cPtr++ = phase_Ptr[0];
+        phase_Ptr[0] *= (phase_inc);
+    }
+
+    (*phase) = phase_Ptr[0];
+}
+
+#endif /* LV_HAVE_SSE4_1 for aligned */
+
+
+#ifdef LV_HAVE_AVX
+#include <immintrin.h>
+#include <volk/volk_avx_intrinsics.h>
+
+static inline void volk_32fc_s32fc_nco_32fc_a_avx(lv_32fc_t* outVector,
+                                                  const lv_32fc_t phase_inc,
+                                                  lv_32fc_t* phase,
+                                                  unsigned int num_points)
+{
+    lv_32fc_t* cPtr = outVector;
+    lv_32fc_t incr = lv_cmake(1.0f, 0.0f);
+    __VOLK_ATTR_ALIGNED(32) lv_32fc_t phase_Ptr[8];
+
+    unsigned int i, j = 0;
+
+    for (i = 0; i < 8; ++i) {
+        phase_Ptr[i] = (*phase) * incr;
+        incr *= (phase_inc);
+    }
+
+    // Two independent phase registers, each stepped by phase_inc^8, so that
+    // consecutive complex multiplies do not wait for each other.
+    __m256 phase_Val0 = _mm256_load_ps((float*)phase_Ptr);
+    __m256 phase_Val1 = _mm256_load_ps((float*)(phase_Ptr + 4));
+
+    const __m256 inc_Val = _mm256_set_ps(lv_cimag(incr),
+                                         lv_creal(incr),
+                                         lv_cimag(incr),
+                                         lv_creal(incr),
+                                         lv_cimag(incr),
+                                         lv_creal(incr),
+                                         lv_cimag(incr),
+                                         lv_creal(incr));
+
+    for (i = 0; i < (unsigned int)(num_points / ROTATOR_RELOAD); i++) {
+        for (j = 0; j < ROTATOR_RELOAD / 8; ++j) {
+            _mm256_store_ps((float*)cPtr, phase_Val0);
+            _mm256_store_ps((float*)(cPtr + 4), phase_Val1);
+
+            phase_Val0 = _mm256_complexmul_ps(phase_Val0, inc_Val);
+            phase_Val1 = _mm256_complexmul_ps(phase_Val1, inc_Val);
+
+            cPtr += 8;
+        }
+        phase_Val0 = _mm256_normalize_ps(phase_Val0);
+        phase_Val1 = _mm256_normalize_ps(phase_Val1);
+    }
+
+    for (i = 0; i < (num_points % ROTATOR_RELOAD) / 8; ++i) {
+        _mm256_store_ps((float*)cPtr, phase_Val0);
+        _mm256_store_ps((float*)(cPtr + 4), phase_Val1);
+
+        phase_Val0 = _mm256_complexmul_ps(phase_Val0, inc_Val);
+        phase_Val1 = _mm256_complexmul_ps(phase_Val1, inc_Val);
+
+        cPtr += 8;
+    }
+    if (i) {
+        phase_Val0 = _mm256_normalize_ps(phase_Val0);
+    }
+
+    _mm256_store_ps((float*)phase_Ptr, phase_Val0);
+    (*phase) = phase_Ptr[0];
+    volk_32fc_s32fc_nco_32fc_generic(cPtr, phase_inc, phase, num_points % 8);
+}
+
+#endif /* LV_HAVE_AVX for aligned */
+
+
+#ifdef LV_HAVE_AVX512F
+#include <immintrin.h>
+#include <volk/volk_avx512_intrinsics.h>
+
+static inline void volk_32fc_s32fc_nco_32fc_a_avx512f(lv_32fc_t* outVector,
+                                                      const lv_32fc_t phase_inc,
+                                                      lv_32fc_t* phase,
+                                                      unsigned int num_points)
+{
+    lv_32fc_t* cPtr = outVector;
+    lv_32fc_t incr = lv_cmake(1.0f, 0.0f);
+    __VOLK_ATTR_ALIGNED(64) lv_32fc_t phase_Ptr[16];
+
+    unsigned int i, j = 0;
+
+    for (i = 0; i < 16; ++i) {
+        phase_Ptr[i] = (*phase) * incr;
+        incr *= (phase_inc);
+    }
+
+    // Two independent phase registers, each stepped by phase_inc^16
+    __m512 phase_Val0 = _mm512_load_ps((float*)phase_Ptr);
+    __m512 phase_Val1 = _mm512_load_ps((float*)(phase_Ptr + 8));
+
+    const lv_32fc_t incr_Ptr[8] = { incr, incr, incr, incr, incr, incr, incr, incr };
+    const __m512 inc_Val = _mm512_loadu_ps((float*)incr_Ptr);
+
+    for (i = 0; i < (unsigned int)(num_points / ROTATOR_RELOAD); i++) {
+        for (j = 0; j < ROTATOR_RELOAD / 16; ++j) {
+            _mm512_store_ps((float*)cPtr, phase_Val0);
+            _mm512_store_ps((float*)(cPtr + 8), phase_Val1);
+
+            phase_Val0 = _mm512_complexmul_ps(phase_Val0, inc_Val);
+            phase_Val1 = _mm512_complexmul_ps(phase_Val1, inc_Val);
+
+            cPtr += 16;
+        }
+        phase_Val0 = _mm512_normalize_ps(phase_Val0);
+        phase_Val1 = _mm512_normalize_ps(phase_Val1);
+    }
+
+    for (i = 0; i < (num_points % ROTATOR_RELOAD) / 16; ++i) {
+        _mm512_store_ps((float*)cPtr, phase_Val0);
+        _mm512_store_ps((float*)(cPtr + 8), phase_Val1);
+
+        phase_Val0 = _mm512_complexmul_ps(phase_Val0, inc_Val);
+        phase_Val1 = _mm512_complexmul_ps(phase_Val1, inc_Val);
+
+        cPtr += 16;
+    }
+    if (i) {
+        phase_Val0 = _mm512_normalize_ps(phase_Val0);
+    }
+
+    _mm512_store_ps((float*)phase_Ptr, phase_Val0);
+    (*phase) = phase_Ptr[0];
+    volk_32fc_s32fc_nco_32fc_generic(cPtr, phase_inc, phase, num_points % 16);
+}
+
+#endif /* LV_HAVE_AVX512F for aligned */
+
+#endif /* INCLUDED_volk_32fc_s32fc_nco_32fc_a_H */
+
+
+#ifndef INCLUDED_volk_32fc_s32fc_nco_32fc_u_H
+#define INCLUDED_volk_32fc_s32fc_nco_32fc_u_H
+
+#include <math.h>
+#include <stdio.h>
+#include <volk/volk_32fc_s32fc_x2_rotator_32fc.h>
+#include <volk/volk_complex.h>
+
+
+#ifdef LV_HAVE_SSE4_1
+#include <smmintrin.h>
+#include <volk/volk_sse3_intrinsics.h>
+
+static inline void volk_32fc_s32fc_nco_32fc_u_sse4_1(lv_32fc_t* outVector,
+                                                     const lv_32fc_t phase_inc,
+                                                     lv_32fc_t* phase,
+                                                     unsigned int num_points)
+{
+    lv_32fc_t* cPtr = outVector;
+    lv_32fc_t incr = 1;
+    lv_32fc_t phase_Ptr[2] = { (*phase), (*phase) };
+
+    unsigned int i, j = 0;
+
+    for (i = 0; i < 2; ++i) {
+        phase_Ptr[i] *= incr;
+        incr *= (phase_inc);
+    }
+
+    __m128 phase_Val, inc_Val, tmp1, tmp2;
+
+    phase_Val = _mm_loadu_ps((float*)phase_Ptr);
+    inc_Val = _mm_set_ps(lv_cimag(incr), lv_creal(incr), lv_cimag(incr), lv_creal(incr));
+
+    for (i = 0; i < (unsigned int)(num_points / ROTATOR_RELOAD); i++) {
+        for (j = 0; j < ROTATOR_RELOAD_2; ++j) {
+            _mm_storeu_ps((float*)cPtr, phase_Val);
+            phase_Val = _mm_complexmul_ps(phase_Val, inc_Val);
+            cPtr += 2;
+        }
+        tmp1 = _mm_mul_ps(phase_Val, phase_Val);
+        tmp2 = _mm_hadd_ps(tmp1, tmp1);
+        tmp1 = _mm_shuffle_ps(tmp2, tmp2, 0xD8);
+        tmp2 = _mm_sqrt_ps(tmp1);
+        phase_Val = _mm_div_ps(phase_Val, tmp2);
+    }
+    for (i = 0; i < (num_points % ROTATOR_RELOAD) / 2; ++i) {
+        _mm_storeu_ps((float*)cPtr, phase_Val);
+        phase_Val = _mm_complexmul_ps(phase_Val, inc_Val);
+        cPtr += 2;
+    }
+    if (i) {
+        tmp1 = _mm_mul_ps(phase_Val, phase_Val);
+        tmp2 = _mm_hadd_ps(tmp1, tmp1);
+        tmp1 = _mm_shuffle_ps(tmp2, tmp2, 0xD8);
+        tmp2 = _mm_sqrt_ps(tmp1);
+        phase_Val = _mm_div_ps(phase_Val, tmp2);
+    }
+
+    _mm_storeu_ps((float*)phase_Ptr, phase_Val);
+    if (num_points & 1) {
+        *cPtr++ = phase_Ptr[0];
+        phase_Ptr[0] *= (phase_inc);
+    }
+
+    (*phase) = phase_Ptr[0];
+}
+
+#endif /* LV_HAVE_SSE4_1 for unaligned */
+
+
+#ifdef LV_HAVE_AVX
+#include <immintrin.h>
+#include <volk/volk_avx_intrinsics.h>
+
+static inline void volk_32fc_s32fc_nco_32fc_u_avx(lv_32fc_t* outVector,
+                                                  const lv_32fc_t phase_inc,
+                                                  lv_32fc_t* phase,
+                                                  unsigned int num_points)
+{
+    lv_32fc_t* cPtr = outVector;
+    lv_32fc_t incr = lv_cmake(1.0f, 0.0f);
+    __VOLK_ATTR_ALIGNED(32) lv_32fc_t phase_Ptr[8];
+
+    unsigned int i, j = 0;
+
+    for (i = 0; i < 8; ++i) {
+        phase_Ptr[i] = (*phase) * incr;
+        incr *= (phase_inc);
+    }
+
+    // Two independent phase registers, each stepped by phase_inc^8, so that
+    // consecutive complex multiplies do not wait for each other.
+    __m256 phase_Val0 = _mm256_load_ps((float*)phase_Ptr);
+    __m256 phase_Val1 = _mm256_load_ps((float*)(phase_Ptr + 4));
+
+    const __m256 inc_Val = _mm256_set_ps(lv_cimag(incr),
+                                         lv_creal(incr),
+                                         lv_cimag(incr),
+                                         lv_creal(incr),
+                                         lv_cimag(incr),
+                                         lv_creal(incr),
+                                         lv_cimag(incr),
+                                         lv_creal(incr));
+
+    for (i = 0; i < (unsigned int)(num_points / ROTATOR_RELOAD); i++) {
+        for (j = 0; j < ROTATOR_RELOAD / 8; ++j) {
+            _mm256_storeu_ps((float*)cPtr, phase_Val0);
+            _mm256_storeu_ps((float*)(cPtr + 4), phase_Val1);
+
+            phase_Val0 = _mm256_complexmul_ps(phase_Val0, inc_Val);
+            phase_Val1 = _mm256_complexmul_ps(phase_Val1, inc_Val);
+
+            cPtr += 8;
+        }
+        phase_Val0 = _mm256_normalize_ps(phase_Val0);
+        phase_Val1 = _mm256_normalize_ps(phase_Val1);
+    }
+
+    for (i = 0; i < (num_points % ROTATOR_RELOAD) / 8; ++i) {
+        _mm256_storeu_ps((float*)cPtr, phase_Val0);
+        _mm256_storeu_ps((float*)(cPtr + 4), phase_Val1);
+
+        phase_Val0 = _mm256_complexmul_ps(phase_Val0, inc_Val);
+        phase_Val1 = _mm256_complexmul_ps(phase_Val1, inc_Val);
+
+        cPtr += 8;
+    }
+    if (i) {
+        phase_Val0 = _mm256_normalize_ps(phase_Val0);
+    }
+
+    _mm256_store_ps((float*)phase_Ptr, phase_Val0);
+    (*phase) = phase_Ptr[0];
+    volk_32fc_s32fc_nco_32fc_generic(cPtr, phase_inc, phase, num_points % 8);
+}
+
+#endif /* LV_HAVE_AVX for unaligned */
+
+
+#ifdef LV_HAVE_AVX512F
+#include <immintrin.h>
+#include <volk/volk_avx512_intrinsics.h>
+
+static inline void volk_32fc_s32fc_nco_32fc_u_avx512f(lv_32fc_t* outVector,
+                                                      const lv_32fc_t phase_inc,
+                                                      lv_32fc_t* phase,
+                                                      unsigned int num_points)
+{
+    lv_32fc_t* cPtr = outVector;
+    lv_32fc_t incr = lv_cmake(1.0f, 0.0f);
+    __VOLK_ATTR_ALIGNED(64) lv_32fc_t phase_Ptr[16];
+
+    unsigned int i, j = 0;
+
+    for (i = 0; i < 16; ++i) {
+        phase_Ptr[i] = (*phase) * incr;
+        incr *= (phase_inc);
+    }
+
+    // Two independent phase registers, each stepped by phase_inc^16
+    __m512 phase_Val0 = _mm512_load_ps((float*)phase_Ptr);
+    __m512 phase_Val1 = _mm512_load_ps((float*)(phase_Ptr + 8));
+
+    const lv_32fc_t incr_Ptr[8] = { incr, incr, incr, incr, incr, incr, incr, incr };
+    const __m512 inc_Val = _mm512_loadu_ps((float*)incr_Ptr);
+
+    for (i = 0; i < (unsigned int)(num_points / ROTATOR_RELOAD); i++) {
+        for (j = 0; j < ROTATOR_RELOAD / 16; ++j) {
+            _mm512_storeu_ps((float*)cPtr, phase_Val0);
+            _mm512_storeu_ps((float*)(cPtr + 8), phase_Val1);
+
+            phase_Val0 = _mm512_complexmul_ps(phase_Val0, inc_Val);
+            phase_Val1 = _mm512_complexmul_ps(phase_Val1, inc_Val);
+
+            cPtr += 16;
+        }
+        phase_Val0 = _mm512_normalize_ps(phase_Val0);
+        phase_Val1 = _mm512_normalize_ps(phase_Val1);
+    }
+
+    for (i = 0; i < (num_points % ROTATOR_RELOAD) / 16; ++i) {
+        _mm512_storeu_ps((float*)cPtr, phase_Val0);
+        _mm512_storeu_ps((float*)(cPtr + 8), phase_Val1);
+
+        phase_Val0 = _mm512_complexmul_ps(phase_Val0, inc_Val);
+        phase_Val1 = _mm512_complexmul_ps(phase_Val1, inc_Val);
+
+        cPtr += 16;
+    }
+    if (i) {
+        phase_Val0 = _mm512_normalize_ps(phase_Val0);
+    }
+
+    _mm512_store_ps((float*)phase_Ptr, phase_Val0);
+    (*phase) = phase_Ptr[0];
+    volk_32fc_s32fc_nco_32fc_generic(cPtr, phase_inc, phase, num_points % 16);
+}
+
+#endif /* LV_HAVE_AVX512F for unaligned */
+
+#endif /* INCLUDED_volk_32fc_s32fc_nco_32fc_u_H */
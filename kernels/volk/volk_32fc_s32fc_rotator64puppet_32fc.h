@@ -0,0 +1,160 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2026 Free Software Foundation, Inc.
+ *
+ * This file is part of VOLK
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+/*
+ * QA wrapper for volk_32fc_s64fc_x2_rotator_32fc. Uses the same initial phase
+ * as the single precision rotator puppet; the test harness only provides a
+ * single precision scalar, so the phase increment is widened to double here.
+ */
+
+#ifndef INCLUDED_volk_32fc_s32fc_rotator64puppet_32fc_a_H
+#define INCLUDED_volk_32fc_s32fc_rotator64puppet_32fc_a_H
+
+#include <math.h>
+#include <volk/volk_32fc_s64fc_x2_rotator_32fc.h>
+#include <volk/volk_complex.h>
+
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void volk_32fc_s32fc_rotator64puppet_32fc_generic(lv_32fc_t* outVector,
+                                                                const lv_32fc_t* inVector,
+                                                                const lv_32fc_t phase_inc,
+                                                                unsigned int num_points)
+{
+    lv_64fc_t phase[1] = { lv_cmake(.3, .95393) };
+    (*phase) /= hypot(lv_creal(*phase), lv_cimag(*phase));
+    const lv_64fc_t phase_inc_d = lv_cmake((double)lv_creal(phase_inc),
+                                           (double)lv_cimag(phase_inc));
+    const lv_64fc_t phase_inc_n =
+        phase_inc_d / hypot(lv_creal(phase_inc_d), lv_cimag(phase_inc_d));
+    volk_32fc_s64fc_x2_rotator_32fc_generic(
+        outVector, inVector, phase_inc_n, phase, num_points);
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+
+#ifdef LV_HAVE_NEON
+#include <arm_neon.h>
+
+static inline void volk_32fc_s32fc_rotator64puppet_32fc_neon(lv_32fc_t* outVector,
+                                                             const lv_32fc_t* inVector,
+                                                             const lv_32fc_t phase_inc,
+                                                             unsigned int num_points)
+{
+    lv_64fc_t phase[1] = { lv_cmake(.3, .95393) };
+    (*phase) /= hypot(lv_creal(*phase), lv_cimag(*phase));
+    const lv_64fc_t phase_inc_d = lv_cmake((double)lv_creal(phase_inc),
+                                           (double)lv_cimag(phase_inc));
+    const lv_64fc_t phase_inc_n =
+        phase_inc_d / hypot(lv_creal(phase_inc_d), lv_cimag(phase_inc_d));
+    volk_32fc_s64fc_x2_rotator_32fc_neon(
+        outVector, inVector, phase_inc_n, phase, num_points);
+}
+
+#endif /* LV_HAVE_NEON */
+
+
+#ifdef LV_HAVE_AVX
+#include <immintrin.h>
+
+static inline void volk_32fc_s32fc_rotator64puppet_32fc_a_avx(lv_32fc_t* outVector,
+                                                              const lv_32fc_t* inVector,
+                                                              const lv_32fc_t phase_inc,
+                                                              unsigned int num_points)
+{
+    lv_64fc_t phase[1] = { lv_cmake(.3, .95393) };
+    (*phase) /= hypot(lv_creal(*phase), lv_cimag(*phase));
+    const lv_64fc_t phase_inc_d = lv_cmake((double)lv_creal(phase_inc),
+                                           (double)lv_cimag(phase_inc));
+    const lv_64fc_t phase_inc_n =
+        phase_inc_d / hypot(lv_creal(phase_inc_d), lv_cimag(phase_inc_d));
+    volk_32fc_s64fc_x2_rotator_32fc_a_avx(
+        outVector, inVector, phase_inc_n, phase, num_points);
+}
+
+#endif /* LV_HAVE_AVX for aligned */
+
+
+#ifdef LV_HAVE_AVX512F
+#include <immintrin.h>
+
+static inline void
+volk_32fc_s32fc_rotator64puppet_32fc_a_avx512f(lv_32fc_t* outVector,
+                                               const lv_32fc_t* inVector,
+                                               const lv_32fc_t phase_inc,
+                                               unsigned int num_points)
+{
+    lv_64fc_t phase[1] = { lv_cmake(.3, .95393) };
+    (*phase) /= hypot(lv_creal(*phase), lv_cimag(*phase));
+    const lv_64fc_t phase_inc_d = lv_cmake((double)lv_creal(phase_inc),
+                                           (double)lv_cimag(phase_inc));
+    const lv_64fc_t phase_inc_n =
+        phase_inc_d / hypot(lv_creal(phase_inc_d), lv_cimag(phase_inc_d));
+    volk_32fc_s64fc_x2_rotator_32fc_a_avx512f(
+        outVector, inVector, phase_inc_n, phase, num_points);
+}
+
+#endif /* LV_HAVE_AVX512F for aligned */
+
+#endif /* INCLUDED_volk_32fc_s32fc_rotator64puppet_32fc_a_H */
+
+
+#ifndef INCLUDED_volk_32fc_s32fc_rotator64puppet_32fc_u_H
+#define INCLUDED_volk_32fc_s32fc_rotator64puppet_32fc_u_H
+
+#include <math.h>
+#include <volk/volk_32fc_s64fc_x2_rotator_32fc.h>
+#include <volk/volk_complex.h>
+
+
+#ifdef LV_HAVE_AVX
+#include <immintrin.h>
+
+static inline void volk_32fc_s32fc_rotator64puppet_32fc_u_avx(lv_32fc_t* outVector,
+                                                              const lv_32fc_t* inVector,
+                                                              const lv_32fc_t phase_inc,
+                                                              unsigned int num_points)
+{
+    lv_64fc_t phase[1] = { lv_cmake(.3, .95393) };
+    (*phase) /= hypot(lv_creal(*phase), lv_cimag(*phase));
+    const lv_64fc_t phase_inc_d = lv_cmake((double)lv_creal(phase_inc),
+                                           (double)lv_cimag(phase_inc));
+    const lv_64fc_t phase_inc_n =
+        phase_inc_d / hypot(lv_creal(phase_inc_d), lv_cimag(phase_inc_d));
+    volk_32fc_s64fc_x2_rotator_32fc_u_avx(
+        outVector, inVector, phase_inc_n, phase, num_points);
+}
+
+#endif /* LV_HAVE_AVX for unaligned */
+
+
+#ifdef LV_HAVE_AVX512F
+#include <immintrin.h>
+
+static inline void
+volk_32fc_s32fc_rotator64puppet_32fc_u_avx512f(lv_32fc_t* outVector,
+                                               const lv_32fc_t* inVector,
+                                               const lv_32fc_t phase_inc,
+                                               unsigned int num_points)
+{
+    lv_64fc_t phase[1] = { lv_cmake(.3, .95393) };
+    (*phase) /= hypot(lv_creal(*phase), lv_cimag(*phase));
+    const lv_64fc_t phase_inc_d = lv_cmake((double)lv_creal(phase_inc),
+                                           (double)lv_cimag(phase_inc));
+    const lv_64fc_t phase_inc_n =
+        phase_inc_d / hypot(lv_creal(phase_inc_d), lv_cimag(phase_inc_d));
+    volk_32fc_s64fc_x2_rotator_32fc_u_avx512f(
+        outVector, inVector, phase_inc_n, phase, num_points);
+}
+
+#endif /* LV_HAVE_AVX512F for unaligned */
+
+#endif /* INCLUDED_volk_32fc_s32fc_rotator64puppet_32fc_u_H */
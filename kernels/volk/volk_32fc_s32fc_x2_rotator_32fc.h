@@ -777,4 +777,138 @@ static inline void volk_32fc_s32fc_x2_rotator_32fc_u_avx_fma(lv_32fc_t* outVecto
 
 #endif /* LV_HAVE_AVX && LV_HAVE_FMA*/
 
+#ifdef LV_HAVE_AVX512F
+#include <immintrin.h>
+#include <volk/volk_avx512_intrinsics.h>
+
+static inline void volk_32fc_s32fc_x2_rotator_32fc_a_avx512f(lv_32fc_t* outVector,
+                                                             const lv_32fc_t* inVector,
+                                                             const lv_32fc_t phase_inc,
+                                                             lv_32fc_t* phase,
+                                                             unsigned int num_points)
+{
+    lv_32fc_t* cPtr = outVector;
+    const lv_32fc_t* aPtr = inVector;
+    lv_32fc_t incr = lv_cmake(1.0f, 0.0f);
+    __VOLK_ATTR_ALIGNED(64) lv_32fc_t phase_Ptr[8];
+
+    unsigned int i, j = 0;
+
+    for (i = 0; i < 8; ++i) {
+        phase_Ptr[i] = (*phase) * incr;
+        incr *= (phase_inc);
+    }
+
+    __m512 aVal, phase_Val, z;
+
+    phase_Val = _mm512_load_ps((float*)phase_Ptr);
+
+    const lv_32fc_t incr_Ptr[8] = { incr, incr, incr, incr, incr, incr, incr, incr };
+    const __m512 inc_Val = _mm512_loadu_ps((float*)incr_Ptr);
+
+    for (i = 0; i < (unsigned int)(num_points / ROTATOR_RELOAD); i++) {
+        for (j = 0; j < ROTATOR_RELOAD / 8; ++j) {
+
+            aVal = _mm512_load_ps((float*)aPtr);
+
+            z = _mm512_complexmul_ps(aVal, phase_Val);
+            phase_Val = _mm512_complexmul_ps(phase_Val, inc_Val);
+
+            _mm512_store_ps((float*)cPtr, z);
+
+            aPtr += 8;
+            cPtr += 8;
+        }
+        phase_Val = _mm512_normalize_ps(phase_Val);
+    }
+
+    for (i = 0; i < (num_points % ROTATOR_RELOAD) / 8; ++i) {
+        aVal = _mm512_load_ps((float*)aPtr);
+
+        z = _mm512_complexmul_ps(aVal, phase_Val);
+        phase_Val = _mm512_complexmul_ps(phase_Val, inc_Val);
+
+        _mm512_store_ps((float*)cPtr, z);
+
+        aPtr += 8;
+        cPtr += 8;
+    }
+    if (i) {
+        phase_Val = _mm512_normalize_ps(phase_Val);
+    }
+
+    _mm512_store_ps((float*)phase_Ptr, phase_Val);
+    (*phase) = phase_Ptr[0];
+    volk_32fc_s32fc_x2_rotator_32fc_generic(cPtr, aPtr, phase_inc, phase, num_points % 8);
+}
+
+#endif /* LV_HAVE_AVX512F for aligned */
+
+#ifdef LV_HAVE_AVX512F
+#include <immintrin.h>
+#include <volk/volk_avx512_intrinsics.h>
+
+static inline void volk_32fc_s32fc_x2_rotator_32fc_u_avx512f(lv_32fc_t* outVector,
+                                                             const lv_32fc_t* inVector,
+                                                             const lv_32fc_t phase_inc,
+                                                             lv_32fc_t* phase,
+                                                             unsigned int num_points)
+{
+    lv_32fc_t* cPtr = outVector;
+    const lv_32fc_t* aPtr = inVector;
+    lv_32fc_t incr = lv_cmake(1.0f, 0.0f);
+    __VOLK_ATTR_ALIGNED(64) lv_32fc_t phase_Ptr[8];
+
+    unsigned int i, j = 0;
+
+    for (i = 0; i < 8; ++i) {
+        phase_Ptr[i] = (*phase) * incr;
+        incr *= (phase_inc);
+    }
+
+    __m512 aVal, phase_Val, z;
+
+    phase_Val = _mm512_load_ps((float*)phase_Ptr);
+
+    const lv_32fc_t incr_Ptr[8] = { incr, incr, incr, incr, incr, incr, incr, incr };
+    const __m512 inc_Val = _mm512_loadu_ps((float*)incr_Ptr);
+
+    for (i = 0; i < (unsigned int)(num_points / ROTATOR_RELOAD); i++) {
+        for (j = 0; j < ROTATOR_RELOAD / 8; ++j) {
+
+            aVal = _mm512_loadu_ps((float*)aPtr);
+
+            z = _mm512_complexmul_ps(aVal, phase_Val);
+            phase_Val = _mm512_complexmul_ps(phase_Val, inc_Val);
+
+            _mm512_storeu_ps((float*)cPtr, z);
+
+            aPtr += 8;
+            cPtr += 8;
+        }
+        phase_Val = _mm512_normalize_ps(phase_Val);
+    }
+
+    for (i = 0; i < (num_points % ROTATOR_RELOAD) / 8; ++i) {
+        aVal = _mm512_loadu_ps((float*)aPtr);
+
+        z = _mm512_complexmul_ps(aVal, phase_Val);
+        phase_Val = _mm512_complexmul_ps(phase_Val, inc_Val);
+
+        _mm512_storeu_ps((float*)cPtr, z);
+
+        aPtr += 8;
+        cPtr += 8;
+    }
+    if (i) {
+        phase_Val = _mm512_normalize_ps(phase_Val);
+    }
+
+    _mm512_store_ps((float*)phase_Ptr, phase_Val);
+    (*phase) = phase_Ptr[0];
+    volk_32fc_s32fc_x2_rotator_32fc_generic(cPtr, aPtr, phase_inc, phase, num_points % 8);
+}
+
+#endif /* LV_HAVE_AVX512F for unaligned */
+
 #endif /* INCLUDED_volk_32fc_s32fc_rotator_32fc_a_H */
@@ -0,0 +1,513 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2026 Free Software Foundation, Inc.
+ *
+ * This file is part of VOLK
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+/*!
+ * \page volk_32fc_s64fc_x2_rotator_32fc
+ *
+ * \b Overview
+ *
+ * Rotate input vector at fixed rate per sample from initial phase
+ * offset, keeping the running phase in double precision.
+ *
+ * volk_32fc_s32fc_x2_rotator_32fc accumulates the phase in single precision
+ * and only renormalizes its magnitude, so the phase error grows over long
+ * runs. In this variant the samples are still rotated with single precision
+ * complex multiplies, but the phasor at the start of every ROTATOR_RELOAD
+ * block is recomputed from the double precision phase, so the single
+ * precision error never accumulates over more than one block.
+ *
+ * <b>Dispatcher Prototype</b>
+ * \code
+ * void volk_32fc_s64fc_x2_rotator_32fc(lv_32fc_t* outVector, const lv_32fc_t* inVector,
+ *                                      const lv_64fc_t phase_inc, lv_64fc_t* phase,
+ *                                      unsigned int num_points)
+ * \endcode
+ *
+ * \b Inputs
+ * \li inVector: Vector to be rotated.
+ * \li phase_inc: rotational velocity.
+ * \li phase: initial phase offset, updated to the phase of the next sample.
+ * \li num_points: The number of values in inVector to be rotated and stored into
+ * outVector.
+ *
+ * \b Outputs
+ * \li outVector: The vector where the results will be stored.
+ *
+ * \b Example
+ * Generate a tone at f=0.3 (normalized frequency) and use the rotator with
+ * f=0.1 to shift the tone to f=0.4.
+ * \code
+ *   int N = 10;
+ *   unsigned int alignment = volk_get_alignment();
+ *   lv_32fc_t* in  = (lv_32fc_t*)volk_malloc(sizeof(lv_32fc_t)*N, alignment);
+ *   lv_32fc_t* out = (lv_32fc_t*)volk_malloc(sizeof(lv_32fc_t)*N, alignment);
+ *
+ *   for(unsigned int ii = 0; ii < N; ++ii){
+ *       // Generate a tone at f=0.3
+ *       float real = std::cos(0.3f * (float)ii);
+ *       float imag = std::sin(0.3f * (float)ii);
+ *       in[ii] = lv_cmake(real, imag);
+ *   }
+ *   // The oscillator rotates at f=0.1
+ *   double frequency = 0.1;
+ *   lv_64fc_t phase_increment = lv_cmake(std::cos(frequency), std::sin(frequency));
+ *   lv_64fc_t phase = lv_cmake(1.0, 0.0); // start at 1 (0 rad phase)
+ *
+ *   // rotate so the output is a tone at f=0.4
+ *   volk_32fc_s64fc_x2_rotator_32fc(out, in, phase_increment, &phase, N);
+ *
+ *   // print results for inspection
+ *   for(unsigned int ii = 0; ii < N; ++ii){
+ *       printf("out[%u] = %+1.2f %+1.2fj\n",
+ *           ii, lv_creal(out[ii]), lv_cimag(out[ii]));
+ *   }
+ *
+ *   volk_free(in);
+ *   volk_free(out);
+ * \endcode
+ */
+
+#ifndef INCLUDED_volk_32fc_s64fc_x2_rotator_32fc_a_H
+#define INCLUDED_volk_32fc_s64fc_x2_rotator_32fc_a_H
+
+#include <math.h>
+#include <stdio.h>
+#include <volk/volk_32fc_s32fc_x2_rotator_32fc.h>
+#include <volk/volk_complex.h>
+
+/*
+ * x^n by square and multiply, in double precision. Used to advance the
+ * double precision phase over a whole block at once.
+ */
+static inline lv_64fc_t volk_rotator64_cpow(lv_64fc_t x, unsigned int n)
+{
+    lv_64fc_t result = lv_cmake(1.0, 0.0);
+    while (n) {
+        if (n & 1) {
+            result *= x;
+        }
+        x *= x;
+        n >>= 1;
+    }
+    return result;
+}
+
+/*
+ * Advance the double precision phase by one block and renormalize it.
+ */
+static inline void volk_rotator64_advance(lv_64fc_t* phase, const lv_64fc_t block_inc)
+{
+    (*phase) *= block_inc;
+    (*phase) /= hypot(lv_creal(*phase), lv_cimag(*phase));
+}
+
+static inline lv_32fc_t volk_rotator64_to_32fc(const lv_64fc_t x)
+{
+    return lv_cmake((float)lv_creal(x), (float)lv_cimag(x));
+}
+
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void volk_32fc_s64fc_x2_rotator_32fc_generic(lv_32fc_t* outVector,
+                                                           const lv_32fc_t* inVector,
+                                                           const lv_64fc_t phase_inc,
+                                                           lv_64fc_t* phase,
+                                                           unsigned int num_points)
+{
+    const lv_32fc_t incr = volk_rotator64_to_32fc(phase_inc);
+    const lv_64fc_t incr_reload = volk_rotator64_cpow(phase_inc, ROTATOR_RELOAD);
+    lv_32fc_t phase_f;
+
+    unsigned int i = 0;
+    int j = 0;
+    for (i = 0; i < (unsigned int)(num_points / ROTATOR_RELOAD); ++i) {
+        phase_f = volk_rotator64_to_32fc(*phase);
+        for (j = 0; j < ROTATOR_RELOAD; ++j) {
+            *outVector++ = *inVector++ * phase_f;
+            phase_f *= incr;
+        }
+        volk_rotator64_advance(phase, incr_reload);
+    }
+
+    const unsigned int rest = num_points % ROTATOR_RELOAD;
+    if (rest) {
+        phase_f = volk_rotator64_to_32fc(*phase);
+        for (i = 0; i < rest; ++i) {
+            *outVector++ = *inVector++ * phase_f;
+            phase_f *= incr;
+        }
+        volk_rotator64_advance(phase, volk_rotator64_cpow(phase_inc, rest));
+    }
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+
+#ifdef LV_HAVE_NEON
+#include <arm_neon.h>
+#include <volk/volk_neon_intrinsics.h>
+
+static inline void volk_32fc_s64fc_x2_rotator_32fc_neon(lv_32fc_t* outVector,
+                                                        const lv_32fc_t* inVector,
+                                                        const lv_64fc_t phase_inc,
+                                                        lv_64fc_t* phase,
+                                                        unsigned int num_points)
+{
+    lv_32fc_t* outputVectorPtr = outVector;
+    const lv_32fc_t* inputVectorPtr = inVector;
+    lv_64fc_t incr = lv_cmake(1.0, 0.0);
+    lv_64fc_t lane_incr[4];
+    lv_32fc_t phasePtr[4];
+    float32x4x2_t input_vec;
+    float32x4x2_t output_vec;
+    float32x4x2_t phase_vec;
+
+    unsigned int i, j, block;
+
+    for (i = 0; i < 4; ++i) {
+        lane_incr[i] = incr;
+        incr *= (phase_inc);
+    }
+
+    const lv_64fc_t incr_reload = volk_rotator64_cpow(phase_inc, ROTATOR_RELOAD);
+    const lv_32fc_t incr_f = volk_rotator64_to_32fc(incr);
+    const lv_32fc_t incrPtr[4] = { incr_f, incr_f, incr_f, incr_f };
+    const float32x4x2_t incr_vec = vld2q_f32((float*)incrPtr);
+
+    const unsigned int vector_points = num_points - num_points % 4;
+    for (i = 0; i < vector_points; i += block) {
+        block = vector_points - i;
+        if (block > ROTATOR_RELOAD) {
+            block = ROTATOR_RELOAD;
+        }
+
+        // reseed the lanes from the double precision phase
+        for (j = 0; j < 4; ++j) {
+            phasePtr[j] = volk_rotator64_to_32fc((*phase) * lane_incr[j]);
+        }
+        phase_vec = vld2q_f32((float*)phasePtr);
+
+        for (j = 0; j < block / 4; ++j) {
+            input_vec = vld2q_f32((float*)inputVectorPtr);
+            // Prefetch next one, speeds things up
+            __VOLK_PREFETCH(inputVectorPtr + 4);
+            // Rotate
+            output_vec = _vmultiply_complexq_f32(input_vec, phase_vec);
+            // Increase phase
+            phase_vec = _vmultiply_complexq_f32(phase_vec, incr_vec);
+            // Store output
+            vst2q_f32((float*)outputVectorPtr, output_vec);
+
+            outputVectorPtr += 4;
+            inputVectorPtr += 4;
+        }
+
+        volk_rotator64_advance(phase,
+                               (block == ROTATOR_RELOAD)
+                                   ? incr_reload
+                                   : volk_rotator64_cpow(phase_inc, block));
+    }
+
+    volk_32fc_s64fc_x2_rotator_32fc_generic(
+        outputVectorPtr, inputVectorPtr, phase_inc, phase, num_points % 4);
+}
+
+#endif /* LV_HAVE_NEON */
+
+
+#ifdef LV_HAVE_AVX
+#include <immintrin.h>
+#include <volk/volk_avx_intrinsics.h>
+
+static inline void volk_32fc_s64fc_x2_rotator_32fc_a_avx(lv_32fc_t* outVector,
+                                                         const lv_32fc_t* inVector,
+                                                         const lv_64fc_t phase_inc,
+                                                         lv_64fc_t* phase,
+                                                         unsigned int num_points)
+{
+    lv_32fc_t* cPtr = outVector;
+    const lv_32fc_t* aPtr = inVector;
+    lv_64fc_t incr = lv_cmake(1.0, 0.0);
+    lv_64fc_t lane_incr[4];
+    __VOLK_ATTR_ALIGNED(32) lv_32fc_t phase_Ptr[4];
+
+    unsigned int i, j, block;
+
+    for (i = 0; i < 4; ++i) {
+        lane_incr[i] = incr;
+        incr *= (phase_inc);
+    }
+
+    const lv_64fc_t incr_reload = volk_rotator64_cpow(phase_inc, ROTATOR_RELOAD);
+    const lv_32fc_t incr_f = volk_rotator64_to_32fc(incr);
+    const __m256 inc_Val = _mm256_set_ps(lv_cimag(incr_f),
+                                         lv_creal(incr_f),
+                                         lv_cimag(incr_f),
+                                         lv_creal(incr_f),
+                                         lv_cimag(incr_f),
+                                         lv_creal(incr_f),
+                                         lv_cimag(incr_f),
+                                         lv_creal(incr_f));
+
+    __m256 aVal, phase_Val, z;
+
+    const unsigned int vector_points = num_points - num_points % 4;
+    for (i = 0; i < vector_points; i += block) {
+        block = vector_points - i;
+        if (block > ROTATOR_RELOAD) {
+            block = ROTATOR_RELOAD;
+        }
+
+        // reseed the lanes from the double precision phase
+        for (j = 0; j < 4; ++j) {
+            phase_Ptr[j] = volk_rotator64_to_32fc((*phase) * lane_incr[j]);
+        }
+        phase_Val = _mm256_load_ps((float*)phase_Ptr);
+
+        for (j = 0; j < block / 4; ++j) {
+            aVal = _mm256_load_ps((float*)aPtr);
+
+            z = _mm256_complexmul_ps(aVal, phase_Val);
+            phase_Val = _mm256_complexmul_ps(phase_Val, inc_Val);
+
+            _mm256_store_ps((float*)cPtr, z);
+
+            aPtr += 4;
+            cPtr += 4;
+        }
+
+        volk_rotator64_advance(phase,
+                               (block == ROTATOR_RELOAD)
+                                   ? incr_reload
+                                   : volk_rotator64_cpow(phase_inc, block));
+    }
+
+    volk_32fc_s64fc_x2_rotator_32fc_generic(cPtr, aPtr, phase_inc, phase, num_points % 4);
+}
+
+#endif /* LV_HAVE_AVX for aligned */
+
+
+#ifdef LV_HAVE_AVX512F
+#include <immintrin.h>
+#include <volk/volk_avx512_intrinsics.h>
+
+static inline void volk_32fc_s64fc_x2_rotator_32fc_a_avx512f(lv_32fc_t* outVector,
+                                                             const lv_32fc_t* inVector,
+                                                             const lv_64fc_t phase_inc,
+                                                             lv_64fc_t* phase,
+                                                             unsigned int num_points)
+{
+    lv_32fc_t* cPtr = outVector;
+    const lv_32fc_t* aPtr = inVector;
+    lv_64fc_t incr = lv_cmake(1.0, 0.0);
+    lv_64fc_t lane_incr[8];
+    __VOLK_ATTR_ALIGNED(64) lv_32fc_t phase_Ptr[8];
+
+    unsigned int i, j, block;
+
+    for (i = 0; i < 8; ++i) {
+        lane_incr[i] = incr;
+        incr *= (phase_inc);
+    }
+
+    const lv_64fc_t incr_reload = volk_rotator64_cpow(phase_inc, ROTATOR_RELOAD);
+    const lv_32fc_t incr_f = volk_rotator64_to_32fc(incr);
+    const lv_32fc_t incr_Ptr[8] = {
+        incr_f, incr_f, incr_f, incr_f, incr_f, incr_f, incr_f, incr_f
+    };
+    const __m512 inc_Val = _mm512_loadu_ps((float*)incr_Ptr);
+
+    __m512 aVal, phase_Val, z;
+
+    const unsigned int vector_points = num_points - num_points % 8;
+    for (i = 0; i < vector_points; i += block) {
+        block = vector_points - i;
+        if (block > ROTATOR_RELOAD) {
+            block = ROTATOR_RELOAD;
+        }
+
+        // reseed the lanes from the double precision phase
+        for (j = 0; j < 8; ++j) {
+            phase_Ptr[j] = volk_rotator64_to_32fc((*phase) * lane_incr[j]);
+        }
+        phase_Val = _mm512_load_ps((float*)phase_Ptr);
+
+        for (j = 0; j < block / 8; ++j) {
+            aVal = _mm512_load_ps((float*)aPtr);
+
+            z = _mm512_complexmul_ps(aVal, phase_Val);
+            phase_Val = _mm512_complexmul_ps(phase_Val, inc_Val);
+
+            _mm512_store_ps((float*)cPtr, z);
+
+            aPtr += 8;
+            cPtr += 8;
+        }
+
+        volk_rotator64_advance(phase,
+                               (block == ROTATOR_RELOAD)
+                                   ? incr_reload
+                                   : volk_rotator64_cpow(phase_inc, block));
+    }
+
+    volk_32fc_s64fc_x2_rotator_32fc_generic(cPtr, aPtr, phase_inc, phase, num_points % 8);
+}
+
+#endif /* LV_HAVE_AVX512F for aligned */
+
+#endif /* INCLUDED_volk_32fc_s64fc_x2_rotator_32fc_a_H */
+
+
+#ifndef INCLUDED_volk_32fc_s64fc_x2_rotator_32fc_u_H
+#define INCLUDED_volk_32fc_s64fc_x2_rotator_32fc_u_H
+
+#ifdef LV_HAVE_AVX
+#include <immintrin.h>
+#include <volk/volk_avx_intrinsics.h>
+
+static inline void volk_32fc_s64fc_x2_rotator_32fc_u_avx(lv_32fc_t* outVector,
+                                                         const lv_32fc_t* inVector,
+                                                         const lv_64fc_t phase_inc,
+                                                         lv_64fc_t* phase,
+                                                         unsigned int num_points)
+{
+    lv_32fc_t* cPtr = outVector;
+    const lv_32fc_t* aPtr = inVector;
+    lv_64fc_t incr = lv_cmake(1.0, 0.0);
+    lv_64fc_t lane_incr[4];
+    __VOLK_ATTR_ALIGNED(32) lv_32fc_t phase_Ptr[4];
+
+    unsigned int i, j, block;
+
+    for (i = 0; i < 4; ++i) {
+        lane_incr[i] = incr;
+        incr *= (phase_inc);
+    }
+
+    const lv_64fc_t incr_reload = volk_rotator64_cpow(phase_inc, ROTATOR_RELOAD);
+    const lv_32fc_t incr_f = volk_rotator64_to_32fc(incr);
+    const __m256 inc_Val = _mm256_set_ps(lv_cimag(incr_f),
+                                         lv_creal(incr_f),
+                                         lv_cimag(incr_f),
+                                         lv_creal(incr_f),
+                                         lv_cimag(incr_f),
+                                         lv_creal(incr_f),
+                                         lv_cimag(incr_f),
+                                         lv_creal(incr_f));
+
+    __m256 aVal, phase_Val, z;
+
+    const unsigned int vector_points = num_points - num_points % 4;
+    for (i = 0; i < vector_points; i += block) {
+        block = vector_points - i;
+        if (block > ROTATOR_RELOAD) {
+            block = ROTATOR_RELOAD;
+        }
+
+        // reseed the lanes from the double precision phase
+        for (j = 0; j < 4; ++j) {
+            phase_Ptr[j] = volk_rotator64_to_32fc((*phase) * lane_incr[j]);
+        }
+        phase_Val = _mm256_load_ps((float*)phase_Ptr);
+
+        for (j = 0; j < block / 4; ++j) {
+            aVal = _mm256_loadu_ps((float*)aPtr);
+
+            z = _mm256_complexmul_ps(aVal, phase_Val);
+            phase_Val = _mm256_complexmul_ps(phase_Val, inc_Val);
+
+            _mm256_storeu_ps((float*)cPtr, z);
+
+            aPtr += 4;
+            cPtr += 4;
+        }
+
+        volk_rotator64_advance(phase,
+                               (block == ROTATOR_RELOAD)
+                                   ? incr_reload
+                                   : volk_rotator64_cpow(phase_inc, block));
+    }
+
+    volk_32fc_s64fc_x2_rotator_32fc_generic(cPtr, aPtr, phase_inc, phase, num_points % 4);
+}
+
+#endif /* LV_HAVE_AVX for unaligned */
+
+
+#ifdef LV_HAVE_AVX512F
+#include <immintrin.h>
+#include <volk/volk_avx512_intrinsics.h>
+
+static inline void volk_32fc_s64fc_x2_rotator_32fc_u_avx512f(lv_32fc_t* outVector,
+                                                             const lv_32fc_t* inVector,
+                                                             const lv_64fc_t phase_inc,
+                                                             lv_64fc_t* phase,
+                                                             unsigned int num_points)
+{
+    lv_32fc_t* cPtr = outVector;
+    const lv_32fc_t* aPtr = inVector;
+    lv_64fc_t incr = lv_cmake(1.0, 0.0);
+    lv_64fc_t lane_incr[8];
+    __VOLK_ATTR_ALIGNED(64) lv_32fc_t phase_Ptr[8];
+
+    unsigned int i, j, block;
+
+    for (i = 0; i < 8; ++i) {
+        lane_incr[i] = incr;
+        incr *= (phase_inc);
+    }
+
+    const lv_64fc_t incr_reload = volk_rotator64_cpow(phase_inc, ROTATOR_RELOAD);
+    const lv_32fc_t incr_f = volk_rotator64_to_32fc(incr);
+    const lv_32fc_t incr_Ptr[8] = {
+        incr_f, incr_f, incr_f, incr_f, incr_f, incr_f, incr_f, incr_f
+    };
+    const __m512 inc_Val = _mm512_loadu_ps((float*)incr_Ptr);
+
+    __m512 aVal, phase_Val, z;
+
+    const unsigned int vector_points = num_points - num_points % 8;
+    for (i = 0; i < vector_points; i += block) {
+        block = vector_points - i;
+        if (block > ROTATOR_RELOAD) {
+            block = ROTATOR_RELOAD;
+        }
+
+        // reseed the lanes from the double precision phase
+        for (j = 0; j < 8; ++j) {
+            phase_Ptr[j] = volk_rotator64_to_32fc((*phase) * lane_incr[j]);
+        }
+        phase_Val = _mm512_load_ps((float*)phase_Ptr);
+
+        for (j = 0; j < block / 8; ++j) {
+            aVal = _mm512_loadu_ps((float*)aPtr);
+
+            z = _mm512_complexmul_ps(aVal, phase_Val);
+            phase_Val = _mm512_complexmul_ps(phase_Val, inc_Val);
+
+            _mm512_storeu_ps((float*)cPtr, z);
+
+            aPtr += 8;
+            cPtr += 8;
+        }
+
+        volk_rotator64_advance(phase,
+                               (block == ROTATOR_RELOAD)
+                                   ? incr_reload
+                                   : volk_rotator64_cpow(phase_inc, block));
+    }
+
+    volk_32fc_s64fc_x2_rotator_32fc_generic(cPtr, aPtr, phase_inc, phase, num_points % 8);
+}
+
+#endif /* LV_HAVE_AVX512F for unaligned */
+
+#endif /* INCLUDED_volk_32fc_s64fc_x2_rotator_32fc_u_H */
@@ -0,0 +1,447 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2026 Free Software Foundation, Inc.
+ *
+ * This file is part of VOLK
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+/*!
+ * \page volk_32fc_transpose_32fc
+ *
+ * \b Overview
+ *
+ * Transposes a rows x cols complex matrix with row-major storage, e.g. for
+ * corner turns between a channelizer and per-channel processing. Blocking
+ * and streaming stores work as in volk_32f_transpose_32f.
+ *
+ * outputMatrix[c * output_stride + r] = inputMatrix[r * input_stride + c]
+ *
+ * <b>Dispatcher Prototype</b>
+ * \code
+ * void volk_32fc_transpose_32fc(lv_32fc_t* outputMatrix,
+ *                               const lv_32fc_t* inputMatrix,
+ *                               unsigned int rows,
+ *                               unsigned int cols,
+ *                               unsigned int input_stride,
+ *                               unsigned int output_stride)
+ * \endcode
+ *
+ * \b Inputs
+ * \li inputMatrix: the rows x cols input matrix.
+ * \li rows: the number of input rows.
+ * \li cols: the number of input columns.
+ * \li input_stride: the distance between input rows in elements, at least cols.
+ * \li output_stride: the distance between output rows in elements, at least rows.
+ *
+ * \b Outputs
+ * \li outputMatrix: the cols x rows transposed matrix, must not overlap the input.
+ *
+ * \b Example
+ * Turn the output of a 256 channel channelizer, one row per time step,
+ * into the 200 samples of each channel.
+ * \code
+ *   unsigned int channels = 256;
+ *   unsigned int steps = 200;
+ *   unsigned int alignment = volk_get_alignment();
+ *   lv_32fc_t* in =
+ *       (lv_32fc_t*)volk_malloc(sizeof(lv_32fc_t) * channels * steps, alignment);
+ *   lv_32fc_t* out =
+ *       (lv_32fc_t*)volk_malloc(sizeof(lv_32fc_t) * channels * steps, alignment);
+ *
+ *   // ... fill in
+ *
+ *   volk_32fc_transpose_32fc(out, in, steps, channels, channels, steps);
+ *
+ *   volk_free(in);
+ *   volk_free(out);
+ * \endcode
+ */
+
+#ifndef INCLUDED_volk_32fc_transpose_32fc_H
+#define INCLUDED_volk_32fc_transpose_32fc_H
+
+#include <volk/volk_32f_transpose_32f.h>
+#include <volk/volk_complex.h>
+
+static inline void volk_32fc_transpose_rect(lv_32fc_t* outputMatrix,
+                                            const lv_32fc_t* inputMatrix,
+                                            unsigned int row_begin,
+                                            unsigned int row_end,
+                                            unsigned int col_begin,
+                                            unsigned int col_end,
+                                            unsigned int input_stride,
+                                            unsigned int output_stride)
+{
+    unsigned int row, col;
+
+    for (col = col_begin; col < col_end; col++) {
+        for (row = row_begin; row < row_end; row++) {
+            outputMatrix[(size_t)col * output_stride + row] =
+                inputMatrix[(size_t)row * input_stride + col];
+        }
+    }
+}
+
+static inline void volk_32fc_transpose_edges(lv_32fc_t* outputMatrix,
+                                             const lv_32fc_t* inputMatrix,
+                                             unsigned int row0,
+                                             unsigned int row_end,
+                                             unsigned int col0,
+                                             unsigned int col_end,
+                                             unsigned int row_tile,
+                                             unsigned int col_tile,
+                                             unsigned int input_stride,
+                                             unsigned int output_stride)
+{
+    const unsigned int row_tiles = row0 + (row_end - row0) / row_tile * row_tile;
+    const unsigned int col_tiles = col0 + (col_end - col0) / col_tile * col_tile;
+
+    volk_32fc_transpose_rect(outputMatrix,
+                             inputMatrix,
+                             row0,
+                             row_end,
+                             col_tiles,
+                             col_end,
+                             input_stride,
+                             output_stride);
+    volk_32fc_transpose_rect(outputMatrix,
+                             inputMatrix,
+                             row_tiles,
+                             row_end,
+                             col0,
+                             col_tiles,
+                             input_stride,
+                             output_stride);
+}
+
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void volk_32fc_transpose_32fc_generic(lv_32fc_t* outputMatrix,
+                                                    const lv_32fc_t* inputMatrix,
+                                                    unsigned int rows,
+                                                    unsigned int cols,
+                                                    unsigned int input_stride,
+                                                    unsigned int output_stride)
+{
+    unsigned int row0, col0;
+
+    for (row0 = 0; row0 < rows; row0 += VOLK_TRANSPOSE_BLOCK) {
+        for (col0 = 0; col0 < cols; col0 += VOLK_TRANSPOSE_BLOCK) {
+            volk_32fc_transpose_rect(
+                outputMatrix,
+                inputMatrix,
+                row0,
+                volk_transpose_min(row0 + VOLK_TRANSPOSE_BLOCK, rows),
+                col0,
+                volk_transpose_min(col0 + VOLK_TRANSPOSE_BLOCK, cols),
+                input_stride,
+                output_stride);
+        }
+    }
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+
+#ifdef LV_HAVE_SSE2
+#include <emmintrin.h>
+
+static inline void volk_32fc_transpose_32fc_u_sse2(lv_32fc_t* outputMatrix,
+                                                   const lv_32fc_t* inputMatrix,
+                                                   unsigned int rows,
+                                                   unsigned int cols,
+                                                   unsigned int input_stride,
+                                                   unsigned int output_stride)
+{
+    unsigned int row0, col0, row_end, col_end, row, col;
+    const double* in;
+    double* out;
+    __m128d r0, r1;
+
+    for (row0 = 0; row0 < rows; row0 += VOLK_TRANSPOSE_BLOCK) {
+        row_end = volk_transpose_min(row0 + VOLK_TRANSPOSE_BLOCK, rows);
+        for (col0 = 0; col0 < cols; col0 += VOLK_TRANSPOSE_BLOCK) {
+            col_end = volk_transpose_min(col0 + VOLK_TRANSPOSE_BLOCK, cols);
+            for (col = col0; col + 2 <= col_end; col += 2) {
+                for (row = row0; row + 2 <= row_end; row += 2) {
+                    in = (const double*)(inputMatrix + (size_t)row * input_stride + col);
+                    out = (double*)(outputMatrix + (size_t)col * output_stride + row);
+                    r0 = _mm_loadu_pd(in);
+                    r1 = _mm_loadu_pd(in + input_stride);
+                    _mm_storeu_pd(out, _mm_unpacklo_pd(r0, r1));
+                    _mm_storeu_pd(out + output_stride, _mm_unpackhi_pd(r0, r1));
+                }
+            }
+            volk_32fc_transpose_edges(outputMatrix,
+                                      inputMatrix,
+                                      row0,
+                                      row_end,
+                                      col0,
+                                      col_end,
+                                      2,
+                                      2,
+                                      input_stride,
+                                      output_stride);
+        }
+    }
+}
+
+#endif /* LV_HAVE_SSE2 */
+
+
+#ifdef LV_HAVE_AVX
+#include <immintrin.h>
+
+static inline void volk_32fc_transpose_avx_tiles(lv_32fc_t* outputMatrix,
+                                                 const lv_32fc_t* inputMatrix,
+                                                 unsigned int rows,
+                                                 unsigned int cols,
+                                                 unsigned int input_stride,
+                                                 unsigned int output_stride,
+                                                 int stream);
+
+static inline void volk_32fc_transpose_32fc_u_avx(lv_32fc_t* outputMatrix,
+                                                  const lv_32fc_t* inputMatrix,
+                                                  unsigned int rows,
+                                                  unsigned int cols,
+                                                  unsigned int input_stride,
+                                                  unsigned int output_stride)
+{
+    const int stream =
+        volk_transpose_stream(outputMatrix, cols, output_stride, sizeof(lv_32fc_t), 32);
+    volk_32fc_transpose_avx_tiles(
+        outputMatrix, inputMatrix, rows, cols, input_stride, output_stride, stream);
+}
+
+// the tiled transpose, with non-temporal stores if stream is set, which needs
+// the output and its rows aligned to 32 bytes
+static inline void volk_32fc_transpose_avx_tiles(lv_32fc_t* outputMatrix,
+                                                 const lv_32fc_t* inputMatrix,
+                                                 unsigned int rows,
+                                                 unsigned int cols,
+                                                 unsigned int input_stride,
+                                                 unsigned int output_stride,
+                                                 int stream)
+{
+    // streaming stores take two tiles at once, so that every output row
+    // gets a whole cache line
+    const unsigned int row_tile = stream ? 8 : 4;
+    unsigned int row0, col0, row_end, col_end, row, col, half, k;
+    const double* in;
+    double* out;
+    __m256d t0, t1, t2, t3;
+    __m256d r[2][4];
+
+    for (row0 = 0; row0 < rows; row0 += VOLK_TRANSPOSE_BLOCK) {
+        row_end = volk_transpose_min(row0 + VOLK_TRANSPOSE_BLOCK, rows);
+        for (col0 = 0; col0 < cols; col0 += VOLK_TRANSPOSE_BLOCK) {
+            col_end = volk_transpose_min(col0 + VOLK_TRANSPOSE_BLOCK, cols);
+            for (col = col0; col + 4 <= col_end; col += 4) {
+                for (row = row0; row + row_tile <= row_end; row += row_tile) {
+                    for (half = 0; half < row_tile / 4; half++) {
+                        in = (const double*)(inputMatrix + col) +
+                             (size_t)(row + 4 * half) * input_stride;
+                        t0 = _mm256_loadu_pd(in);
+                        t1 = _mm256_loadu_pd(in + input_stride);
+                        t2 = _mm256_loadu_pd(in + 2 * input_stride);
+                        t3 = _mm256_loadu_pd(in + 3 * input_stride);
+                        r[half][0] = _mm256_unpacklo_pd(t0, t1);
+                        r[half][1] = _mm256_unpackhi_pd(t0, t1);
+                        r[half][2] = _mm256_unpacklo_pd(t2, t3);
+                        r[half][3] = _mm256_unpackhi_pd(t2, t3);
+                        t0 = _mm256_permute2f128_pd(r[half][0], r[half][2], 0x20);
+                        t1 = _mm256_permute2f128_pd(r[half][1], r[half][3], 0x20);
+                        t2 = _mm256_permute2f128_pd(r[half][0], r[half][2], 0x31);
+                        t3 = _mm256_permute2f128_pd(r[half][1], r[half][3], 0x31);
+                        r[half][0] = t0;
+                        r[half][1] = t1;
+                        r[half][2] = t2;
+                        r[half][3] = t3;
+                    }
+
+                    out = (double*)(outputMatrix + (size_t)col * output_stride + row);
+                    if (stream) {
+                        for (k = 0; k < 4; k++) {
+                            _mm256_stream_pd(out + k * output_stride, r[0][k]);
+                            _mm256_stream_pd(out + k * output_stride + 4, r[1][k]);
+                        }
+                    } else {
+                        for (k = 0; k < 4; k++) {
+                            _mm256_storeu_pd(out + k * output_stride, r[0][k]);
+                        }
+                    }
+                }
+            }
+            volk_32fc_transpose_edges(outputMatrix,
+                                      inputMatrix,
+                                      row0,
+                                      row_end,
+                                      col0,
+                                      col_end,
+                                      row_tile,
+                                      4,
+                                      input_stride,
+                                      output_stride);
+        }
+    }
+
+    if (stream) {
+        _mm_sfence();
+    }
+}
+
+#endif /* LV_HAVE_AVX */
+
+
+#ifdef LV_HAVE_AVX512F
+#include <immintrin.h>
+
+static inline void volk_32fc_transpose_avx512f_tiles(lv_32fc_t* outputMatrix,
+                                                     const lv_32fc_t* inputMatrix,
+                                                     unsigned int rows,
+                                                     unsigned int cols,
+                                                     unsigned int input_stride,
+                                                     unsigned int output_stride,
+                                                     int stream);
+
+static inline void volk_32fc_transpose_32fc_u_avx512f(lv_32fc_t* outputMatrix,
+                                                      const lv_32fc_t* inputMatrix,
+                                                      unsigned int rows,
+                                                      unsigned int cols,
+                                                      unsigned int input_stride,
+                                                      unsigned int output_stride)
+{
+    const int stream =
+        volk_transpose_stream(outputMatrix, cols, output_stride, sizeof(lv_32fc_t), 64);
+    volk_32fc_transpose_avx512f_tiles(
+        outputMatrix, inputMatrix, rows, cols, input_stride, output_stride, stream);
+}
+
+// the tiled transpose, with non-temporal stores if stream is set, which needs
+// the output and its rows aligned to 64 bytes
+static inline void volk_32fc_transpose_avx512f_tiles(lv_32fc_t* outputMatrix,
+                                                     const lv_32fc_t* inputMatrix,
+                                                     unsigned int rows,
+                                                     unsigned int cols,
+                                                     unsigned int input_stride,
+                                                     unsigned int output_stride,
+                                                     int stream)
+{
+    unsigned int row0, col0, row_end, col_end, row, col, k;
+    const double* in;
+    double* out;
+    __m512d r[8], t[8];
+
+    for (row0 = 0; row0 < rows; row0 += VOLK_TRANSPOSE_BLOCK) {
+        row_end = volk_transpose_min(row0 + VOLK_TRANSPOSE_BLOCK, rows);
+        for (col0 = 0; col0 < cols; col0 += VOLK_TRANSPOSE_BLOCK) {
+            col_end = volk_transpose_min(col0 + VOLK_TRANSPOSE_BLOCK, cols);
+            for (col = col0; col + 8 <= col_end; col += 8) {
+                for (row = row0; row + 8 <= row_end; row += 8) {
+                    in = (const double*)(inputMatrix + (size_t)row * input_stride + col);
+                    out = (double*)(outputMatrix + (size_t)col * output_stride + row);
+                    for (k = 0; k < 8; k++) {
+                        r[k] = _mm512_loadu_pd(in + k * input_stride);
+                    }
+
+                    // 2x2 transposes inside the 128-bit lanes of each pair of
+                    // rows, t[2 * p + j] holds column 2 * lane + j
+                    for (k = 0; k < 8; k += 2) {
+                        t[k] = _mm512_unpacklo_pd(r[k], r[k + 1]);
+                        t[k + 1] = _mm512_unpackhi_pd(r[k], r[k + 1]);
+                    }
+
+                    // then a 4x4 transpose of the lanes
+                    for (k = 0; k < 2; k++) {
+                        __m512d even01 = _mm512_shuffle_f64x2(t[k], t[2 + k], 0x88);
+                        __m512d odd01 = _mm512_shuffle_f64x2(t[k], t[2 + k], 0xDD);
+                        __m512d even23 = _mm512_shuffle_f64x2(t[4 + k], t[6 + k], 0x88);
+                        __m512d odd23 = _mm512_shuffle_f64x2(t[4 + k], t[6 + k], 0xDD);
+                        r[k] = _mm512_shuffle_f64x2(even01, even23, 0x88);
+                        r[2 + k] = _mm512_shuffle_f64x2(odd01, odd23, 0x88);
+                        r[4 + k] = _mm512_shuffle_f64x2(even01, even23, 0xDD);
+                        r[6 + k] = _mm512_shuffle_f64x2(odd01, odd23, 0xDD);
+                    }
+
+                    if (stream) {
+                        for (k = 0; k < 8; k++) {
+                            _mm512_stream_pd(out + k * output_stride, r[k]);
+                        }
+                    } else {
+                        for (k = 0; k < 8; k++) {
+                            _mm512_storeu_pd(out + k * output_stride, r[k]);
+                        }
+                    }
+                }
+            }
+            volk_32fc_transpose_edges(outputMatrix,
+                                      inputMatrix,
+                                      row0,
+                                      row_end,
+                                      col0,
+                                      col_end,
+                                      8,
+                                      8,
+                                      input_stride,
+                                      output_stride);
+        }
+    }
+
+    if (stream) {
+        _mm_sfence();
+    }
+}
+
+#endif /* LV_HAVE_AVX512F */
+
+
+#ifdef LV_HAVE_NEON
+#include <arm_neon.h>
+
+static inline void volk_32fc_transpose_32fc_neon(lv_32fc_t* outputMatrix,
+                                                 const lv_32fc_t* inputMatrix,
+                                                 unsigned int rows,
+                                                 unsigned int cols,
+                                                 unsigned int input_stride,
+                                                 unsigned int output_stride)
+{
+    unsigned int row0, col0, row_end, col_end, row, col;
+    const float* in;
+    float* out;
+    float32x4_t r0, r1;
+
+    for (row0 = 0; row0 < rows; row0 += VOLK_TRANSPOSE_BLOCK) {
+        row_end = volk_transpose_min(row0 + VOLK_TRANSPOSE_BLOCK, rows);
+        for (col0 = 0; col0 < cols; col0 += VOLK_TRANSPOSE_BLOCK) {
+            col_end = volk_transpose_min(col0 + VOLK_TRANSPOSE_BLOCK, cols);
+            for (col = col0; col + 2 <= col_end; col += 2) {
+                for (row = row0; row + 2 <= row_end; row += 2) {
+                    in = (const float*)(inputMatrix + (size_t)row * input_stride + col);
+                    out = (float*)(outputMatrix + (size_t)col * output_stride + row);
+                    r0 = vld1q_f32(in);
+                    r1 = vld1q_f32(in + 2 * input_stride);
+                    vst1q_f32(out, vcombine_f32(vget_low_f32(r0), vget_low_f32(r1)));
+                    vst1q_f32(out + 2 * output_stride,
+                              vcombine_f32(vget_high_f32(r0), vget_high_f32(r1)));
+                }
+            }
+            volk_32fc_transpose_edges(outputMatrix,
+                                      inputMatrix,
+                                      row0,
+                                      row_end,
+                                      col0,
+                                      col_end,
+                                      2,
+                                      2,
+                                      input_stride,
+                                      output_stride);
+        }
+    }
+}
+
+#endif /* LV_HAVE_NEON */
+
+#endif /* INCLUDED_volk_32fc_transpose_32fc_H */
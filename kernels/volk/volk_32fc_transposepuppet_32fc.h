@@ -0,0 +1,153 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2026 Free Software Foundation, Inc.
+ *
+ * This file is part of VOLK
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+/*
+ * QA wrapper for volk_32fc_transpose_32fc. The buffers are split into five segments
+ * holding a square matrix, a wide and a tall matrix with padded rows, a
+ * matrix of whole tiles with odd strides, and an aligned square matrix. QA
+ * vectors are far below VOLK_TRANSPOSE_STREAM_BYTES, so the AVX and AVX-512
+ * wrappers force the streaming stores on the last segment.
+ */
+
+#ifndef INCLUDED_volk_32fc_transposepuppet_32fc_H
+#define INCLUDED_volk_32fc_transposepuppet_32fc_H
+
+#include <string.h>
+#include <volk/volk_32fc_transpose_32fc.h>
+
+typedef void (*volk_32fc_transpose_kernel)(lv_32fc_t*,
+                                           const lv_32fc_t*,
+                                           unsigned int,
+                                           unsigned int,
+                                           unsigned int,
+                                           unsigned int);
+
+typedef void (*volk_32fc_transpose_tiles_kernel)(lv_32fc_t*,
+                                                 const lv_32fc_t*,
+                                                 unsigned int,
+                                                 unsigned int,
+                                                 unsigned int,
+                                                 unsigned int,
+                                                 int);
+
+static inline void
+volk_32fc_transposepuppet_32fc_run(volk_32fc_transpose_kernel kernel,
+                                   volk_32fc_transpose_tiles_kernel tiles,
+                                   lv_32fc_t* output,
+                                   const lv_32fc_t* input,
+                                   unsigned int num_points)
+{
+    // whole cache lines, so that the last segment stays aligned
+    const unsigned int segment = num_points / 5 & ~15u;
+    unsigned int side = 0;
+    unsigned int tiled, wide, aligned;
+
+    while ((side + 1) * (side + 1) <= segment) {
+        side++;
+    }
+    tiled = side > 5 ? (side - 5) & ~15u : 0;
+    wide = segment / 40;
+    aligned = side & ~15u;
+
+    memset(output, 0, num_points * sizeof(lv_32fc_t));
+    kernel(output, input, side, side, side, side);
+    kernel(output + segment, input + segment, 37, wide, wide, 40);
+    kernel(output + 2 * segment, input + 2 * segment, wide, 37, 40, wide);
+    kernel(
+        output + 3 * segment, input + 3 * segment, tiled, tiled, tiled + 3, tiled + 5);
+    if (tiles) {
+        tiles(output + 4 * segment,
+              input + 4 * segment,
+              aligned,
+              aligned,
+              aligned,
+              aligned,
+              1);
+    } else {
+        kernel(output + 4 * segment,
+               input + 4 * segment,
+               aligned,
+               aligned,
+               aligned,
+               aligned);
+    }
+}
+
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void volk_32fc_transposepuppet_32fc_generic(lv_32fc_t* output,
+                                                          const lv_32fc_t* input,
+                                                          unsigned int num_points)
+{
+    volk_32fc_transposepuppet_32fc_run(
+        volk_32fc_transpose_32fc_generic, NULL, output, input, num_points);
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+
+#ifdef LV_HAVE_SSE2
+
+static inline void volk_32fc_transposepuppet_32fc_u_sse2(lv_32fc_t* output,
+                                                         const lv_32fc_t* input,
+                                                         unsigned int num_points)
+{
+    volk_32fc_transposepuppet_32fc_run(
+        volk_32fc_transpose_32fc_u_sse2, NULL, output, input, num_points);
+}
+
+#endif /* LV_HAVE_SSE2 */
+
+
+#ifdef LV_HAVE_AVX
+
+static inline void volk_32fc_transposepuppet_32fc_u_avx(lv_32fc_t* output,
+                                                        const lv_32fc_t* input,
+                                                        unsigned int num_points)
+{
+    volk_32fc_transposepuppet_32fc_run(volk_32fc_transpose_32fc_u_avx,
+                                       volk_32fc_transpose_avx_tiles,
+                                       output,
+                                       input,
+                                       num_points);
+}
+
+#endif /* LV_HAVE_AVX */
+
+
+#ifdef LV_HAVE_AVX512F
+
+static inline void volk_32fc_transposepuppet_32fc_u_avx512f(lv_32fc_t* output,
+                                                            const lv_32fc_t* input,
+                                                            unsigned int num_points)
+{
+    volk_32fc_transposepuppet_32fc_run(volk_32fc_transpose_32fc_u_avx512f,
+                                       volk_32fc_transpose_avx512f_tiles,
+                                       output,
+                                       input,
+                                       num_points);
+}
+
+#endif /* LV_HAVE_AVX512F */
+
+
+#ifdef LV_HAVE_NEON
+
+static inline void volk_32fc_transposepuppet_32fc_neon(lv_32fc_t* output,
+                                                       const lv_32fc_t* input,
+                                                       unsigned int num_points)
+{
+    volk_32fc_transposepuppet_32fc_run(
+        volk_32fc_transpose_32fc_neon, NULL, output, input, num_points);
+}
+
+#endif /* LV_HAVE_NEON */
+
+#endif /* INCLUDED_volk_32fc_transposepuppet_32fc_H */
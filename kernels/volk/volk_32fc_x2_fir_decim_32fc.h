@@ -0,0 +1,528 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2026 Free Software Foundation, Inc.
+ *
+ * This file is part of VOLK
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+/*!
+ * \page volk_32fc_x2_fir_decim_32fc
+ *
+ * \b Overview
+ *
+ * FIR filter with integrated decimation for complex input with complex taps.
+ * Output n is the dot product of the taps with the input window starting at
+ * n * decimation:
+ *
+ * outVector[n] = sum_k inVector[n * decimation + k] * taps[k]
+ *
+ * The taps are applied in memory order like a dot product, so pass them time
+ * reversed for a conventional convolution. inVector holds the filter history
+ * followed by the new samples and must contain at least
+ * (num_points - 1) * decimation + num_taps items. Four outputs are computed
+ * per pass, so every block of taps is loaded once for all of them. See also
+ * volk_32fc_32f_fir_decim_32fc and volk_32f_x2_fir_decim_32f.
+ *
+ * <b>Dispatcher Prototype</b>
+ * \code
+ * void volk_32fc_x2_fir_decim_32fc(lv_32fc_t* outVector, const lv_32fc_t* inVector,
+ *                                  const lv_32fc_t* taps,
+ *                                  unsigned int num_taps, unsigned int decimation,
+ *                                  unsigned int num_points)
+ * \endcode
+ *
+ * \b Inputs
+ * \li inVector: The filter history followed by the input samples.
+ * \li taps: The filter taps.
+ * \li num_taps: The number of taps.
+ * \li decimation: The number of input samples consumed per output.
+ * \li num_points: The number of output samples to produce.
+ *
+ * \b Outputs
+ * \li outVector: The filtered and decimated samples.
+ *
+ * \b Example
+ * A 4 tap moving average, decimated by 2.
+ * \code
+ *   unsigned int num_taps = 4;
+ *   unsigned int decimation = 2;
+ *   unsigned int N = 10;
+ *   unsigned int num_in = (N - 1) * decimation + num_taps;
+ *   unsigned int alignment = volk_get_alignment();
+ *   lv_32fc_t* in = (lv_32fc_t*)volk_malloc(sizeof(lv_32fc_t) * num_in, alignment);
+ *   lv_32fc_t* taps = (lv_32fc_t*)volk_malloc(sizeof(lv_32fc_t) * num_taps, alignment);
+ *   lv_32fc_t* out = (lv_32fc_t*)volk_malloc(sizeof(lv_32fc_t) * N, alignment);
+ *
+ *   for(unsigned int ii = 0; ii < num_in; ++ii){
+ *       in[ii] = lv_cmake(1.f, 0.f);
+ *   }
+ *   for(unsigned int ii = 0; ii < num_taps; ++ii){
+ *       taps[ii] = lv_cmake(1.f / num_taps, 0.f);
+ *   }
+ *
+ *   volk_32fc_x2_fir_decim_32fc(out, in, taps, num_taps, decimation, N);
+ *
+ *   for(unsigned int ii = 0; ii < N; ++ii){
+ *       printf("out[%u] = %+1.2f %+1.2fj\n", ii, lv_creal(out[ii]), lv_cimag(out[ii]));
+ *   }
+ *
+ *   volk_free(in);
+ *   volk_free(taps);
+ *   volk_free(out);
+ * \endcode
+ */
+
+#ifndef INCLUDED_volk_32fc_x2_fir_decim_32fc_u_H
+#define INCLUDED_volk_32fc_x2_fir_decim_32fc_u_H
+
+#include <volk/volk_complex.h>
+
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void volk_32fc_x2_fir_decim_32fc_generic(lv_32fc_t* outVector,
+                                                       const lv_32fc_t* inVector,
+                                                       const lv_32fc_t* taps,
+                                                       unsigned int num_taps,
+                                                       unsigned int decimation,
+                                                       unsigned int num_points)
+{
+    const lv_32fc_t* inPtr = inVector;
+    unsigned int n, k;
+
+    for (n = 0; n < num_points; n++) {
+        lv_32fc_t sum = lv_cmake(0.f, 0.f);
+        for (k = 0; k < num_taps; k++) {
+            sum += inPtr[k] * taps[k];
+        }
+        *outVector++ = sum;
+        inPtr += decimation;
+    }
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+
+#ifdef LV_HAVE_SSE3
+#include <pmmintrin.h>
+
+static inline void volk_32fc_x2_fir_decim_32fc_u_sse3(lv_32fc_t* outVector,
+                                                      const lv_32fc_t* inVector,
+                                                      const lv_32fc_t* taps,
+                                                      unsigned int num_taps,
+                                                      unsigned int decimation,
+                                                      unsigned int num_points)
+{
+    const unsigned int half_taps = num_taps / 2;
+    const unsigned int block_taps = half_taps * 2;
+    const unsigned int stride = decimation; // complex samples between outputs
+    const lv_32fc_t* inPtr = inVector;
+    lv_32fc_t* outPtr = outVector;
+    unsigned int n, k, o;
+
+    __m128 tapRe, tapIm, aVal, acc0, acc1, acc2, acc3, sw0, sw1, sw2, sw3;
+
+    // Four outputs per pass: each block of taps is loaded once and
+    // multiplied into four independent accumulators.
+    for (n = 0; n + 4 <= num_points; n += 4) {
+        const float* in0 = (const float*)inPtr;
+        const float* in1 = (const float*)(inPtr + stride);
+        const float* in2 = (const float*)(inPtr + 2 * stride);
+        const float* in3 = (const float*)(inPtr + 3 * stride);
+
+        acc0 = _mm_setzero_ps();
+        acc1 = _mm_setzero_ps();
+        acc2 = _mm_setzero_ps();
+        acc3 = _mm_setzero_ps();
+        sw0 = _mm_setzero_ps();
+        sw1 = _mm_setzero_ps();
+        sw2 = _mm_setzero_ps();
+        sw3 = _mm_setzero_ps();
+
+        for (k = 0; k < half_taps; k++) {
+            aVal = _mm_loadu_ps((const float*)(taps + 2 * k));
+            tapRe = _mm_moveldup_ps(aVal); // tr, tr, ...
+            tapIm = _mm_movehdup_ps(aVal); // ti, ti, ...
+
+            aVal = _mm_loadu_ps(in0 + 4 * k);
+            acc0 = _mm_add_ps(acc0, _mm_mul_ps(aVal, tapRe));
+            aVal = _mm_shuffle_ps(aVal, aVal, 0xB1);
+            sw0 = _mm_add_ps(sw0, _mm_mul_ps(aVal, tapIm));
+            aVal = _mm_loadu_ps(in1 + 4 * k);
+            acc1 = _mm_add_ps(acc1, _mm_mul_ps(aVal, tapRe));
+            aVal = _mm_shuffle_ps(aVal, aVal, 0xB1);
+            sw1 = _mm_add_ps(sw1, _mm_mul_ps(aVal, tapIm));
+            aVal = _mm_loadu_ps(in2 + 4 * k);
+            acc2 = _mm_add_ps(acc2, _mm_mul_ps(aVal, tapRe));
+            aVal = _mm_shuffle_ps(aVal, aVal, 0xB1);
+            sw2 = _mm_add_ps(sw2, _mm_mul_ps(aVal, tapIm));
+            aVal = _mm_loadu_ps(in3 + 4 * k);
+            acc3 = _mm_add_ps(acc3, _mm_mul_ps(aVal, tapRe));
+            aVal = _mm_shuffle_ps(aVal, aVal, 0xB1);
+            sw3 = _mm_add_ps(sw3, _mm_mul_ps(aVal, tapIm));
+        }
+
+        // complex multiply: tr * (ar, ai) -/+ ti * (ai, ar)
+        acc0 = _mm_addsub_ps(acc0, sw0);
+        acc1 = _mm_addsub_ps(acc1, sw1);
+        acc2 = _mm_addsub_ps(acc2, sw2);
+        acc3 = _mm_addsub_ps(acc3, sw3);
+
+        // fold the two complex lanes of every accumulator
+        acc0 = _mm_add_ps(acc0, _mm_movehl_ps(acc0, acc0));
+        acc1 = _mm_add_ps(acc1, _mm_movehl_ps(acc1, acc1));
+        acc2 = _mm_add_ps(acc2, _mm_movehl_ps(acc2, acc2));
+        acc3 = _mm_add_ps(acc3, _mm_movehl_ps(acc3, acc3));
+
+        _mm_storel_pi((__m64*)outPtr, acc0);
+        _mm_storel_pi((__m64*)(outPtr + 1), acc1);
+        _mm_storel_pi((__m64*)(outPtr + 2), acc2);
+        _mm_storel_pi((__m64*)(outPtr + 3), acc3);
+
+        for (k = block_taps; k < num_taps; k++) {
+            for (o = 0; o < 4; o++) {
+                outPtr[o] += inPtr[o * stride + k] * taps[k];
+            }
+        }
+
+        inPtr += 4 * stride;
+        outPtr += 4;
+    }
+
+    volk_32fc_x2_fir_decim_32fc_generic(
+        outPtr, inPtr, taps, num_taps, decimation, num_points - n);
+}
+
+#endif /* LV_HAVE_SSE3 */
+
+
+#if LV_HAVE_AVX2 && LV_HAVE_FMA
+#include <immintrin.h>
+
+static inline void volk_32fc_x2_fir_decim_32fc_u_avx2_fma(lv_32fc_t* outVector,
+                                                          const lv_32fc_t* inVector,
+                                                          const lv_32fc_t* taps,
+                                                          unsigned int num_taps,
+                                                          unsigned int decimation,
+                                                          unsigned int num_points)
+{
+    const unsigned int quarter_taps = num_taps / 4;
+    const unsigned int block_taps = quarter_taps * 4;
+    const unsigned int stride = decimation; // complex samples between outputs
+    const lv_32fc_t* inPtr = inVector;
+    lv_32fc_t* outPtr = outVector;
+    unsigned int n, k, o;
+
+    __m256 tapRe, tapIm, aVal, acc0, acc1, acc2, acc3, sw0, sw1, sw2, sw3;
+    __m256 sum01, sum23, sum;
+
+    // Four outputs per pass: each block of taps is loaded once and
+    // multiplied into four independent accumulators.
+    for (n = 0; n + 4 <= num_points; n += 4) {
+        const float* in0 = (const float*)inPtr;
+        const float* in1 = (const float*)(inPtr + stride);
+        const float* in2 = (const float*)(inPtr + 2 * stride);
+        const float* in3 = (const float*)(inPtr + 3 * stride);
+
+        acc0 = _mm256_setzero_ps();
+        acc1 = _mm256_setzero_ps();
+        acc2 = _mm256_setzero_ps();
+        acc3 = _mm256_setzero_ps();
+        sw0 = _mm256_setzero_ps();
+        sw1 = _mm256_setzero_ps();
+        sw2 = _mm256_setzero_ps();
+        sw3 = _mm256_setzero_ps();
+
+        for (k = 0; k < quarter_taps; k++) {
+            aVal = _mm256_loadu_ps((const float*)(taps + 4 * k));
+            tapRe = _mm256_moveldup_ps(aVal); // tr, tr, ...
+            tapIm = _mm256_movehdup_ps(aVal); // ti, ti, ...
+
+            aVal = _mm256_loadu_ps(in0 + 8 * k);
+            acc0 = _mm256_fmadd_ps(aVal, tapRe, acc0);
+            aVal = _mm256_permute_ps(aVal, 0xB1);
+            sw0 = _mm256_fmadd_ps(aVal, tapIm, sw0);
+            aVal = _mm256_loadu_ps(in1 + 8 * k);
+            acc1 = _mm256_fmadd_ps(aVal, tapRe, acc1);
+            aVal = _mm256_permute_ps(aVal, 0xB1);
+            sw1 = _mm256_fmadd_ps(aVal, tapIm, sw1);
+            aVal = _mm256_loadu_ps(in2 + 8 * k);
+            acc2 = _mm256_fmadd_ps(aVal, tapRe, acc2);
+            aVal = _mm256_permute_ps(aVal, 0xB1);
+            sw2 = _mm256_fmadd_ps(aVal, tapIm, sw2);
+            aVal = _mm256_loadu_ps(in3 + 8 * k);
+            acc3 = _mm256_fmadd_ps(aVal, tapRe, acc3);
+            aVal = _mm256_permute_ps(aVal, 0xB1);
+            sw3 = _mm256_fmadd_ps(aVal, tapIm, sw3);
+        }
+
+        // complex multiply: tr * (ar, ai) -/+ ti * (ai, ar)
+        acc0 = _mm256_addsub_ps(acc0, sw0);
+        acc1 = _mm256_addsub_ps(acc1, sw1);
+        acc2 = _mm256_addsub_ps(acc2, sw2);
+        acc3 = _mm256_addsub_ps(acc3, sw3);
+
+        // (c0a c0b | c1a c1b) and (c2a c2b | c3a c3b)
+        sum01 = _mm256_add_ps(_mm256_permute2f128_ps(acc0, acc1, 0x20),
+                              _mm256_permute2f128_ps(acc0, acc1, 0x31));
+        sum23 = _mm256_add_ps(_mm256_permute2f128_ps(acc2, acc3, 0x20),
+                              _mm256_permute2f128_ps(acc2, acc3, 0x31));
+        // (c0 c2 | c1 c3)
+        sum = _mm256_add_ps(_mm256_shuffle_ps(sum01, sum23, 0x44),
+                            _mm256_shuffle_ps(sum01, sum23, 0xEE));
+        sum = _mm256_castpd_ps(_mm256_permute4x64_pd(_mm256_castps_pd(sum), 0xD8));
+        _mm256_storeu_ps((float*)outPtr, sum);
+
+        for (k = block_taps; k < num_taps; k++) {
+            for (o = 0; o < 4; o++) {
+                outPtr[o] += inPtr[o * stride + k] * taps[k];
+            }
+        }
+
+        inPtr += 4 * stride;
+        outPtr += 4;
+    }
+
+    volk_32fc_x2_fir_decim_32fc_generic(
+        outPtr, inPtr, taps, num_taps, decimation, num_points - n);
+}
+
+#endif /* LV_HAVE_AVX2 && LV_HAVE_FMA */
+
+
+#ifdef LV_HAVE_AVX512F
+#include <immintrin.h>
+
+static inline void volk_32fc_x2_fir_decim_32fc_u_avx512f(lv_32fc_t* outVector,
+                                                         const lv_32fc_t* inVector,
+                                                         const lv_32fc_t* taps,
+                                                         unsigned int num_taps,
+                                                         unsigned int decimation,
+                                                         unsigned int num_points)
+{
+    const unsigned int eighth_taps = num_taps / 8;
+    const unsigned int block_taps = eighth_taps * 8;
+    const unsigned int stride = decimation; // complex samples between outputs
+    const lv_32fc_t* inPtr = inVector;
+    lv_32fc_t* outPtr = outVector;
+    unsigned int n, k;
+    const __mmask16 tailMask =
+        (__mmask16)((1u << (2 * (num_taps - block_taps))) - 1);
+
+    __m512 tapRe, tapIm, aVal, acc0, acc1, acc2, acc3, sw0, sw1, sw2, sw3;
+    __m256 sum01, sum23, sum;
+    __m256 h0, h1, h2, h3;
+    __m256 g0, g1, g2, g3;
+
+    // Four outputs per pass: each block of taps is loaded once and
+    // multiplied into four independent accumulators.
+    for (n = 0; n + 4 <= num_points; n += 4) {
+        const float* in0 = (const float*)inPtr;
+        const float* in1 = (const float*)(inPtr + stride);
+        const float* in2 = (const float*)(inPtr + 2 * stride);
+        const float* in3 = (const float*)(inPtr + 3 * stride);
+
+        acc0 = _mm512_setzero_ps();
+        acc1 = _mm512_setzero_ps();
+        acc2 = _mm512_setzero_ps();
+        acc3 = _mm512_setzero_ps();
+        sw0 = _mm512_setzero_ps();
+        sw1 = _mm512_setzero_ps();
+        sw2 = _mm512_setzero_ps();
+        sw3 = _mm512_setzero_ps();
+
+        for (k = 0; k < eighth_taps; k++) {
+            aVal = _mm512_loadu_ps((const float*)(taps + 8 * k));
+            tapRe = _mm512_moveldup_ps(aVal); // tr, tr, ...
+            tapIm = _mm512_movehdup_ps(aVal); // ti, ti, ...
+
+            aVal = _mm512_loadu_ps(in0 + 16 * k);
+            acc0 = _mm512_fmadd_ps(aVal, tapRe, acc0);
+            aVal = _mm512_permute_ps(aVal, 0xB1);
+            sw0 = _mm512_fmadd_ps(aVal, tapIm, sw0);
+            aVal = _mm512_loadu_ps(in1 + 16 * k);
+            acc1 = _mm512_fmadd_ps(aVal, tapRe, acc1);
+            aVal = _mm512_permute_ps(aVal, 0xB1);
+            sw1 = _mm512_fmadd_ps(aVal, tapIm, sw1);
+            aVal = _mm512_loadu_ps(in2 + 16 * k);
+            acc2 = _mm512_fmadd_ps(aVal, tapRe, acc2);
+            aVal = _mm512_permute_ps(aVal, 0xB1);
+            sw2 = _mm512_fmadd_ps(aVal, tapIm, sw2);
+            aVal = _mm512_loadu_ps(in3 + 16 * k);
+            acc3 = _mm512_fmadd_ps(aVal, tapRe, acc3);
+            aVal = _mm512_permute_ps(aVal, 0xB1);
+            sw3 = _mm512_fmadd_ps(aVal, tapIm, sw3);
+        }
+
+        if (block_taps < num_taps) {
+            // remaining taps, masked out lanes are neither read nor accumulated
+            aVal = _mm512_maskz_loadu_ps(tailMask, (const float*)(taps + 8 * k));
+            tapRe = _mm512_moveldup_ps(aVal);
+            tapIm = _mm512_movehdup_ps(aVal);
+
+            aVal = _mm512_maskz_loadu_ps(tailMask, in0 + 16 * k);
+            acc0 = _mm512_fmadd_ps(aVal, tapRe, acc0);
+            aVal = _mm512_permute_ps(aVal, 0xB1);
+            sw0 = _mm512_fmadd_ps(aVal, tapIm, sw0);
+            aVal = _mm512_maskz_loadu_ps(tailMask, in1 + 16 * k);
+            acc1 = _mm512_fmadd_ps(aVal, tapRe, acc1);
+            aVal = _mm512_permute_ps(aVal, 0xB1);
+            sw1 = _mm512_fmadd_ps(aVal, tapIm, sw1);
+            aVal = _mm512_maskz_loadu_ps(tailMask, in2 + 16 * k);
+            acc2 = _mm512_fmadd_ps(aVal, tapRe, acc2);
+            aVal = _mm512_permute_ps(aVal, 0xB1);
+            sw2 = _mm512_fmadd_ps(aVal, tapIm, sw2);
+            aVal = _mm512_maskz_loadu_ps(tailMask, in3 + 16 * k);
+            acc3 = _mm512_fmadd_ps(aVal, tapRe, acc3);
+            aVal = _mm512_permute_ps(aVal, 0xB1);
+            sw3 = _mm512_fmadd_ps(aVal, tapIm, sw3);
+        }
+
+        // fold every accumulator to 256 bits
+        h0 = _mm256_add_ps(
+            _mm512_castps512_ps256(acc0),
+            _mm256_castpd_ps(_mm512_extractf64x4_pd(_mm512_castps_pd(acc0), 1)));
+        h1 = _mm256_add_ps(
+            _mm512_castps512_ps256(acc1),
+            _mm256_castpd_ps(_mm512_extractf64x4_pd(_mm512_castps_pd(acc1), 1)));
+        h2 = _mm256_add_ps(
+            _mm512_castps512_ps256(acc2),
+            _mm256_castpd_ps(_mm512_extractf64x4_pd(_mm512_castps_pd(acc2), 1)));
+        h3 = _mm256_add_ps(
+            _mm512_castps512_ps256(acc3),
+            _mm256_castpd_ps(_mm512_extractf64x4_pd(_mm512_castps_pd(acc3), 1)));
+        g0 = _mm256_add_ps(
+            _mm512_castps512_ps256(sw0),
+            _mm256_castpd_ps(_mm512_extractf64x4_pd(_mm512_castps_pd(sw0), 1)));
+        g1 = _mm256_add_ps(
+            _mm512_castps512_ps256(sw1),
+            _mm256_castpd_ps(_mm512_extractf64x4_pd(_mm512_castps_pd(sw1), 1)));
+        g2 = _mm256_add_ps(
+            _mm512_castps512_ps256(sw2),
+            _mm256_castpd_ps(_mm512_extractf64x4_pd(_mm512_castps_pd(sw2), 1)));
+        g3 = _mm256_add_ps(
+            _mm512_castps512_ps256(sw3),
+            _mm256_castpd_ps(_mm512_extractf64x4_pd(_mm512_castps_pd(sw3), 1)));
+
+        // complex multiply: tr * (ar, ai) -/+ ti * (ai, ar)
+        h0 = _mm256_addsub_ps(h0, g0);
+        h1 = _mm256_addsub_ps(h1, g1);
+        h2 = _mm256_addsub_ps(h2, g2);
+        h3 = _mm256_addsub_ps(h3, g3);
+
+        // (c0a c0b | c1a c1b) and (c2a c2b | c3a c3b)
+        sum01 = _mm256_add_ps(_mm256_permute2f128_ps(h0, h1, 0x20),
+                              _mm256_permute2f128_ps(h0, h1, 0x31));
+        sum23 = _mm256_add_ps(_mm256_permute2f128_ps(h2, h3, 0x20),
+                              _mm256_permute2f128_ps(h2, h3, 0x31));
+        // (c0 c2 | c1 c3)
+        sum = _mm256_add_ps(_mm256_shuffle_ps(sum01, sum23, 0x44),
+                            _mm256_shuffle_ps(sum01, sum23, 0xEE));
+        sum = _mm256_castpd_ps(_mm256_permute4x64_pd(_mm256_castps_pd(sum), 0xD8));
+        _mm256_storeu_ps((float*)outPtr, sum);
+
+        inPtr += 4 * stride;
+        outPtr += 4;
+    }
+
+    volk_32fc_x2_fir_decim_32fc_generic(
+        outPtr, inPtr, taps, num_taps, decimation, num_points - n);
+}
+
+#endif /* LV_HAVE_AVX512F */
+
+
+#ifdef LV_HAVE_NEON
+#include <arm_neon.h>
+
+static inline void volk_32fc_x2_fir_decim_32fc_neon(lv_32fc_t* outVector,
+                                                    const lv_32fc_t* inVector,
+                                                    const lv_32fc_t* taps,
+                                                    unsigned int num_taps,
+                                                    unsigned int decimation,
+                                                    unsigned int num_points)
+{
+    const unsigned int quarter_taps = num_taps / 4;
+    const unsigned int block_taps = quarter_taps * 4;
+    const unsigned int stride = decimation; // complex samples between outputs
+    const lv_32fc_t* inPtr = inVector;
+    lv_32fc_t* outPtr = outVector;
+    unsigned int n, k, o;
+
+    float32x4x2_t tap, aVal;
+    float32x4_t re0, re1, re2, re3, im0, im1, im2, im3;
+
+    // Four outputs per pass: each block of taps is loaded once and
+    // multiplied into four independent accumulators.
+    for (n = 0; n + 4 <= num_points; n += 4) {
+        const float* in0 = (const float*)inPtr;
+        const float* in1 = (const float*)(inPtr + 1 * stride);
+        const float* in2 = (const float*)(inPtr + 2 * stride);
+        const float* in3 = (const float*)(inPtr + 3 * stride);
+
+        re0 = vdupq_n_f32(0.f);
+        re1 = vdupq_n_f32(0.f);
+        re2 = vdupq_n_f32(0.f);
+        re3 = vdupq_n_f32(0.f);
+        im0 = vdupq_n_f32(0.f);
+        im1 = vdupq_n_f32(0.f);
+        im2 = vdupq_n_f32(0.f);
+        im3 = vdupq_n_f32(0.f);
+
+        for (k = 0; k < quarter_taps; k++) {
+            tap = vld2q_f32((const float*)(taps + 4 * k));
+            aVal = vld2q_f32(in0 + 8 * k);
+            re0 = vmlaq_f32(re0, aVal.val[0], tap.val[0]);
+            re0 = vmlsq_f32(re0, aVal.val[1], tap.val[1]);
+            im0 = vmlaq_f32(im0, aVal.val[0], tap.val[1]);
+            im0 = vmlaq_f32(im0, aVal.val[1], tap.val[0]);
+            aVal = vld2q_f32(in1 + 8 * k);
+            re1 = vmlaq_f32(re1, aVal.val[0], tap.val[0]);
+            re1 = vmlsq_f32(re1, aVal.val[1], tap.val[1]);
+            im1 = vmlaq_f32(im1, aVal.val[0], tap.val[1]);
+            im1 = vmlaq_f32(im1, aVal.val[1], tap.val[0]);
+            aVal = vld2q_f32(in2 + 8 * k);
+            re2 = vmlaq_f32(re2, aVal.val[0], tap.val[0]);
+            re2 = vmlsq_f32(re2, aVal.val[1], tap.val[1]);
+            im2 = vmlaq_f32(im2, aVal.val[0], tap.val[1]);
+            im2 = vmlaq_f32(im2, aVal.val[1], tap.val[0]);
+            aVal = vld2q_f32(in3 + 8 * k);
+            re3 = vmlaq_f32(re3, aVal.val[0], tap.val[0]);
+            re3 = vmlsq_f32(re3, aVal.val[1], tap.val[1]);
+            im3 = vmlaq_f32(im3, aVal.val[0], tap.val[1]);
+            im3 = vmlaq_f32(im3, aVal.val[1], tap.val[0]);
+        }
+
+        // (sum(re), sum(im)) of every output
+        vst1_f32((float*)outPtr,
+                 vpadd_f32(vpadd_f32(vget_low_f32(re0), vget_high_f32(re0)),
+                           vpadd_f32(vget_low_f32(im0), vget_high_f32(im0))));
+        vst1_f32((float*)(outPtr + 1),
+                 vpadd_f32(vpadd_f32(vget_low_f32(re1), vget_high_f32(re1)),
+                           vpadd_f32(vget_low_f32(im1), vget_high_f32(im1))));
+        vst1_f32((float*)(outPtr + 2),
+                 vpadd_f32(vpadd_f32(vget_low_f32(re2), vget_high_f32(re2)),
+                           vpadd_f32(vget_low_f32(im2), vget_high_f32(im2))));
+        vst1_f32((float*)(outPtr + 3),
+                 vpadd_f32(vpadd_f32(vget_low_f32(re3), vget_high_f32(re3)),
+                           vpadd_f32(vget_low_f32(im3), vget_high_f32(im3))));
+
+        for (k = block_taps; k < num_taps; k++) {
+            for (o = 0; o < 4; o++) {
+                outPtr[o] += inPtr[o * stride + k] * taps[k];
+            }
+        }
+
+        inPtr += 4 * stride;
+        outPtr += 4;
+    }
+
+    volk_32fc_x2_fir_decim_32fc_generic(
+        outPtr, inPtr, taps, num_taps, decimation, num_points - n);
+}
+
+#endif /* LV_HAVE_NEON */
+
+#endif /* INCLUDED_volk_32fc_x2_fir_decim_32fc_u_H */
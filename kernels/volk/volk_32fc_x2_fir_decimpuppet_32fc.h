@@ -0,0 +1,136 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2026 Free Software Foundation, Inc.
+ *
+ * This file is part of VOLK
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+/*
+ * QA wrapper for volk_32fc_x2_fir_decim_32fc: a fixed number of taps and decimation
+ * factor; as many outputs as fit into the input buffer are computed.
+ */
+
+#ifndef INCLUDED_volk_32fc_x2_fir_decimpuppet_32fc_H
+#define INCLUDED_volk_32fc_x2_fir_decimpuppet_32fc_H
+
+#include <volk/volk_32fc_x2_fir_decim_32fc.h>
+
+static const unsigned int volk_32fc_x2_fir_decimpuppet_taps = 37;
+static const unsigned int volk_32fc_x2_fir_decimpuppet_decimation = 3;
+
+typedef void (*volk_32fc_x2_fir_decim_kernel)(lv_32fc_t*,
+                                              const lv_32fc_t*,
+                                              const lv_32fc_t*,
+                                              unsigned int,
+                                              unsigned int,
+                                              unsigned int);
+
+static inline void
+volk_32fc_x2_fir_decimpuppet_32fc_run(volk_32fc_x2_fir_decim_kernel kernel,
+                                      lv_32fc_t* outVector,
+                                      const lv_32fc_t* inVector,
+                                      const lv_32fc_t* taps,
+                                      unsigned int num_points)
+{
+    const unsigned int num_taps = volk_32fc_x2_fir_decimpuppet_taps;
+    const unsigned int decimation = volk_32fc_x2_fir_decimpuppet_decimation;
+
+    if (num_points < num_taps) {
+        return;
+    }
+    kernel(outVector,
+           inVector,
+           taps,
+           num_taps,
+           decimation,
+           (num_points - num_taps) / decimation + 1);
+}
+
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void volk_32fc_x2_fir_decimpuppet_32fc_generic(lv_32fc_t* outVector,
+                                                             const lv_32fc_t* inVector,
+                                                             const lv_32fc_t* taps,
+                                                             unsigned int num_points)
+{
+    volk_32fc_x2_fir_decimpuppet_32fc_run(volk_32fc_x2_fir_decim_32fc_generic,
+                                          outVector,
+                                          inVector,
+                                          taps,
+                                          num_points);
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+
+#ifdef LV_HAVE_SSE3
+
+static inline void volk_32fc_x2_fir_decimpuppet_32fc_u_sse3(lv_32fc_t* outVector,
+                                                            const lv_32fc_t* inVector,
+                                                            const lv_32fc_t* taps,
+                                                            unsigned int num_points)
+{
+    volk_32fc_x2_fir_decimpuppet_32fc_run(volk_32fc_x2_fir_decim_32fc_u_sse3,
+                                          outVector,
+                                          inVector,
+                                          taps,
+                                          num_points);
+}
+
+#endif /* LV_HAVE_SSE3 */
+
+
+#if LV_HAVE_AVX2 && LV_HAVE_FMA
+
+static inline void volk_32fc_x2_fir_decimpuppet_32fc_u_avx2_fma(lv_32fc_t* outVector,
+                                                                const lv_32fc_t* inVector,
+                                                                const lv_32fc_t* taps,
+                                                                unsigned int num_points)
+{
+    volk_32fc_x2_fir_decimpuppet_32fc_run(volk_32fc_x2_fir_decim_32fc_u_avx2_fma,
+                                          outVector,
+                                          inVector,
+                                          taps,
+                                          num_points);
+}
+
+#endif /* LV_HAVE_AVX2 && LV_HAVE_FMA */
+
+
+#ifdef LV_HAVE_AVX512F
+
+static inline void volk_32fc_x2_fir_decimpuppet_32fc_u_avx512f(lv_32fc_t* outVector,
+                                                               const lv_32fc_t* inVector,
+                                                               const lv_32fc_t* taps,
+                                                               unsigned int num_points)
+{
+    volk_32fc_x2_fir_decimpuppet_32fc_run(volk_32fc_x2_fir_decim_32fc_u_avx512f,
+                                          outVector,
+                                          inVector,
+                                          taps,
+                                          num_points);
+}
+
+#endif /* LV_HAVE_AVX512F */
+
+
+#ifdef LV_HAVE_NEON
+
+static inline void volk_32fc_x2_fir_decimpuppet_32fc_neon(lv_32fc_t* outVector,
+                                                          const lv_32fc_t* inVector,
+                                                          const lv_32fc_t* taps,
+                                                          unsigned int num_points)
+{
+    volk_32fc_x2_fir_decimpuppet_32fc_run(volk_32fc_x2_fir_decim_32fc_neon,
+                                          outVector,
+                                          inVector,
+                                          taps,
+                                          num_points);
+}
+
+#endif /* LV_HAVE_NEON */
+
+#endif /* INCLUDED_volk_32fc_x2_fir_decimpuppet_32fc_H */
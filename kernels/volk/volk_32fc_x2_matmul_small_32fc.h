@@ -0,0 +1,309 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2026 Free Software Foundation, Inc.
+ *
+ * This file is part of VOLK
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+/*!
+ * \page volk_32fc_x2_matmul_small_32fc
+ *
+ * \b Overview
+ *
+ * Multiplies a small rows x cols complex matrix A with a batch of complex
+ * vectors, i.e. computes Y = A X for a cols x num_vectors matrix X whose
+ * columns are stored one after another, such as the snapshots of an array:
+ *
+ * output[v * rows + m] = sum over n of A[m][n] * input[v * cols + n]
+ *
+ * This is volk_32fc_x2_matvec_32fc for num_vectors vectors, but every
+ * column of A is loaded once for several vectors, which halves (AVX2) or
+ * quarters (AVX-512) the loads of A. The matrix has to be packed with
+ * volk_32fc_x2_matvec_pack_weights from volk/volk_matvec.h, see
+ * volk_32fc_x2_matvec_32fc for the layout.
+ *
+ * <b>Dispatcher Prototype</b>
+ * \code
+ * void volk_32fc_x2_matmul_small_32fc(lv_32fc_t* output,
+ *                                     const lv_32fc_t* weights,
+ *                                     const lv_32fc_t* input,
+ *                                     unsigned int rows,
+ *                                     unsigned int cols,
+ *                                     unsigned int num_vectors)
+ * \endcode
+ *
+ * \b Inputs
+ * \li weights: the packed rows x cols matrix.
+ * \li input: num_vectors vectors of cols elements each.
+ * \li rows: the number of matrix rows M.
+ * \li cols: the number of matrix columns N.
+ * \li num_vectors: the number of vectors in the batch.
+ *
+ * \b Outputs
+ * \li output: num_vectors vectors of rows elements each.
+ *
+ * \b Example
+ * Form 16 beams from 1000 snapshots of a 32 element array.
+ * \code
+ *   #include <volk/volk_matvec.h>
+ *
+ *   unsigned int M = 16;
+ *   unsigned int N = 32;
+ *   unsigned int T = 1000;
+ *   unsigned int alignment = volk_get_alignment();
+ *   lv_32fc_t* A = (lv_32fc_t*)volk_malloc(sizeof(lv_32fc_t) * M * N, alignment);
+ *   lv_32fc_t* packed = (lv_32fc_t*)volk_malloc(
+ *       sizeof(lv_32fc_t) * volk_32fc_x2_matvec_packed_size(M, N), alignment);
+ *   lv_32fc_t* snapshots = (lv_32fc_t*)volk_malloc(sizeof(lv_32fc_t) * N * T, alignment);
+ *   lv_32fc_t* beams = (lv_32fc_t*)volk_malloc(sizeof(lv_32fc_t) * M * T, alignment);
+ *
+ *   // ... fill in the weights A[m * N + n] and the snapshots
+ *   volk_32fc_x2_matvec_pack_weights(packed, A, M, N);
+ *
+ *   volk_32fc_x2_matmul_small_32fc(beams, packed, snapshots, M, N, T);
+ *
+ *   volk_free(A);
+ *   volk_free(packed);
+ *   volk_free(snapshots);
+ *   volk_free(beams);
+ * \endcode
+ */
+
+#ifndef INCLUDED_volk_32fc_x2_matmul_small_32fc_H
+#define INCLUDED_volk_32fc_x2_matmul_small_32fc_H
+
+#include <volk/volk_32fc_x2_matvec_32fc.h>
+
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void volk_32fc_x2_matmul_small_32fc_generic(lv_32fc_t* output,
+                                                          const lv_32fc_t* weights,
+                                                          const lv_32fc_t* input,
+                                                          unsigned int rows,
+                                                          unsigned int cols,
+                                                          unsigned int num_vectors)
+{
+    unsigned int v;
+
+    for (v = 0; v < num_vectors; v++) {
+        volk_32fc_x2_matvec_32fc_generic(
+            output + v * rows, weights, input + v * cols, rows, cols);
+    }
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+
+#if LV_HAVE_AVX2 && LV_HAVE_FMA
+#include <immintrin.h>
+
+static inline void volk_32fc_x2_matmul_small_32fc_u_avx2_fma(lv_32fc_t* output,
+                                                             const lv_32fc_t* weights,
+                                                             const lv_32fc_t* input,
+                                                             unsigned int rows,
+                                                             unsigned int cols,
+                                                             unsigned int num_vectors)
+{
+    const unsigned int num_groups =
+        (rows + VOLK_MATVEC_ROW_BLOCK - 1) / VOLK_MATVEC_ROW_BLOCK;
+    __VOLK_ATTR_ALIGNED(32) lv_32fc_t res[VOLK_MATVEC_ROW_BLOCK];
+    __m256 a0, a1, as0, as1, xr, xi;
+    __m256 accR00, accI00, accR01, accI01, accR10, accI10, accR11, accI11;
+    unsigned int v, g, n;
+
+    // two vectors times two registers of four rows, accRsk is vector s and
+    // register k
+    for (v = 0; v + 2 <= num_vectors; v += 2) {
+        const float* in0 = (const float*)(input + v * cols);
+        const float* in1 = in0 + 2 * cols;
+
+        for (g = 0; g < num_groups; g++) {
+            const float* w = (const float*)(weights + g * VOLK_MATVEC_ROW_BLOCK * cols);
+
+            accR00 = accI00 = accR01 = accI01 = _mm256_setzero_ps();
+            accR10 = accI10 = accR11 = accI11 = _mm256_setzero_ps();
+            for (n = 0; n < cols; n++) {
+                a0 = _mm256_loadu_ps(w);
+                a1 = _mm256_loadu_ps(w + 8);
+                as0 = _mm256_permute_ps(a0, 0xB1);
+                as1 = _mm256_permute_ps(a1, 0xB1);
+
+                xr = _mm256_broadcast_ss(in0 + 2 * n);
+                xi = _mm256_broadcast_ss(in0 + 2 * n + 1);
+                accR00 = _mm256_fmadd_ps(a0, xr, accR00);
+                accI00 = _mm256_fmadd_ps(as0, xi, accI00);
+                accR01 = _mm256_fmadd_ps(a1, xr, accR01);
+                accI01 = _mm256_fmadd_ps(as1, xi, accI01);
+
+                xr = _mm256_broadcast_ss(in1 + 2 * n);
+                xi = _mm256_broadcast_ss(in1 + 2 * n + 1);
+                accR10 = _mm256_fmadd_ps(a0, xr, accR10);
+                accI10 = _mm256_fmadd_ps(as0, xi, accI10);
+                accR11 = _mm256_fmadd_ps(a1, xr, accR11);
+                accI11 = _mm256_fmadd_ps(as1, xi, accI11);
+
+                w += 16;
+            }
+
+            _mm256_store_ps((float*)res, _mm256_addsub_ps(accR00, accI00));
+            _mm256_store_ps((float*)(res + 4), _mm256_addsub_ps(accR01, accI01));
+            volk_32fc_x2_matvec_store(
+                output + v * rows, res, g * VOLK_MATVEC_ROW_BLOCK, rows);
+            _mm256_store_ps((float*)res, _mm256_addsub_ps(accR10, accI10));
+            _mm256_store_ps((float*)(res + 4), _mm256_addsub_ps(accR11, accI11));
+            volk_32fc_x2_matvec_store(
+                output + (v + 1) * rows, res, g * VOLK_MATVEC_ROW_BLOCK, rows);
+        }
+    }
+
+    for (; v < num_vectors; v++) {
+        volk_32fc_x2_matvec_32fc_u_avx2_fma(
+            output + v * rows, weights, input + v * cols, rows, cols);
+    }
+}
+
+#endif /* LV_HAVE_AVX2 && LV_HAVE_FMA */
+
+
+#ifdef LV_HAVE_AVX512F
+#include <immintrin.h>
+
+static inline void volk_32fc_x2_matmul_small_32fc_u_avx512f(lv_32fc_t* output,
+                                                            const lv_32fc_t* weights,
+                                                            const lv_32fc_t* input,
+                                                            unsigned int rows,
+                                                            unsigned int cols,
+                                                            unsigned int num_vectors)
+{
+    const unsigned int num_groups =
+        (rows + VOLK_MATVEC_ROW_BLOCK - 1) / VOLK_MATVEC_ROW_BLOCK;
+    const __m512 sign = _mm512_setr_ps(-1.f, 1.f, -1.f, 1.f, -1.f, 1.f, -1.f, 1.f,
+                                       -1.f, 1.f, -1.f, 1.f, -1.f, 1.f, -1.f, 1.f);
+    __VOLK_ATTR_ALIGNED(64) lv_32fc_t res[VOLK_MATVEC_ROW_BLOCK];
+    __m512 a, as;
+    __m512 accR0, accI0, accR1, accI1, accR2, accI2, accR3, accI3;
+    unsigned int v, g, n;
+
+    // four vectors times one register of eight rows
+    for (v = 0; v + 4 <= num_vectors; v += 4) {
+        const float* in0 = (const float*)(input + v * cols);
+        const float* in1 = in0 + 2 * cols;
+        const float* in2 = in1 + 2 * cols;
+        const float* in3 = in2 + 2 * cols;
+
+        for (g = 0; g < num_groups; g++) {
+            const float* w = (const float*)(weights + g * VOLK_MATVEC_ROW_BLOCK * cols);
+
+            accR0 = accI0 = accR1 = accI1 = _mm512_setzero_ps();
+            accR2 = accI2 = accR3 = accI3 = _mm512_setzero_ps();
+            for (n = 0; n < cols; n++) {
+                a = _mm512_loadu_ps(w);
+                as = _mm512_permute_ps(a, 0xB1);
+                accR0 = _mm512_fmadd_ps(a, _mm512_set1_ps(in0[2 * n]), accR0);
+                accI0 = _mm512_fmadd_ps(as, _mm512_set1_ps(in0[2 * n + 1]), accI0);
+                accR1 = _mm512_fmadd_ps(a, _mm512_set1_ps(in1[2 * n]), accR1);
+                accI1 = _mm512_fmadd_ps(as, _mm512_set1_ps(in1[2 * n + 1]), accI1);
+                accR2 = _mm512_fmadd_ps(a, _mm512_set1_ps(in2[2 * n]), accR2);
+                accI2 = _mm512_fmadd_ps(as, _mm512_set1_ps(in2[2 * n + 1]), accI2);
+                accR3 = _mm512_fmadd_ps(a, _mm512_set1_ps(in3[2 * n]), accR3);
+                accI3 = _mm512_fmadd_ps(as, _mm512_set1_ps(in3[2 * n + 1]), accI3);
+                w += 16;
+            }
+
+            _mm512_store_ps((float*)res, _mm512_fmadd_ps(accI0, sign, accR0));
+            volk_32fc_x2_matvec_store(
+                output + v * rows, res, g * VOLK_MATVEC_ROW_BLOCK, rows);
+            _mm512_store_ps((float*)res, _mm512_fmadd_ps(accI1, sign, accR1));
+            volk_32fc_x2_matvec_store(
+                output + (v + 1) * rows, res, g * VOLK_MATVEC_ROW_BLOCK, rows);
+            _mm512_store_ps((float*)res, _mm512_fmadd_ps(accI2, sign, accR2));
+            volk_32fc_x2_matvec_store(
+                output + (v + 2) * rows, res, g * VOLK_MATVEC_ROW_BLOCK, rows);
+            _mm512_store_ps((float*)res, _mm512_fmadd_ps(accI3, sign, accR3));
+            volk_32fc_x2_matvec_store(
+                output + (v + 3) * rows, res, g * VOLK_MATVEC_ROW_BLOCK, rows);
+        }
+    }
+
+    for (; v < num_vectors; v++) {
+        volk_32fc_x2_matvec_32fc_u_avx512f(
+            output + v * rows, weights, input + v * cols, rows, cols);
+    }
+}
+
+#endif /* LV_HAVE_AVX512F */
+
+
+#ifdef LV_HAVE_NEON
+#include <arm_neon.h>
+
+static inline void volk_32fc_x2_matmul_small_32fc_neon(lv_32fc_t* output,
+                                                       const lv_32fc_t* weights,
+                                                       const lv_32fc_t* input,
+                                                       unsigned int rows,
+                                                       unsigned int cols,
+                                                       unsigned int num_vectors)
+{
+    const unsigned int num_groups =
+        (rows + VOLK_MATVEC_ROW_BLOCK - 1) / VOLK_MATVEC_ROW_BLOCK;
+    const float32x4_t sign = { -1.f, 1.f, -1.f, 1.f };
+    lv_32fc_t res0[VOLK_MATVEC_ROW_BLOCK];
+    lv_32fc_t res1[VOLK_MATVEC_ROW_BLOCK];
+    float32x4_t a0, a1, as0, as1;
+    float32x4_t accR00, accI00, accR01, accI01, accR10, accI10, accR11, accI11;
+    unsigned int v, g, h, n;
+
+    // two vectors times two registers of two rows, so that the accumulators
+    // and both forms of A fit into the 16 registers of ARMv7; the row block
+    // is done in two halves
+    for (v = 0; v + 2 <= num_vectors; v += 2) {
+        const float* in0 = (const float*)(input + v * cols);
+        const float* in1 = in0 + 2 * cols;
+
+        for (g = 0; g < num_groups; g++) {
+            for (h = 0; h < 2; h++) {
+                const float* w =
+                    (const float*)(weights + g * VOLK_MATVEC_ROW_BLOCK * cols) + 8 * h;
+
+                accR00 = accI00 = accR01 = accI01 = vdupq_n_f32(0.f);
+                accR10 = accI10 = accR11 = accI11 = vdupq_n_f32(0.f);
+                for (n = 0; n < cols; n++) {
+                    a0 = vld1q_f32(w);
+                    a1 = vld1q_f32(w + 4);
+                    as0 = vrev64q_f32(a0);
+                    as1 = vrev64q_f32(a1);
+                    accR00 = vmlaq_n_f32(accR00, a0, in0[2 * n]);
+                    accI00 = vmlaq_n_f32(accI00, as0, in0[2 * n + 1]);
+                    accR01 = vmlaq_n_f32(accR01, a1, in0[2 * n]);
+                    accI01 = vmlaq_n_f32(accI01, as1, in0[2 * n + 1]);
+                    accR10 = vmlaq_n_f32(accR10, a0, in1[2 * n]);
+                    accI10 = vmlaq_n_f32(accI10, as0, in1[2 * n + 1]);
+                    accR11 = vmlaq_n_f32(accR11, a1, in1[2 * n]);
+                    accI11 = vmlaq_n_f32(accI11, as1, in1[2 * n + 1]);
+                    w += 16;
+                }
+
+                vst1q_f32((float*)(res0 + 4 * h), vmlaq_f32(accR00, accI00, sign));
+                vst1q_f32((float*)(res0 + 4 * h + 2), vmlaq_f32(accR01, accI01, sign));
+                vst1q_f32((float*)(res1 + 4 * h), vmlaq_f32(accR10, accI10, sign));
+                vst1q_f32((float*)(res1 + 4 * h + 2), vmlaq_f32(accR11, accI11, sign));
+            }
+            volk_32fc_x2_matvec_store(
+                output + v * rows, res0, g * VOLK_MATVEC_ROW_BLOCK, rows);
+            volk_32fc_x2_matvec_store(
+                output + (v + 1) * rows, res1, g * VOLK_MATVEC_ROW_BLOCK, rows);
+        }
+    }
+
+    for (; v < num_vectors; v++) {
+        volk_32fc_x2_matvec_32fc_neon(
+            output + v * rows, weights, input + v * cols, rows, cols);
+    }
+}
+
+#endif /* LV_HAVE_NEON */
+
+#endif /* INCLUDED_volk_32fc_x2_matmul_small_32fc_H */
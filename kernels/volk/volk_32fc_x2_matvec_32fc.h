@@ -0,0 +1,324 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2026 Free Software Foundation, Inc.
+ *
+ * This file is part of VOLK
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+/*!
+ * \page volk_32fc_x2_matvec_32fc
+ *
+ * \b Overview
+ *
+ * Multiplies a rows x cols complex matrix A with a complex vector x, e.g.
+ * the weights of a beamformer with one snapshot of its channels:
+ *
+ * output[m] = sum over n of A[m][n] * x[n]
+ *
+ * Unlike one volk_32fc_x2_dot_prod_32fc call per row, every element of x is
+ * loaded once and multiplied into the accumulators of a whole block of rows.
+ * The kernel is meant for small matrices (up to about 64 x 64) that are
+ * reused for many vectors; volk_32fc_x2_matmul_small_32fc applies the same
+ * matrix to a batch of vectors.
+ *
+ * The matrix has to be in a blocked layout where the elements of 8
+ * consecutive rows are interleaved per column:
+ *
+ * weights[(g * cols + n) * 8 + b] = A[g * 8 + b][n]
+ *
+ * The number of rows is padded to a multiple of 8, the padding rows are
+ * computed but not written. volk_32fc_x2_matvec_pack_weights converts a
+ * row major matrix into this layout; volk_32fc_x2_matvec_packed_size
+ * returns the number of elements it writes. Both are declared in
+ * volk/volk_matvec.h, which has to be included next to volk/volk.h.
+ *
+ * <b>Dispatcher Prototype</b>
+ * \code
+ * void volk_32fc_x2_matvec_32fc(lv_32fc_t* output,
+ *                               const lv_32fc_t* weights,
+ *                               const lv_32fc_t* input,
+ *                               unsigned int rows,
+ *                               unsigned int cols)
+ * \endcode
+ *
+ * \b Inputs
+ * \li weights: the packed rows x cols matrix.
+ * \li input: the vector x of cols elements.
+ * \li rows: the number of matrix rows M.
+ * \li cols: the number of matrix columns N.
+ *
+ * \b Outputs
+ * \li output: the rows elements of A x.
+ *
+ * \b Example
+ * Form 16 beams from the snapshots of a 32 element array.
+ * \code
+ *   #include <volk/volk_matvec.h>
+ *
+ *   unsigned int M = 16;
+ *   unsigned int N = 32;
+ *   unsigned int alignment = volk_get_alignment();
+ *   lv_32fc_t* A = (lv_32fc_t*)volk_malloc(sizeof(lv_32fc_t) * M * N, alignment);
+ *   lv_32fc_t* packed = (lv_32fc_t*)volk_malloc(
+ *       sizeof(lv_32fc_t) * volk_32fc_x2_matvec_packed_size(M, N), alignment);
+ *   lv_32fc_t* snapshot = (lv_32fc_t*)volk_malloc(sizeof(lv_32fc_t) * N, alignment);
+ *   lv_32fc_t* beams = (lv_32fc_t*)volk_malloc(sizeof(lv_32fc_t) * M, alignment);
+ *
+ *   // ... fill in the weights A[m * N + n]
+ *   volk_32fc_x2_matvec_pack_weights(packed, A, M, N);
+ *
+ *   // ... for every snapshot
+ *   volk_32fc_x2_matvec_32fc(beams, packed, snapshot, M, N);
+ *
+ *   volk_free(A);
+ *   volk_free(packed);
+ *   volk_free(snapshot);
+ *   volk_free(beams);
+ * \endcode
+ */
+
+#ifndef INCLUDED_volk_32fc_x2_matvec_32fc_H
+#define INCLUDED_volk_32fc_x2_matvec_32fc_H
+
+#include <string.h>
+#include <volk/volk_common.h>
+#include <volk/volk_complex.h>
+#include <volk/volk_matvec.h>
+
+/* Copy the results of the row block starting at row, dropping the padding */
+static inline void volk_32fc_x2_matvec_store(lv_32fc_t* output,
+                                             const lv_32fc_t* res,
+                                             unsigned int row,
+                                             unsigned int rows)
+{
+    const unsigned int count =
+        (rows - row < VOLK_MATVEC_ROW_BLOCK) ? rows - row : VOLK_MATVEC_ROW_BLOCK;
+    memcpy(output + row, res, sizeof(lv_32fc_t) * count);
+}
+
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void volk_32fc_x2_matvec_32fc_generic(lv_32fc_t* output,
+                                                    const lv_32fc_t* weights,
+                                                    const lv_32fc_t* input,
+                                                    unsigned int rows,
+                                                    unsigned int cols)
+{
+    const unsigned int num_groups =
+        (rows + VOLK_MATVEC_ROW_BLOCK - 1) / VOLK_MATVEC_ROW_BLOCK;
+    lv_32fc_t res[VOLK_MATVEC_ROW_BLOCK];
+    unsigned int g, n, b;
+
+    for (g = 0; g < num_groups; g++) {
+        const lv_32fc_t* w = weights + g * VOLK_MATVEC_ROW_BLOCK * cols;
+
+        for (b = 0; b < VOLK_MATVEC_ROW_BLOCK; b++) {
+            res[b] = lv_cmake(0.f, 0.f);
+        }
+        for (n = 0; n < cols; n++) {
+            for (b = 0; b < VOLK_MATVEC_ROW_BLOCK; b++) {
+                res[b] += w[b] * input[n];
+            }
+            w += VOLK_MATVEC_ROW_BLOCK;
+        }
+        volk_32fc_x2_matvec_store(output, res, g * VOLK_MATVEC_ROW_BLOCK, rows);
+    }
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+
+#if LV_HAVE_AVX2 && LV_HAVE_FMA
+#include <immintrin.h>
+
+static inline void volk_32fc_x2_matvec_32fc_u_avx2_fma(lv_32fc_t* output,
+                                                       const lv_32fc_t* weights,
+                                                       const lv_32fc_t* input,
+                                                       unsigned int rows,
+                                                       unsigned int cols)
+{
+    const unsigned int num_groups =
+        (rows + VOLK_MATVEC_ROW_BLOCK - 1) / VOLK_MATVEC_ROW_BLOCK;
+    const float* in = (const float*)input;
+    __VOLK_ATTR_ALIGNED(32) lv_32fc_t res[VOLK_MATVEC_ROW_BLOCK];
+    __m256 a0, a1, xr, xi;
+    __m256 accR0, accI0, accR1, accI1, accR2, accI2, accR3, accI3;
+    unsigned int g, n;
+
+    for (g = 0; g < num_groups; g++) {
+        const float* w = (const float*)(weights + g * VOLK_MATVEC_ROW_BLOCK * cols);
+
+        // two registers of four rows, even columns go to accumulators 0 and 1,
+        // odd columns to 2 and 3 to hide the latency of the FMAs. accR sums
+        // A * re(x), accI sums A with swapped re and im times im(x).
+        accR0 = accI0 = accR1 = accI1 = _mm256_setzero_ps();
+        accR2 = accI2 = accR3 = accI3 = _mm256_setzero_ps();
+        for (n = 0; n + 2 <= cols; n += 2) {
+            a0 = _mm256_loadu_ps(w);
+            a1 = _mm256_loadu_ps(w + 8);
+            xr = _mm256_broadcast_ss(in);
+            xi = _mm256_broadcast_ss(in + 1);
+            accR0 = _mm256_fmadd_ps(a0, xr, accR0);
+            accI0 = _mm256_fmadd_ps(_mm256_permute_ps(a0, 0xB1), xi, accI0);
+            accR1 = _mm256_fmadd_ps(a1, xr, accR1);
+            accI1 = _mm256_fmadd_ps(_mm256_permute_ps(a1, 0xB1), xi, accI1);
+
+            a0 = _mm256_loadu_ps(w + 16);
+            a1 = _mm256_loadu_ps(w + 24);
+            xr = _mm256_broadcast_ss(in + 2);
+            xi = _mm256_broadcast_ss(in + 3);
+            accR2 = _mm256_fmadd_ps(a0, xr, accR2);
+            accI2 = _mm256_fmadd_ps(_mm256_permute_ps(a0, 0xB1), xi, accI2);
+            accR3 = _mm256_fmadd_ps(a1, xr, accR3);
+            accI3 = _mm256_fmadd_ps(_mm256_permute_ps(a1, 0xB1), xi, accI3);
+
+            w += 32;
+            in += 4;
+        }
+        if (n < cols) {
+            a0 = _mm256_loadu_ps(w);
+            a1 = _mm256_loadu_ps(w + 8);
+            xr = _mm256_broadcast_ss(in);
+            xi = _mm256_broadcast_ss(in + 1);
+            accR0 = _mm256_fmadd_ps(a0, xr, accR0);
+            accI0 = _mm256_fmadd_ps(_mm256_permute_ps(a0, 0xB1), xi, accI0);
+            accR1 = _mm256_fmadd_ps(a1, xr, accR1);
+            accI1 = _mm256_fmadd_ps(_mm256_permute_ps(a1, 0xB1), xi, accI1);
+        }
+        in = (const float*)input;
+
+        // (ar xr - ai xi, ai xr + ar xi)
+        _mm256_store_ps((float*)res,
+                        _mm256_addsub_ps(_mm256_add_ps(accR0, accR2),
+                                         _mm256_add_ps(accI0, accI2)));
+        _mm256_store_ps((float*)(res + 4),
+                        _mm256_addsub_ps(_mm256_add_ps(accR1, accR3),
+                                         _mm256_add_ps(accI1, accI3)));
+        volk_32fc_x2_matvec_store(output, res, g * VOLK_MATVEC_ROW_BLOCK, rows);
+    }
+}
+
+#endif /* LV_HAVE_AVX2 && LV_HAVE_FMA */
+
+
+#ifdef LV_HAVE_AVX512F
+#include <immintrin.h>
+
+static inline void volk_32fc_x2_matvec_32fc_u_avx512f(lv_32fc_t* output,
+                                                      const lv_32fc_t* weights,
+                                                      const lv_32fc_t* input,
+                                                      unsigned int rows,
+                                                      unsigned int cols)
+{
+    const unsigned int num_groups =
+        (rows + VOLK_MATVEC_ROW_BLOCK - 1) / VOLK_MATVEC_ROW_BLOCK;
+    const __m512 sign = _mm512_setr_ps(-1.f, 1.f, -1.f, 1.f, -1.f, 1.f, -1.f, 1.f,
+                                       -1.f, 1.f, -1.f, 1.f, -1.f, 1.f, -1.f, 1.f);
+    const float* in = (const float*)input;
+    __VOLK_ATTR_ALIGNED(64) lv_32fc_t res[VOLK_MATVEC_ROW_BLOCK];
+    __m512 a0, a1, a2, a3;
+    __m512 accR0, accI0, accR1, accI1, accR2, accI2, accR3, accI3;
+    unsigned int g, n;
+
+    for (g = 0; g < num_groups; g++) {
+        const float* w = (const float*)(weights + g * VOLK_MATVEC_ROW_BLOCK * cols);
+
+        // one register holds the whole row block, four columns are in flight
+        accR0 = accI0 = accR1 = accI1 = _mm512_setzero_ps();
+        accR2 = accI2 = accR3 = accI3 = _mm512_setzero_ps();
+        for (n = 0; n + 4 <= cols; n += 4) {
+            a0 = _mm512_loadu_ps(w);
+            a1 = _mm512_loadu_ps(w + 16);
+            a2 = _mm512_loadu_ps(w + 32);
+            a3 = _mm512_loadu_ps(w + 48);
+            accR0 = _mm512_fmadd_ps(a0, _mm512_set1_ps(in[0]), accR0);
+            accI0 = _mm512_fmadd_ps(
+                _mm512_permute_ps(a0, 0xB1), _mm512_set1_ps(in[1]), accI0);
+            accR1 = _mm512_fmadd_ps(a1, _mm512_set1_ps(in[2]), accR1);
+            accI1 = _mm512_fmadd_ps(
+                _mm512_permute_ps(a1, 0xB1), _mm512_set1_ps(in[3]), accI1);
+            accR2 = _mm512_fmadd_ps(a2, _mm512_set1_ps(in[4]), accR2);
+            accI2 = _mm512_fmadd_ps(
+                _mm512_permute_ps(a2, 0xB1), _mm512_set1_ps(in[5]), accI2);
+            accR3 = _mm512_fmadd_ps(a3, _mm512_set1_ps(in[6]), accR3);
+            accI3 = _mm512_fmadd_ps(
+                _mm512_permute_ps(a3, 0xB1), _mm512_set1_ps(in[7]), accI3);
+            w += 64;
+            in += 8;
+        }
+        for (; n < cols; n++) {
+            a0 = _mm512_loadu_ps(w);
+            accR0 = _mm512_fmadd_ps(a0, _mm512_set1_ps(in[0]), accR0);
+            accI0 = _mm512_fmadd_ps(
+                _mm512_permute_ps(a0, 0xB1), _mm512_set1_ps(in[1]), accI0);
+            w += 16;
+            in += 2;
+        }
+        in = (const float*)input;
+
+        accR0 = _mm512_add_ps(_mm512_add_ps(accR0, accR1), _mm512_add_ps(accR2, accR3));
+        accI0 = _mm512_add_ps(_mm512_add_ps(accI0, accI1), _mm512_add_ps(accI2, accI3));
+        _mm512_store_ps((float*)res, _mm512_fmadd_ps(accI0, sign, accR0));
+        volk_32fc_x2_matvec_store(output, res, g * VOLK_MATVEC_ROW_BLOCK, rows);
+    }
+}
+
+#endif /* LV_HAVE_AVX512F */
+
+
+#ifdef LV_HAVE_NEON
+#include <arm_neon.h>
+
+static inline void volk_32fc_x2_matvec_32fc_neon(lv_32fc_t* output,
+                                                 const lv_32fc_t* weights,
+                                                 const lv_32fc_t* input,
+                                                 unsigned int rows,
+                                                 unsigned int cols)
+{
+    const unsigned int num_groups =
+        (rows + VOLK_MATVEC_ROW_BLOCK - 1) / VOLK_MATVEC_ROW_BLOCK;
+    const float32x4_t sign = { -1.f, 1.f, -1.f, 1.f };
+    const float* in;
+    lv_32fc_t res[VOLK_MATVEC_ROW_BLOCK];
+    float32x4_t a0, a1, a2, a3;
+    float32x4_t accR0, accI0, accR1, accI1, accR2, accI2, accR3, accI3;
+    unsigned int g, n;
+
+    for (g = 0; g < num_groups; g++) {
+        const float* w = (const float*)(weights + g * VOLK_MATVEC_ROW_BLOCK * cols);
+
+        // four registers of two rows each
+        accR0 = accI0 = accR1 = accI1 = vdupq_n_f32(0.f);
+        accR2 = accI2 = accR3 = accI3 = vdupq_n_f32(0.f);
+        in = (const float*)input;
+        for (n = 0; n < cols; n++) {
+            a0 = vld1q_f32(w);
+            a1 = vld1q_f32(w + 4);
+            a2 = vld1q_f32(w + 8);
+            a3 = vld1q_f32(w + 12);
+            accR0 = vmlaq_n_f32(accR0, a0, in[0]);
+            accI0 = vmlaq_n_f32(accI0, vrev64q_f32(a0), in[1]);
+            accR1 = vmlaq_n_f32(accR1, a1, in[0]);
+            accI1 = vmlaq_n_f32(accI1, vrev64q_f32(a1), in[1]);
+            accR2 = vmlaq_n_f32(accR2, a2, in[0]);
+            accI2 = vmlaq_n_f32(accI2, vrev64q_f32(a2), in[1]);
+            accR3 = vmlaq_n_f32(accR3, a3, in[0]);
+            accI3 = vmlaq_n_f32(accI3, vrev64q_f32(a3), in[1]);
+            w += 16;
+            in += 2;
+        }
+
+        vst1q_f32((float*)res, vmlaq_f32(accR0, accI0, sign));
+        vst1q_f32((float*)(res + 2), vmlaq_f32(accR1, accI1, sign));
+        vst1q_f32((float*)(res + 4), vmlaq_f32(accR2, accI2, sign));
+        vst1q_f32((float*)(res + 6), vmlaq_f32(accR3, accI3, sign));
+        volk_32fc_x2_matvec_store(output, res, g * VOLK_MATVEC_ROW_BLOCK, rows);
+    }
+}
+
+#endif /* LV_HAVE_NEON */
+
+#endif /* INCLUDED_volk_32fc_x2_matvec_32fc_H */
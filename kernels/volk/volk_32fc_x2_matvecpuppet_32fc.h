@@ -0,0 +1,110 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2026 Free Software Foundation, Inc.
+ *
+ * This file is part of VOLK
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+/*
+ * QA wrapper for volk_32fc_x2_matvec_32fc. The buffers are split into three
+ * segments, each holding the packed weights and a batch of vectors for one
+ * matrix shape: a ragged 37 x 61 matrix, a full 64 x 64 one and a 12 x 7 one
+ * that is smaller than a single row block.
+ */
+
+#ifndef INCLUDED_volk_32fc_x2_matvecpuppet_32fc_H
+#define INCLUDED_volk_32fc_x2_matvecpuppet_32fc_H
+
+#include <string.h>
+#include <volk/volk_32fc_x2_matvec_32fc.h>
+
+typedef void (*volk_32fc_x2_matvec_kernel)(lv_32fc_t*,
+                                           const lv_32fc_t*,
+                                           const lv_32fc_t*,
+                                           unsigned int,
+                                           unsigned int);
+
+static inline void volk_32fc_x2_matvecpuppet_32fc_run(volk_32fc_x2_matvec_kernel kernel,
+                                                      lv_32fc_t* output,
+                                                      const lv_32fc_t* weights,
+                                                      const lv_32fc_t* input,
+                                                      unsigned int num_points)
+{
+    const unsigned int segment = num_points / 3;
+    const unsigned int shapes[3][2] = { { 37, 61 }, { 64, 64 }, { 12, 7 } };
+    unsigned int s, v, rows, cols, batch;
+
+    memset(output, 0, num_points * sizeof(lv_32fc_t));
+    for (s = 0; s < 3; s++) {
+        rows = shapes[s][0];
+        cols = shapes[s][1];
+        batch = segment / (rows > cols ? rows : cols);
+        for (v = 0; v < batch; v++) {
+            kernel(output + s * segment + v * rows,
+                   weights + s * segment,
+                   input + s * segment + v * cols,
+                   rows,
+                   cols);
+        }
+    }
+}
+
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void volk_32fc_x2_matvecpuppet_32fc_generic(lv_32fc_t* output,
+                                                          const lv_32fc_t* weights,
+                                                          const lv_32fc_t* input,
+                                                          unsigned int num_points)
+{
+    volk_32fc_x2_matvecpuppet_32fc_run(
+        volk_32fc_x2_matvec_32fc_generic, output, weights, input, num_points);
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+
+#if LV_HAVE_AVX2 && LV_HAVE_FMA
+
+static inline void volk_32fc_x2_matvecpuppet_32fc_u_avx2_fma(lv_32fc_t* output,
+                                                             const lv_32fc_t* weights,
+                                                             const lv_32fc_t* input,
+                                                             unsigned int num_points)
+{
+    volk_32fc_x2_matvecpuppet_32fc_run(
+        volk_32fc_x2_matvec_32fc_u_avx2_fma, output, weights, input, num_points);
+}
+
+#endif /* LV_HAVE_AVX2 && LV_HAVE_FMA */
+
+
+#ifdef LV_HAVE_AVX512F
+
+static inline void volk_32fc_x2_matvecpuppet_32fc_u_avx512f(lv_32fc_t* output,
+                                                            const lv_32fc_t* weights,
+                                                            const lv_32fc_t* input,
+                                                            unsigned int num_points)
+{
+    volk_32fc_x2_matvecpuppet_32fc_run(
+        volk_32fc_x2_matvec_32fc_u_avx512f, output, weights, input, num_points);
+}
+
+#endif /* LV_HAVE_AVX512F */
+
+
+#ifdef LV_HAVE_NEON
+
+static inline void volk_32fc_x2_matvecpuppet_32fc_neon(lv_32fc_t* output,
+                                                       const lv_32fc_t* weights,
+                                                       const lv_32fc_t* input,
+                                                       unsigned int num_points)
+{
+    volk_32fc_x2_matvecpuppet_32fc_run(
+        volk_32fc_x2_matvec_32fc_neon, output, weights, input, num_points);
+}
+
+#endif /* LV_HAVE_NEON */
+
+#endif /* INCLUDED_volk_32fc_x2_matvecpuppet_32fc_H */
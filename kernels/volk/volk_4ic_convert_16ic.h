@@ -0,0 +1,211 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2026 Free Software Foundation, Inc.
+ *
+ * This file is part of VOLK
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+/*!
+ * \page volk_4ic_convert_16ic
+ *
+ * \b Overview
+ *
+ * Unpacks complex samples with 4-bit two's complement I and Q, packed into
+ * one byte per sample with I in the low and Q in the high nibble, to 16-bit
+ * complex integers. The values are sign extended, not scaled.
+ *
+ * <b>Dispatcher Prototype</b>
+ * \code
+ * void volk_4ic_convert_16ic(lv_16sc_t* outputVector, const uint8_t* inputVector,
+ *                            unsigned int num_points)
+ * \endcode
+ *
+ * \b Inputs
+ * \li inputVector: the packed samples, num_points bytes.
+ * \li num_points: the number of complex samples.
+ *
+ * \b Outputs
+ * \li outputVector: the samples, between -8 and 7.
+ *
+ * \b Example
+ * \code
+ *   unsigned int N = 1000;
+ *   unsigned int alignment = volk_get_alignment();
+ *   uint8_t* in = (uint8_t*)volk_malloc(N, alignment);
+ *   lv_16sc_t* out = (lv_16sc_t*)volk_malloc(sizeof(lv_16sc_t) * N, alignment);
+ *
+ *   for (unsigned int ii = 0; ii < N; ++ii) {
+ *       in[ii] = 0x7f; // I = -1, Q = 7
+ *   }
+ *
+ *   volk_4ic_convert_16ic(out, in, N); // out[ii] == lv_cmake(-1, 7)
+ *
+ *   volk_free(in);
+ *   volk_free(out);
+ * \endcode
+ */
+
+#ifndef INCLUDED_volk_4ic_convert_16ic_H
+#define INCLUDED_volk_4ic_convert_16ic_H
+
+#include <inttypes.h>
+#include <volk/volk_common.h>
+#include <volk/volk_complex.h>
+
+static inline void volk_4ic_unpack(int16_t* iq, uint8_t byte)
+{
+    iq[0] = (int16_t)((int8_t)(byte << 4) >> 4);
+    iq[1] = (int16_t)((int8_t)byte >> 4);
+}
+
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void volk_4ic_convert_16ic_generic(lv_16sc_t* outputVector,
+                                                 const uint8_t* inputVector,
+                                                 unsigned int num_points)
+{
+    int16_t* outputPtr = (int16_t*)outputVector;
+    unsigned int number;
+
+    for (number = 0; number < num_points; number++) {
+        volk_4ic_unpack(outputPtr, *inputVector++);
+        outputPtr += 2;
+    }
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+
+#ifdef LV_HAVE_SSSE3
+#include <tmmintrin.h>
+
+static inline void volk_4ic_convert_16ic_u_ssse3(lv_16sc_t* outputVector,
+                                                 const uint8_t* inputVector,
+                                                 unsigned int num_points)
+{
+    const unsigned int sixteenthPoints = num_points / 16;
+    // sign extended value of each nibble
+    const __m128i lut =
+        _mm_setr_epi8(0, 1, 2, 3, 4, 5, 6, 7, -8, -7, -6, -5, -4, -3, -2, -1);
+    const __m128i nibble = _mm_set1_epi8(0x0f);
+    const __m128i zero = _mm_setzero_si128();
+    int16_t* outputPtr = (int16_t*)outputVector;
+    __m128i bytes, real, imag, lo, hi;
+    unsigned int number;
+
+    for (number = 0; number < sixteenthPoints; number++) {
+        bytes = _mm_loadu_si128((const __m128i*)inputVector);
+        real = _mm_shuffle_epi8(lut, _mm_and_si128(bytes, nibble));
+        imag = _mm_shuffle_epi8(lut, _mm_and_si128(_mm_srli_epi16(bytes, 4), nibble));
+        lo = _mm_unpacklo_epi8(real, imag);
+        hi = _mm_unpackhi_epi8(real, imag);
+
+        // widen by moving each byte to the top of its lane
+        _mm_storeu_si128((__m128i*)outputPtr,
+                         _mm_srai_epi16(_mm_unpacklo_epi8(zero, lo), 8));
+        _mm_storeu_si128((__m128i*)(outputPtr + 8),
+                         _mm_srai_epi16(_mm_unpackhi_epi8(zero, lo), 8));
+        _mm_storeu_si128((__m128i*)(outputPtr + 16),
+                         _mm_srai_epi16(_mm_unpacklo_epi8(zero, hi), 8));
+        _mm_storeu_si128((__m128i*)(outputPtr + 24),
+                         _mm_srai_epi16(_mm_unpackhi_epi8(zero, hi), 8));
+
+        inputVector += 16;
+        outputPtr += 32;
+    }
+
+    for (number = sixteenthPoints * 16; number < num_points; number++) {
+        volk_4ic_unpack(outputPtr, *inputVector++);
+        outputPtr += 2;
+    }
+}
+
+#endif /* LV_HAVE_SSSE3 */
+
+
+#ifdef LV_HAVE_AVX2
+#include <immintrin.h>
+
+static inline void volk_4ic_convert_16ic_u_avx2(lv_16sc_t* outputVector,
+                                                const uint8_t* inputVector,
+                                                unsigned int num_points)
+{
+    const unsigned int thirtySecondPoints = num_points / 32;
+    const __m256i lut =
+        _mm256_setr_epi8(0, 1, 2, 3, 4, 5, 6, 7, -8, -7, -6, -5, -4, -3, -2, -1,
+                         0, 1, 2, 3, 4, 5, 6, 7, -8, -7, -6, -5, -4, -3, -2, -1);
+    const __m256i nibble = _mm256_set1_epi8(0x0f);
+    int16_t* outputPtr = (int16_t*)outputVector;
+    __m256i bytes, real, imag, lo, hi;
+    unsigned int number;
+
+    for (number = 0; number < thirtySecondPoints; number++) {
+        bytes = _mm256_loadu_si256((const __m256i*)inputVector);
+        real = _mm256_shuffle_epi8(lut, _mm256_and_si256(bytes, nibble));
+        imag = _mm256_shuffle_epi8(
+            lut, _mm256_and_si256(_mm256_srli_epi16(bytes, 4), nibble));
+        // samples 0-7 and 16-23, 8-15 and 24-31
+        lo = _mm256_unpacklo_epi8(real, imag);
+        hi = _mm256_unpackhi_epi8(real, imag);
+
+        _mm256_storeu_si256((__m256i*)outputPtr,
+                            _mm256_cvtepi8_epi16(_mm256_castsi256_si128(lo)));
+        _mm256_storeu_si256((__m256i*)(outputPtr + 16),
+                            _mm256_cvtepi8_epi16(_mm256_castsi256_si128(hi)));
+        _mm256_storeu_si256((__m256i*)(outputPtr + 32),
+                            _mm256_cvtepi8_epi16(_mm256_extracti128_si256(lo, 1)));
+        _mm256_storeu_si256((__m256i*)(outputPtr + 48),
+                            _mm256_cvtepi8_epi16(_mm256_extracti128_si256(hi, 1)));
+
+        inputVector += 32;
+        outputPtr += 64;
+    }
+
+    for (number = thirtySecondPoints * 32; number < num_points; number++) {
+        volk_4ic_unpack(outputPtr, *inputVector++);
+        outputPtr += 2;
+    }
+}
+
+#endif /* LV_HAVE_AVX2 */
+
+
+#ifdef LV_HAVE_NEON
+#include <arm_neon.h>
+
+static inline void volk_4ic_convert_16ic_neon(lv_16sc_t* outputVector,
+                                              const uint8_t* inputVector,
+                                              unsigned int num_points)
+{
+    const unsigned int sixteenthPoints = num_points / 16;
+    int16_t* outputPtr = (int16_t*)outputVector;
+    int8x16_t bytes;
+    int8x16x2_t values;
+    unsigned int number;
+
+    for (number = 0; number < sixteenthPoints; number++) {
+        bytes = vreinterpretq_s8_u8(vld1q_u8(inputVector));
+        values.val[0] = vshrq_n_s8(vshlq_n_s8(bytes, 4), 4);
+        values.val[1] = vshrq_n_s8(bytes, 4);
+        values = vzipq_s8(values.val[0], values.val[1]);
+        vst1q_s16(outputPtr, vmovl_s8(vget_low_s8(values.val[0])));
+        vst1q_s16(outputPtr + 8, vmovl_s8(vget_high_s8(values.val[0])));
+        vst1q_s16(outputPtr + 16, vmovl_s8(vget_low_s8(values.val[1])));
+        vst1q_s16(outputPtr + 24, vmovl_s8(vget_high_s8(values.val[1])));
+
+        inputVector += 16;
+        outputPtr += 32;
+    }
+
+    for (number = sixteenthPoints * 16; number < num_points; number++) {
+        volk_4ic_unpack(outputPtr, *inputVector++);
+        outputPtr += 2;
+    }
+}
+
+#endif /* LV_HAVE_NEON */
+
+#endif /* INCLUDED_volk_4ic_convert_16ic_H */
@@ -0,0 +1,242 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2026 Free Software Foundation, Inc.
+ *
+ * This file is part of VOLK
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+/*!
+ * \page volk_4ic_s32f_convert_32fc
+ *
+ * \b Overview
+ *
+ * Converts complex samples with 4-bit I and Q, packed into one byte per
+ * sample as described for volk_4ic_convert_16ic, to floating point complex
+ * values and divides them by the scalar.
+ *
+ * <b>Dispatcher Prototype</b>
+ * \code
+ * void volk_4ic_s32f_convert_32fc(lv_32fc_t* outputVector, const uint8_t* inputVector,
+ *                                 const float scalar, unsigned int num_points)
+ * \endcode
+ *
+ * \b Inputs
+ * \li inputVector: the packed samples, num_points bytes.
+ * \li scalar: the value the samples are divided by, e.g. 8 for full scale 1.
+ * \li num_points: the number of complex samples.
+ *
+ * \b Outputs
+ * \li outputVector: the scaled samples.
+ *
+ * \b Example
+ * \code
+ *   unsigned int N = 1000;
+ *   unsigned int alignment = volk_get_alignment();
+ *   uint8_t* in = (uint8_t*)volk_malloc(N, alignment);
+ *   lv_32fc_t* out = (lv_32fc_t*)volk_malloc(sizeof(lv_32fc_t) * N, alignment);
+ *
+ *   for (unsigned int ii = 0; ii < N; ++ii) {
+ *       in[ii] = 0x48; // I = -8, Q = 4
+ *   }
+ *
+ *   volk_4ic_s32f_convert_32fc(out, in, 8.f, N); // out[ii] == lv_cmake(-1.f, .5f)
+ *
+ *   volk_free(in);
+ *   volk_free(out);
+ * \endcode
+ */
+
+#ifndef INCLUDED_volk_4ic_s32f_convert_32fc_H
+#define INCLUDED_volk_4ic_s32f_convert_32fc_H
+
+#include <inttypes.h>
+#include <volk/volk_4ic_convert_16ic.h>
+#include <volk/volk_complex.h>
+
+static inline void volk_4ic_unpack_32f(float* iq, uint8_t byte, float scale)
+{
+    int16_t values[2];
+    volk_4ic_unpack(values, byte);
+    iq[0] = values[0] * scale;
+    iq[1] = values[1] * scale;
+}
+
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void volk_4ic_s32f_convert_32fc_generic(lv_32fc_t* outputVector,
+                                                      const uint8_t* inputVector,
+                                                      const float scalar,
+                                                      unsigned int num_points)
+{
+    const float scale = 1.f / scalar;
+    float* outputPtr = (float*)outputVector;
+    unsigned int number;
+
+    for (number = 0; number < num_points; number++) {
+        volk_4ic_unpack_32f(outputPtr, *inputVector++, scale);
+        outputPtr += 2;
+    }
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+
+#ifdef LV_HAVE_SSSE3
+#include <tmmintrin.h>
+
+static inline void volk_4ic_s32f_convert_32fc_u_ssse3(lv_32fc_t* outputVector,
+                                                      const uint8_t* inputVector,
+                                                      const float scalar,
+                                                      unsigned int num_points)
+{
+    const unsigned int sixteenthPoints = num_points / 16;
+    const float scale = 1.f / scalar;
+    const __m128 vScale = _mm_set1_ps(scale);
+    // sign extended value of each nibble
+    const __m128i lut =
+        _mm_setr_epi8(0, 1, 2, 3, 4, 5, 6, 7, -8, -7, -6, -5, -4, -3, -2, -1);
+    const __m128i nibble = _mm_set1_epi8(0x0f);
+    const __m128i zero = _mm_setzero_si128();
+    float* outputPtr = (float*)outputVector;
+    __m128i bytes, real, imag, interleaved[2], words;
+    unsigned int number, ii;
+
+    for (number = 0; number < sixteenthPoints; number++) {
+        bytes = _mm_loadu_si128((const __m128i*)inputVector);
+        real = _mm_shuffle_epi8(lut, _mm_and_si128(bytes, nibble));
+        imag = _mm_shuffle_epi8(lut, _mm_and_si128(_mm_srli_epi16(bytes, 4), nibble));
+        interleaved[0] = _mm_unpacklo_epi8(real, imag);
+        interleaved[1] = _mm_unpackhi_epi8(real, imag);
+
+        for (ii = 0; ii < 2; ii++) {
+            // move each byte to the top of a 32-bit lane and sign extend
+            words = _mm_unpacklo_epi8(zero, interleaved[ii]);
+            _mm_storeu_ps(outputPtr,
+                          _mm_mul_ps(_mm_cvtepi32_ps(_mm_srai_epi32(
+                                         _mm_unpacklo_epi16(zero, words), 24)),
+                                     vScale));
+            _mm_storeu_ps(outputPtr + 4,
+                          _mm_mul_ps(_mm_cvtepi32_ps(_mm_srai_epi32(
+                                         _mm_unpackhi_epi16(zero, words), 24)),
+                                     vScale));
+            words = _mm_unpackhi_epi8(zero, interleaved[ii]);
+            _mm_storeu_ps(outputPtr + 8,
+                          _mm_mul_ps(_mm_cvtepi32_ps(_mm_srai_epi32(
+                                         _mm_unpacklo_epi16(zero, words), 24)),
+                                     vScale));
+            _mm_storeu_ps(outputPtr + 12,
+                          _mm_mul_ps(_mm_cvtepi32_ps(_mm_srai_epi32(
+                                         _mm_unpackhi_epi16(zero, words), 24)),
+                                     vScale));
+            outputPtr += 16;
+        }
+
+        inputVector += 16;
+    }
+
+    for (number = sixteenthPoints * 16; number < num_points; number++) {
+        volk_4ic_unpack_32f(outputPtr, *inputVector++, scale);
+        outputPtr += 2;
+    }
+}
+
+#endif /* LV_HAVE_SSSE3 */
+
+
+#ifdef LV_HAVE_AVX2
+#include <immintrin.h>
+
+static inline void volk_4ic_s32f_convert_32fc_u_avx2(lv_32fc_t* outputVector,
+                                                     const uint8_t* inputVector,
+                                                     const float scalar,
+                                                     unsigned int num_points)
+{
+    const unsigned int sixteenthPoints = num_points / 16;
+    const float scale = 1.f / scalar;
+    const __m256 vScale = _mm256_set1_ps(scale);
+    const __m128i lut =
+        _mm_setr_epi8(0, 1, 2, 3, 4, 5, 6, 7, -8, -7, -6, -5, -4, -3, -2, -1);
+    const __m128i nibble = _mm_set1_epi8(0x0f);
+    float* outputPtr = (float*)outputVector;
+    __m128i bytes, real, imag, lo, hi;
+    unsigned int number;
+
+    for (number = 0; number < sixteenthPoints; number++) {
+        bytes = _mm_loadu_si128((const __m128i*)inputVector);
+        real = _mm_shuffle_epi8(lut, _mm_and_si128(bytes, nibble));
+        imag = _mm_shuffle_epi8(lut, _mm_and_si128(_mm_srli_epi16(bytes, 4), nibble));
+        lo = _mm_unpacklo_epi8(real, imag);
+        hi = _mm_unpackhi_epi8(real, imag);
+
+        _mm256_storeu_ps(
+            outputPtr,
+            _mm256_mul_ps(_mm256_cvtepi32_ps(_mm256_cvtepi8_epi32(lo)), vScale));
+        _mm256_storeu_ps(outputPtr + 8,
+                         _mm256_mul_ps(_mm256_cvtepi32_ps(
+                                           _mm256_cvtepi8_epi32(_mm_srli_si128(lo, 8))),
+                                       vScale));
+        _mm256_storeu_ps(
+            outputPtr + 16,
+            _mm256_mul_ps(_mm256_cvtepi32_ps(_mm256_cvtepi8_epi32(hi)), vScale));
+        _mm256_storeu_ps(outputPtr + 24,
+                         _mm256_mul_ps(_mm256_cvtepi32_ps(
+                                           _mm256_cvtepi8_epi32(_mm_srli_si128(hi, 8))),
+                                       vScale));
+
+        inputVector += 16;
+        outputPtr += 32;
+    }
+
+    for (number = sixteenthPoints * 16; number < num_points; number++) {
+        volk_4ic_unpack_32f(outputPtr, *inputVector++, scale);
+        outputPtr += 2;
+    }
+}
+
+#endif /* LV_HAVE_AVX2 */
+
+
+#ifdef LV_HAVE_NEON
+#include <arm_neon.h>
+
+static inline void volk_4ic_s32f_convert_32fc_neon(lv_32fc_t* outputVector,
+                                                   const uint8_t* inputVector,
+                                                   const float scalar,
+                                                   unsigned int num_points)
+{
+    const unsigned int eighthPoints = num_points / 8;
+    const float scale = 1.f / scalar;
+    float* outputPtr = (float*)outputVector;
+    int8x8_t bytes;
+    int16x8_t real, imag;
+    float32x4x2_t values;
+    unsigned int number;
+
+    for (number = 0; number < eighthPoints; number++) {
+        bytes = vreinterpret_s8_u8(vld1_u8(inputVector));
+        real = vmovl_s8(vshr_n_s8(vshl_n_s8(bytes, 4), 4));
+        imag = vmovl_s8(vshr_n_s8(bytes, 4));
+
+        values.val[0] = vmulq_n_f32(vcvtq_f32_s32(vmovl_s16(vget_low_s16(real))), scale);
+        values.val[1] = vmulq_n_f32(vcvtq_f32_s32(vmovl_s16(vget_low_s16(imag))), scale);
+        vst2q_f32(outputPtr, values);
+        values.val[0] = vmulq_n_f32(vcvtq_f32_s32(vmovl_s16(vget_high_s16(real))), scale);
+        values.val[1] = vmulq_n_f32(vcvtq_f32_s32(vmovl_s16(vget_high_s16(imag))), scale);
+        vst2q_f32(outputPtr + 8, values);
+
+        inputVector += 8;
+        outputPtr += 16;
+    }
+
+    for (number = eighthPoints * 8; number < num_points; number++) {
+        volk_4ic_unpack_32f(outputPtr, *inputVector++, scale);
+        outputPtr += 2;
+    }
+}
+
+#endif /* LV_HAVE_NEON */
+
+#endif /* INCLUDED_volk_4ic_s32f_convert_32fc_H */
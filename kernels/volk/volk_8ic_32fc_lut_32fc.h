@@ -0,0 +1,247 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2026 Free Software Foundation, Inc.
+ *
+ * This file is part of VOLK
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+/*!
+ * \page volk_8ic_32fc_lut_32fc
+ *
+ * \b Overview
+ *
+ * Converts 8-bit complex samples to complex floats through a 256 entry
+ * lookup table, e.g. to apply separate nonlinear calibrations to the I and Q
+ * converters of a receiver. The real parts of the table map I, the imaginary
+ * parts map Q. Both are indexed with the bit pattern of the sample, i.e.
+ * table[128] holds the values for -128.
+ *
+ * outputVector[i] = lv_cmake(lv_creal(table[(uint8_t)I[i]]),
+ *                            lv_cimag(table[(uint8_t)Q[i]]))
+ *
+ * <b>Dispatcher Prototype</b>
+ * \code
+ * void volk_8ic_32fc_lut_32fc(lv_32fc_t* outputVector, const lv_8sc_t* inputVector,
+ *                             const lv_32fc_t* table, unsigned int num_points)
+ * \endcode
+ *
+ * \b Inputs
+ * \li inputVector: the samples to convert.
+ * \li table: the 256 output values of I (real part) and Q (imaginary part).
+ * \li num_points: the number of complex samples.
+ *
+ * \b Outputs
+ * \li outputVector: the looked up samples.
+ *
+ * \b Example
+ * Remove a DC offset of I and a gain imbalance of Q.
+ * \code
+ *   unsigned int N = 1000;
+ *   unsigned int alignment = volk_get_alignment();
+ *   lv_8sc_t* in = (lv_8sc_t*)volk_malloc(sizeof(lv_8sc_t) * N, alignment);
+ *   lv_32fc_t* out = (lv_32fc_t*)volk_malloc(sizeof(lv_32fc_t) * N, alignment);
+ *   lv_32fc_t table[256];
+ *
+ *   for (unsigned int ii = 0; ii < 256; ++ii) {
+ *       float value = (float)(int8_t)ii;
+ *       table[ii] = lv_cmake((value - 0.7f) / 128.f, 1.05f * value / 128.f);
+ *   }
+ *   // ... fill in
+ *
+ *   volk_8ic_32fc_lut_32fc(out, in, table, N);
+ *
+ *   volk_free(in);
+ *   volk_free(out);
+ * \endcode
+ */
+
+#ifndef INCLUDED_volk_8ic_32fc_lut_32fc_H
+#define INCLUDED_volk_8ic_32fc_lut_32fc_H
+
+#include <inttypes.h>
+#include <volk/volk_complex.h>
+
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void volk_8ic_32fc_lut_32fc_generic(lv_32fc_t* outputVector,
+                                                  const lv_8sc_t* inputVector,
+                                                  const lv_32fc_t* table,
+                                                  unsigned int num_points)
+{
+    const uint8_t* inputPtr = (const uint8_t*)inputVector;
+    const float* tablePtr = (const float*)table;
+    float* outputPtr = (float*)outputVector;
+    unsigned int number;
+
+    for (number = 0; number < num_points; number++) {
+        *outputPtr++ = tablePtr[2 * inputPtr[0]];
+        *outputPtr++ = tablePtr[2 * inputPtr[1] + 1];
+        inputPtr += 2;
+    }
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+
+#ifdef LV_HAVE_AVX2
+#include <immintrin.h>
+
+static inline void volk_8ic_32fc_lut_32fc_u_avx2(lv_32fc_t* outputVector,
+                                                 const lv_8sc_t* inputVector,
+                                                 const lv_32fc_t* table,
+                                                 unsigned int num_points)
+{
+    const unsigned int eighthPoints = num_points / 8;
+    const uint8_t* inputPtr = (const uint8_t*)inputVector;
+    const float* tablePtr = (const float*)table;
+    float* outputPtr = (float*)outputVector;
+    // I indexes the real and Q the imaginary parts
+    const __m256i part = _mm256_setr_epi32(0, 1, 0, 1, 0, 1, 0, 1);
+    __m256i idx0, idx1;
+    unsigned int number;
+
+    for (number = 0; number < eighthPoints; number++) {
+        idx0 = _mm256_cvtepu8_epi32(_mm_loadl_epi64((const __m128i*)inputPtr));
+        idx1 = _mm256_cvtepu8_epi32(_mm_loadl_epi64((const __m128i*)(inputPtr + 8)));
+        idx0 = _mm256_or_si256(_mm256_slli_epi32(idx0, 1), part);
+        idx1 = _mm256_or_si256(_mm256_slli_epi32(idx1, 1), part);
+        _mm256_storeu_ps(outputPtr, _mm256_i32gather_ps(tablePtr, idx0, 4));
+        _mm256_storeu_ps(outputPtr + 8, _mm256_i32gather_ps(tablePtr, idx1, 4));
+        inputPtr += 16;
+        outputPtr += 16;
+    }
+
+    for (number = eighthPoints * 8; number < num_points; number++) {
+        *outputPtr++ = tablePtr[2 * inputPtr[0]];
+        *outputPtr++ = tablePtr[2 * inputPtr[1] + 1];
+        inputPtr += 2;
+    }
+}
+
+#endif /* LV_HAVE_AVX2 */
+
+
+#ifdef LV_HAVE_AVX512F
+#include <immintrin.h>
+
+static inline void volk_8ic_32fc_lut_32fc_u_avx512f(lv_32fc_t* outputVector,
+                                                    const lv_8sc_t* inputVector,
+                                                    const lv_32fc_t* table,
+                                                    unsigned int num_points)
+{
+    const unsigned int eighthPoints = num_points / 8;
+    const uint8_t* inputPtr = (const uint8_t*)inputVector;
+    const float* tablePtr = (const float*)table;
+    float* outputPtr = (float*)outputVector;
+    // the 512 floats do not fit the register file, gather them instead
+    const __m512i part =
+        _mm512_setr_epi32(0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1);
+    __m512i idx;
+    unsigned int number;
+
+    for (number = 0; number < eighthPoints; number++) {
+        idx = _mm512_cvtepu8_epi32(_mm_loadu_si128((const __m128i*)inputPtr));
+        idx = _mm512_or_si512(_mm512_slli_epi32(idx, 1), part);
+        _mm512_storeu_ps(outputPtr, _mm512_i32gather_ps(idx, tablePtr, 4));
+        inputPtr += 16;
+        outputPtr += 16;
+    }
+
+    for (number = eighthPoints * 8; number < num_points; number++) {
+        *outputPtr++ = tablePtr[2 * inputPtr[0]];
+        *outputPtr++ = tablePtr[2 * inputPtr[1] + 1];
+        inputPtr += 2;
+    }
+}
+
+#endif /* LV_HAVE_AVX512F */
+
+
+#ifdef LV_HAVE_NEONV8
+#include <arm_neon.h>
+
+static inline void volk_8ic_32fc_lut_32fc_neonv8(lv_32fc_t* outputVector,
+                                                 const lv_8sc_t* inputVector,
+                                                 const lv_32fc_t* table,
+                                                 unsigned int num_points)
+{
+    const unsigned int sixteenthPoints = num_points / 16;
+    const uint8_t* inputPtr = (const uint8_t*)inputVector;
+    const float* tablePtr = (const float*)table;
+    float* outputPtr = (float*)outputVector;
+    const uint8x16_t step = vdupq_n_u8(64);
+    // byte planes 0-3 of the real parts, 4-7 of the imaginary parts
+    uint8_t planes[8][256];
+    uint8x16x4_t bytes, next;
+    uint8x16x2_t samples;
+    uint8x16_t idx[4], result[8];
+    uint8x16x2_t low, high;
+    uint16x8x2_t words0, words1;
+    float32x4x2_t values;
+    unsigned int number, plane, quarter;
+
+    for (number = 0; number < 16; number++) {
+        bytes = vld4q_u8((const uint8_t*)(tablePtr + 32 * number));
+        next = vld4q_u8((const uint8_t*)(tablePtr + 32 * number + 16));
+        for (plane = 0; plane < 4; plane++) {
+            samples = vuzpq_u8(bytes.val[plane], next.val[plane]);
+            vst1q_u8(planes[plane] + 16 * number, samples.val[0]);
+            vst1q_u8(planes[plane + 4] + 16 * number, samples.val[1]);
+        }
+    }
+
+    for (number = 0; number < sixteenthPoints; number++) {
+        samples = vld2q_u8(inputPtr);
+
+        for (plane = 0; plane < 8; plane++) {
+            if (plane % 4 == 0) {
+                idx[0] = samples.val[plane / 4];
+                idx[1] = vsubq_u8(idx[0], step);
+                idx[2] = vsubq_u8(idx[1], step);
+                idx[3] = vsubq_u8(idx[2], step);
+            }
+            // out of range indices leave the byte of the previous quarter
+            result[plane] = vqtbl4q_u8(vld1q_u8_x4(planes[plane]), idx[0]);
+            for (quarter = 1; quarter < 4; quarter++) {
+                result[plane] = vqtbx4q_u8(result[plane],
+                                           vld1q_u8_x4(planes[plane] + 64 * quarter),
+                                           idx[quarter]);
+            }
+        }
+
+        // assemble the floats from their bytes and interleave I and Q
+        for (plane = 0; plane < 8; plane += 4) {
+            low = vzipq_u8(result[plane], result[plane + 1]);
+            high = vzipq_u8(result[plane + 2], result[plane + 3]);
+            words0 = vzipq_u16(vreinterpretq_u16_u8(low.val[0]),
+                               vreinterpretq_u16_u8(high.val[0]));
+            words1 = vzipq_u16(vreinterpretq_u16_u8(low.val[1]),
+                               vreinterpretq_u16_u8(high.val[1]));
+            result[plane] = vreinterpretq_u8_u16(words0.val[0]);
+            result[plane + 1] = vreinterpretq_u8_u16(words0.val[1]);
+            result[plane + 2] = vreinterpretq_u8_u16(words1.val[0]);
+            result[plane + 3] = vreinterpretq_u8_u16(words1.val[1]);
+        }
+        for (plane = 0; plane < 4; plane++) {
+            values.val[0] = vreinterpretq_f32_u8(result[plane]);
+            values.val[1] = vreinterpretq_f32_u8(result[plane + 4]);
+            vst2q_f32(outputPtr + 8 * plane, values);
+        }
+
+        inputPtr += 32;
+        outputPtr += 32;
+    }
+
+    for (number = sixteenthPoints * 16; number < num_points; number++) {
+        *outputPtr++ = tablePtr[2 * inputPtr[0]];
+        *outputPtr++ = tablePtr[2 * inputPtr[1] + 1];
+        inputPtr += 2;
+    }
+}
+
+#endif /* LV_HAVE_NEONV8 */
+
+#endif /* INCLUDED_volk_8ic_32fc_lut_32fc_H */
@@ -0,0 +1,238 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2026 Free Software Foundation, Inc.
+ *
+ * This file is part of VOLK
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+/*!
+ * \page volk_8u_32f_lut_32f
+ *
+ * \b Overview
+ *
+ * Converts bytes to floats through a 256 entry lookup table, e.g. to apply
+ * the nonlinear calibration of an 8-bit ADC or to expand mu-law or A-law
+ * samples.
+ *
+ * outputVector[i] = table[inputVector[i]]
+ *
+ * Signed samples index the table with their bit pattern, i.e. table[128]
+ * holds the value for -128.
+ *
+ * <b>Dispatcher Prototype</b>
+ * \code
+ * void volk_8u_32f_lut_32f(float* outputVector, const uint8_t* inputVector,
+ *                          const float* table, unsigned int num_points)
+ * \endcode
+ *
+ * \b Inputs
+ * \li inputVector: the bytes to convert.
+ * \li table: the 256 output values.
+ * \li num_points: the number of bytes.
+ *
+ * \b Outputs
+ * \li outputVector: the looked up values.
+ *
+ * \b Example
+ * Expand mu-law samples.
+ * \code
+ *   unsigned int N = 1000;
+ *   unsigned int alignment = volk_get_alignment();
+ *   uint8_t* in = (uint8_t*)volk_malloc(N, alignment);
+ *   float* out = (float*)volk_malloc(sizeof(float) * N, alignment);
+ *   float table[256];
+ *
+ *   for (unsigned int ii = 0; ii < 256; ++ii) {
+ *       unsigned int code = ~ii & 0xff;
+ *       int magnitude = ((((code & 0x0f) << 3) + 0x84) << ((code >> 4) & 7)) - 0x84;
+ *       table[ii] = ((code & 0x80) ? -magnitude : magnitude) / 32768.f;
+ *   }
+ *   // ... fill in
+ *
+ *   volk_8u_32f_lut_32f(out, in, table, N);
+ *
+ *   volk_free(in);
+ *   volk_free(out);
+ * \endcode
+ */
+
+#ifndef INCLUDED_volk_8u_32f_lut_32f_H
+#define INCLUDED_volk_8u_32f_lut_32f_H
+
+#include <inttypes.h>
+
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void volk_8u_32f_lut_32f_generic(float* outputVector,
+                                               const uint8_t* inputVector,
+                                               const float* table,
+                                               unsigned int num_points)
+{
+    unsigned int number;
+
+    for (number = 0; number < num_points; number++) {
+        *outputVector++ = table[*inputVector++];
+    }
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+
+#ifdef LV_HAVE_AVX2
+#include <immintrin.h>
+
+static inline void volk_8u_32f_lut_32f_u_avx2(float* outputVector,
+                                              const uint8_t* inputVector,
+                                              const float* table,
+                                              unsigned int num_points)
+{
+    const unsigned int sixteenthPoints = num_points / 16;
+    __m256i idx0, idx1;
+    unsigned int number;
+
+    for (number = 0; number < sixteenthPoints; number++) {
+        idx0 = _mm256_cvtepu8_epi32(_mm_loadl_epi64((const __m128i*)inputVector));
+        idx1 = _mm256_cvtepu8_epi32(_mm_loadl_epi64((const __m128i*)(inputVector + 8)));
+        _mm256_storeu_ps(outputVector, _mm256_i32gather_ps(table, idx0, 4));
+        _mm256_storeu_ps(outputVector + 8, _mm256_i32gather_ps(table, idx1, 4));
+        inputVector += 16;
+        outputVector += 16;
+    }
+
+    for (number = sixteenthPoints * 16; number < num_points; number++) {
+        *outputVector++ = table[*inputVector++];
+    }
+}
+
+#endif /* LV_HAVE_AVX2 */
+
+
+#ifdef LV_HAVE_AVX512F
+#include <immintrin.h>
+
+static inline void volk_8u_32f_lut_32f_u_avx512f(float* outputVector,
+                                                 const uint8_t* inputVector,
+                                                 const float* table,
+                                                 unsigned int num_points)
+{
+    const unsigned int sixteenthPoints = num_points / 16;
+    const __m512i bit5 = _mm512_set1_epi32(32);
+    const __m512i bit6 = _mm512_set1_epi32(64);
+    const __m512i bit7 = _mm512_set1_epi32(128);
+    __m512 t0, t1, t2, t3, t4, t5, t6, t7, t8, t9, t10, t11, t12, t13, t14, t15;
+    __m512 r0, r1, r2, r3, r4, r5, r6, r7;
+    __m512i idx;
+    __mmask16 mask;
+    unsigned int number;
+
+    // the whole table lives in 16 registers
+    t0 = _mm512_loadu_ps(table);
+    t1 = _mm512_loadu_ps(table + 16);
+    t2 = _mm512_loadu_ps(table + 32);
+    t3 = _mm512_loadu_ps(table + 48);
+    t4 = _mm512_loadu_ps(table + 64);
+    t5 = _mm512_loadu_ps(table + 80);
+    t6 = _mm512_loadu_ps(table + 96);
+    t7 = _mm512_loadu_ps(table + 112);
+    t8 = _mm512_loadu_ps(table + 128);
+    t9 = _mm512_loadu_ps(table + 144);
+    t10 = _mm512_loadu_ps(table + 160);
+    t11 = _mm512_loadu_ps(table + 176);
+    t12 = _mm512_loadu_ps(table + 192);
+    t13 = _mm512_loadu_ps(table + 208);
+    t14 = _mm512_loadu_ps(table + 224);
+    t15 = _mm512_loadu_ps(table + 240);
+
+    for (number = 0; number < sixteenthPoints; number++) {
+        idx = _mm512_cvtepu8_epi32(_mm_loadu_si128((const __m128i*)inputVector));
+
+        // look up the low 5 bits in each 32 entry slice of the table, then
+        // select the slice with the high 3 bits
+        r0 = _mm512_permutex2var_ps(t0, idx, t1);
+        r1 = _mm512_permutex2var_ps(t2, idx, t3);
+        r2 = _mm512_permutex2var_ps(t4, idx, t5);
+        r3 = _mm512_permutex2var_ps(t6, idx, t7);
+        r4 = _mm512_permutex2var_ps(t8, idx, t9);
+        r5 = _mm512_permutex2var_ps(t10, idx, t11);
+        r6 = _mm512_permutex2var_ps(t12, idx, t13);
+        r7 = _mm512_permutex2var_ps(t14, idx, t15);
+
+        mask = _mm512_test_epi32_mask(idx, bit5);
+        r0 = _mm512_mask_mov_ps(r0, mask, r1);
+        r2 = _mm512_mask_mov_ps(r2, mask, r3);
+        r4 = _mm512_mask_mov_ps(r4, mask, r5);
+        r6 = _mm512_mask_mov_ps(r6, mask, r7);
+        mask = _mm512_test_epi32_mask(idx, bit6);
+        r0 = _mm512_mask_mov_ps(r0, mask, r2);
+        r4 = _mm512_mask_mov_ps(r4, mask, r6);
+        mask = _mm512_test_epi32_mask(idx, bit7);
+        _mm512_storeu_ps(outputVector, _mm512_mask_mov_ps(r0, mask, r4));
+
+        inputVector += 16;
+        outputVector += 16;
+    }
+
+    for (number = sixteenthPoints * 16; number < num_points; number++) {
+        *outputVector++ = table[*inputVector++];
+    }
+}
+
+#endif /* LV_HAVE_AVX512F */
+
+
+#ifdef LV_HAVE_NEONV8
+#include <arm_neon.h>
+
+static inline void volk_8u_32f_lut_32f_neonv8(float* outputVector,
+                                              const uint8_t* inputVector,
+                                              const float* table,
+                                              unsigned int num_points)
+{
+    const unsigned int sixteenthPoints = num_points / 16;
+    const uint8x16_t step = vdupq_n_u8(64);
+    uint8_t planes[4][256];
+    uint8x16x4_t bytes;
+    uint8x16_t idx[4];
+    unsigned int number, plane, quarter;
+
+    // split the floats into byte planes, each a 256 byte vtbl table
+    for (number = 0; number < 16; number++) {
+        bytes = vld4q_u8((const uint8_t*)(table + 16 * number));
+        vst1q_u8(planes[0] + 16 * number, bytes.val[0]);
+        vst1q_u8(planes[1] + 16 * number, bytes.val[1]);
+        vst1q_u8(planes[2] + 16 * number, bytes.val[2]);
+        vst1q_u8(planes[3] + 16 * number, bytes.val[3]);
+    }
+
+    for (number = 0; number < sixteenthPoints; number++) {
+        idx[0] = vld1q_u8(inputVector);
+        idx[1] = vsubq_u8(idx[0], step);
+        idx[2] = vsubq_u8(idx[1], step);
+        idx[3] = vsubq_u8(idx[2], step);
+
+        // out of range indices leave the byte of the previous quarter
+        for (plane = 0; plane < 4; plane++) {
+            bytes.val[plane] = vqtbl4q_u8(vld1q_u8_x4(planes[plane]), idx[0]);
+            for (quarter = 1; quarter < 4; quarter++) {
+                bytes.val[plane] = vqtbx4q_u8(bytes.val[plane],
+                                              vld1q_u8_x4(planes[plane] + 64 * quarter),
+                                              idx[quarter]);
+            }
+        }
+        vst4q_u8((uint8_t*)outputVector, bytes);
+
+        inputVector += 16;
+        outputVector += 16;
+    }
+
+    for (number = sixteenthPoints * 16; number < num_points; number++) {
+        *outputVector++ = table[*inputVector++];
+    }
+}
+
+#endif /* LV_HAVE_NEONV8 */
+
+#endif /* INCLUDED_volk_8u_32f_lut_32f_H */
@@ -0,0 +1,83 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2026 Free Software Foundation, Inc.
+ *
+ * This file is part of VOLK
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+/* For documentation see 'kernels/volk/volk_12ic_convert_16ic.h'
+ * This file exists for test purposes only. Should not be used directly.
+ *
+ * Unpacks the input as num_points / 3 samples and zeroes the rest of the
+ * output.
+ */
+
+#ifndef INCLUDED_volk_8u_convert12icpuppet_16ic_H
+#define INCLUDED_volk_8u_convert12icpuppet_16ic_H
+
+#include <string.h>
+#include <volk/volk_12ic_convert_16ic.h>
+
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void volk_8u_convert12icpuppet_16ic_generic(lv_16sc_t* outputVector,
+                                                          const uint8_t* inputVector,
+                                                          unsigned int num_points)
+{
+    const unsigned int samples = num_points / 3;
+
+    volk_12ic_convert_16ic_generic(outputVector, inputVector, samples);
+    memset(outputVector + samples, 0, (num_points - samples) * sizeof(lv_16sc_t));
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+
+#ifdef LV_HAVE_SSSE3
+
+static inline void volk_8u_convert12icpuppet_16ic_u_ssse3(lv_16sc_t* outputVector,
+                                                          const uint8_t* inputVector,
+                                                          unsigned int num_points)
+{
+    const unsigned int samples = num_points / 3;
+
+    volk_12ic_convert_16ic_u_ssse3(outputVector, inputVector, samples);
+    memset(outputVector + samples, 0, (num_points - samples) * sizeof(lv_16sc_t));
+}
+
+#endif /* LV_HAVE_SSSE3 */
+
+
+#ifdef LV_HAVE_AVX2
+
+static inline void volk_8u_convert12icpuppet_16ic_u_avx2(lv_16sc_t* outputVector,
+                                                         const uint8_t* inputVector,
+                                                         unsigned int num_points)
+{
+    const unsigned int samples = num_points / 3;
+
+    volk_12ic_convert_16ic_u_avx2(outputVector, inputVector, samples);
+    memset(outputVector + samples, 0, (num_points - samples) * sizeof(lv_16sc_t));
+}
+
+#endif /* LV_HAVE_AVX2 */
+
+
+#ifdef LV_HAVE_NEON
+
+static inline void volk_8u_convert12icpuppet_16ic_neon(lv_16sc_t* outputVector,
+                                                       const uint8_t* inputVector,
+                                                       unsigned int num_points)
+{
+    const unsigned int samples = num_points / 3;
+
+    volk_12ic_convert_16ic_neon(outputVector, inputVector, samples);
+    memset(outputVector + samples, 0, (num_points - samples) * sizeof(lv_16sc_t));
+}
+
+#endif /* LV_HAVE_NEON */
+
+#endif /* INCLUDED_volk_8u_convert12icpuppet_16ic_H */
@@ -0,0 +1,69 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2026 Free Software Foundation, Inc.
+ *
+ * This file is part of VOLK
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+/* For documentation see 'kernels/volk/volk_4ic_s32f_convert_32fc.h'
+ * This file exists for test purposes only. Should not be used directly.
+ *
+ * Converts every input byte as one sample to full scale 1.
+ */
+
+#ifndef INCLUDED_volk_8u_convert4icpuppet_32fc_H
+#define INCLUDED_volk_8u_convert4icpuppet_32fc_H
+
+#include <volk/volk_4ic_s32f_convert_32fc.h>
+
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void volk_8u_convert4icpuppet_32fc_generic(lv_32fc_t* outputVector,
+                                                         const uint8_t* inputVector,
+                                                         unsigned int num_points)
+{
+    volk_4ic_s32f_convert_32fc_generic(outputVector, inputVector, 8.f, num_points);
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+
+#ifdef LV_HAVE_SSSE3
+
+static inline void volk_8u_convert4icpuppet_32fc_u_ssse3(lv_32fc_t* outputVector,
+                                                         const uint8_t* inputVector,
+                                                         unsigned int num_points)
+{
+    volk_4ic_s32f_convert_32fc_u_ssse3(outputVector, inputVector, 8.f, num_points);
+}
+
+#endif /* LV_HAVE_SSSE3 */
+
+
+#ifdef LV_HAVE_AVX2
+
+static inline void volk_8u_convert4icpuppet_32fc_u_avx2(lv_32fc_t* outputVector,
+                                                        const uint8_t* inputVector,
+                                                        unsigned int num_points)
+{
+    volk_4ic_s32f_convert_32fc_u_avx2(outputVector, inputVector, 8.f, num_points);
+}
+
+#endif /* LV_HAVE_AVX2 */
+
+
+#ifdef LV_HAVE_NEON
+
+static inline void volk_8u_convert4icpuppet_32fc_neon(lv_32fc_t* outputVector,
+                                                      const uint8_t* inputVector,
+                                                      unsigned int num_points)
+{
+    volk_4ic_s32f_convert_32fc_neon(outputVector, inputVector, 8.f, num_points);
+}
+
+#endif /* LV_HAVE_NEON */
+
+#endif /* INCLUDED_volk_8u_convert4icpuppet_32fc_H */
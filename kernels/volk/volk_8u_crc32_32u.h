@@ -0,0 +1,358 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2026 Free Software Foundation, Inc.
+ *
+ * This file is part of VOLK
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+/*!
+ * \page volk_8u_crc32_32u
+ *
+ * \b Overview
+ *
+ * Computes the CRC-32 of a byte vector as used by Ethernet, zlib and PNG:
+ * reflected polynomial 0x04C11DB7, initial value and final XOR 0xFFFFFFFF.
+ * The value in crc is updated like zlib's crc32(), so a stream split into
+ * several calls gives the same result as one call over all bytes as long as
+ * crc starts at 0.
+ *
+ * The PCLMUL and ARMv8 PMULL implementations fold 64 bytes per iteration
+ * with carry-less multiplications and finish the last bytes with the table.
+ * The VPCLMULQDQ implementation folds 256 bytes per iteration in four 512-bit
+ * registers.
+ *
+ * <b>Dispatcher Prototype</b>
+ * \code
+ * void volk_8u_crc32_32u(uint32_t* crc, const uint8_t* data, unsigned int num_points)
+ * \endcode
+ *
+ * \b Inputs
+ * \li crc: the CRC of the preceding bytes, 0 at the start of a message.
+ * \li data: the message bytes.
+ * \li num_points: the number of bytes.
+ *
+ * \b Outputs
+ * \li crc: the CRC including data.
+ *
+ * \b Example
+ * \code
+ *   const char* msg = "123456789";
+ *   uint32_t crc = 0;
+ *
+ *   volk_8u_crc32_32u(&crc, (const uint8_t*)msg, 9); // crc == 0xcbf43926
+ * \endcode
+ */
+
+#ifndef INCLUDED_volk_8u_crc32_32u_H
+#define INCLUDED_volk_8u_crc32_32u_H
+
+#include <inttypes.h>
+#include <volk/volk_common.h>
+
+static const uint32_t volk_8u_crc32_table[256] = {
+    0x00000000, 0x77073096, 0xee0e612c, 0x990951ba, 0x076dc419, 0x706af48f,
+    0xe963a535, 0x9e6495a3, 0x0edb8832, 0x79dcb8a4, 0xe0d5e91e, 0x97d2d988,
+    0x09b64c2b, 0x7eb17cbd, 0xe7b82d07, 0x90bf1d91, 0x1db71064, 0x6ab020f2,
+    0xf3b97148, 0x84be41de, 0x1adad47d, 0x6ddde4eb, 0xf4d4b551, 0x83d385c7,
+    0x136c9856, 0x646ba8c0, 0xfd62f97a, 0x8a65c9ec, 0x14015c4f, 0x63066cd9,
+    0xfa0f3d63, 0x8d080df5, 0x3b6e20c8, 0x4c69105e, 0xd56041e4, 0xa2677172,
+    0x3c03e4d1, 0x4b04d447, 0xd20d85fd, 0xa50ab56b, 0x35b5a8fa, 0x42b2986c,
+    0xdbbbc9d6, 0xacbcf940, 0x32d86ce3, 0x45df5c75, 0xdcd60dcf, 0xabd13d59,
+    0x26d930ac, 0x51de003a, 0xc8d75180, 0xbfd06116, 0x21b4f4b5, 0x56b3c423,
+    0xcfba9599, 0xb8bda50f, 0x2802b89e, 0x5f058808, 0xc60cd9b2, 0xb10be924,
+    0x2f6f7c87, 0x58684c11, 0xc1611dab, 0xb6662d3d, 0x76dc4190, 0x01db7106,
+    0x98d220bc, 0xefd5102a, 0x71b18589, 0x06b6b51f, 0x9fbfe4a5, 0xe8b8d433,
+    0x7807c9a2, 0x0f00f934, 0x9609a88e, 0xe10e9818, 0x7f6a0dbb, 0x086d3d2d,
+    0x91646c97, 0xe6635c01, 0x6b6b51f4, 0x1c6c6162, 0x856530d8, 0xf262004e,
+    0x6c0695ed, 0x1b01a57b, 0x8208f4c1, 0xf50fc457, 0x65b0d9c6, 0x12b7e950,
+    0x8bbeb8ea, 0xfcb9887c, 0x62dd1ddf, 0x15da2d49, 0x8cd37cf3, 0xfbd44c65,
+    0x4db26158, 0x3ab551ce, 0xa3bc0074, 0xd4bb30e2, 0x4adfa541, 0x3dd895d7,
+    0xa4d1c46d, 0xd3d6f4fb, 0x4369e96a, 0x346ed9fc, 0xad678846, 0xda60b8d0,
+    0x44042d73, 0x33031de5, 0xaa0a4c5f, 0xdd0d7cc9, 0x5005713c, 0x270241aa,
+    0xbe0b1010, 0xc90c2086, 0x5768b525, 0x206f85b3, 0xb966d409, 0xce61e49f,
+    0x5edef90e, 0x29d9c998, 0xb0d09822, 0xc7d7a8b4, 0x59b33d17, 0x2eb40d81,
+    0xb7bd5c3b, 0xc0ba6cad, 0xedb88320, 0x9abfb3b6, 0x03b6e20c, 0x74b1d29a,
+    0xead54739, 0x9dd277af, 0x04db2615, 0x73dc1683, 0xe3630b12, 0x94643b84,
+    0x0d6d6a3e, 0x7a6a5aa8, 0xe40ecf0b, 0x9309ff9d, 0x0a00ae27, 0x7d079eb1,
+    0xf00f9344, 0x8708a3d2, 0x1e01f268, 0x6906c2fe, 0xf762575d, 0x806567cb,
+    0x196c3671, 0x6e6b06e7, 0xfed41b76, 0x89d32be0, 0x10da7a5a, 0x67dd4acc,
+    0xf9b9df6f, 0x8ebeeff9, 0x17b7be43, 0x60b08ed5, 0xd6d6a3e8, 0xa1d1937e,
+    0x38d8c2c4, 0x4fdff252, 0xd1bb67f1, 0xa6bc5767, 0x3fb506dd, 0x48b2364b,
+    0xd80d2bda, 0xaf0a1b4c, 0x36034af6, 0x41047a60, 0xdf60efc3, 0xa867df55,
+    0x316e8eef, 0x4669be79, 0xcb61b38c, 0xbc66831a, 0x256fd2a0, 0x5268e236,
+    0xcc0c7795, 0xbb0b4703, 0x220216b9, 0x5505262f, 0xc5ba3bbe, 0xb2bd0b28,
+    0x2bb45a92, 0x5cb36a04, 0xc2d7ffa7, 0xb5d0cf31, 0x2cd99e8b, 0x5bdeae1d,
+    0x9b64c2b0, 0xec63f226, 0x756aa39c, 0x026d930a, 0x9c0906a9, 0xeb0e363f,
+    0x72076785, 0x05005713, 0x95bf4a82, 0xe2b87a14, 0x7bb12bae, 0x0cb61b38,
+    0x92d28e9b, 0xe5d5be0d, 0x7cdcefb7, 0x0bdbdf21, 0x86d3d2d4, 0xf1d4e242,
+    0x68ddb3f8, 0x1fda836e, 0x81be16cd, 0xf6b9265b, 0x6fb077e1, 0x18b74777,
+    0x88085ae6, 0xff0f6a70, 0x66063bca, 0x11010b5c, 0x8f659eff, 0xf862ae69,
+    0x616bffd3, 0x166ccf45, 0xa00ae278, 0xd70dd2ee, 0x4e048354, 0x3903b3c2,
+    0xa7672661, 0xd06016f7, 0x4969474d, 0x3e6e77db, 0xaed16a4a, 0xd9d65adc,
+    0x40df0b66, 0x37d83bf0, 0xa9bcae53, 0xdebb9ec5, 0x47b2cf7f, 0x30b5ffe9,
+    0xbdbdf21c, 0xcabac28a, 0x53b39330, 0x24b4a3a6, 0xbad03605, 0xcdd70693,
+    0x54de5729, 0x23d967bf, 0xb3667a2e, 0xc4614ab8, 0x5d681b02, 0x2a6f2b94,
+    0xb40bbe37, 0xc30c8ea1, 0x5a05df1b, 0x2d02ef8d
+};
+
+static inline uint32_t
+volk_8u_crc32_update(uint32_t reg, const uint8_t* data, unsigned int num_points)
+{
+    unsigned int number;
+    for (number = 0; number < num_points; number++) {
+        reg = (reg >> 8) ^ volk_8u_crc32_table[(reg ^ data[number]) & 0xff];
+    }
+    return reg;
+}
+
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void
+volk_8u_crc32_32u_generic(uint32_t* crc, const uint8_t* data, unsigned int num_points)
+{
+    *crc = ~volk_8u_crc32_update(~*crc, data, num_points);
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+
+#if LV_HAVE_SSE2 && LV_HAVE_PCLMUL
+#include <emmintrin.h>
+#include <wmmintrin.h>
+
+static inline void
+volk_8u_crc32_32u_u_pclmul(uint32_t* crc, const uint8_t* data, unsigned int num_points)
+{
+    uint32_t reg = ~*crc;
+    unsigned int remaining = num_points;
+
+    if (remaining >= 64) {
+        // Bit-reflected x^(D+32) mod P and x^(D-32) mod P shifted left by one for
+        // the low and high halves, for fold distances D of 512 and 128 bits
+        const __m128i k512 = _mm_set_epi64x(0x1c6e41596, 0x154442bd4);
+        const __m128i k128 = _mm_set_epi64x(0x0ccaa009e, 0x1751997d0);
+        __VOLK_ATTR_ALIGNED(16) uint8_t residue[16];
+        __m128i x0, x1, x2, x3;
+
+        x0 = _mm_xor_si128(_mm_loadu_si128((const __m128i*)data),
+                           _mm_cvtsi32_si128((int)reg));
+        x1 = _mm_loadu_si128((const __m128i*)(data + 16));
+        x2 = _mm_loadu_si128((const __m128i*)(data + 32));
+        x3 = _mm_loadu_si128((const __m128i*)(data + 48));
+        data += 64;
+        remaining -= 64;
+
+        while (remaining >= 64) {
+            x0 = _mm_xor_si128(_mm_xor_si128(_mm_clmulepi64_si128(x0, k512, 0x00),
+                                             _mm_clmulepi64_si128(x0, k512, 0x11)),
+                               _mm_loadu_si128((const __m128i*)data));
+            x1 = _mm_xor_si128(_mm_xor_si128(_mm_clmulepi64_si128(x1, k512, 0x00),
+                                             _mm_clmulepi64_si128(x1, k512, 0x11)),
+                               _mm_loadu_si128((const __m128i*)(data + 16)));
+            x2 = _mm_xor_si128(_mm_xor_si128(_mm_clmulepi64_si128(x2, k512, 0x00),
+                                             _mm_clmulepi64_si128(x2, k512, 0x11)),
+                               _mm_loadu_si128((const __m128i*)(data + 32)));
+            x3 = _mm_xor_si128(_mm_xor_si128(_mm_clmulepi64_si128(x3, k512, 0x00),
+                                             _mm_clmulepi64_si128(x3, k512, 0x11)),
+                               _mm_loadu_si128((const __m128i*)(data + 48)));
+            data += 64;
+            remaining -= 64;
+        }
+
+        x0 = _mm_xor_si128(_mm_xor_si128(_mm_clmulepi64_si128(x0, k128, 0x00),
+                                         _mm_clmulepi64_si128(x0, k128, 0x11)),
+                           x1);
+        x0 = _mm_xor_si128(_mm_xor_si128(_mm_clmulepi64_si128(x0, k128, 0x00),
+                                         _mm_clmulepi64_si128(x0, k128, 0x11)),
+                           x2);
+        x0 = _mm_xor_si128(_mm_xor_si128(_mm_clmulepi64_si128(x0, k128, 0x00),
+                                         _mm_clmulepi64_si128(x0, k128, 0x11)),
+                           x3);
+        while (remaining >= 16) {
+            x0 = _mm_xor_si128(_mm_xor_si128(_mm_clmulepi64_si128(x0, k128, 0x00),
+                                             _mm_clmulepi64_si128(x0, k128, 0x11)),
+                               _mm_loadu_si128((const __m128i*)data));
+            data += 16;
+            remaining -= 16;
+        }
+
+        // The folded 128 bits are congruent to the message so far, their CRC
+        // with a zero register is the register after the message
+        _mm_store_si128((__m128i*)residue, x0);
+        reg = volk_8u_crc32_update(0, residue, 16);
+    }
+
+    *crc = ~volk_8u_crc32_update(reg, data, remaining);
+}
+
+#endif /* LV_HAVE_SSE2 && LV_HAVE_PCLMUL */
+
+
+#if LV_HAVE_AVX512F && LV_HAVE_PCLMUL && LV_HAVE_VPCLMULQDQ
+#include <immintrin.h>
+
+static inline void
+volk_8u_crc32_32u_u_vpclmulqdq(uint32_t* crc,
+                               const uint8_t* data,
+                               unsigned int num_points)
+{
+    uint32_t reg = ~*crc;
+    unsigned int remaining = num_points;
+
+    if (remaining >= 64) {
+        // The constants of the PCLMUL implementation in every 128-bit lane, and
+        // for a fold distance of 2048 bits
+        const __m512i k2048 =
+            _mm512_broadcast_i32x4(_mm_set_epi64x(0x1322d1430, 0x11542778a));
+        const __m512i k512 =
+            _mm512_broadcast_i32x4(_mm_set_epi64x(0x1c6e41596, 0x154442bd4));
+        const __m128i k128 = _mm_set_epi64x(0x0ccaa009e, 0x1751997d0);
+        __VOLK_ATTR_ALIGNED(16) uint8_t residue[16];
+        __m512i z0, z1, z2, z3;
+        __m128i x0;
+
+        z0 = _mm512_xor_si512(
+            _mm512_loadu_si512(data),
+            _mm512_inserti32x4(_mm512_setzero_si512(), _mm_cvtsi32_si128((int)reg), 0));
+        data += 64;
+        remaining -= 64;
+
+        if (remaining >= 192) {
+            z1 = _mm512_loadu_si512(data);
+            z2 = _mm512_loadu_si512(data + 64);
+            z3 = _mm512_loadu_si512(data + 128);
+            data += 192;
+            remaining -= 192;
+
+            while (remaining >= 256) {
+                z0 = _mm512_ternarylogic_epi64(_mm512_clmulepi64_epi128(z0, k2048, 0x00),
+                                               _mm512_clmulepi64_epi128(z0, k2048, 0x11),
+                                               _mm512_loadu_si512(data),
+                                               0x96);
+                z1 = _mm512_ternarylogic_epi64(_mm512_clmulepi64_epi128(z1, k2048, 0x00),
+                                               _mm512_clmulepi64_epi128(z1, k2048, 0x11),
+                                               _mm512_loadu_si512(data + 64),
+                                               0x96);
+                z2 = _mm512_ternarylogic_epi64(_mm512_clmulepi64_epi128(z2, k2048, 0x00),
+                                               _mm512_clmulepi64_epi128(z2, k2048, 0x11),
+                                               _mm512_loadu_si512(data + 128),
+                                               0x96);
+                z3 = _mm512_ternarylogic_epi64(_mm512_clmulepi64_epi128(z3, k2048, 0x00),
+                                               _mm512_clmulepi64_epi128(z3, k2048, 0x11),
+                                               _mm512_loadu_si512(data + 192),
+                                               0x96);
+                data += 256;
+                remaining -= 256;
+            }
+
+            z0 = _mm512_ternarylogic_epi64(_mm512_clmulepi64_epi128(z0, k512, 0x00),
+                                           _mm512_clmulepi64_epi128(z0, k512, 0x11),
+                                           z1,
+                                           0x96);
+            z0 = _mm512_ternarylogic_epi64(_mm512_clmulepi64_epi128(z0, k512, 0x00),
+                                           _mm512_clmulepi64_epi128(z0, k512, 0x11),
+                                           z2,
+                                           0x96);
+            z0 = _mm512_ternarylogic_epi64(_mm512_clmulepi64_epi128(z0, k512, 0x00),
+                                           _mm512_clmulepi64_epi128(z0, k512, 0x11),
+                                           z3,
+                                           0x96);
+        }
+        while (remaining >= 64) {
+            z0 = _mm512_ternarylogic_epi64(_mm512_clmulepi64_epi128(z0, k512, 0x00),
+                                           _mm512_clmulepi64_epi128(z0, k512, 0x11),
+                                           _mm512_loadu_si512(data),
+                                           0x96);
+            data += 64;
+            remaining -= 64;
+        }
+
+        // fold the four lanes into one, the first lane holds the oldest bytes
+        x0 = _mm512_extracti32x4_epi32(z0, 0);
+        x0 = _mm_xor_si128(_mm_xor_si128(_mm_clmulepi64_si128(x0, k128, 0x00),
+                                         _mm_clmulepi64_si128(x0, k128, 0x11)),
+                           _mm512_extracti32x4_epi32(z0, 1));
+        x0 = _mm_xor_si128(_mm_xor_si128(_mm_clmulepi64_si128(x0, k128, 0x00),
+                                         _mm_clmulepi64_si128(x0, k128, 0x11)),
+                           _mm512_extracti32x4_epi32(z0, 2));
+        x0 = _mm_xor_si128(_mm_xor_si128(_mm_clmulepi64_si128(x0, k128, 0x00),
+                                         _mm_clmulepi64_si128(x0, k128, 0x11)),
+                           _mm512_extracti32x4_epi32(z0, 3));
+        while (remaining >= 16) {
+            x0 = _mm_xor_si128(_mm_xor_si128(_mm_clmulepi64_si128(x0, k128, 0x00),
+                                             _mm_clmulepi64_si128(x0, k128, 0x11)),
+                               _mm_loadu_si128((const __m128i*)data));
+            data += 16;
+            remaining -= 16;
+        }
+
+        _mm_store_si128((__m128i*)residue, x0);
+        reg = volk_8u_crc32_update(0, residue, 16);
+    }
+
+    *crc = ~volk_8u_crc32_update(reg, data, remaining);
+}
+
+#endif /* LV_HAVE_AVX512F && LV_HAVE_PCLMUL && LV_HAVE_VPCLMULQDQ */
+
+
+#if LV_HAVE_NEONV8 && LV_HAVE_NEONV8_PMULL
+#include <arm_neon.h>
+#include <volk/volk_neon_intrinsics.h>
+
+static inline void
+volk_8u_crc32_32u_neonv8_pmull(uint32_t* crc,
+                               const uint8_t* data,
+                               unsigned int num_points)
+{
+    uint32_t reg = ~*crc;
+    unsigned int remaining = num_points;
+
+    if (remaining >= 64) {
+        // the constants of the PCLMUL implementation, low half first
+        const uint64_t k512Halves[2] = { 0x154442bd4, 0x1c6e41596 };
+        const uint64_t k128Halves[2] = { 0x1751997d0, 0x0ccaa009e };
+        const poly64x2_t k512 = vreinterpretq_p64_u64(vld1q_u64(k512Halves));
+        const poly64x2_t k128 = vreinterpretq_p64_u64(vld1q_u64(k128Halves));
+        uint8_t residue[16];
+        uint8x16_t x0, x1, x2, x3;
+
+        x0 = veorq_u8(vld1q_u8(data),
+                      vreinterpretq_u8_u32(vsetq_lane_u32(reg, vdupq_n_u32(0), 0)));
+        x1 = vld1q_u8(data + 16);
+        x2 = vld1q_u8(data + 32);
+        x3 = vld1q_u8(data + 48);
+        data += 64;
+        remaining -= 64;
+
+        while (remaining >= 64) {
+            x0 = _vclmulfoldq_u8(x0, k512, vld1q_u8(data));
+            x1 = _vclmulfoldq_u8(x1, k512, vld1q_u8(data + 16));
+            x2 = _vclmulfoldq_u8(x2, k512, vld1q_u8(data + 32));
+            x3 = _vclmulfoldq_u8(x3, k512, vld1q_u8(data + 48));
+            data += 64;
+            remaining -= 64;
+        }
+
+        x0 = _vclmulfoldq_u8(x0, k128, x1);
+        x0 = _vclmulfoldq_u8(x0, k128, x2);
+        x0 = _vclmulfoldq_u8(x0, k128, x3);
+        while (remaining >= 16) {
+            x0 = _vclmulfoldq_u8(x0, k128, vld1q_u8(data));
+            data += 16;
+            remaining -= 16;
+        }
+
+        vst1q_u8(residue, x0);
+        reg = volk_8u_crc32_update(0, residue, 16);
+    }
+
+    *crc = ~volk_8u_crc32_update(reg, data, remaining);
+}
+
+#endif /* LV_HAVE_NEONV8 && LV_HAVE_NEONV8_PMULL */
+
+#endif /* INCLUDED_volk_8u_crc32_32u_H */
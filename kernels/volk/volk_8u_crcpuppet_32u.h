@@ -0,0 +1,103 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2026 Free Software Foundation, Inc.
+ *
+ * This file is part of VOLK
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+/* For documentation see 'kernels/volk/volk_8u_s32u_crc_32u.h'
+ * This file exists for test purposes only. Should not be used directly.
+ *
+ * Computes CRC8, CRC16, CRC24A and CRC-32/MPEG-2 over the whole input in calls
+ * of varying length, carrying the register between calls. The four registers
+ * go to the start of the output, the rest of the output is cleared.
+ */
+
+#ifndef INCLUDED_volk_8u_crcpuppet_32u_H
+#define INCLUDED_volk_8u_crcpuppet_32u_H
+
+#include <string.h>
+#include <volk/volk_8u_s32u_crc_32u.h>
+
+static const uint32_t volk_8u_crcpuppet_polys[4] = { 0x9b, 0x1021, 0x864cfb, 0x04c11db7 };
+static const unsigned int volk_8u_crcpuppet_widths[4] = { 8, 16, 24, 32 };
+static const unsigned int volk_8u_crcpuppet_chunks[8] = {
+    1, 15, 16, 63, 64, 65, 1000, 4096
+};
+
+typedef void (*volk_8u_crc_kernel)(
+    uint32_t*, const uint8_t*, const uint32_t, unsigned int, unsigned int);
+
+static inline void volk_8u_crcpuppet_32u_run(volk_8u_crc_kernel kernel,
+                                             uint32_t* crc,
+                                             const uint8_t* data,
+                                             unsigned int num_points)
+{
+    unsigned int ii, offset, chunk, count;
+
+    for (ii = 0; ii < 4; ii++) {
+        crc[ii] = ii;
+        for (offset = 0, chunk = 0; offset < num_points; offset += count, chunk++) {
+            count = volk_8u_crcpuppet_chunks[chunk % 8];
+            count = (count < num_points - offset) ? count : num_points - offset;
+            kernel(crc + ii,
+                   data + offset,
+                   volk_8u_crcpuppet_polys[ii],
+                   volk_8u_crcpuppet_widths[ii],
+                   count);
+        }
+    }
+    memset(crc + 4, 0, (num_points - 4) * sizeof(uint32_t));
+}
+
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void volk_8u_crcpuppet_32u_generic(uint32_t* crc,
+                                                 const uint8_t* data,
+                                                 unsigned int num_points)
+{
+    volk_8u_crcpuppet_32u_run(volk_8u_s32u_crc_32u_generic, crc, data, num_points);
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+
+#if LV_HAVE_SSSE3 && LV_HAVE_PCLMUL
+
+static inline void volk_8u_crcpuppet_32u_u_pclmul(uint32_t* crc,
+                                                  const uint8_t* data,
+                                                  unsigned int num_points)
+{
+    volk_8u_crcpuppet_32u_run(volk_8u_s32u_crc_32u_u_pclmul, crc, data, num_points);
+}
+
+#endif /* LV_HAVE_SSSE3 && LV_HAVE_PCLMUL */
+
+
+#if LV_HAVE_AVX512F && LV_HAVE_SSSE3 && LV_HAVE_PCLMUL && LV_HAVE_VPCLMULQDQ
+
+static inline void volk_8u_crcpuppet_32u_u_vpclmulqdq(uint32_t* crc,
+                                                      const uint8_t* data,
+                                                      unsigned int num_points)
+{
+    volk_8u_crcpuppet_32u_run(volk_8u_s32u_crc_32u_u_vpclmulqdq, crc, data, num_points);
+}
+
+#endif /* LV_HAVE_AVX512F && LV_HAVE_SSSE3 && LV_HAVE_PCLMUL && LV_HAVE_VPCLMULQDQ */
+
+
+#if LV_HAVE_NEONV8 && LV_HAVE_NEONV8_PMULL
+
+static inline void volk_8u_crcpuppet_32u_neonv8_pmull(uint32_t* crc,
+                                                      const uint8_t* data,
+                                                      unsigned int num_points)
+{
+    volk_8u_crcpuppet_32u_run(volk_8u_s32u_crc_32u_neonv8_pmull, crc, data, num_points);
+}
+
+#endif /* LV_HAVE_NEONV8 && LV_HAVE_NEONV8_PMULL */
+
+#endif /* INCLUDED_volk_8u_crcpuppet_32u_H */
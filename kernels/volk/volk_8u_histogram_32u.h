@@ -0,0 +1,115 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2026 Free Software Foundation, Inc.
+ *
+ * This file is part of VOLK
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+/*!
+ * \page volk_8u_histogram_32u
+ *
+ * \b Overview
+ *
+ * Counts how often each of the 256 byte values occurs in a vector.
+ *
+ * Counting is scalar, SIMD has no useful way to increment 256 bins. The
+ * interleaved implementation counts successive bytes into four
+ * sub-histograms, which avoids store-to-load stalls on repeated values.
+ *
+ * <b>Dispatcher Prototype</b>
+ * \code
+ * void volk_8u_histogram_32u(uint32_t* histogram, const uint8_t* inputBuffer,
+ *                            unsigned int num_points)
+ * \endcode
+ *
+ * \b Inputs
+ * \li inputBuffer: the input vector.
+ * \li num_points: the number of elements in the input vector.
+ *
+ * \b Outputs
+ * \li histogram: the 256 counts, histogram[v] counts the value v. Overwritten.
+ * The buffer has to hold 256 elements whatever num_points is.
+ *
+ * \b Example
+ * \code
+ *   unsigned int N = 1024;
+ *   unsigned int alignment = volk_get_alignment();
+ *   uint8_t* in = (uint8_t*)volk_malloc(sizeof(uint8_t) * N, alignment);
+ *   uint32_t* hist = (uint32_t*)volk_malloc(sizeof(uint32_t) * 256, alignment);
+ *
+ *   for (unsigned int ii = 0; ii < N; ++ii) {
+ *       in[ii] = (uint8_t)ii;
+ *   }
+ *
+ *   volk_8u_histogram_32u(hist, in, N); // hist[ii] == 4
+ *
+ *   volk_free(in);
+ *   volk_free(hist);
+ * \endcode
+ */
+
+#ifndef INCLUDED_volk_8u_histogram_32u_u_H
+#define INCLUDED_volk_8u_histogram_32u_u_H
+
+#include <inttypes.h>
+#include <string.h>
+#include <volk/volk_common.h>
+
+static inline void volk_8u_histogram_merge(uint32_t* histogram, const uint32_t* sub)
+{
+    unsigned int ii;
+    for (ii = 0; ii < 256; ii++) {
+        histogram[ii] = sub[ii] + sub[256 + ii] + sub[512 + ii] + sub[768 + ii];
+    }
+}
+
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void volk_8u_histogram_32u_generic(uint32_t* histogram,
+                                                 const uint8_t* inputBuffer,
+                                                 unsigned int num_points)
+{
+    unsigned int number;
+
+    memset(histogram, 0, 256 * sizeof(uint32_t));
+    for (number = 0; number < num_points; number++) {
+        histogram[inputBuffer[number]]++;
+    }
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void volk_8u_histogram_32u_generic_interleaved(uint32_t* histogram,
+                                                             const uint8_t* inputBuffer,
+                                                             unsigned int num_points)
+{
+    uint32_t sub[4 * 256];
+    const unsigned int quarterPoints = num_points / 4;
+    uint32_t word;
+    unsigned int number;
+
+    memset(sub, 0, sizeof(sub));
+    for (number = 0; number < quarterPoints; number++) {
+        memcpy(&word, inputBuffer, sizeof(word));
+        sub[word & 0xff]++;
+        sub[256 + ((word >> 8) & 0xff)]++;
+        sub[512 + ((word >> 16) & 0xff)]++;
+        sub[768 + (word >> 24)]++;
+        inputBuffer += 4;
+    }
+
+    for (number = quarterPoints * 4; number < num_points; number++) {
+        sub[*inputBuffer++]++;
+    }
+    volk_8u_histogram_merge(histogram, sub);
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+#endif /* INCLUDED_volk_8u_histogram_32u_u_H */
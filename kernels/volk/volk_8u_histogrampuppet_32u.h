@@ -0,0 +1,67 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2026 Free Software Foundation, Inc.
+ *
+ * This file is part of VOLK
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+/* For documentation see 'kernels/volk/volk_8u_histogram_32u.h'
+ * This file exists for test purposes only. Should not be used directly.
+ *
+ * The kernel writes 256 bins whatever the vector length is, so the histogram
+ * goes to a local buffer and bin ii is added to output[ii % num_points].
+ */
+
+#ifndef INCLUDED_volk_8u_histogrampuppet_32u_H
+#define INCLUDED_volk_8u_histogrampuppet_32u_H
+
+#include <string.h>
+#include <volk/volk_8u_histogram_32u.h>
+
+typedef void (*volk_8u_histogram_kernel)(uint32_t*, const uint8_t*, unsigned int);
+
+static inline void volk_8u_histogrampuppet_32u_run(volk_8u_histogram_kernel kernel,
+                                                   uint32_t* output,
+                                                   const uint8_t* inputBuffer,
+                                                   unsigned int num_points)
+{
+    uint32_t histogram[256];
+    unsigned int ii;
+
+    kernel(histogram, inputBuffer, num_points);
+    memset(output, 0, num_points * sizeof(uint32_t));
+    for (ii = 0; ii < 256; ii++) {
+        output[ii % num_points] += histogram[ii];
+    }
+}
+
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void volk_8u_histogrampuppet_32u_generic(uint32_t* output,
+                                                       const uint8_t* inputBuffer,
+                                                       unsigned int num_points)
+{
+    volk_8u_histogrampuppet_32u_run(
+        volk_8u_histogram_32u_generic, output, inputBuffer, num_points);
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void
+volk_8u_histogrampuppet_32u_generic_interleaved(uint32_t* output,
+                                                const uint8_t* inputBuffer,
+                                                unsigned int num_points)
+{
+    volk_8u_histogrampuppet_32u_run(
+        volk_8u_histogram_32u_generic_interleaved, output, inputBuffer, num_points);
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+#endif /* INCLUDED_volk_8u_histogrampuppet_32u_H */
@@ -0,0 +1,197 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2026 Free Software Foundation, Inc.
+ *
+ * This file is part of VOLK
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+/*!
+ * \page volk_8u_pack_bits_8u
+ *
+ * \b Overview
+ *
+ * Packs a vector of bits stored one per byte, as used by the polar and
+ * convolutional coding kernels, into bytes of eight bits. Only the least
+ * significant bit of each input byte is used. With msbFirst set the first bit
+ * goes into the most significant bit of the first byte, otherwise into the
+ * least significant bit. A last partial byte is padded with zero bits.
+ *
+ * <b>Dispatcher Prototype</b>
+ * \code
+ * void volk_8u_pack_bits_8u(uint8_t* bytes, const uint8_t* bits,
+ *                           const unsigned int msbFirst, unsigned int num_points)
+ * \endcode
+ *
+ * \b Inputs
+ * \li bits: the unpacked bits.
+ * \li msbFirst: non-zero to fill the bytes from the most significant bit.
+ * \li num_points: the number of bits.
+ *
+ * \b Outputs
+ * \li bytes: (num_points + 7) / 8 packed bytes.
+ *
+ * \b Example
+ * \code
+ *   unsigned int N = 16;
+ *   unsigned int alignment = volk_get_alignment();
+ *   uint8_t* bits = (uint8_t*)volk_malloc(sizeof(uint8_t) * N, alignment);
+ *   uint8_t* bytes = (uint8_t*)volk_malloc(sizeof(uint8_t) * N / 8, alignment);
+ *
+ *   for (unsigned int ii = 0; ii < N; ++ii) {
+ *       bits[ii] = ii % 3 == 0;
+ *   }
+ *
+ *   volk_8u_pack_bits_8u(bytes, bits, 1, N); // bytes == { 0x92, 0x49 }
+ *
+ *   volk_free(bits);
+ *   volk_free(bytes);
+ * \endcode
+ */
+
+#ifndef INCLUDED_volk_8u_pack_bits_8u_u_H
+#define INCLUDED_volk_8u_pack_bits_8u_u_H
+
+#include <inttypes.h>
+#include <string.h>
+
+/* Reverses the order of the bits within each byte of a word */
+static inline uint32_t volk_8u_pack_bits_reverse(uint32_t word)
+{
+    word = ((word >> 4) & 0x0f0f0f0f) | ((word & 0x0f0f0f0f) << 4);
+    word = ((word >> 2) & 0x33333333) | ((word & 0x33333333) << 2);
+    return ((word >> 1) & 0x55555555) | ((word & 0x55555555) << 1);
+}
+
+/* Packs up to eight bits into one byte, missing bits are zero */
+static inline uint8_t
+volk_8u_pack_bits_byte(const uint8_t* bits, unsigned int msbFirst, unsigned int count)
+{
+    uint32_t value = 0;
+    unsigned int bit;
+
+    for (bit = 0; bit < count; bit++) {
+        value |= (uint32_t)(bits[bit] & 1) << bit;
+    }
+    return (uint8_t)(msbFirst ? volk_8u_pack_bits_reverse(value) : value);
+}
+
+static inline void volk_8u_pack_bits_scalar(uint8_t* bytes,
+                                            const uint8_t* bits,
+                                            unsigned int msbFirst,
+                                            unsigned int count)
+{
+    for (; count >= 8; count -= 8) {
+        *bytes++ = volk_8u_pack_bits_byte(bits, msbFirst, 8);
+        bits += 8;
+    }
+    if (count > 0) {
+        *bytes = volk_8u_pack_bits_byte(bits, msbFirst, count);
+    }
+}
+
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void volk_8u_pack_bits_8u_generic(uint8_t* bytes,
+                                                const uint8_t* bits,
+                                                const unsigned int msbFirst,
+                                                unsigned int num_points)
+{
+    volk_8u_pack_bits_scalar(bytes, bits, msbFirst, num_points);
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+
+#ifdef LV_HAVE_SSE2
+#include <emmintrin.h>
+
+static inline void volk_8u_pack_bits_8u_u_sse2(uint8_t* bytes,
+                                               const uint8_t* bits,
+                                               const unsigned int msbFirst,
+                                               unsigned int num_points)
+{
+    const unsigned int sixteenthPoints = num_points / 16;
+    uint32_t mask;
+    unsigned int number;
+
+    for (number = 0; number < sixteenthPoints; number++) {
+        // moves bit 0 of every byte into its sign bit
+        mask = _mm_movemask_epi8(
+            _mm_slli_epi16(_mm_loadu_si128((const __m128i*)bits), 7));
+        mask = msbFirst ? volk_8u_pack_bits_reverse(mask) : mask;
+        bytes[0] = (uint8_t)mask;
+        bytes[1] = (uint8_t)(mask >> 8);
+        bits += 16;
+        bytes += 2;
+    }
+
+    volk_8u_pack_bits_scalar(bytes, bits, msbFirst, num_points - number * 16);
+}
+
+#endif /* LV_HAVE_SSE2 */
+
+
+#ifdef LV_HAVE_AVX2
+#include <immintrin.h>
+
+static inline void volk_8u_pack_bits_8u_u_avx2(uint8_t* bytes,
+                                               const uint8_t* bits,
+                                               const unsigned int msbFirst,
+                                               unsigned int num_points)
+{
+    const unsigned int thirtySecondPoints = num_points / 32;
+    uint32_t mask;
+    unsigned int number;
+
+    for (number = 0; number < thirtySecondPoints; number++) {
+        mask = (uint32_t)_mm256_movemask_epi8(
+            _mm256_slli_epi16(_mm256_loadu_si256((const __m256i*)bits), 7));
+        mask = msbFirst ? volk_8u_pack_bits_reverse(mask) : mask;
+        memcpy(bytes, &mask, sizeof(mask));
+        bits += 32;
+        bytes += 4;
+    }
+
+    volk_8u_pack_bits_scalar(bytes, bits, msbFirst, num_points - number * 32);
+}
+
+#endif /* LV_HAVE_AVX2 */
+
+
+#ifdef LV_HAVE_NEON
+#include <arm_neon.h>
+
+static inline void volk_8u_pack_bits_8u_neon(uint8_t* bytes,
+                                             const uint8_t* bits,
+                                             const unsigned int msbFirst,
+                                             unsigned int num_points)
+{
+    const unsigned int sixteenthPoints = num_points / 16;
+    const int8_t lsbShifts[8] = { 0, 1, 2, 3, 4, 5, 6, 7 };
+    const int8_t msbShifts[8] = { 7, 6, 5, 4, 3, 2, 1, 0 };
+    const int8x8_t shifts = vld1_s8(msbFirst ? msbShifts : lsbShifts);
+    const int8x16_t shiftsx2 = vcombine_s8(shifts, shifts);
+    const uint8x16_t one = vdupq_n_u8(1);
+    uint8x16_t value;
+    uint64x2_t sums;
+    unsigned int number;
+
+    for (number = 0; number < sixteenthPoints; number++) {
+        // the bits of each group of eight do not overlap, so adding combines them
+        value = vshlq_u8(vandq_u8(vld1q_u8(bits), one), shiftsx2);
+        sums = vpaddlq_u32(vpaddlq_u16(vpaddlq_u8(value)));
+        bytes[0] = (uint8_t)vgetq_lane_u64(sums, 0);
+        bytes[1] = (uint8_t)vgetq_lane_u64(sums, 1);
+        bits += 16;
+        bytes += 2;
+    }
+
+    volk_8u_pack_bits_scalar(bytes, bits, msbFirst, num_points - number * 16);
+}
+
+#endif /* LV_HAVE_NEON */
+
+#endif /* INCLUDED_volk_8u_pack_bits_8u_u_H */
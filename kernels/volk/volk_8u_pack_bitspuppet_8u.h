@@ -0,0 +1,95 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2026 Free Software Foundation, Inc.
+ *
+ * This file is part of VOLK
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+/* For documentation see 'kernels/volk/volk_8u_pack_bits_8u.h'
+ * This file exists for test purposes only. Should not be used directly.
+ *
+ * Packs the first half of the input MSB first and the second half LSB first.
+ * The unused part of the output is cleared.
+ */
+
+#ifndef INCLUDED_volk_8u_pack_bitspuppet_8u_H
+#define INCLUDED_volk_8u_pack_bitspuppet_8u_H
+
+#include <string.h>
+#include <volk/volk_8u_pack_bits_8u.h>
+
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void volk_8u_pack_bitspuppet_8u_generic(uint8_t* bytes,
+                                                      const uint8_t* bits,
+                                                      unsigned int num_points)
+{
+    const unsigned int half = num_points / 2;
+    const unsigned int halfBytes = (half + 7) / 8;
+    const unsigned int used = halfBytes + (num_points - half + 7) / 8;
+
+    volk_8u_pack_bits_8u_generic(bytes, bits, 1, half);
+    volk_8u_pack_bits_8u_generic(bytes + halfBytes, bits + half, 0, num_points - half);
+    memset(bytes + used, 0, num_points - used);
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+
+#ifdef LV_HAVE_SSE2
+
+static inline void volk_8u_pack_bitspuppet_8u_u_sse2(uint8_t* bytes,
+                                                     const uint8_t* bits,
+                                                     unsigned int num_points)
+{
+    const unsigned int half = num_points / 2;
+    const unsigned int halfBytes = (half + 7) / 8;
+    const unsigned int used = halfBytes + (num_points - half + 7) / 8;
+
+    volk_8u_pack_bits_8u_u_sse2(bytes, bits, 1, half);
+    volk_8u_pack_bits_8u_u_sse2(bytes + halfBytes, bits + half, 0, num_points - half);
+    memset(bytes + used, 0, num_points - used);
+}
+
+#endif /* LV_HAVE_SSE2 */
+
+
+#ifdef LV_HAVE_AVX2
+
+static inline void volk_8u_pack_bitspuppet_8u_u_avx2(uint8_t* bytes,
+                                                     const uint8_t* bits,
+                                                     unsigned int num_points)
+{
+    const unsigned int half = num_points / 2;
+    const unsigned int halfBytes = (half + 7) / 8;
+    const unsigned int used = halfBytes + (num_points - half + 7) / 8;
+
+    volk_8u_pack_bits_8u_u_avx2(bytes, bits, 1, half);
+    volk_8u_pack_bits_8u_u_avx2(bytes + halfBytes, bits + half, 0, num_points - half);
+    memset(bytes + used, 0, num_points - used);
+}
+
+#endif /* LV_HAVE_AVX2 */
+
+
+#ifdef LV_HAVE_NEON
+
+static inline void volk_8u_pack_bitspuppet_8u_neon(uint8_t* bytes,
+                                                   const uint8_t* bits,
+                                                   unsigned int num_points)
+{
+    const unsigned int half = num_points / 2;
+    const unsigned int halfBytes = (half + 7) / 8;
+    const unsigned int used = halfBytes + (num_points - half + 7) / 8;
+
+    volk_8u_pack_bits_8u_neon(bytes, bits, 1, half);
+    volk_8u_pack_bits_8u_neon(bytes + halfBytes, bits + half, 0, num_points - half);
+    memset(bytes + used, 0, num_points - used);
+}
+
+#endif /* LV_HAVE_NEON */
+
+#endif /* INCLUDED_volk_8u_pack_bitspuppet_8u_H */
@@ -0,0 +1,260 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2026 Free Software Foundation, Inc.
+ *
+ * This file is part of VOLK
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+/*!
+ * \page volk_8u_popcnt_32u
+ *
+ * \b Overview
+ *
+ * Counts the set bits in a vector of bytes, e.g. the errors in an XORed bit
+ * stream. Unlike volk_32u_popcnt and volk_64u_popcnt, which count the bits of
+ * one value per call, this kernel works through a whole array.
+ *
+ * The SIMD implementations count the bits of each byte with a nibble lookup
+ * table or bit-parallel arithmetic and sum the byte counts in wider lanes.
+ * With AVX512_VPOPCNTDQ, vpopcntq counts the bits of 64-bit lanes directly.
+ *
+ * <b>Dispatcher Prototype</b>
+ * \code
+ * void volk_8u_popcnt_32u(uint32_t* count, const uint8_t* inputBuffer,
+ *                         unsigned int num_points)
+ * \endcode
+ *
+ * \b Inputs
+ * \li inputBuffer: the input bytes.
+ * \li num_points: the number of bytes.
+ *
+ * \b Outputs
+ * \li count: the number of set bits.
+ *
+ * \b Example
+ * \code
+ *   unsigned int N = 1000;
+ *   unsigned int alignment = volk_get_alignment();
+ *   uint8_t* in = (uint8_t*)volk_malloc(sizeof(uint8_t) * N, alignment);
+ *   uint32_t count;
+ *
+ *   for (unsigned int ii = 0; ii < N; ++ii) {
+ *       in[ii] = 0x55;
+ *   }
+ *
+ *   volk_8u_popcnt_32u(&count, in, N); // count == 4 * N
+ *
+ *   volk_free(in);
+ * \endcode
+ */
+
+#ifndef INCLUDED_volk_8u_popcnt_32u_H
+#define INCLUDED_volk_8u_popcnt_32u_H
+
+#include <inttypes.h>
+#include <string.h>
+#include <volk/volk_common.h>
+
+static inline uint32_t volk_8u_popcnt_word(uint64_t word)
+{
+    word = word - ((word >> 1) & 0x5555555555555555ULL);
+    word = (word & 0x3333333333333333ULL) + ((word >> 2) & 0x3333333333333333ULL);
+    word = (word + (word >> 4)) & 0x0f0f0f0f0f0f0f0fULL;
+    word = word + (word >> 8);
+    word = word + (word >> 16);
+    word = word + (word >> 32);
+    return (uint32_t)(word & 0x7f);
+}
+
+static inline uint32_t volk_8u_popcnt_scalar(const uint8_t* inputBuffer,
+                                             unsigned int num_points)
+{
+    uint32_t total = 0;
+    unsigned int number;
+    for (number = 0; number < num_points; number++) {
+        total += volk_8u_popcnt_word(inputBuffer[number]);
+    }
+    return total;
+}
+
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void volk_8u_popcnt_32u_generic(uint32_t* count,
+                                              const uint8_t* inputBuffer,
+                                              unsigned int num_points)
+{
+    const unsigned int eighthPoints = num_points / 8;
+    uint64_t word;
+    uint32_t total = 0;
+    unsigned int number;
+
+    for (number = 0; number < eighthPoints; number++) {
+        memcpy(&word, inputBuffer, 8);
+        total += volk_8u_popcnt_word(word);
+        inputBuffer += 8;
+    }
+
+    *count = total +
+             volk_8u_popcnt_scalar(inputBuffer, num_points - eighthPoints * 8);
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+
+#ifdef LV_HAVE_AVX2
+#include <immintrin.h>
+
+static inline void volk_8u_popcnt_32u_u_avx2(uint32_t* count,
+                                             const uint8_t* inputBuffer,
+                                             unsigned int num_points)
+{
+    const unsigned int thirtySecondPoints = num_points / 32;
+    const __m256i lookup = _mm256_setr_epi8(
+        0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4,
+        0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4);
+    const __m256i lowNibble = _mm256_set1_epi8(0x0f);
+    const __m256i zero = _mm256_setzero_si256();
+    __VOLK_ATTR_ALIGNED(32) uint64_t sums[4];
+    __m256i total = zero;
+    __m256i counts, bytes, low, high;
+    unsigned int number, block, ii;
+
+    for (number = 0; number < thirtySecondPoints; number += block) {
+        // each byte gains at most 8 per iteration, flush before it overflows
+        block = thirtySecondPoints - number;
+        block = (block < 31) ? block : 31;
+        counts = zero;
+        for (ii = 0; ii < block; ii++) {
+            bytes = _mm256_loadu_si256((const __m256i*)inputBuffer);
+            low = _mm256_and_si256(bytes, lowNibble);
+            high = _mm256_and_si256(_mm256_srli_epi16(bytes, 4), lowNibble);
+            counts = _mm256_add_epi8(counts, _mm256_shuffle_epi8(lookup, low));
+            counts = _mm256_add_epi8(counts, _mm256_shuffle_epi8(lookup, high));
+            inputBuffer += 32;
+        }
+        total = _mm256_add_epi64(total, _mm256_sad_epu8(counts, zero));
+    }
+    _mm256_store_si256((__m256i*)sums, total);
+
+    *count = (uint32_t)(sums[0] + sums[1] + sums[2] + sums[3]) +
+             volk_8u_popcnt_scalar(inputBuffer, num_points - thirtySecondPoints * 32);
+}
+
+#endif /* LV_HAVE_AVX2 */
+
+
+#ifdef LV_HAVE_AVX512F
+#include <immintrin.h>
+
+static inline void volk_8u_popcnt_32u_u_avx512f(uint32_t* count,
+                                                const uint8_t* inputBuffer,
+                                                unsigned int num_points)
+{
+    const unsigned int sixtyFourthPoints = num_points / 64;
+    const __m512i m1 = _mm512_set1_epi8(0x55);
+    const __m512i m2 = _mm512_set1_epi8(0x33);
+    const __m512i m4 = _mm512_set1_epi8(0x0f);
+    const __m512i m8 = _mm512_set1_epi16(0x00ff);
+    const __m512i m16 = _mm512_set1_epi32(0x0000ffff);
+    const __m512i m32 = _mm512_set1_epi64(0xffffffff);
+    __m512i total = _mm512_setzero_si512();
+    __m512i counts, bytes;
+    unsigned int number, block, ii;
+
+    for (number = 0; number < sixtyFourthPoints; number += block) {
+        // Bit counts per byte with 64-bit arithmetic, no field carries into the
+        // next byte. Each byte gains at most 8 per iteration.
+        block = sixtyFourthPoints - number;
+        block = (block < 31) ? block : 31;
+        counts = _mm512_setzero_si512();
+        for (ii = 0; ii < block; ii++) {
+            bytes = _mm512_loadu_si512((const void*)inputBuffer);
+            bytes = _mm512_sub_epi64(bytes,
+                                     _mm512_and_si512(_mm512_srli_epi64(bytes, 1), m1));
+            bytes = _mm512_add_epi64(_mm512_and_si512(bytes, m2),
+                                     _mm512_and_si512(_mm512_srli_epi64(bytes, 2), m2));
+            bytes = _mm512_and_si512(
+                _mm512_add_epi64(bytes, _mm512_srli_epi64(bytes, 4)), m4);
+            counts = _mm512_add_epi64(counts, bytes);
+            inputBuffer += 64;
+        }
+        counts = _mm512_add_epi64(_mm512_and_si512(counts, m8),
+                                  _mm512_and_si512(_mm512_srli_epi64(counts, 8), m8));
+        counts = _mm512_add_epi64(_mm512_and_si512(counts, m16),
+                                  _mm512_and_si512(_mm512_srli_epi64(counts, 16), m16));
+        counts = _mm512_add_epi64(_mm512_and_si512(counts, m32),
+                                  _mm512_srli_epi64(counts, 32));
+        total = _mm512_add_epi64(total, counts);
+    }
+
+    *count = (uint32_t)_mm512_reduce_add_epi64(total) +
+             volk_8u_popcnt_scalar(inputBuffer, num_points - sixtyFourthPoints * 64);
+}
+
+#endif /* LV_HAVE_AVX512F */
+
+
+#if LV_HAVE_AVX512F && LV_HAVE_AVX512VPOPCNTDQ
+#include <immintrin.h>
+
+static inline void volk_8u_popcnt_32u_u_avx512vpopcntdq(uint32_t* count,
+                                                        const uint8_t* inputBuffer,
+                                                        unsigned int num_points)
+{
+    const unsigned int sixtyFourthPoints = num_points / 64;
+    __m512i total0 = _mm512_setzero_si512();
+    __m512i total1 = _mm512_setzero_si512();
+    unsigned int number = 0;
+
+    // two accumulators hide the latency of the adds
+    for (; number + 2 <= sixtyFourthPoints; number += 2) {
+        total0 = _mm512_add_epi64(
+            total0, _mm512_popcnt_epi64(_mm512_loadu_si512((const void*)inputBuffer)));
+        total1 = _mm512_add_epi64(
+            total1,
+            _mm512_popcnt_epi64(_mm512_loadu_si512((const void*)(inputBuffer + 64))));
+        inputBuffer += 128;
+    }
+    if (number < sixtyFourthPoints) {
+        total0 = _mm512_add_epi64(
+            total0, _mm512_popcnt_epi64(_mm512_loadu_si512((const void*)inputBuffer)));
+        inputBuffer += 64;
+    }
+
+    *count = (uint32_t)_mm512_reduce_add_epi64(_mm512_add_epi64(total0, total1)) +
+             volk_8u_popcnt_scalar(inputBuffer, num_points - sixtyFourthPoints * 64);
+}
+
+#endif /* LV_HAVE_AVX512F && LV_HAVE_AVX512VPOPCNTDQ */
+
+
+#ifdef LV_HAVE_NEON
+#include <arm_neon.h>
+
+static inline void volk_8u_popcnt_32u_neon(uint32_t* count,
+                                           const uint8_t* inputBuffer,
+                                           unsigned int num_points)
+{
+    const unsigned int sixteenthPoints = num_points / 16;
+    uint32x4_t total = vdupq_n_u32(0);
+    uint64x2_t pairs;
+    uint8x16_t bytes;
+    unsigned int number;
+
+    for (number = 0; number < sixteenthPoints; number++) {
+        bytes = vld1q_u8(inputBuffer);
+        total = vpadalq_u16(total, vpaddlq_u8(vcntq_u8(bytes)));
+        inputBuffer += 16;
+    }
+    pairs = vpaddlq_u32(total);
+
+    *count = (uint32_t)(vgetq_lane_u64(pairs, 0) + vgetq_lane_u64(pairs, 1)) +
+             volk_8u_popcnt_scalar(inputBuffer, num_points - sixteenthPoints * 16);
+}
+
+#endif /* LV_HAVE_NEON */
+
+#endif /* INCLUDED_volk_8u_popcnt_32u_H */
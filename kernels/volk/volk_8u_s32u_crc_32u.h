@@ -0,0 +1,496 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2026 Free Software Foundation, Inc.
+ *
+ * This file is part of VOLK
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+/*!
+ * \page volk_8u_s32u_crc_32u
+ *
+ * \b Overview
+ *
+ * Computes a CRC of a byte vector with a configurable polynomial of 8 to 32
+ * bits, such as the 3GPP CRC16 (0x1021), CRC24A (0x864CFB) and CRC24B
+ * (0x800063) or CRC-32/MPEG-2 (0x04C11DB7). The CRC is not reflected: the
+ * most significant bit of each byte enters the register first. There is no
+ * final XOR, so crc holds the register, which is the initial value before the
+ * first byte of a message and can be carried over between calls.
+ *
+ * The PCLMUL and ARMv8 PMULL implementations derive their folding constants
+ * from the polynomial and fold 64 bytes per iteration with carry-less
+ * multiplications. The VPCLMULQDQ implementation folds 256 bytes per iteration
+ * in four 512-bit registers. The constants are derived on every call, which
+ * costs about a microsecond, so these pay off for messages of a few kilobytes
+ * or for long messages split into few calls. Shorter messages and the last
+ * bytes of a message go through a lookup table that is derived on the call.
+ *
+ * <b>Dispatcher Prototype</b>
+ * \code
+ * void volk_8u_s32u_crc_32u(uint32_t* crc, const uint8_t* data,
+ *                           const uint32_t polynomial, unsigned int width,
+ *                           unsigned int num_points)
+ * \endcode
+ *
+ * \b Inputs
+ * \li crc: the register after the preceding bytes, or the initial value.
+ * \li data: the message bytes.
+ * \li polynomial: the generator polynomial without its x^width term.
+ * \li width: the CRC width in bits, 8 to 32.
+ * \li num_points: the number of bytes.
+ *
+ * \b Outputs
+ * \li crc: the register after data, in the low width bits.
+ *
+ * \b Example
+ * CRC24A of a transport block, attached most significant byte first.
+ * \code
+ *   unsigned int N = 1000;
+ *   unsigned int alignment = volk_get_alignment();
+ *   uint8_t* block = (uint8_t*)volk_malloc(sizeof(uint8_t) * (N + 3), alignment);
+ *   uint32_t crc = 0;
+ *
+ *   for (unsigned int ii = 0; ii < N; ++ii) {
+ *       block[ii] = (uint8_t)ii;
+ *   }
+ *
+ *   volk_8u_s32u_crc_32u(&crc, block, 0x864cfb, 24, N);
+ *   block[N] = (uint8_t)(crc >> 16);
+ *   block[N + 1] = (uint8_t)(crc >> 8);
+ *   block[N + 2] = (uint8_t)crc;
+ *
+ *   crc = 0;
+ *   volk_8u_s32u_crc_32u(&crc, block, 0x864cfb, 24, N + 3); // crc == 0
+ *
+ *   volk_free(block);
+ * \endcode
+ */
+
+#ifndef INCLUDED_volk_8u_s32u_crc_32u_H
+#define INCLUDED_volk_8u_s32u_crc_32u_H
+
+#include <inttypes.h>
+#include <volk/volk_common.h>
+
+/* The register and the polynomial are kept aligned to the top of 32 bits, so
+ * that all widths share the same update. The 2^bits entries of table hold the
+ * register after shifting out an index in its top bits. The entries are linear
+ * in the index: the one of 1 is poly, each further power of two is one step
+ * more, and the others are sums of those. */
+static inline void
+volk_8u_crc_make_table(uint32_t* table, const uint32_t poly, unsigned int bits)
+{
+    uint32_t reg = poly;
+    unsigned int index, number;
+
+    table[0] = 0;
+    for (index = 1; index < (1u << bits); index <<= 1) {
+        for (number = 0; number < index; number++) {
+            table[index + number] = reg ^ table[number];
+        }
+        reg = (reg << 1) ^ ((reg & 0x80000000) ? poly : 0);
+    }
+}
+
+static inline uint32_t volk_8u_crc_update_table(uint32_t reg,
+                                                const uint8_t* data,
+                                                const uint32_t* table,
+                                                unsigned int num_points)
+{
+    unsigned int number;
+    for (number = 0; number < num_points; number++) {
+        reg = (reg << 8) ^ table[(reg >> 24) ^ data[number]];
+    }
+    return reg;
+}
+
+/* Derives a table on the call: one for bytes from 16 bytes on, below that one
+ * of 16 entries for half bytes, which is cheaper to derive. */
+static inline uint32_t volk_8u_crc_update_bytes(uint32_t reg,
+                                                const uint8_t* data,
+                                                const uint32_t poly,
+                                                unsigned int num_points)
+{
+    uint32_t table[256];
+    unsigned int number;
+
+    if (num_points >= 16) {
+        volk_8u_crc_make_table(table, poly, 8);
+        return volk_8u_crc_update_table(reg, data, table, num_points);
+    }
+    volk_8u_crc_make_table(table, poly, 4);
+    for (number = 0; number < num_points; number++) {
+        reg ^= (uint32_t)data[number] << 24;
+        reg = (reg << 4) ^ table[reg >> 28];
+        reg = (reg << 4) ^ table[reg >> 28];
+    }
+    return reg;
+}
+
+/* a * b mod x^32 + poly */
+static inline uint32_t volk_8u_crc_mulmod(uint32_t a, uint32_t b, const uint32_t poly)
+{
+    uint32_t reg = 0;
+    unsigned int bit;
+    for (bit = 32; bit > 0; bit--) {
+        reg = (reg << 1) ^ ((reg & 0x80000000) ? poly : 0);
+        reg ^= ((b >> (bit - 1)) & 1) ? a : 0;
+    }
+    return reg;
+}
+
+/* x^power mod x^32 + poly for power >= 32. The top six bits of power are
+ * stepped one by one, the rest by squaring, so that the constants of the long
+ * fold distances cost a few hundred steps per call rather than thousands. */
+static inline uint32_t volk_8u_crc_xpow(unsigned int power, const uint32_t poly)
+{
+    uint32_t reg = poly;
+    unsigned int shift = 0;
+    unsigned int exponent;
+
+    while ((power >> shift) >= 64) {
+        shift++;
+    }
+    for (exponent = power >> shift; exponent > 32; exponent--) {
+        reg = (reg << 1) ^ ((reg & 0x80000000) ? poly : 0);
+    }
+    for (; shift > 0; shift--) {
+        reg = volk_8u_crc_mulmod(reg, reg, poly);
+        if ((power >> (shift - 1)) & 1) {
+            reg = (reg << 1) ^ ((reg & 0x80000000) ? poly : 0);
+        }
+    }
+    return reg;
+}
+
+/* Reverses the bytes of each 128-bit lane with AVX512F only: swap the bytes of
+ * each 32-bit word, then reverse the words. */
+#define VOLK_CRC_REVERSE_512(x)                                      \
+    _mm512_shuffle_epi32(_mm512_ternarylogic_epi32(                  \
+                             _mm512_set1_epi32((int)0xff00ff00),     \
+                             _mm512_ror_epi32((x), 8),               \
+                             _mm512_rol_epi32((x), 8),               \
+                             0xca),                                  \
+                         _MM_PERM_ABCD)
+
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void volk_8u_s32u_crc_32u_generic(uint32_t* crc,
+                                                const uint8_t* data,
+                                                const uint32_t polynomial,
+                                                unsigned int width,
+                                                unsigned int num_points)
+{
+    const uint32_t poly = polynomial << (32 - width);
+    const uint32_t reg =
+        volk_8u_crc_update_bytes(*crc << (32 - width), data, poly, num_points);
+    *crc = reg >> (32 - width);
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+
+#if LV_HAVE_SSSE3 && LV_HAVE_PCLMUL
+#include <tmmintrin.h>
+#include <wmmintrin.h>
+
+static inline void volk_8u_s32u_crc_32u_u_pclmul(uint32_t* crc,
+                                                 const uint8_t* data,
+                                                 const uint32_t polynomial,
+                                                 unsigned int width,
+                                                 unsigned int num_points)
+{
+    const uint32_t poly = polynomial << (32 - width);
+    uint32_t reg = *crc << (32 - width);
+    unsigned int remaining = num_points;
+
+    if (remaining >= 64) {
+        // The first byte holds the highest powers, reversing the bytes puts the
+        // coefficient of x^i into bit i of the register
+        const __m128i reverse =
+            _mm_set_epi8(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15);
+        // x^(D+64) mod P and x^D mod P for the high and low halves, for fold
+        // distances D of 512 and 128 bits
+        const __m128i k512 = _mm_set_epi64x(volk_8u_crc_xpow(576, poly),
+                                            volk_8u_crc_xpow(512, poly));
+        const __m128i k128 = _mm_set_epi64x(volk_8u_crc_xpow(192, poly),
+                                            volk_8u_crc_xpow(128, poly));
+        __VOLK_ATTR_ALIGNED(16) uint8_t residue[16];
+        uint32_t table[256];
+        __m128i x0, x1, x2, x3;
+
+        x0 = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i*)data), reverse);
+        x0 = _mm_xor_si128(x0, _mm_set_epi32((int)reg, 0, 0, 0));
+        x1 = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i*)(data + 16)), reverse);
+        x2 = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i*)(data + 32)), reverse);
+        x3 = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i*)(data + 48)), reverse);
+        data += 64;
+        remaining -= 64;
+
+        while (remaining >= 64) {
+            x0 = _mm_xor_si128(
+                _mm_xor_si128(_mm_clmulepi64_si128(x0, k512, 0x00),
+                              _mm_clmulepi64_si128(x0, k512, 0x11)),
+                _mm_shuffle_epi8(_mm_loadu_si128((const __m128i*)data), reverse));
+            x1 = _mm_xor_si128(
+                _mm_xor_si128(_mm_clmulepi64_si128(x1, k512, 0x00),
+                              _mm_clmulepi64_si128(x1, k512, 0x11)),
+                _mm_shuffle_epi8(_mm_loadu_si128((const __m128i*)(data + 16)), reverse));
+            x2 = _mm_xor_si128(
+                _mm_xor_si128(_mm_clmulepi64_si128(x2, k512, 0x00),
+                              _mm_clmulepi64_si128(x2, k512, 0x11)),
+                _mm_shuffle_epi8(_mm_loadu_si128((const __m128i*)(data + 32)), reverse));
+            x3 = _mm_xor_si128(
+                _mm_xor_si128(_mm_clmulepi64_si128(x3, k512, 0x00),
+                              _mm_clmulepi64_si128(x3, k512, 0x11)),
+                _mm_shuffle_epi8(_mm_loadu_si128((const __m128i*)(data + 48)), reverse));
+            data += 64;
+            remaining -= 64;
+        }
+
+        x0 = _mm_xor_si128(_mm_xor_si128(_mm_clmulepi64_si128(x0, k128, 0x00),
+                                         _mm_clmulepi64_si128(x0, k128, 0x11)),
+                           x1);
+        x0 = _mm_xor_si128(_mm_xor_si128(_mm_clmulepi64_si128(x0, k128, 0x00),
+                                         _mm_clmulepi64_si128(x0, k128, 0x11)),
+                           x2);
+        x0 = _mm_xor_si128(_mm_xor_si128(_mm_clmulepi64_si128(x0, k128, 0x00),
+                                         _mm_clmulepi64_si128(x0, k128, 0x11)),
+                           x3);
+        while (remaining >= 16) {
+            x0 = _mm_xor_si128(
+                _mm_xor_si128(_mm_clmulepi64_si128(x0, k128, 0x00),
+                              _mm_clmulepi64_si128(x0, k128, 0x11)),
+                _mm_shuffle_epi8(_mm_loadu_si128((const __m128i*)data), reverse));
+            data += 16;
+            remaining -= 16;
+        }
+
+        // The folded 128 bits are congruent to the message so far, their CRC
+        // with a zero register is the register after the message
+        _mm_store_si128((__m128i*)residue, _mm_shuffle_epi8(x0, reverse));
+        // the residue and the last bytes share one table
+        volk_8u_crc_make_table(table, poly, 8);
+        reg = volk_8u_crc_update_table(0, residue, table, 16);
+        reg = volk_8u_crc_update_table(reg, data, table, remaining);
+    } else {
+        reg = volk_8u_crc_update_bytes(reg, data, poly, remaining);
+    }
+
+    *crc = reg >> (32 - width);
+}
+
+#endif /* LV_HAVE_SSSE3 && LV_HAVE_PCLMUL */
+
+
+#if LV_HAVE_AVX512F && LV_HAVE_SSSE3 && LV_HAVE_PCLMUL && LV_HAVE_VPCLMULQDQ
+#include <immintrin.h>
+
+static inline void volk_8u_s32u_crc_32u_u_vpclmulqdq(uint32_t* crc,
+                                                     const uint8_t* data,
+                                                     const uint32_t polynomial,
+                                                     unsigned int width,
+                                                     unsigned int num_points)
+{
+    const uint32_t poly = polynomial << (32 - width);
+    uint32_t reg = *crc << (32 - width);
+    unsigned int remaining = num_points;
+
+    if (remaining >= 64) {
+        const __m128i reverse =
+            _mm_set_epi8(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15);
+        const uint32_t x512 = volk_8u_crc_xpow(512, poly);
+        // the constants of the PCLMUL implementation in every 128-bit lane
+        const __m512i k512 = _mm512_broadcast_i32x4(
+            _mm_set_epi64x(volk_8u_crc_xpow(576, poly), x512));
+        const __m128i k128 = _mm_set_epi64x(volk_8u_crc_xpow(192, poly),
+                                            volk_8u_crc_xpow(128, poly));
+        __VOLK_ATTR_ALIGNED(16) uint8_t residue[16];
+        uint32_t table[256];
+        __m512i z0, z1, z2, z3;
+        __m128i x0;
+
+        z0 = VOLK_CRC_REVERSE_512(_mm512_loadu_si512(data));
+        z0 = _mm512_xor_si512(
+            z0,
+            _mm512_inserti32x4(
+                _mm512_setzero_si512(), _mm_set_epi32((int)reg, 0, 0, 0), 0));
+        data += 64;
+        remaining -= 64;
+
+        if (remaining >= 192) {
+            // the same for a fold distance of 2048 bits, x^2048 is x^512 squared
+            // twice, only derived when the message reaches the 256-byte loop
+            const uint32_t x1024 = volk_8u_crc_mulmod(x512, x512, poly);
+            const uint32_t x2048 = volk_8u_crc_mulmod(x1024, x1024, poly);
+            const __m512i k2048 = _mm512_broadcast_i32x4(_mm_set_epi64x(
+                volk_8u_crc_mulmod(x2048, volk_8u_crc_xpow(64, poly), poly), x2048));
+
+            z1 = VOLK_CRC_REVERSE_512(_mm512_loadu_si512(data));
+            z2 = VOLK_CRC_REVERSE_512(_mm512_loadu_si512(data + 64));
+            z3 = VOLK_CRC_REVERSE_512(_mm512_loadu_si512(data + 128));
+            data += 192;
+            remaining -= 192;
+
+            while (remaining >= 256) {
+                z0 = _mm512_ternarylogic_epi64(
+                    _mm512_clmulepi64_epi128(z0, k2048, 0x00),
+                    _mm512_clmulepi64_epi128(z0, k2048, 0x11),
+                    VOLK_CRC_REVERSE_512(_mm512_loadu_si512(data)),
+                    0x96);
+                z1 = _mm512_ternarylogic_epi64(
+                    _mm512_clmulepi64_epi128(z1, k2048, 0x00),
+                    _mm512_clmulepi64_epi128(z1, k2048, 0x11),
+                    VOLK_CRC_REVERSE_512(_mm512_loadu_si512(data + 64)),
+                    0x96);
+                z2 = _mm512_ternarylogic_epi64(
+                    _mm512_clmulepi64_epi128(z2, k2048, 0x00),
+                    _mm512_clmulepi64_epi128(z2, k2048, 0x11),
+                    VOLK_CRC_REVERSE_512(_mm512_loadu_si512(data + 128)),
+                    0x96);
+                z3 = _mm512_ternarylogic_epi64(
+                    _mm512_clmulepi64_epi128(z3, k2048, 0x00),
+                    _mm512_clmulepi64_epi128(z3, k2048, 0x11),
+                    VOLK_CRC_REVERSE_512(_mm512_loadu_si512(data + 192)),
+                    0x96);
+                data += 256;
+                remaining -= 256;
+            }
+
+            z0 = _mm512_ternarylogic_epi64(
+                _mm512_clmulepi64_epi128(z0, k512, 0x00),
+                _mm512_clmulepi64_epi128(z0, k512, 0x11),
+                z1,
+                0x96);
+            z0 = _mm512_ternarylogic_epi64(
+                _mm512_clmulepi64_epi128(z0, k512, 0x00),
+                _mm512_clmulepi64_epi128(z0, k512, 0x11),
+                z2,
+                0x96);
+            z0 = _mm512_ternarylogic_epi64(
+                _mm512_clmulepi64_epi128(z0, k512, 0x00),
+                _mm512_clmulepi64_epi128(z0, k512, 0x11),
+                z3,
+                0x96);
+        }
+        while (remaining >= 64) {
+            z0 = _mm512_ternarylogic_epi64(
+                _mm512_clmulepi64_epi128(z0, k512, 0x00),
+                _mm512_clmulepi64_epi128(z0, k512, 0x11),
+                VOLK_CRC_REVERSE_512(_mm512_loadu_si512(data)),
+                0x96);
+            data += 64;
+            remaining -= 64;
+        }
+
+        // fold the four lanes into one, the first lane holds the oldest bytes
+        x0 = _mm512_extracti32x4_epi32(z0, 0);
+        x0 = _mm_xor_si128(_mm_xor_si128(_mm_clmulepi64_si128(x0, k128, 0x00),
+                                         _mm_clmulepi64_si128(x0, k128, 0x11)),
+                           _mm512_extracti32x4_epi32(z0, 1));
+        x0 = _mm_xor_si128(_mm_xor_si128(_mm_clmulepi64_si128(x0, k128, 0x00),
+                                         _mm_clmulepi64_si128(x0, k128, 0x11)),
+                           _mm512_extracti32x4_epi32(z0, 2));
+        x0 = _mm_xor_si128(_mm_xor_si128(_mm_clmulepi64_si128(x0, k128, 0x00),
+                                         _mm_clmulepi64_si128(x0, k128, 0x11)),
+                           _mm512_extracti32x4_epi32(z0, 3));
+        while (remaining >= 16) {
+            x0 = _mm_xor_si128(
+                _mm_xor_si128(_mm_clmulepi64_si128(x0, k128, 0x00),
+                              _mm_clmulepi64_si128(x0, k128, 0x11)),
+                _mm_shuffle_epi8(_mm_loadu_si128((const __m128i*)data), reverse));
+            data += 16;
+            remaining -= 16;
+        }
+
+        _mm_store_si128((__m128i*)residue, _mm_shuffle_epi8(x0, reverse));
+        volk_8u_crc_make_table(table, poly, 8);
+        reg = volk_8u_crc_update_table(0, residue, table, 16);
+        reg = volk_8u_crc_update_table(reg, data, table, remaining);
+    } else {
+        reg = volk_8u_crc_update_bytes(reg, data, poly, remaining);
+    }
+
+    *crc = reg >> (32 - width);
+}
+
+#endif /* LV_HAVE_AVX512F && LV_HAVE_SSSE3 && LV_HAVE_PCLMUL && LV_HAVE_VPCLMULQDQ */
+
+
+#if LV_HAVE_NEONV8 && LV_HAVE_NEONV8_PMULL
+#include <arm_neon.h>
+#include <volk/volk_neon_intrinsics.h>
+
+/* Loads 16 bytes so that the coefficient of x^i sits in bit i */
+static inline uint8x16_t volk_8u_s32u_crc_32u_load_reversed(const uint8_t* data)
+{
+    const uint8x16_t x = vrev64q_u8(vld1q_u8(data));
+    return vextq_u8(x, x, 8);
+}
+
+static inline void volk_8u_s32u_crc_32u_neonv8_pmull(uint32_t* crc,
+                                                     const uint8_t* data,
+                                                     const uint32_t polynomial,
+                                                     unsigned int width,
+                                                     unsigned int num_points)
+{
+    const uint32_t poly = polynomial << (32 - width);
+    uint32_t reg = *crc << (32 - width);
+    unsigned int remaining = num_points;
+
+    if (remaining >= 64) {
+        // the constants of the PCLMUL implementation, low half first
+        const uint64_t k512Halves[2] = { volk_8u_crc_xpow(512, poly),
+                                         volk_8u_crc_xpow(576, poly) };
+        const uint64_t k128Halves[2] = { volk_8u_crc_xpow(128, poly),
+                                         volk_8u_crc_xpow(192, poly) };
+        const poly64x2_t k512 = vreinterpretq_p64_u64(vld1q_u64(k512Halves));
+        const poly64x2_t k128 = vreinterpretq_p64_u64(vld1q_u64(k128Halves));
+        uint8_t residue[16];
+        uint32_t table[256];
+        uint8x16_t x0, x1, x2, x3;
+
+        x0 = veorq_u8(volk_8u_s32u_crc_32u_load_reversed(data),
+                      vreinterpretq_u8_u32(vsetq_lane_u32(reg, vdupq_n_u32(0), 3)));
+        x1 = volk_8u_s32u_crc_32u_load_reversed(data + 16);
+        x2 = volk_8u_s32u_crc_32u_load_reversed(data + 32);
+        x3 = volk_8u_s32u_crc_32u_load_reversed(data + 48);
+        data += 64;
+        remaining -= 64;
+
+        while (remaining >= 64) {
+            x0 = _vclmulfoldq_u8(x0, k512, volk_8u_s32u_crc_32u_load_reversed(data));
+            x1 = _vclmulfoldq_u8(x1, k512, volk_8u_s32u_crc_32u_load_reversed(data + 16));
+            x2 = _vclmulfoldq_u8(x2, k512, volk_8u_s32u_crc_32u_load_reversed(data + 32));
+            x3 = _vclmulfoldq_u8(x3, k512, volk_8u_s32u_crc_32u_load_reversed(data + 48));
+            data += 64;
+            remaining -= 64;
+        }
+
+        x0 = _vclmulfoldq_u8(x0, k128, x1);
+        x0 = _vclmulfoldq_u8(x0, k128, x2);
+        x0 = _vclmulfoldq_u8(x0, k128, x3);
+        while (remaining >= 16) {
+            x0 = _vclmulfoldq_u8(x0, k128, volk_8u_s32u_crc_32u_load_reversed(data));
+            data += 16;
+            remaining -= 16;
+        }
+
+        x0 = vrev64q_u8(x0);
+        vst1q_u8(residue, vextq_u8(x0, x0, 8));
+        volk_8u_crc_make_table(table, poly, 8);
+        reg = volk_8u_crc_update_table(0, residue, table, 16);
+        reg = volk_8u_crc_update_table(reg, data, table, remaining);
+    } else {
+        reg = volk_8u_crc_update_bytes(reg, data, poly, remaining);
+    }
+
+    *crc = reg >> (32 - width);
+}
+
+#endif /* LV_HAVE_NEONV8 && LV_HAVE_NEONV8_PMULL */
+
+#endif /* INCLUDED_volk_8u_s32u_crc_32u_H */
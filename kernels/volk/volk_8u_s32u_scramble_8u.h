@@ -0,0 +1,353 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2026 Free Software Foundation, Inc.
+ *
+ * This file is part of VOLK
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+/*!
+ * \page volk_8u_s32u_scramble_8u
+ *
+ * \b Overview
+ *
+ * Additive scrambler as used by DVB, 802.11 and CCSDS: XORs byte-packed data,
+ * most significant bit first, with the sequence of a Fibonacci LFSR. As the
+ * operation is its own inverse, the same call descrambles.
+ *
+ * The polynomial x^d + ... + 1 of degree d up to 31 is given with all its
+ * terms, e.g. 0x91 for the 802.11 x^7 + x^4 + 1. Each step XORs the register
+ * bits selected by the polynomial, where term x^k selects bit k - 1, shifts the
+ * result into bit 0 of the register and XORs it into the next data bit. Bit 0
+ * of the register thus holds the most recent sequence bit. The register is
+ * read from state and written back after the last byte, so a stream can be
+ * scrambled in several calls.
+ *
+ * The SIMD implementations precompute, for every byte of the register, the
+ * next 128 or 256 sequence bits and the register that follows them. Each step
+ * then produces a full vector of the sequence with four table lookups. The
+ * tables take 16 KB (SSE2, NEON) or 32 KB (AVX2) of stack and are rebuilt on
+ * every call, which takes a few microseconds, about as long as the bitwise
+ * generic implementation needs for 200 bytes. Calls shorter than 256 or 512
+ * bytes therefore skip the tables; a stream is best scrambled in long calls.
+ *
+ * <b>Dispatcher Prototype</b>
+ * \code
+ * void volk_8u_s32u_scramble_8u(uint8_t* outputBuffer, const uint8_t* inputBuffer,
+ *                               uint32_t* state, const uint32_t polynomial,
+ *                               unsigned int num_points)
+ * \endcode
+ *
+ * \b Inputs
+ * \li inputBuffer: the packed data bytes.
+ * \li state: the register, the seed at the start of a frame. Bits at and above
+ * the degree of the polynomial are ignored.
+ * \li polynomial: the LFSR polynomial including the x^d and 1 terms.
+ * \li num_points: the number of bytes.
+ *
+ * \b Outputs
+ * \li outputBuffer: the scrambled bytes, may be the same as inputBuffer.
+ * \li state: the register after the last byte.
+ *
+ * \b Example
+ * Scramble and descramble a frame with the 802.11 scrambler.
+ * \code
+ *   unsigned int N = 100;
+ *   unsigned int alignment = volk_get_alignment();
+ *   uint8_t* data = (uint8_t*)volk_malloc(sizeof(uint8_t) * N, alignment);
+ *   uint32_t state;
+ *
+ *   for (unsigned int ii = 0; ii < N; ++ii) {
+ *       data[ii] = (uint8_t)ii;
+ *   }
+ *
+ *   state = 0x5d;
+ *   volk_8u_s32u_scramble_8u(data, data, &state, 0x91, N);
+ *   state = 0x5d;
+ *   volk_8u_s32u_scramble_8u(data, data, &state, 0x91, N); // data[ii] == ii
+ *
+ *   volk_free(data);
+ * \endcode
+ */
+
+#ifndef INCLUDED_volk_8u_s32u_scramble_8u_H
+#define INCLUDED_volk_8u_s32u_scramble_8u_H
+
+#include <inttypes.h>
+#include <string.h>
+#include <volk/volk_common.h>
+
+static inline unsigned int volk_8u_scramble_degree(uint32_t polynomial)
+{
+    unsigned int degree = 0;
+    while (polynomial >>= 1) {
+        degree++;
+    }
+    return degree;
+}
+
+static inline uint32_t volk_8u_scramble_mask(uint32_t polynomial)
+{
+    return (1u << volk_8u_scramble_degree(polynomial)) - 1;
+}
+
+static inline uint32_t volk_8u_scramble_parity(uint32_t value)
+{
+    value ^= value >> 16;
+    value ^= value >> 8;
+    value ^= value >> 4;
+    value ^= value >> 2;
+    value ^= value >> 1;
+    return value & 1;
+}
+
+/* Scrambles bytes one bit at a time and returns the register */
+static inline uint32_t volk_8u_scramble_bytes(uint8_t* outputBuffer,
+                                              const uint8_t* inputBuffer,
+                                              uint32_t reg,
+                                              uint32_t polynomial,
+                                              unsigned int num_points)
+{
+    const uint32_t mask = volk_8u_scramble_mask(polynomial);
+    const uint32_t taps = polynomial >> 1;
+    unsigned int number, bit;
+    uint32_t feedback;
+    uint8_t sequence;
+
+    for (number = 0; number < num_points; number++) {
+        sequence = 0;
+        for (bit = 0; bit < 8; bit++) {
+            feedback = volk_8u_scramble_parity(reg & taps);
+            reg = ((reg << 1) | feedback) & mask;
+            sequence = (uint8_t)((sequence << 1) | feedback);
+        }
+        outputBuffer[number] = inputBuffer[number] ^ sequence;
+    }
+    return reg;
+}
+
+/* Fills the tables for steps of width bytes. Entry b of table q holds the
+ * sequence and the following register when byte q of the register is b and all
+ * other bytes are zero, so that by linearity the XOR of the entries for the
+ * four register bytes gives the step from any register. */
+static inline void volk_8u_scramble_tables(uint8_t* sequenceTable,
+                                           uint32_t* stateTable,
+                                           uint32_t polynomial,
+                                           unsigned int width)
+{
+    const unsigned int degree = volk_8u_scramble_degree(polynomial);
+    const unsigned int tables = (degree + 7) / 8;
+    const uint32_t mask = volk_8u_scramble_mask(polynomial);
+    uint32_t history[31 + 256];
+    unsigned int taps[31];
+    unsigned int numTaps = 0;
+    unsigned int t, k, q, low, bit, b;
+    uint32_t byte;
+    uint8_t* entry;
+    const uint8_t* last;
+    uint64_t word, other;
+
+    // Run the LFSR for all single-bit registers at once: bit j of history[i]
+    // is the sequence for the register 1 << j
+    for (k = 1; k <= degree; k++) {
+        if ((polynomial >> k) & 1) {
+            taps[numTaps++] = k;
+        }
+        history[degree - k] = 1u << (k - 1);
+    }
+    for (t = degree; t < degree + 8 * width; t++) {
+        history[t] = 0;
+        for (k = 0; k < numTaps; k++) {
+            history[t] ^= history[t - taps[k]];
+        }
+    }
+
+    for (q = 0; q < 4; q++) {
+        memset(sequenceTable + q * 256 * width, 0, width);
+        stateTable[q * 256] = 0;
+        for (low = 1; q < tables && low < 256; low++) {
+            entry = sequenceTable + (q * 256 + low) * width;
+            bit = low & (0u - low);
+            if (low == bit) {
+                for (k = 8 * q; low >> (k - 8 * q + 1); k++) {
+                }
+                for (t = 0; t < width; t++) {
+                    for (byte = 0, b = 0; b < 8; b++) {
+                        byte = (byte << 1) | ((history[degree + 8 * t + b] >> k) & 1);
+                    }
+                    entry[t] = (uint8_t)byte;
+                }
+                last = entry + width - 4;
+                stateTable[q * 256 + low] =
+                    (((uint32_t)last[0] << 24) | ((uint32_t)last[1] << 16) |
+                     ((uint32_t)last[2] << 8) | (uint32_t)last[3]) &
+                    mask;
+            } else {
+                for (t = 0; t < width; t += 8) {
+                    memcpy(&word, entry - bit * width + t, 8);
+                    memcpy(&other, entry - (low - bit) * width + t, 8);
+                    word ^= other;
+                    memcpy(entry + t, &word, 8);
+                }
+                stateTable[q * 256 + low] =
+                    stateTable[q * 256 + low - bit] ^ stateTable[q * 256 + bit];
+            }
+        }
+    }
+}
+
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void volk_8u_s32u_scramble_8u_generic(uint8_t* outputBuffer,
+                                                    const uint8_t* inputBuffer,
+                                                    uint32_t* state,
+                                                    const uint32_t polynomial,
+                                                    unsigned int num_points)
+{
+    *state =
+        volk_8u_scramble_bytes(outputBuffer, inputBuffer, *state, polynomial, num_points);
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+
+#ifdef LV_HAVE_SSE2
+#include <emmintrin.h>
+
+static inline void volk_8u_s32u_scramble_8u_u_sse2(uint8_t* outputBuffer,
+                                                   const uint8_t* inputBuffer,
+                                                   uint32_t* state,
+                                                   const uint32_t polynomial,
+                                                   unsigned int num_points)
+{
+    __VOLK_ATTR_ALIGNED(16) uint8_t sequenceTable[4 * 256 * 16];
+    uint32_t stateTable[4 * 256];
+    // building the tables only pays off for longer vectors
+    const unsigned int sixteenthPoints = (num_points >= 256) ? num_points / 16 : 0;
+    uint32_t reg = *state;
+    const __m128i* table = (const __m128i*)sequenceTable;
+    unsigned int number, b0, b1, b2, b3;
+    __m128i sequence;
+
+    if (sixteenthPoints) {
+        volk_8u_scramble_tables(sequenceTable, stateTable, polynomial, 16);
+        // only the tables of the register bytes below the degree are filled
+        reg &= volk_8u_scramble_mask(polynomial);
+    }
+    for (number = 0; number < sixteenthPoints; number++) {
+        b0 = reg & 0xff;
+        b1 = 256 + ((reg >> 8) & 0xff);
+        b2 = 512 + ((reg >> 16) & 0xff);
+        b3 = 768 + (reg >> 24);
+        sequence = _mm_xor_si128(
+            _mm_xor_si128(_mm_load_si128(table + b0), _mm_load_si128(table + b1)),
+            _mm_xor_si128(_mm_load_si128(table + b2), _mm_load_si128(table + b3)));
+        reg = stateTable[b0] ^ stateTable[b1] ^ stateTable[b2] ^ stateTable[b3];
+        _mm_storeu_si128(
+            (__m128i*)outputBuffer,
+            _mm_xor_si128(_mm_loadu_si128((const __m128i*)inputBuffer), sequence));
+        inputBuffer += 16;
+        outputBuffer += 16;
+    }
+
+    *state = volk_8u_scramble_bytes(
+        outputBuffer, inputBuffer, reg, polynomial, num_points - sixteenthPoints * 16);
+}
+
+#endif /* LV_HAVE_SSE2 */
+
+
+#ifdef LV_HAVE_AVX2
+#include <immintrin.h>
+
+static inline void volk_8u_s32u_scramble_8u_u_avx2(uint8_t* outputBuffer,
+                                                   const uint8_t* inputBuffer,
+                                                   uint32_t* state,
+                                                   const uint32_t polynomial,
+                                                   unsigned int num_points)
+{
+    __VOLK_ATTR_ALIGNED(32) uint8_t sequenceTable[4 * 256 * 32];
+    uint32_t stateTable[4 * 256];
+    // building the tables only pays off for longer vectors
+    const unsigned int thirtySecondPoints = (num_points >= 512) ? num_points / 32 : 0;
+    uint32_t reg = *state;
+    const __m256i* table = (const __m256i*)sequenceTable;
+    unsigned int number, b0, b1, b2, b3;
+    __m256i sequence;
+
+    if (thirtySecondPoints) {
+        volk_8u_scramble_tables(sequenceTable, stateTable, polynomial, 32);
+        // only the tables of the register bytes below the degree are filled
+        reg &= volk_8u_scramble_mask(polynomial);
+    }
+    for (number = 0; number < thirtySecondPoints; number++) {
+        b0 = reg & 0xff;
+        b1 = 256 + ((reg >> 8) & 0xff);
+        b2 = 512 + ((reg >> 16) & 0xff);
+        b3 = 768 + (reg >> 24);
+        sequence = _mm256_xor_si256(
+            _mm256_xor_si256(_mm256_load_si256(table + b0),
+                             _mm256_load_si256(table + b1)),
+            _mm256_xor_si256(_mm256_load_si256(table + b2),
+                             _mm256_load_si256(table + b3)));
+        reg = stateTable[b0] ^ stateTable[b1] ^ stateTable[b2] ^ stateTable[b3];
+        _mm256_storeu_si256(
+            (__m256i*)outputBuffer,
+            _mm256_xor_si256(_mm256_loadu_si256((const __m256i*)inputBuffer), sequence));
+        inputBuffer += 32;
+        outputBuffer += 32;
+    }
+
+    *state = volk_8u_scramble_bytes(
+        outputBuffer, inputBuffer, reg, polynomial, num_points - thirtySecondPoints * 32);
+}
+
+#endif /* LV_HAVE_AVX2 */
+
+
+#ifdef LV_HAVE_NEON
+#include <arm_neon.h>
+
+static inline void volk_8u_s32u_scramble_8u_neon(uint8_t* outputBuffer,
+                                                 const uint8_t* inputBuffer,
+                                                 uint32_t* state,
+                                                 const uint32_t polynomial,
+                                                 unsigned int num_points)
+{
+    __VOLK_ATTR_ALIGNED(16) uint8_t sequenceTable[4 * 256 * 16];
+    uint32_t stateTable[4 * 256];
+    // building the tables only pays off for longer vectors
+    const unsigned int sixteenthPoints = (num_points >= 256) ? num_points / 16 : 0;
+    uint32_t reg = *state;
+    unsigned int number, b0, b1, b2, b3;
+    uint8x16_t sequence;
+
+    if (sixteenthPoints) {
+        volk_8u_scramble_tables(sequenceTable, stateTable, polynomial, 16);
+        // only the tables of the register bytes below the degree are filled
+        reg &= volk_8u_scramble_mask(polynomial);
+    }
+    for (number = 0; number < sixteenthPoints; number++) {
+        b0 = reg & 0xff;
+        b1 = 256 + ((reg >> 8) & 0xff);
+        b2 = 512 + ((reg >> 16) & 0xff);
+        b3 = 768 + (reg >> 24);
+        sequence = veorq_u8(veorq_u8(vld1q_u8(sequenceTable + 16 * b0),
+                                     vld1q_u8(sequenceTable + 16 * b1)),
+                            veorq_u8(vld1q_u8(sequenceTable + 16 * b2),
+                                     vld1q_u8(sequenceTable + 16 * b3)));
+        reg = stateTable[b0] ^ stateTable[b1] ^ stateTable[b2] ^ stateTable[b3];
+        vst1q_u8(outputBuffer, veorq_u8(vld1q_u8(inputBuffer), sequence));
+        inputBuffer += 16;
+        outputBuffer += 16;
+    }
+
+    *state = volk_8u_scramble_bytes(
+        outputBuffer, inputBuffer, reg, polynomial, num_points - sixteenthPoints * 16);
+}
+
+#endif /* LV_HAVE_NEON */
+
+#endif /* INCLUDED_volk_8u_s32u_scramble_8u_H */
@@ -0,0 +1,137 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2026 Free Software Foundation, Inc.
+ *
+ * This file is part of VOLK
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+/* For documentation see 'kernels/volk/volk_8u_s32u_scramble_8u.h'
+ * This file exists for test purposes only. Should not be used directly.
+ *
+ * Scrambles the input in calls of varying length with the 802.11, DVB-S,
+ * CCSDS and PRBS23 polynomials in turn, carrying the register between calls.
+ * The second round of seeds has bits set above the polynomial degree, which
+ * must be ignored. The first call after a seed is long enough for the table
+ * based implementations.
+ */
+
+#ifndef INCLUDED_volk_8u_scramblepuppet_8u_H
+#define INCLUDED_volk_8u_scramblepuppet_8u_H
+
+#include <volk/volk_8u_s32u_scramble_8u.h>
+
+static const uint32_t volk_8u_scramblepuppet_polys[4] = { 0x91, 0xc001, 0x12b, 0x840001 };
+static const uint32_t volk_8u_scramblepuppet_seeds[8] = {
+    0x5d, 0xa9, 0xff, 0x7fffff, 0x1ff, 0xdead00a9, 0x8000ff01, 0xffffffff
+};
+static const unsigned int volk_8u_scramblepuppet_chunks[8] = {
+    1000, 1, 15, 16, 100, 127, 128, 4096
+};
+
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void volk_8u_scramblepuppet_8u_generic(uint8_t* outputBuffer,
+                                                     const uint8_t* inputBuffer,
+                                                     unsigned int num_points)
+{
+    unsigned int offset, chunk, count;
+    uint32_t state = 0;
+
+    for (offset = 0, chunk = 0; offset < num_points; offset += count, chunk++) {
+        if (chunk % 8 == 0) {
+            state = volk_8u_scramblepuppet_seeds[chunk / 8 % 8];
+        }
+        count = volk_8u_scramblepuppet_chunks[chunk % 8];
+        count = (count < num_points - offset) ? count : num_points - offset;
+        volk_8u_s32u_scramble_8u_generic(outputBuffer + offset,
+                                         inputBuffer + offset,
+                                         &state,
+                                         volk_8u_scramblepuppet_polys[chunk / 8 % 4],
+                                         count);
+    }
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+
+#ifdef LV_HAVE_SSE2
+
+static inline void volk_8u_scramblepuppet_8u_u_sse2(uint8_t* outputBuffer,
+                                                    const uint8_t* inputBuffer,
+                                                    unsigned int num_points)
+{
+    unsigned int offset, chunk, count;
+    uint32_t state = 0;
+
+    for (offset = 0, chunk = 0; offset < num_points; offset += count, chunk++) {
+        if (chunk % 8 == 0) {
+            state = volk_8u_scramblepuppet_seeds[chunk / 8 % 8];
+        }
+        count = volk_8u_scramblepuppet_chunks[chunk % 8];
+        count = (count < num_points - offset) ? count : num_points - offset;
+        volk_8u_s32u_scramble_8u_u_sse2(outputBuffer + offset,
+                                        inputBuffer + offset,
+                                        &state,
+                                        volk_8u_scramblepuppet_polys[chunk / 8 % 4],
+                                        count);
+    }
+}
+
+#endif /* LV_HAVE_SSE2 */
+
+
+#ifdef LV_HAVE_AVX2
+
+static inline void volk_8u_scramblepuppet_8u_u_avx2(uint8_t* outputBuffer,
+                                                    const uint8_t* inputBuffer,
+                                                    unsigned int num_points)
+{
+    unsigned int offset, chunk, count;
+    uint32_t state = 0;
+
+    for (offset = 0, chunk = 0; offset < num_points; offset += count, chunk++) {
+        if (chunk % 8 == 0) {
+            state = volk_8u_scramblepuppet_seeds[chunk / 8 % 8];
+        }
+        count = volk_8u_scramblepuppet_chunks[chunk % 8];
+        count = (count < num_points - offset) ? count : num_points - offset;
+        volk_8u_s32u_scramble_8u_u_avx2(outputBuffer + offset,
+                                        inputBuffer + offset,
+                                        &state,
+                                        volk_8u_scramblepuppet_polys[chunk / 8 % 4],
+                                        count);
+    }
+}
+
+#endif /* LV_HAVE_AVX2 */
+
+
+#ifdef LV_HAVE_NEON
+
+static inline void volk_8u_scramblepuppet_8u_neon(uint8_t* outputBuffer,
+                                                  const uint8_t* inputBuffer,
+                                                  unsigned int num_points)
+{
+    unsigned int offset, chunk, count;
+    uint32_t state = 0;
+
+    for (offset = 0, chunk = 0; offset < num_points; offset += count, chunk++) {
+        if (chunk % 8 == 0) {
+            state = volk_8u_scramblepuppet_seeds[chunk / 8 % 8];
+        }
+        count = volk_8u_scramblepuppet_chunks[chunk % 8];
+        count = (count < num_points - offset) ? count : num_points - offset;
+        volk_8u_s32u_scramble_8u_neon(outputBuffer + offset,
+                                      inputBuffer + offset,
+                                      &state,
+                                      volk_8u_scramblepuppet_polys[chunk / 8 % 4],
+                                      count);
+    }
+}
+
+#endif /* LV_HAVE_NEON */
+
+#endif /* INCLUDED_volk_8u_scramblepuppet_8u_H */
@@ -0,0 +1,158 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2026 Free Software Foundation, Inc.
+ *
+ * This file is part of VOLK
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+/* For documentation see 'kernels/volk/volk_8u_x2_s32u_sync_search_32u.h'
+ * This file exists for test purposes only. Should not be used directly.
+ *
+ * Searches two parts of the input for a 64-bit and a 37-bit sync word taken
+ * from the end of the input, with thresholds that give a few hundred random
+ * matches. The output holds the two match counts followed by the offsets of
+ * both searches, the rest of the output is cleared.
+ */
+
+#ifndef INCLUDED_volk_8u_sync_searchpuppet_32u_H
+#define INCLUDED_volk_8u_sync_searchpuppet_32u_H
+
+#include <string.h>
+#include <volk/volk_8u_x2_s32u_sync_search_32u.h>
+
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void volk_8u_sync_searchpuppet_32u_generic(uint32_t* result,
+                                                         const uint8_t* inputBuffer,
+                                                         unsigned int num_points)
+{
+    const unsigned int part = num_points / 20;
+    const uint8_t* syncWord = inputBuffer + num_points - 8;
+    uint32_t* offsets = result + 2;
+
+    volk_8u_x2_s32u_sync_search_32u_generic(
+        offsets, result, inputBuffer, syncWord, 22, 64, part);
+    offsets += result[0];
+    volk_8u_x2_s32u_sync_search_32u_generic(
+        offsets, result + 1, inputBuffer + part, syncWord, 10, 37, part);
+    offsets += result[1];
+    memset(offsets, 0, (num_points - (offsets - result)) * sizeof(uint32_t));
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+
+#if LV_HAVE_SSE4_2 && LV_HAVE_64
+
+static inline void volk_8u_sync_searchpuppet_32u_u_sse4_2(uint32_t* result,
+                                                          const uint8_t* inputBuffer,
+                                                          unsigned int num_points)
+{
+    const unsigned int part = num_points / 20;
+    const uint8_t* syncWord = inputBuffer + num_points - 8;
+    uint32_t* offsets = result + 2;
+
+    volk_8u_x2_s32u_sync_search_32u_u_sse4_2(
+        offsets, result, inputBuffer, syncWord, 22, 64, part);
+    offsets += result[0];
+    volk_8u_x2_s32u_sync_search_32u_u_sse4_2(
+        offsets, result + 1, inputBuffer + part, syncWord, 10, 37, part);
+    offsets += result[1];
+    memset(offsets, 0, (num_points - (offsets - result)) * sizeof(uint32_t));
+}
+
+#endif /* LV_HAVE_SSE4_2 && LV_HAVE_64 */
+
+
+#ifdef LV_HAVE_AVX2
+
+static inline void volk_8u_sync_searchpuppet_32u_u_avx2(uint32_t* result,
+                                                        const uint8_t* inputBuffer,
+                                                        unsigned int num_points)
+{
+    const unsigned int part = num_points / 20;
+    const uint8_t* syncWord = inputBuffer + num_points - 8;
+    uint32_t* offsets = result + 2;
+
+    volk_8u_x2_s32u_sync_search_32u_u_avx2(
+        offsets, result, inputBuffer, syncWord, 22, 64, part);
+    offsets += result[0];
+    volk_8u_x2_s32u_sync_search_32u_u_avx2(
+        offsets, result + 1, inputBuffer + part, syncWord, 10, 37, part);
+    offsets += result[1];
+    memset(offsets, 0, (num_points - (offsets - result)) * sizeof(uint32_t));
+}
+
+#endif /* LV_HAVE_AVX2 */
+
+
+#ifdef LV_HAVE_AVX512F
+
+static inline void volk_8u_sync_searchpuppet_32u_u_avx512f(uint32_t* result,
+                                                           const uint8_t* inputBuffer,
+                                                           unsigned int num_points)
+{
+    const unsigned int part = num_points / 20;
+    const uint8_t* syncWord = inputBuffer + num_points - 8;
+    uint32_t* offsets = result + 2;
+
+    volk_8u_x2_s32u_sync_search_32u_u_avx512f(
+        offsets, result, inputBuffer, syncWord, 22, 64, part);
+    offsets += result[0];
+    volk_8u_x2_s32u_sync_search_32u_u_avx512f(
+        offsets, result + 1, inputBuffer + part, syncWord, 10, 37, part);
+    offsets += result[1];
+    memset(offsets, 0, (num_points - (offsets - result)) * sizeof(uint32_t));
+}
+
+#endif /* LV_HAVE_AVX512F */
+
+
+#if LV_HAVE_AVX512F && LV_HAVE_AVX512VPOPCNTDQ
+
+static inline void
+volk_8u_sync_searchpuppet_32u_u_avx512vpopcntdq(uint32_t* result,
+                                                const uint8_t* inputBuffer,
+                                                unsigned int num_points)
+{
+    const unsigned int part = num_points / 20;
+    const uint8_t* syncWord = inputBuffer + num_points - 8;
+    uint32_t* offsets = result + 2;
+
+    volk_8u_x2_s32u_sync_search_32u_u_avx512vpopcntdq(
+        offsets, result, inputBuffer, syncWord, 22, 64, part);
+    offsets += result[0];
+    volk_8u_x2_s32u_sync_search_32u_u_avx512vpopcntdq(
+        offsets, result + 1, inputBuffer + part, syncWord, 10, 37, part);
+    offsets += result[1];
+    memset(offsets, 0, (num_points - (offsets - result)) * sizeof(uint32_t));
+}
+
+#endif /* LV_HAVE_AVX512F && LV_HAVE_AVX512VPOPCNTDQ */
+
+
+#ifdef LV_HAVE_NEON
+
+static inline void volk_8u_sync_searchpuppet_32u_neon(uint32_t* result,
+                                                      const uint8_t* inputBuffer,
+                                                      unsigned int num_points)
+{
+    const unsigned int part = num_points / 20;
+    const uint8_t* syncWord = inputBuffer + num_points - 8;
+    uint32_t* offsets = result + 2;
+
+    volk_8u_x2_s32u_sync_search_32u_neon(
+        offsets, result, inputBuffer, syncWord, 22, 64, part);
+    offsets += result[0];
+    volk_8u_x2_s32u_sync_search_32u_neon(
+        offsets, result + 1, inputBuffer + part, syncWord, 10, 37, part);
+    offsets += result[1];
+    memset(offsets, 0, (num_points - (offsets - result)) * sizeof(uint32_t));
+}
+
+#endif /* LV_HAVE_NEON */
+
+#endif /* INCLUDED_volk_8u_sync_searchpuppet_32u_H */
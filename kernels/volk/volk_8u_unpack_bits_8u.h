@@ -0,0 +1,188 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2026 Free Software Foundation, Inc.
+ *
+ * This file is part of VOLK
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+/*!
+ * \page volk_8u_unpack_bits_8u
+ *
+ * \b Overview
+ *
+ * Unpacks bytes into bits stored one per byte as 0 or 1, the layout of the
+ * polar and convolutional coding kernels. With msbFirst set the most
+ * significant bit of each byte comes first, otherwise the least significant.
+ *
+ * <b>Dispatcher Prototype</b>
+ * \code
+ * void volk_8u_unpack_bits_8u(uint8_t* bits, const uint8_t* bytes,
+ *                             const unsigned int msbFirst, unsigned int num_points)
+ * \endcode
+ *
+ * \b Inputs
+ * \li bytes: (num_points + 7) / 8 packed bytes.
+ * \li msbFirst: non-zero to start with the most significant bit of each byte.
+ * \li num_points: the number of bits.
+ *
+ * \b Outputs
+ * \li bits: the unpacked bits.
+ *
+ * \b Example
+ * \code
+ *   unsigned int N = 16;
+ *   unsigned int alignment = volk_get_alignment();
+ *   uint8_t* bytes = (uint8_t*)volk_malloc(sizeof(uint8_t) * N / 8, alignment);
+ *   uint8_t* bits = (uint8_t*)volk_malloc(sizeof(uint8_t) * N, alignment);
+ *
+ *   bytes[0] = 0x92;
+ *   bytes[1] = 0x49;
+ *
+ *   volk_8u_unpack_bits_8u(bits, bytes, 1, N); // bits[ii] == (ii % 3 == 0)
+ *
+ *   volk_free(bytes);
+ *   volk_free(bits);
+ * \endcode
+ */
+
+#ifndef INCLUDED_volk_8u_unpack_bits_8u_u_H
+#define INCLUDED_volk_8u_unpack_bits_8u_u_H
+
+#include <inttypes.h>
+
+static inline void volk_8u_unpack_bits_scalar(uint8_t* bits,
+                                              const uint8_t* bytes,
+                                              unsigned int msbFirst,
+                                              unsigned int count)
+{
+    const unsigned int first = msbFirst ? 7 : 0;
+    unsigned int number;
+
+    for (number = 0; number < count; number++) {
+        *bits++ = (bytes[number / 8] >> (first ^ (number % 8))) & 1;
+    }
+}
+
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void volk_8u_unpack_bits_8u_generic(uint8_t* bits,
+                                                  const uint8_t* bytes,
+                                                  const unsigned int msbFirst,
+                                                  unsigned int num_points)
+{
+    volk_8u_unpack_bits_scalar(bits, bytes, msbFirst, num_points);
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+
+#ifdef LV_HAVE_SSE2
+#include <emmintrin.h>
+
+static inline void volk_8u_unpack_bits_8u_u_sse2(uint8_t* bits,
+                                                 const uint8_t* bytes,
+                                                 const unsigned int msbFirst,
+                                                 unsigned int num_points)
+{
+    const unsigned int thirtySecondPoints = num_points / 32;
+    const __m128i bitMask =
+        msbFirst ? _mm_setr_epi8(
+                       -128, 64, 32, 16, 8, 4, 2, 1, -128, 64, 32, 16, 8, 4, 2, 1)
+                 : _mm_setr_epi8(
+                       1, 2, 4, 8, 16, 32, 64, -128, 1, 2, 4, 8, 16, 32, 64, -128);
+    const __m128i one = _mm_set1_epi8(1);
+    __m128i value, low, high;
+    unsigned int number;
+
+    for (number = 0; number < thirtySecondPoints; number++) {
+        // repeat each of four bytes eight times
+        value = _mm_cvtsi32_si128(bytes[0] | bytes[1] << 8 | bytes[2] << 16 |
+                                  (uint32_t)bytes[3] << 24);
+        value = _mm_unpacklo_epi8(value, value);
+        value = _mm_unpacklo_epi16(value, value);
+        low = _mm_unpacklo_epi32(value, value);
+        high = _mm_unpackhi_epi32(value, value);
+
+        low = _mm_cmpeq_epi8(_mm_and_si128(low, bitMask), bitMask);
+        high = _mm_cmpeq_epi8(_mm_and_si128(high, bitMask), bitMask);
+        _mm_storeu_si128((__m128i*)bits, _mm_and_si128(low, one));
+        _mm_storeu_si128((__m128i*)(bits + 16), _mm_and_si128(high, one));
+        bytes += 4;
+        bits += 32;
+    }
+
+    volk_8u_unpack_bits_scalar(bits, bytes, msbFirst, num_points - number * 32);
+}
+
+#endif /* LV_HAVE_SSE2 */
+
+
+#ifdef LV_HAVE_AVX2
+#include <immintrin.h>
+
+static inline void volk_8u_unpack_bits_8u_u_avx2(uint8_t* bits,
+                                                 const uint8_t* bytes,
+                                                 const unsigned int msbFirst,
+                                                 unsigned int num_points)
+{
+    const unsigned int thirtySecondPoints = num_points / 32;
+    const __m256i spread = _mm256_setr_epi8(0, 0, 0, 0, 0, 0, 0, 0,
+                                            1, 1, 1, 1, 1, 1, 1, 1,
+                                            2, 2, 2, 2, 2, 2, 2, 2,
+                                            3, 3, 3, 3, 3, 3, 3, 3);
+    const __m256i bitMask =
+        msbFirst ? _mm256_set1_epi64x(0x0102040810204080LL)
+                 : _mm256_set1_epi64x(0x8040201008040201LL);
+    const __m256i one = _mm256_set1_epi8(1);
+    __m256i value;
+    unsigned int number;
+
+    for (number = 0; number < thirtySecondPoints; number++) {
+        value = _mm256_set1_epi32(bytes[0] | bytes[1] << 8 | bytes[2] << 16 |
+                                  (uint32_t)bytes[3] << 24);
+        value = _mm256_shuffle_epi8(value, spread);
+        value = _mm256_cmpeq_epi8(_mm256_and_si256(value, bitMask), bitMask);
+        _mm256_storeu_si256((__m256i*)bits, _mm256_and_si256(value, one));
+        bytes += 4;
+        bits += 32;
+    }
+
+    volk_8u_unpack_bits_scalar(bits, bytes, msbFirst, num_points - number * 32);
+}
+
+#endif /* LV_HAVE_AVX2 */
+
+
+#ifdef LV_HAVE_NEON
+#include <arm_neon.h>
+
+static inline void volk_8u_unpack_bits_8u_neon(uint8_t* bits,
+                                               const uint8_t* bytes,
+                                               const unsigned int msbFirst,
+                                               unsigned int num_points)
+{
+    const unsigned int sixteenthPoints = num_points / 16;
+    const uint8_t lsbMask[8] = { 1, 2, 4, 8, 16, 32, 64, 128 };
+    const uint8_t msbMask[8] = { 128, 64, 32, 16, 8, 4, 2, 1 };
+    const uint8x8_t mask = vld1_u8(msbFirst ? msbMask : lsbMask);
+    const uint8x16_t bitMask = vcombine_u8(mask, mask);
+    const uint8x16_t one = vdupq_n_u8(1);
+    uint8x16_t value;
+    unsigned int number;
+
+    for (number = 0; number < sixteenthPoints; number++) {
+        value = vcombine_u8(vdup_n_u8(bytes[0]), vdup_n_u8(bytes[1]));
+        vst1q_u8(bits, vandq_u8(vtstq_u8(value, bitMask), one));
+        bytes += 2;
+        bits += 16;
+    }
+
+    volk_8u_unpack_bits_scalar(bits, bytes, msbFirst, num_points - number * 16);
+}
+
+#endif /* LV_HAVE_NEON */
+
+#endif /* INCLUDED_volk_8u_unpack_bits_8u_u_H */
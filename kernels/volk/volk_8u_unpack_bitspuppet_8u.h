@@ -0,0 +1,85 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2026 Free Software Foundation, Inc.
+ *
+ * This file is part of VOLK
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+/* For documentation see 'kernels/volk/volk_8u_unpack_bits_8u.h'
+ * This file exists for test purposes only. Should not be used directly.
+ *
+ * Unpacks the first half of the bits MSB first and the second half LSB first.
+ */
+
+#ifndef INCLUDED_volk_8u_unpack_bitspuppet_8u_H
+#define INCLUDED_volk_8u_unpack_bitspuppet_8u_H
+
+#include <volk/volk_8u_unpack_bits_8u.h>
+
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void volk_8u_unpack_bitspuppet_8u_generic(uint8_t* bits,
+                                                        const uint8_t* bytes,
+                                                        unsigned int num_points)
+{
+    const unsigned int half = num_points / 2;
+
+    volk_8u_unpack_bits_8u_generic(bits, bytes, 1, half);
+    volk_8u_unpack_bits_8u_generic(
+        bits + half, bytes + (half + 7) / 8, 0, num_points - half);
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+
+#ifdef LV_HAVE_SSE2
+
+static inline void volk_8u_unpack_bitspuppet_8u_u_sse2(uint8_t* bits,
+                                                       const uint8_t* bytes,
+                                                       unsigned int num_points)
+{
+    const unsigned int half = num_points / 2;
+
+    volk_8u_unpack_bits_8u_u_sse2(bits, bytes, 1, half);
+    volk_8u_unpack_bits_8u_u_sse2(
+        bits + half, bytes + (half + 7) / 8, 0, num_points - half);
+}
+
+#endif /* LV_HAVE_SSE2 */
+
+
+#ifdef LV_HAVE_AVX2
+
+static inline void volk_8u_unpack_bitspuppet_8u_u_avx2(uint8_t* bits,
+                                                       const uint8_t* bytes,
+                                                       unsigned int num_points)
+{
+    const unsigned int half = num_points / 2;
+
+    volk_8u_unpack_bits_8u_u_avx2(bits, bytes, 1, half);
+    volk_8u_unpack_bits_8u_u_avx2(
+        bits + half, bytes + (half + 7) / 8, 0, num_points - half);
+}
+
+#endif /* LV_HAVE_AVX2 */
+
+
+#ifdef LV_HAVE_NEON
+
+static inline void volk_8u_unpack_bitspuppet_8u_neon(uint8_t* bits,
+                                                     const uint8_t* bytes,
+                                                     unsigned int num_points)
+{
+    const unsigned int half = num_points / 2;
+
+    volk_8u_unpack_bits_8u_neon(bits, bytes, 1, half);
+    volk_8u_unpack_bits_8u_neon(
+        bits + half, bytes + (half + 7) / 8, 0, num_points - half);
+}
+
+#endif /* LV_HAVE_NEON */
+
+#endif /* INCLUDED_volk_8u_unpack_bitspuppet_8u_H */
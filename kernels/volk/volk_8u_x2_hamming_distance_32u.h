@@ -0,0 +1,274 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2026 Free Software Foundation, Inc.
+ *
+ * This file is part of VOLK
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+/*!
+ * \page volk_8u_x2_hamming_distance_32u
+ *
+ * \b Overview
+ *
+ * Computes the Hamming distance between two byte vectors, the number of bit
+ * positions in which they differ, e.g. to count bit errors against a known
+ * sequence. Uses the same bit counting as volk_8u_popcnt_32u on the XOR of
+ * the inputs.
+ *
+ * <b>Dispatcher Prototype</b>
+ * \code
+ * void volk_8u_x2_hamming_distance_32u(uint32_t* distance, const uint8_t* aVector,
+ *                                      const uint8_t* bVector, unsigned int num_points)
+ * \endcode
+ *
+ * \b Inputs
+ * \li aVector: the first input vector.
+ * \li bVector: the second input vector.
+ * \li num_points: the number of bytes in each vector.
+ *
+ * \b Outputs
+ * \li distance: the number of differing bits.
+ *
+ * \b Example
+ * \code
+ *   unsigned int N = 1000;
+ *   unsigned int alignment = volk_get_alignment();
+ *   uint8_t* a = (uint8_t*)volk_malloc(sizeof(uint8_t) * N, alignment);
+ *   uint8_t* b = (uint8_t*)volk_malloc(sizeof(uint8_t) * N, alignment);
+ *   uint32_t distance;
+ *
+ *   for (unsigned int ii = 0; ii < N; ++ii) {
+ *       a[ii] = 0x0f;
+ *       b[ii] = 0x0e;
+ *   }
+ *
+ *   volk_8u_x2_hamming_distance_32u(&distance, a, b, N); // distance == N
+ *
+ *   volk_free(a);
+ *   volk_free(b);
+ * \endcode
+ */
+
+#ifndef INCLUDED_volk_8u_x2_hamming_distance_32u_H
+#define INCLUDED_volk_8u_x2_hamming_distance_32u_H
+
+#include <inttypes.h>
+#include <string.h>
+#include <volk/volk_8u_popcnt_32u.h>
+
+static inline uint32_t volk_8u_hamming_scalar(const uint8_t* aVector,
+                                              const uint8_t* bVector,
+                                              unsigned int num_points)
+{
+    uint32_t total = 0;
+    unsigned int number;
+    for (number = 0; number < num_points; number++) {
+        total += volk_8u_popcnt_word(aVector[number] ^ bVector[number]);
+    }
+    return total;
+}
+
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void volk_8u_x2_hamming_distance_32u_generic(uint32_t* distance,
+                                                           const uint8_t* aVector,
+                                                           const uint8_t* bVector,
+                                                           unsigned int num_points)
+{
+    const unsigned int eighthPoints = num_points / 8;
+    uint64_t word, other;
+    uint32_t total = 0;
+    unsigned int number;
+
+    for (number = 0; number < eighthPoints; number++) {
+        memcpy(&word, aVector, 8);
+        memcpy(&other, bVector, 8);
+        word ^= other;
+        total += volk_8u_popcnt_word(word);
+        aVector += 8;
+        bVector += 8;
+    }
+
+    *distance = total +
+                volk_8u_hamming_scalar(aVector, bVector, num_points - eighthPoints * 8);
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+
+#ifdef LV_HAVE_AVX2
+#include <immintrin.h>
+
+static inline void volk_8u_x2_hamming_distance_32u_u_avx2(uint32_t* distance,
+                                                          const uint8_t* aVector,
+                                                          const uint8_t* bVector,
+                                                          unsigned int num_points)
+{
+    const unsigned int thirtySecondPoints = num_points / 32;
+    const __m256i lookup = _mm256_setr_epi8(
+        0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4,
+        0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4);
+    const __m256i lowNibble = _mm256_set1_epi8(0x0f);
+    const __m256i zero = _mm256_setzero_si256();
+    __VOLK_ATTR_ALIGNED(32) uint64_t sums[4];
+    __m256i total = zero;
+    __m256i counts, bytes, low, high;
+    unsigned int number, block, ii;
+
+    for (number = 0; number < thirtySecondPoints; number += block) {
+        // each byte gains at most 8 per iteration, flush before it overflows
+        block = thirtySecondPoints - number;
+        block = (block < 31) ? block : 31;
+        counts = zero;
+        for (ii = 0; ii < block; ii++) {
+            bytes = _mm256_xor_si256(_mm256_loadu_si256((const __m256i*)aVector),
+                                     _mm256_loadu_si256((const __m256i*)bVector));
+            low = _mm256_and_si256(bytes, lowNibble);
+            high = _mm256_and_si256(_mm256_srli_epi16(bytes, 4), lowNibble);
+            counts = _mm256_add_epi8(counts, _mm256_shuffle_epi8(lookup, low));
+            counts = _mm256_add_epi8(counts, _mm256_shuffle_epi8(lookup, high));
+            aVector += 32;
+            bVector += 32;
+        }
+        total = _mm256_add_epi64(total, _mm256_sad_epu8(counts, zero));
+    }
+    _mm256_store_si256((__m256i*)sums, total);
+
+    *distance = (uint32_t)(sums[0] + sums[1] + sums[2] + sums[3]) +
+                volk_8u_hamming_scalar(
+                    aVector, bVector, num_points - thirtySecondPoints * 32);
+}
+
+#endif /* LV_HAVE_AVX2 */
+
+
+#ifdef LV_HAVE_AVX512F
+#include <immintrin.h>
+
+static inline void volk_8u_x2_hamming_distance_32u_u_avx512f(uint32_t* distance,
+                                                             const uint8_t* aVector,
+                                                             const uint8_t* bVector,
+                                                             unsigned int num_points)
+{
+    const unsigned int sixtyFourthPoints = num_points / 64;
+    const __m512i m1 = _mm512_set1_epi8(0x55);
+    const __m512i m2 = _mm512_set1_epi8(0x33);
+    const __m512i m4 = _mm512_set1_epi8(0x0f);
+    const __m512i m8 = _mm512_set1_epi16(0x00ff);
+    const __m512i m16 = _mm512_set1_epi32(0x0000ffff);
+    const __m512i m32 = _mm512_set1_epi64(0xffffffff);
+    __m512i total = _mm512_setzero_si512();
+    __m512i counts, bytes;
+    unsigned int number, block, ii;
+
+    for (number = 0; number < sixtyFourthPoints; number += block) {
+        // Bit counts per byte with 64-bit arithmetic, no field carries into the
+        // next byte. Each byte gains at most 8 per iteration.
+        block = sixtyFourthPoints - number;
+        block = (block < 31) ? block : 31;
+        counts = _mm512_setzero_si512();
+        for (ii = 0; ii < block; ii++) {
+            bytes = _mm512_xor_si512(_mm512_loadu_si512((const void*)aVector),
+                                     _mm512_loadu_si512((const void*)bVector));
+            bytes = _mm512_sub_epi64(bytes,
+                                     _mm512_and_si512(_mm512_srli_epi64(bytes, 1), m1));
+            bytes = _mm512_add_epi64(_mm512_and_si512(bytes, m2),
+                                     _mm512_and_si512(_mm512_srli_epi64(bytes, 2), m2));
+            bytes = _mm512_and_si512(
+                _mm512_add_epi64(bytes, _mm512_srli_epi64(bytes, 4)), m4);
+            counts = _mm512_add_epi64(counts, bytes);
+            aVector += 64;
+            bVector += 64;
+        }
+        counts = _mm512_add_epi64(_mm512_and_si512(counts, m8),
+                                  _mm512_and_si512(_mm512_srli_epi64(counts, 8), m8));
+        counts = _mm512_add_epi64(_mm512_and_si512(counts, m16),
+                                  _mm512_and_si512(_mm512_srli_epi64(counts, 16), m16));
+        counts = _mm512_add_epi64(_mm512_and_si512(counts, m32),
+                                  _mm512_srli_epi64(counts, 32));
+        total = _mm512_add_epi64(total, counts);
+    }
+
+    *distance = (uint32_t)_mm512_reduce_add_epi64(total) +
+                volk_8u_hamming_scalar(
+                    aVector, bVector, num_points - sixtyFourthPoints * 64);
+}
+
+#endif /* LV_HAVE_AVX512F */
+
+
+#if LV_HAVE_AVX512F && LV_HAVE_AVX512VPOPCNTDQ
+#include <immintrin.h>
+
+static inline void
+volk_8u_x2_hamming_distance_32u_u_avx512vpopcntdq(uint32_t* distance,
+                                                  const uint8_t* aVector,
+                                                  const uint8_t* bVector,
+                                                  unsigned int num_points)
+{
+    const unsigned int sixtyFourthPoints = num_points / 64;
+    __m512i total0 = _mm512_setzero_si512();
+    __m512i total1 = _mm512_setzero_si512();
+    __m512i bytes0, bytes1;
+    unsigned int number = 0;
+
+    // two accumulators hide the latency of the adds
+    for (; number + 2 <= sixtyFourthPoints; number += 2) {
+        bytes0 = _mm512_xor_si512(_mm512_loadu_si512((const void*)aVector),
+                                  _mm512_loadu_si512((const void*)bVector));
+        bytes1 = _mm512_xor_si512(_mm512_loadu_si512((const void*)(aVector + 64)),
+                                  _mm512_loadu_si512((const void*)(bVector + 64)));
+        total0 = _mm512_add_epi64(total0, _mm512_popcnt_epi64(bytes0));
+        total1 = _mm512_add_epi64(total1, _mm512_popcnt_epi64(bytes1));
+        aVector += 128;
+        bVector += 128;
+    }
+    if (number < sixtyFourthPoints) {
+        bytes0 = _mm512_xor_si512(_mm512_loadu_si512((const void*)aVector),
+                                  _mm512_loadu_si512((const void*)bVector));
+        total0 = _mm512_add_epi64(total0, _mm512_popcnt_epi64(bytes0));
+        aVector += 64;
+        bVector += 64;
+    }
+
+    *distance = (uint32_t)_mm512_reduce_add_epi64(_mm512_add_epi64(total0, total1)) +
+                volk_8u_hamming_scalar(
+                    aVector, bVector, num_points - sixtyFourthPoints * 64);
+}
+
+#endif /* LV_HAVE_AVX512F && LV_HAVE_AVX512VPOPCNTDQ */
+
+
+#ifdef LV_HAVE_NEON
+#include <arm_neon.h>
+
+static inline void volk_8u_x2_hamming_distance_32u_neon(uint32_t* distance,
+                                                        const uint8_t* aVector,
+                                                        const uint8_t* bVector,
+                                                        unsigned int num_points)
+{
+    const unsigned int sixteenthPoints = num_points / 16;
+    uint32x4_t total = vdupq_n_u32(0);
+    uint64x2_t pairs;
+    uint8x16_t bytes;
+    unsigned int number;
+
+    for (number = 0; number < sixteenthPoints; number++) {
+        bytes = veorq_u8(vld1q_u8(aVector), vld1q_u8(bVector));
+        total = vpadalq_u16(total, vpaddlq_u8(vcntq_u8(bytes)));
+        aVector += 16;
+        bVector += 16;
+    }
+    pairs = vpaddlq_u32(total);
+
+    *distance = (uint32_t)(vgetq_lane_u64(pairs, 0) + vgetq_lane_u64(pairs, 1)) +
+                volk_8u_hamming_scalar(
+                    aVector, bVector, num_points - sixteenthPoints * 16);
+}
+
+#endif /* LV_HAVE_NEON */
+
+#endif /* INCLUDED_volk_8u_x2_hamming_distance_32u_H */
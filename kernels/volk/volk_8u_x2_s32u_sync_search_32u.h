@@ -0,0 +1,432 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2026 Free Software Foundation, Inc.
+ *
+ * This file is part of VOLK
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+/*!
+ * \page volk_8u_x2_s32u_sync_search_32u
+ *
+ * \b Overview
+ *
+ * Searches a packed bit stream for a sync word of up to 64 bits at every bit
+ * offset and reports the offsets where at most maxErrors bits differ. Bits
+ * are packed most significant bit first, both in the stream and in the sync
+ * word. The offsets are written in ascending order, followed by their number.
+ *
+ * The SIMD implementations evaluate the eight bit offsets of a stream byte in
+ * parallel: they shift a 64-bit window of the stream into each lane, XOR it
+ * with the sync word and count the differing bits per lane, with vpopcntq
+ * where AVX512_VPOPCNTDQ is available.
+ *
+ * <b>Dispatcher Prototype</b>
+ * \code
+ * void volk_8u_x2_s32u_sync_search_32u(uint32_t* offsets, uint32_t* numOffsets,
+ *                                      const uint8_t* inputBuffer,
+ *                                      const uint8_t* syncWord,
+ *                                      const uint32_t maxErrors,
+ *                                      unsigned int syncBits,
+ *                                      unsigned int num_points)
+ * \endcode
+ *
+ * \b Inputs
+ * \li inputBuffer: the packed bit stream.
+ * \li syncWord: the sync word, (syncBits + 7) / 8 bytes.
+ * \li maxErrors: the largest number of differing bits that is reported.
+ * \li syncBits: the length of the sync word in bits, 1 to 64.
+ * \li num_points: the number of bytes in the bit stream.
+ *
+ * \b Outputs
+ * \li offsets: the bit offsets of the matches. Must have room for
+ * 8 * num_points - syncBits + 1 offsets, all of which may be written.
+ * \li numOffsets: the number of matches.
+ *
+ * \b Example
+ * Find a 32-bit sync word that starts at bit 100 of the stream.
+ * \code
+ *   unsigned int N = 100;
+ *   unsigned int alignment = volk_get_alignment();
+ *   uint8_t* stream = (uint8_t*)volk_malloc(sizeof(uint8_t) * N, alignment);
+ *   uint32_t* offsets = (uint32_t*)volk_malloc(sizeof(uint32_t) * 8 * N, alignment);
+ *   const uint8_t sync[4] = { 0x1a, 0xcf, 0xfc, 0x1d };
+ *   uint32_t count;
+ *
+ *   memset(stream, 0, N);
+ *   for (unsigned int ii = 0; ii < 4; ++ii) {
+ *       stream[12 + ii] |= sync[ii] >> 4;
+ *       stream[13 + ii] |= (uint8_t)(sync[ii] << 4);
+ *   }
+ *
+ *   volk_8u_x2_s32u_sync_search_32u(offsets, &count, stream, sync, 2, 32, N);
+ *   // count == 1, offsets[0] == 100
+ *
+ *   volk_free(stream);
+ *   volk_free(offsets);
+ * \endcode
+ */
+
+#ifndef INCLUDED_volk_8u_x2_s32u_sync_search_32u_H
+#define INCLUDED_volk_8u_x2_s32u_sync_search_32u_H
+
+#include <inttypes.h>
+#include <volk/volk_8u_popcnt_32u.h>
+
+/* Reads up to 8 bytes most significant first, missing bytes are zero */
+static inline uint64_t volk_8u_sync_load(const uint8_t* bytes, unsigned int available)
+{
+    uint64_t word = 0;
+    unsigned int ii;
+    for (ii = 0; ii < 8; ii++) {
+        word = (word << 8) | ((ii < available) ? bytes[ii] : 0);
+    }
+    return word;
+}
+
+/* The sync word aligned to the top of 64 bits, and the mask of its bits */
+static inline void volk_8u_sync_setup(uint64_t* sync,
+                                      uint64_t* mask,
+                                      const uint8_t* syncWord,
+                                      unsigned int syncBits)
+{
+    *mask = ~0ULL << (64 - syncBits);
+    *sync = volk_8u_sync_load(syncWord, (syncBits + 7) / 8) & *mask;
+}
+
+/* Tests the offsets from 8 * firstByte on, returns the new number of matches */
+static inline uint32_t volk_8u_sync_search_scalar(uint32_t* offsets,
+                                                  uint32_t count,
+                                                  const uint8_t* inputBuffer,
+                                                  uint64_t sync,
+                                                  uint64_t mask,
+                                                  uint32_t maxErrors,
+                                                  unsigned int syncBits,
+                                                  unsigned int firstByte,
+                                                  unsigned int num_points)
+{
+    uint64_t word, window;
+    uint32_t next;
+    unsigned int offset, byte, shift;
+
+    for (offset = 8 * firstByte; offset + syncBits <= 8 * num_points; offset++) {
+        byte = offset / 8;
+        shift = offset % 8;
+        word = volk_8u_sync_load(inputBuffer + byte, num_points - byte);
+        next = (byte + 8 < num_points) ? inputBuffer[byte + 8] : 0;
+        window = (word << shift) | ((uint64_t)next >> (8 - shift));
+        if (volk_8u_popcnt_word((window ^ sync) & mask) <= maxErrors) {
+            offsets[count++] = offset;
+        }
+    }
+    return count;
+}
+
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void volk_8u_x2_s32u_sync_search_32u_generic(uint32_t* offsets,
+                                                           uint32_t* numOffsets,
+                                                           const uint8_t* inputBuffer,
+                                                           const uint8_t* syncWord,
+                                                           const uint32_t maxErrors,
+                                                           unsigned int syncBits,
+                                                           unsigned int num_points)
+{
+    uint64_t sync, mask;
+
+    volk_8u_sync_setup(&sync, &mask, syncWord, syncBits);
+    *numOffsets = volk_8u_sync_search_scalar(
+        offsets, 0, inputBuffer, sync, mask, maxErrors, syncBits, 0, num_points);
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+
+#if LV_HAVE_SSE4_2 && LV_HAVE_64
+#include <nmmintrin.h>
+
+static inline void volk_8u_x2_s32u_sync_search_32u_u_sse4_2(uint32_t* offsets,
+                                                            uint32_t* numOffsets,
+                                                            const uint8_t* inputBuffer,
+                                                            const uint8_t* syncWord,
+                                                            const uint32_t maxErrors,
+                                                            unsigned int syncBits,
+                                                            unsigned int num_points)
+{
+    uint64_t sync, mask, word, window;
+    uint32_t next;
+    uint32_t count = 0;
+    unsigned int byte, shift;
+
+    volk_8u_sync_setup(&sync, &mask, syncWord, syncBits);
+    word = volk_8u_sync_load(inputBuffer, num_points);
+    for (byte = 0; byte + 9 <= num_points; byte++) {
+        next = inputBuffer[byte + 8];
+        for (shift = 0; shift < 8; shift++) {
+            window = (word << shift) | ((uint64_t)next >> (8 - shift));
+            // always store, count only advances on a match
+            offsets[count] = 8 * byte + shift;
+            count += (_mm_popcnt_u64((window ^ sync) & mask) <= maxErrors);
+        }
+        word = (word << 8) | next;
+    }
+
+    *numOffsets = volk_8u_sync_search_scalar(
+        offsets, count, inputBuffer, sync, mask, maxErrors, syncBits, byte, num_points);
+}
+
+#endif /* LV_HAVE_SSE4_2 && LV_HAVE_64 */
+
+
+#ifdef LV_HAVE_AVX2
+#include <immintrin.h>
+
+static inline void volk_8u_x2_s32u_sync_search_32u_u_avx2(uint32_t* offsets,
+                                                          uint32_t* numOffsets,
+                                                          const uint8_t* inputBuffer,
+                                                          const uint8_t* syncWord,
+                                                          const uint32_t maxErrors,
+                                                          unsigned int syncBits,
+                                                          unsigned int num_points)
+{
+    const __m256i lookup = _mm256_setr_epi8(
+        0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4,
+        0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4);
+    const __m256i lowNibble = _mm256_set1_epi8(0x0f);
+    const __m256i zero = _mm256_setzero_si256();
+    const __m256i shiftsLow = _mm256_setr_epi64x(0, 1, 2, 3);
+    const __m256i shiftsHigh = _mm256_setr_epi64x(4, 5, 6, 7);
+    const __m256i nextShiftsLow = _mm256_setr_epi64x(8, 7, 6, 5);
+    const __m256i nextShiftsHigh = _mm256_setr_epi64x(4, 3, 2, 1);
+    const __m256i limit = _mm256_set1_epi64x((long long)maxErrors + 1);
+    uint64_t sync, mask, stream;
+    __m256i vSync, vMask, word, next, low, high;
+    uint32_t count = 0;
+    unsigned int byte, shift;
+    int hits;
+
+    volk_8u_sync_setup(&sync, &mask, syncWord, syncBits);
+    vSync = _mm256_set1_epi64x((long long)sync);
+    vMask = _mm256_set1_epi64x((long long)mask);
+    stream = volk_8u_sync_load(inputBuffer, num_points);
+    for (byte = 0; byte + 9 <= num_points; byte++) {
+        word = _mm256_set1_epi64x((long long)stream);
+        next = _mm256_set1_epi64x(inputBuffer[byte + 8]);
+        stream = (stream << 8) | inputBuffer[byte + 8];
+
+        // the windows for shifts 0 to 3 and 4 to 7, XORed with the sync word
+        low = _mm256_or_si256(_mm256_sllv_epi64(word, shiftsLow),
+                              _mm256_srlv_epi64(next, nextShiftsLow));
+        high = _mm256_or_si256(_mm256_sllv_epi64(word, shiftsHigh),
+                               _mm256_srlv_epi64(next, nextShiftsHigh));
+        low = _mm256_and_si256(_mm256_xor_si256(low, vSync), vMask);
+        high = _mm256_and_si256(_mm256_xor_si256(high, vSync), vMask);
+
+        // count the differing bits per 64-bit lane
+        low = _mm256_add_epi8(
+            _mm256_shuffle_epi8(lookup, _mm256_and_si256(low, lowNibble)),
+            _mm256_shuffle_epi8(
+                lookup, _mm256_and_si256(_mm256_srli_epi16(low, 4), lowNibble)));
+        high = _mm256_add_epi8(
+            _mm256_shuffle_epi8(lookup, _mm256_and_si256(high, lowNibble)),
+            _mm256_shuffle_epi8(
+                lookup, _mm256_and_si256(_mm256_srli_epi16(high, 4), lowNibble)));
+        low = _mm256_cmpgt_epi64(limit, _mm256_sad_epu8(low, zero));
+        high = _mm256_cmpgt_epi64(limit, _mm256_sad_epu8(high, zero));
+
+        hits = _mm256_movemask_pd(_mm256_castsi256_pd(low)) |
+               (_mm256_movemask_pd(_mm256_castsi256_pd(high)) << 4);
+        if (hits) {
+            for (shift = 0; shift < 8; shift++) {
+                if ((hits >> shift) & 1) {
+                    offsets[count++] = 8 * byte + shift;
+                }
+            }
+        }
+    }
+
+    *numOffsets = volk_8u_sync_search_scalar(
+        offsets, count, inputBuffer, sync, mask, maxErrors, syncBits, byte, num_points);
+}
+
+#endif /* LV_HAVE_AVX2 */
+
+
+#ifdef LV_HAVE_AVX512F
+#include <immintrin.h>
+
+static inline void
+volk_8u_x2_s32u_sync_search_32u_u_avx512f(uint32_t* offsets,
+                                          uint32_t* numOffsets,
+                                          const uint8_t* inputBuffer,
+                                          const uint8_t* syncWord,
+                                          const uint32_t maxErrors,
+                                          unsigned int syncBits,
+                                          unsigned int num_points)
+{
+    const __m512i shifts = _mm512_setr_epi64(0, 1, 2, 3, 4, 5, 6, 7);
+    const __m512i nextShifts = _mm512_setr_epi64(8, 7, 6, 5, 4, 3, 2, 1);
+    const __m512i lanes =
+        _mm512_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7, 0, 0, 0, 0, 0, 0, 0, 0);
+    const __m512i m1 = _mm512_set1_epi8(0x55);
+    const __m512i m2 = _mm512_set1_epi8(0x33);
+    const __m512i m4 = _mm512_set1_epi8(0x0f);
+    const __m512i m7 = _mm512_set1_epi64(0x7f);
+    const __m512i vMax = _mm512_set1_epi64(maxErrors);
+    uint64_t sync, mask, stream;
+    __m512i vSync, vMask, window;
+    uint32_t count = 0;
+    unsigned int byte;
+    __mmask8 hits;
+
+    volk_8u_sync_setup(&sync, &mask, syncWord, syncBits);
+    vSync = _mm512_set1_epi64((long long)sync);
+    vMask = _mm512_set1_epi64((long long)mask);
+    stream = volk_8u_sync_load(inputBuffer, num_points);
+    for (byte = 0; byte + 9 <= num_points; byte++) {
+        window = _mm512_or_si512(
+            _mm512_sllv_epi64(_mm512_set1_epi64((long long)stream), shifts),
+            _mm512_srlv_epi64(_mm512_set1_epi64(inputBuffer[byte + 8]), nextShifts));
+        stream = (stream << 8) | inputBuffer[byte + 8];
+        window = _mm512_and_si512(_mm512_xor_si512(window, vSync), vMask);
+
+        // count the differing bits per 64-bit lane
+        window = _mm512_sub_epi64(window,
+                                  _mm512_and_si512(_mm512_srli_epi64(window, 1), m1));
+        window = _mm512_add_epi64(_mm512_and_si512(window, m2),
+                                  _mm512_and_si512(_mm512_srli_epi64(window, 2), m2));
+        window = _mm512_and_si512(
+            _mm512_add_epi64(window, _mm512_srli_epi64(window, 4)), m4);
+        window = _mm512_add_epi64(window, _mm512_srli_epi64(window, 8));
+        window = _mm512_add_epi64(window, _mm512_srli_epi64(window, 16));
+        window = _mm512_add_epi64(window, _mm512_srli_epi64(window, 32));
+
+        hits = _mm512_cmple_epu64_mask(_mm512_and_si512(window, m7), vMax);
+        if (hits) {
+            _mm512_mask_compressstoreu_epi32(
+                offsets + count,
+                (__mmask16)hits,
+                _mm512_add_epi32(lanes, _mm512_set1_epi32(8 * byte)));
+            count += _mm_popcnt_u32(hits);
+        }
+    }
+
+    *numOffsets = volk_8u_sync_search_scalar(
+        offsets, count, inputBuffer, sync, mask, maxErrors, syncBits, byte, num_points);
+}
+
+#endif /* LV_HAVE_AVX512F */
+
+
+#if LV_HAVE_AVX512F && LV_HAVE_AVX512VPOPCNTDQ
+#include <immintrin.h>
+
+static inline void
+volk_8u_x2_s32u_sync_search_32u_u_avx512vpopcntdq(uint32_t* offsets,
+                                                  uint32_t* numOffsets,
+                                                  const uint8_t* inputBuffer,
+                                                  const uint8_t* syncWord,
+                                                  const uint32_t maxErrors,
+                                                  unsigned int syncBits,
+                                                  unsigned int num_points)
+{
+    const __m512i shifts = _mm512_setr_epi64(0, 1, 2, 3, 4, 5, 6, 7);
+    const __m512i nextShifts = _mm512_setr_epi64(8, 7, 6, 5, 4, 3, 2, 1);
+    const __m512i lanes =
+        _mm512_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7, 0, 0, 0, 0, 0, 0, 0, 0);
+    const __m512i vMax = _mm512_set1_epi64(maxErrors);
+    uint64_t sync, mask, stream;
+    __m512i vSync, vMask, window;
+    uint32_t count = 0;
+    unsigned int byte;
+    __mmask8 hits;
+
+    volk_8u_sync_setup(&sync, &mask, syncWord, syncBits);
+    vSync = _mm512_set1_epi64((long long)sync);
+    vMask = _mm512_set1_epi64((long long)mask);
+    stream = volk_8u_sync_load(inputBuffer, num_points);
+    for (byte = 0; byte + 9 <= num_points; byte++) {
+        window = _mm512_or_si512(
+            _mm512_sllv_epi64(_mm512_set1_epi64((long long)stream), shifts),
+            _mm512_srlv_epi64(_mm512_set1_epi64(inputBuffer[byte + 8]), nextShifts));
+        stream = (stream << 8) | inputBuffer[byte + 8];
+        window = _mm512_and_si512(_mm512_xor_si512(window, vSync), vMask);
+
+        hits = _mm512_cmple_epu64_mask(_mm512_popcnt_epi64(window), vMax);
+        if (hits) {
+            _mm512_mask_compressstoreu_epi32(
+                offsets + count,
+                (__mmask16)hits,
+                _mm512_add_epi32(lanes, _mm512_set1_epi32(8 * byte)));
+            count += _mm_popcnt_u32(hits);
+        }
+    }
+
+    *numOffsets = volk_8u_sync_search_scalar(
+        offsets, count, inputBuffer, sync, mask, maxErrors, syncBits, byte, num_points);
+}
+
+#endif /* LV_HAVE_AVX512F && LV_HAVE_AVX512VPOPCNTDQ */
+
+
+#ifdef LV_HAVE_NEON
+#include <arm_neon.h>
+
+static inline void volk_8u_x2_s32u_sync_search_32u_neon(uint32_t* offsets,
+                                                        uint32_t* numOffsets,
+                                                        const uint8_t* inputBuffer,
+                                                        const uint8_t* syncWord,
+                                                        const uint32_t maxErrors,
+                                                        unsigned int syncBits,
+                                                        unsigned int num_points)
+{
+    const int64_t shifts[8] = { 0, 1, 2, 3, 4, 5, 6, 7 };
+    const int64_t nextShifts[8] = { -8, -7, -6, -5, -4, -3, -2, -1 };
+    const uint32x4_t vMax = vdupq_n_u32(maxErrors);
+    uint64_t sync, mask, stream, hits;
+    uint64x2_t vSync, vMask, word, next, window;
+    uint32x2_t counts[4];
+    uint32x4_t low, high;
+    uint32_t count = 0;
+    unsigned int byte, pair, shift;
+
+    volk_8u_sync_setup(&sync, &mask, syncWord, syncBits);
+    vSync = vdupq_n_u64(sync);
+    vMask = vdupq_n_u64(mask);
+    stream = volk_8u_sync_load(inputBuffer, num_points);
+    for (byte = 0; byte + 9 <= num_points; byte++) {
+        word = vdupq_n_u64(stream);
+        next = vdupq_n_u64(inputBuffer[byte + 8]);
+        stream = (stream << 8) | inputBuffer[byte + 8];
+        for (pair = 0; pair < 4; pair++) {
+            window = vorrq_u64(vshlq_u64(word, vld1q_s64(shifts + 2 * pair)),
+                               vshlq_u64(next, vld1q_s64(nextShifts + 2 * pair)));
+            window = vandq_u64(veorq_u64(window, vSync), vMask);
+            counts[pair] = vmovn_u64(vpaddlq_u32(
+                vpaddlq_u16(vpaddlq_u8(vcntq_u8(vreinterpretq_u8_u64(window))))));
+        }
+        low = vcleq_u32(vcombine_u32(counts[0], counts[1]), vMax);
+        high = vcleq_u32(vcombine_u32(counts[2], counts[3]), vMax);
+
+        // one byte per shift, all ones on a match
+        hits = vget_lane_u64(
+            vreinterpret_u64_u8(vmovn_u16(vcombine_u16(vmovn_u32(low), vmovn_u32(high)))),
+            0);
+        if (hits) {
+            for (shift = 0; shift < 8; shift++) {
+                if ((hits >> (8 * shift)) & 1) {
+                    offsets[count++] = 8 * byte + shift;
+                }
+            }
+        }
+    }
+
+    *numOffsets = volk_8u_sync_search_scalar(
+        offsets, count, inputBuffer, sync, mask, maxErrors, syncBits, byte, num_points);
+}
+
+#endif /* LV_HAVE_NEON */
+
+#endif /* INCLUDED_volk_8u_x2_s32u_sync_search_32u_H */
@@ -54,6 +54,12 @@ std::vector<volk_test_case_t> init_test_list(volk_test_params_t test_params)
     QA(VOLK_INIT_PUPP(volk_32fc_s32fc_rotatorpuppet_32fc,
                       volk_32fc_s32fc_x2_rotator_32fc,
                       test_params_rotator))
+    QA(VOLK_INIT_PUPP(volk_32fc_s32fc_rotator64puppet_32fc,
+                      volk_32fc_s64fc_x2_rotator_32fc,
+                      test_params_rotator))
+    QA(VOLK_INIT_PUPP(volk_32fc_s32fc_ncopuppet_32fc,
+                      volk_32fc_s32fc_nco_32fc,
+                      test_params_rotator))
     QA(VOLK_INIT_PUPP(
         volk_8u_conv_k7_r2puppet_8u, volk_8u_x4_conv_k7_r2_8u, test_params.make_tol(0)))
     QA(VOLK_INIT_PUPP(
@@ -84,6 +90,8 @@ std::vector<volk_test_case_t> init_test_list(volk_test_params_t test_params)
     QA(VOLK_INIT_TEST(volk_32f_x2_pow_32f, test_params_inacc))
     QA(VOLK_INIT_TEST(volk_32f_sin_32f, test_params_inacc))
     QA(VOLK_INIT_TEST(volk_32f_cos_32f, test_params_inacc))
+    QA(VOLK_INIT_TEST(volk_32f_sincos_32f_x2, test_params_inacc))
+    QA(VOLK_INIT_TEST(volk_32f_expj_32fc, test_params_inacc))
     QA(VOLK_INIT_TEST(volk_32f_tan_32f, test_params_inacc))
     QA(VOLK_INIT_TEST(volk_32f_atan_32f, test_params_inacc))
     QA(VOLK_INIT_TEST(volk_32f_asin_32f, test_params_inacc))
@@ -173,6 +181,101 @@ std::vector<volk_test_case_t> init_test_list(volk_test_params_t test_params)
     QA(VOLK_INIT_PUPP(volk_32fc_s32f_power_spectral_densitypuppet_32f,
                       volk_32fc_s32f_x2_power_spectral_density_32f,
                       test_params))
+    QA(VOLK_INIT_PUPP(volk_32fc_32f_fir_decimpuppet_32fc,
+                      volk_32fc_32f_fir_decim_32fc,
+                      test_params_inacc))
+    QA(VOLK_INIT_PUPP(volk_32fc_x2_fir_decimpuppet_32fc,
+                      volk_32fc_x2_fir_decim_32fc,
+                      test_params_inacc))
+    QA(VOLK_INIT_PUPP(volk_32f_x2_fir_decimpuppet_32f,
+                      volk_32f_x2_fir_decim_32f,
+                      test_params.make_absolute(1e-4)))
+    QA(VOLK_INIT_PUPP(volk_32fc_32f_xK_dot_prodpuppet_32fc,
+                      volk_32fc_32f_xK_dot_prod_32fc,
+                      test_params_inacc))
+    QA(VOLK_INIT_PUPP(
+        volk_32fc_fftpuppet_32fc, volk_32fc_fft_32fc, test_params.make_tol(1e-3)))
+    QA(VOLK_INIT_PUPP(
+        volk_32f_fftpuppet_32fc, volk_32f_fft_32fc, test_params.make_tol(1e-3)))
+    QA(VOLK_INIT_PUPP(volk_32fc_s32f_power_spectrum_avgpuppet_32f,
+                      volk_32fc_s32f_x2_power_spectrum_avg_32f,
+                      test_params))
+    QA(VOLK_INIT_PUPP(
+        volk_32f_quantilepuppet_32f, volk_32f_s32f_quantile_32f, test_params))
+    QA(VOLK_INIT_PUPP(volk_32f_quantile_noise_floorpuppet_32f,
+                      volk_32f_s32f_quantile_noise_floor_32f,
+                      test_params))
+    QA(VOLK_INIT_PUPP(
+        volk_32f_histogrampuppet_32u, volk_32f_s32f_x2_histogram_32u, test_params))
+    QA(VOLK_INIT_PUPP(volk_8u_histogrampuppet_32u, volk_8u_histogram_32u, test_params))
+    QA(VOLK_INIT_PUPP(
+        volk_16i_histogrampuppet_32u, volk_16i_histogram_32u, test_params))
+    QA(VOLK_INIT_PUPP(
+        volk_32f_index_abovepuppet_32u, volk_32f_s32f_index_above_32u, test_params))
+    QA(VOLK_INIT_PUPP(
+        volk_32fc_index_abovepuppet_32u, volk_32fc_s32f_index_above_32u, test_params))
+    QA(VOLK_INIT_PUPP(volk_32f_topkpuppet_32u, volk_32f_topk_32u, test_params))
+    QA(VOLK_INIT_PUPP(volk_32fc_magnitude_topkpuppet_32u,
+                      volk_32fc_magnitude_topk_32u,
+                      test_params))
+    QA(VOLK_INIT_TEST(volk_32f_minmax_index_32u_x2, test_params))
+    QA(VOLK_INIT_PUPP(volk_32f_statspuppet_32f, volk_32f_stats_32f, test_params_inacc))
+    QA(VOLK_INIT_PUPP(
+        volk_32fc_qam_llrpuppet_32f, volk_32fc_s32f_qam_llr_32f, test_params))
+    QA(VOLK_INIT_PUPP(
+        volk_32fc_qam_slicerpuppet_8u, volk_32fc_s32f_qam_slicer_8u, test_params))
+    QA(VOLK_INIT_PUPP(
+        volk_32fc_qam_slicerpuppet_32fc, volk_32fc_s32f_qam_slicer_32fc, test_params))
+    QA(VOLK_INIT_PUPP(
+        volk_8u_unpack_bitspuppet_8u, volk_8u_unpack_bits_8u, test_params))
+    QA(VOLK_INIT_PUPP(volk_8u_pack_bitspuppet_8u, volk_8u_pack_bits_8u, test_params))
+    QA(VOLK_INIT_PUPP(volk_32f_pack_hard_decisionspuppet_8u,
+                      volk_32f_pack_hard_decisions_8u,
+                      test_params))
+    QA(VOLK_INIT_TEST(volk_8u_crc32_32u, test_params))
+    QA(VOLK_INIT_PUPP(volk_8u_crcpuppet_32u, volk_8u_s32u_crc_32u, test_params))
+    QA(VOLK_INIT_PUPP(
+        volk_8u_scramblepuppet_8u, volk_8u_s32u_scramble_8u, test_params))
+    QA(VOLK_INIT_TEST(volk_8u_popcnt_32u, test_params))
+    QA(VOLK_INIT_TEST(volk_8u_x2_hamming_distance_32u, test_params))
+    QA(VOLK_INIT_PUPP(volk_8u_sync_searchpuppet_32u,
+                      volk_8u_x2_s32u_sync_search_32u,
+                      test_params))
+    QA(VOLK_INIT_PUPP(
+        volk_8u_convert12icpuppet_16ic, volk_12ic_convert_16ic, test_params))
+    QA(VOLK_INIT_PUPP(
+        volk_8u_convert12icpuppet_32fc, volk_12ic_s32f_convert_32fc, test_params))
+    QA(VOLK_INIT_PUPP(
+        volk_8u_convert4icpuppet_16ic, volk_4ic_convert_16ic, test_params))
+    QA(VOLK_INIT_PUPP(
+        volk_8u_convert4icpuppet_32fc, volk_4ic_s32f_convert_32fc, test_params))
+    QA(VOLK_INIT_TEST(volk_32f_convert_16f, test_params))
+    QA(VOLK_INIT_TEST(volk_16f_convert_32f, test_params))
+    QA(VOLK_INIT_TEST(volk_32fc_convert_16fc, test_params))
+    QA(VOLK_INIT_TEST(volk_16fc_convert_32fc, test_params))
+    QA(VOLK_INIT_TEST(volk_16fc_x2_multiply_32fc, test_params))
+    QA(VOLK_INIT_TEST(volk_16fc_32fc_dot_prod_32fc, test_params_inacc))
+    QA(VOLK_INIT_TEST(volk_8u_32f_lut_32f, test_params))
+    QA(VOLK_INIT_TEST(volk_8ic_32fc_lut_32fc, test_params))
+    QA(VOLK_INIT_PUPP(volk_32fc_deinterleave_xNpuppet_32fc,
+                      volk_32fc_deinterleave_32fc_xN,
+                      test_params))
+    QA(VOLK_INIT_PUPP(volk_16ic_deinterleave_xNpuppet_32fc,
+                      volk_16ic_deinterleave_32fc_xN,
+                      test_params))
+    QA(VOLK_INIT_PUPP(volk_32fc_interleave_xNpuppet_32fc,
+                      volk_32fc_interleave_32fc_xN,
+                      test_params))
+    QA(VOLK_INIT_PUPP(
+        volk_32f_transposepuppet_32f, volk_32f_transpose_32f, test_params))
+    QA(VOLK_INIT_PUPP(
+        volk_32fc_transposepuppet_32fc, volk_32fc_transpose_32fc, test_params))
+    QA(VOLK_INIT_PUPP(volk_32fc_x2_matvecpuppet_32fc,
+                      volk_32fc_x2_matvec_32fc,
+                      test_params_inacc))
+    QA(VOLK_INIT_PUPP(volk_32fc_x2_matmul_smallpuppet_32fc,
+                      volk_32fc_x2_matmul_small_32fc,
+                      test_params_inacc))
     // no one uses these, so don't test them
     // VOLK_PROFILE(volk_16i_x5_add_quad_16i_x4, 1e-4, 2046, 10000, &results,
     // benchmark_mode, kernel_regex); VOLK_PROFILE(volk_16i_branch_4_state_8, 1e-4, 2046,
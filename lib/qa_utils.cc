@@ -38,6 +38,17 @@ void random_floats(void* buf, unsigned int n, std::default_random_engine& rnd_en
     }
 }
 
+// IEEE 754 binary16 bit patterns between -1 and 1, including subnormals
+void random_halves(void* buf, unsigned int n, std::default_random_engine& rnd_engine)
+{
+    uint16_t* array = static_cast<uint16_t*>(buf);
+    std::uniform_int_distribution<unsigned int> uniform_dist(0, 2 * 0x3c00 - 1);
+    for (unsigned int i = 0; i < n; i++) {
+        unsigned int bits = uniform_dist(rnd_engine);
+        array[i] = (uint16_t)((bits < 0x3c00) ? bits : 0x8000 | (bits - 0x3c00));
+    }
+}
+
 void load_random_data(void* data, volk_type_t type, unsigned int n)
 {
     std::random_device rnd_device;
@@ -47,6 +58,8 @@ void load_random_data(void* data, volk_type_t type, unsigned int n)
     if (type.is_float) {
         if (type.size == 8) {
             random_floats<double>(data, n, rnd_engine);
+        } else if (type.size == 2) {
+            random_halves(data, n, rnd_engine);
         } else {
             random_floats<float>(data, n, rnd_engine);
         }
@@ -746,6 +759,13 @@ bool run_volk_tests(volk_func_desc_t desc,
                                             tol_f,
                                             absolute_mode);
                         }
+                    } else if (both_sigs[j].size == 2) {
+                        // half precision results are rounded bit patterns
+                        fail = icompare((uint16_t*)test_data[generic_offset][j],
+                                        (uint16_t*)test_data[i][j],
+                                        vlen * (both_sigs[j].is_complex ? 2 : 1),
+                                        tol_i,
+                                        absolute_mode);
                     } else {
                         if (both_sigs[j].is_complex) {
                             fail = ccompare((float*)test_data[generic_offset][j],
@@ -43,6 +43,11 @@ static int i_can_has_${arch.name} (void) {
 #if defined(CPU_FEATURES_ARCH_ARM)
     if (GetArmInfo().features.${check} == 0){ return 0; }
 #endif
+            %if check != "neon":
+#if defined(CPU_FEATURES_ARCH_AARCH64)
+    if (GetAarch64Info().features.${check} == 0){ return 0; }
+#endif
+            %endif
         %else:
 #if defined(CPU_FEATURES_ARCH_X86)
     if (GetX86Info().features.${check} == 0){ return 0; }
@@ -12,6 +12,7 @@
 
 #include <inttypes.h>
 #include <volk/volk_complex.h>
+#include <volk/volk_stats.h>
 
 %for kern in kernels:
 typedef void (*${kern.pname})(${kern.arglist_types});